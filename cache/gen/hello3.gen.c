@@ -0,0 +1,199 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+/* Copyright © 2015 Ben Longbons */
+/*  */
+/* This file is part of Nicate. */
+/*  */
+/* This program is free software: you can redistribute it and/or modify */
+/* it under the terms of the GNU Lesser General Public License as published */
+/* by the Free Software Foundation, either version 3 of the License, or */
+/* (at your option) any later version. */
+/*  */
+/* This program is distributed in the hope that it will be useful, */
+/* but WITHOUT ANY WARRANTY without even the implied warranty of */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the */
+/* GNU Lesser General Public License for more details. */
+/*  */
+/* You should have received a copy of the GNU Lesser General Public License */
+/* along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+struct FILE;
+extern struct FILE *stdin;
+extern struct FILE *stdout;
+extern struct FILE *stderr;
+struct Builder;
+struct BuildTranslationUnit;
+struct BuildStatement;
+struct BuildStorageClass;
+struct BuildParamDeclaration;
+struct BuildMemberDeclaration;
+struct BuildEnumerator;
+struct BuildType;
+struct BuildInitializer;
+struct BuildExpression;
+extern struct Builder *builder_create(void);
+extern void builder_destroy(struct Builder *b);
+extern void builder_emit_tu_to_file(struct BuildTranslationUnit *tu, struct FILE *fp);
+extern char *builder_emit_tu_to_string(struct BuildTranslationUnit *tu);
+extern void builder_free_string(char *s);
+extern struct BuildTranslationUnit *build_tu(struct Builder *b, size_t ntops, struct BuildStatement *(*tops));
+extern struct BuildStatement *build_struct_definition(struct Builder *b, char const *name, size_t nmembs, struct BuildMemberDeclaration *(*decls));
+extern struct BuildStatement *build_union_definition(struct Builder *b, char const *name, size_t nmembs, struct BuildMemberDeclaration *(*decls));
+extern struct BuildStatement *build_enum_definition(struct Builder *b, char const *name, size_t nvars, struct BuildEnumerator *(*vars));
+extern struct BuildStatement *build_function_definition(struct Builder *b, size_t nscs, struct BuildStorageClass *(*scs), char const *name, struct BuildType *fnty, struct BuildStatement *body);
+extern struct BuildStorageClass *build_storage_class_typedef(struct Builder *b);
+extern struct BuildStorageClass *build_storage_class_extern(struct Builder *b);
+extern struct BuildStorageClass *build_storage_class_static(struct Builder *b);
+extern struct BuildStorageClass *build_storage_class_register(struct Builder *b);
+extern struct BuildStatement *build_declaration_noinit(struct Builder *b, size_t nscs, struct BuildStorageClass *(*scs), struct BuildType *type, char const *name);
+extern struct BuildStatement *build_declaration_init(struct Builder *b, size_t nscs, struct BuildStorageClass *(*scs), struct BuildType *type, char const *name, struct BuildInitializer *init);
+extern struct BuildParamDeclaration *build_param_declaration(struct Builder *b, size_t nscs, struct BuildStorageClass *(*scs), struct BuildType *type, char const *name);
+extern struct BuildParamDeclaration *build_param_declaration_anon(struct Builder *b, size_t nscs, struct BuildStorageClass *(*scs), struct BuildType *type);
+extern struct BuildMemberDeclaration *build_member_declaration(struct Builder *b, struct BuildType *type, char const *name);
+extern struct BuildMemberDeclaration *build_member_declaration_bitfield(struct Builder *b, struct BuildType *type, char const *name, struct BuildExpression *width);
+extern struct BuildMemberDeclaration *build_member_declaration_bitfield_anon(struct Builder *b, struct BuildType *type, struct BuildExpression *width);
+extern struct BuildEnumerator *build_enumerator_noinit(struct Builder *b, char const *name);
+extern struct BuildEnumerator *build_enumerator_init(struct Builder *b, char const *name, struct BuildExpression *init);
+extern struct BuildType *build_type_typedef(struct Builder *b, char const *name);
+extern struct BuildType *build_type_struct(struct Builder *b, char const *name);
+extern struct BuildType *build_type_union(struct Builder *b, char const *name);
+extern struct BuildType *build_type_enum(struct Builder *b, char const *name);
+extern struct BuildType *build_type_void(struct Builder *b);
+extern struct BuildType *build_type_char(struct Builder *b);
+extern struct BuildType *build_type_signed_char(struct Builder *b);
+extern struct BuildType *build_type_unsigned_char(struct Builder *b);
+extern struct BuildType *build_type_signed_short(struct Builder *b);
+extern struct BuildType *build_type_unsigned_short(struct Builder *b);
+extern struct BuildType *build_type_signed_int(struct Builder *b);
+extern struct BuildType *build_type_unsigned_int(struct Builder *b);
+extern struct BuildType *build_type_signed_long(struct Builder *b);
+extern struct BuildType *build_type_unsigned_long(struct Builder *b);
+extern struct BuildType *build_type_signed_long_long(struct Builder *b);
+extern struct BuildType *build_type_unsigned_long_long(struct Builder *b);
+extern struct BuildType *build_type_float(struct Builder *b);
+extern struct BuildType *build_type_double(struct Builder *b);
+extern struct BuildType *build_type_long_double(struct Builder *b);
+extern struct BuildType *build_type_const(struct Builder *b, struct BuildType *type);
+extern struct BuildType *build_type_volatile(struct Builder *b, struct BuildType *type);
+extern struct BuildType *build_type_pointer(struct Builder *b, struct BuildType *type);
+extern struct BuildType *build_type_array(struct Builder *b, struct BuildType *type, struct BuildExpression *size);
+extern struct BuildType *build_type_array_unknown_bound(struct Builder *b, struct BuildType *type);
+extern struct BuildType *build_type_function(struct Builder *b, struct BuildType *ret, size_t nargs, struct BuildParamDeclaration *(*args), _Bool vararg);
+extern struct BuildStatement *build_stmt_none(struct Builder *b);
+extern struct BuildStatement *build_stmt_expr(struct Builder *b, struct BuildExpression *expr);
+extern struct BuildStatement *build_stmt_label(struct Builder *b, char const *label, struct BuildStatement *target);
+extern struct BuildStatement *build_stmt_case(struct Builder *b, struct BuildExpression *expr, struct BuildStatement *target);
+extern struct BuildStatement *build_stmt_default(struct Builder *b, struct BuildStatement *target);
+extern struct BuildStatement *build_stmt_compound(struct Builder *b, size_t nstmts, struct BuildStatement *(*stmts));
+extern struct BuildStatement *build_stmt_if(struct Builder *b, struct BuildExpression *cond, struct BuildStatement *if_true);
+extern struct BuildStatement *build_stmt_if_else(struct Builder *b, struct BuildExpression *cond, struct BuildStatement *if_true, struct BuildStatement *if_false);
+extern struct BuildStatement *build_stmt_while(struct Builder *b, struct BuildExpression *cond, struct BuildStatement *body);
+extern struct BuildStatement *build_stmt_do_while(struct Builder *b, struct BuildStatement *body, struct BuildExpression *cond);
+extern struct BuildStatement *build_stmt_for(struct Builder *b, struct BuildExpression *init, struct BuildExpression *cond, struct BuildExpression *post, struct BuildStatement *body);
+extern struct BuildStatement *build_stmt_goto(struct Builder *b, char const *label);
+extern struct BuildStatement *build_stmt_continue(struct Builder *b);
+extern struct BuildStatement *build_stmt_break(struct Builder *b);
+extern struct BuildStatement *build_stmt_return(struct Builder *b, struct BuildExpression *expr);
+extern struct BuildInitializer *build_initializer_expr(struct Builder *b, struct BuildExpression *expr);
+extern struct BuildInitializer *build_initializer_braced(struct Builder *b, size_t nelems, struct BuildInitializer *(*elems));
+extern struct BuildExpression *build_expr_none(struct Builder *b);
+extern struct BuildExpression *build_expr_parenthesize(struct Builder *b, struct BuildExpression *expr);
+extern struct BuildExpression *build_expr_id(struct Builder *b, char const *id);
+extern struct BuildExpression *build_expr_char(struct Builder *b, char c);
+extern struct BuildExpression *build_expr_multi_char(struct Builder *b, char const *c);
+extern struct BuildExpression *build_expr_multi_char_slice(struct Builder *b, char const *c, size_t l);
+extern struct BuildExpression *build_expr_string(struct Builder *b, char const *s);
+extern struct BuildExpression *build_expr_string_slice(struct Builder *b, char const *s, size_t l);
+extern struct BuildExpression *build_expr_int(struct Builder *b, uintmax_t i);
+extern struct BuildExpression *build_expr_int_oct(struct Builder *b, uintmax_t i, unsigned int min_len);
+extern struct BuildExpression *build_expr_int_hex(struct Builder *b, uintmax_t i, unsigned int min_len);
+extern struct BuildExpression *build_expr_float(struct Builder *b, double f);
+extern struct BuildExpression *build_expr_index(struct Builder *b, struct BuildExpression *arr, struct BuildExpression *idx);
+extern struct BuildExpression *build_expr_call(struct Builder *b, struct BuildExpression *fun_, size_t nargs, struct BuildExpression *(*args));
+extern struct BuildExpression *build_expr_direct_member(struct Builder *b, struct BuildExpression *obj, char const *field);
+extern struct BuildExpression *build_expr_indirect_member(struct Builder *b, struct BuildExpression *ptr_, char const *field);
+extern struct BuildExpression *build_expr_post_inc(struct Builder *b, struct BuildExpression *lhs);
+extern struct BuildExpression *build_expr_post_dec(struct Builder *b, struct BuildExpression *lhs);
+extern struct BuildExpression *build_expr_pre_inc(struct Builder *b, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_pre_dec(struct Builder *b, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_addressof(struct Builder *b, struct BuildExpression *obj);
+extern struct BuildExpression *build_expr_deref(struct Builder *b, struct BuildExpression *ptr_);
+extern struct BuildExpression *build_expr_unary_plus(struct Builder *b, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_unary_minus(struct Builder *b, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_bitwise_not(struct Builder *b, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_logical_not(struct Builder *b, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_sizeof_expr(struct Builder *b, struct BuildExpression *obj);
+extern struct BuildExpression *build_expr_sizeof_type(struct Builder *b, struct BuildType *type);
+extern struct BuildExpression *build_expr_cast(struct Builder *b, struct BuildType *type, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_times(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_divide(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_modulus(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_plus(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_minus(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_lshift(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_rshift(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_cmp_lt(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_cmp_gt(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_cmp_le(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_cmp_ge(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_cmp_eq(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_cmp_ne(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_bitwise_and(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_bitwise_xor(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_bitwise_or(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_logical_and(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_logical_or(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_conditional(struct Builder *b, struct BuildExpression *cond, struct BuildExpression *if_true, struct BuildExpression *if_false);
+extern struct BuildExpression *build_expr_assign(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_times(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_divide(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_modulus(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_plus(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_minus(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_lshift(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_rshift(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_bitwise_and(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_bitwise_xor(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_assign_bitwise_or(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern struct BuildExpression *build_expr_comma(struct Builder *b, struct BuildExpression *lhs, struct BuildExpression *rhs);
+extern signed int printf(char const *fmt, ...);
+signed int main(void)
+{
+    printf("/* %s */\n", "This program writes \"Hello, World!\"");
+    struct Builder *b = builder_create();
+    struct BuildStorageClass *extern_sc = build_storage_class_extern(b);
+    struct BuildType *ty_void = build_type_void(b);
+    struct BuildType *ty_char = build_type_char(b);
+    struct BuildType *ty_ccp = build_type_pointer(b, build_type_const(b, ty_char));
+    struct BuildType *ty_cpp = build_type_pointer(b, build_type_pointer(b, ty_char));
+    struct BuildType *ty_int = build_type_signed_int(b);
+    struct BuildParamDeclaration *p_format = build_param_declaration(b, 0, NULL, ty_ccp, "format");
+    struct BuildParamDeclaration *printf_params[1] = { p_format };
+    struct BuildType *printf_ty = build_type_function(b, ty_int, 1, &printf_params[0], true);
+    struct BuildStatement *decl_printf = build_declaration_noinit(b, 1, &extern_sc, printf_ty, "printf");
+    struct BuildExpression *zero = build_expr_int(b, 0);
+    struct BuildExpression *hello = build_expr_string(b, "Hello, World!\n");
+    struct BuildExpression *expr_argc = build_expr_id(b, "argc");
+    struct BuildExpression *expr_argv = build_expr_id(b, "argv");
+    struct BuildExpression *expr_printf = build_expr_id(b, "printf");
+    struct BuildExpression *cast_argc = build_expr_cast(b, ty_void, expr_argc);
+    struct BuildExpression *cast_argv = build_expr_cast(b, ty_void, expr_argv);
+    struct BuildExpression *printf_args[1] = { hello };
+    struct BuildExpression *call_printf = build_expr_call(b, expr_printf, 1, &printf_args[0]);
+    struct BuildStatement *stmt_cast_argc = build_stmt_expr(b, cast_argc);
+    struct BuildStatement *stmt_cast_argv = build_stmt_expr(b, cast_argv);
+    struct BuildStatement *stmt_call_printf = build_stmt_expr(b, call_printf);
+    struct BuildStatement *return_0 = build_stmt_return(b, zero);
+    struct BuildStatement *main_stmts[4] = { stmt_cast_argc, stmt_cast_argv, stmt_call_printf, return_0 };
+    struct BuildParamDeclaration *p_argc = build_param_declaration(b, 0, NULL, ty_int, "argc");
+    struct BuildParamDeclaration *p_argv = build_param_declaration(b, 0, NULL, ty_cpp, "argv");
+    struct BuildParamDeclaration *main_params[2] = { p_argc, p_argv };
+    struct BuildType *main_ty = build_type_function(b, ty_int, 2, &main_params[0], false);
+    struct BuildStatement *main_body = build_stmt_compound(b, 4, &main_stmts[0]);
+    struct BuildStatement *def_main = build_function_definition(b, 0, NULL, "main", main_ty, main_body);
+    struct BuildStatement *tops[2] = { decl_printf, def_main };
+    struct BuildTranslationUnit *tu = build_tu(b, 2, &tops[0]);
+    builder_emit_tu_to_file(tu, stdout);
+    builder_destroy(b);
+    return 0;
+}
@@ -0,0 +1,1981 @@
+/* Generated file, edit cache/gram/nicate-glass.gram instead. */
+#include "nicate-glass.gen.h"
+
+/*
+    Copyright © 2015-2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "pool.h"
+
+
+/* Concrete types only. */
+typedef enum NicateGlassAstType NicateGlassAstType;
+enum NicateGlassAstType
+{
+    NICATE_GLASS_NOTHING,
+    NICATE_GLASS_ATOM_BINARY_LITERAL,
+    NICATE_GLASS_ATOM_CHARACTER_LITERAL,
+    NICATE_GLASS_ATOM_COMMENT,
+    NICATE_GLASS_ATOM_DECIMAL_FLOATING_LITERAL,
+    NICATE_GLASS_ATOM_DECIMAL_LITERAL,
+    NICATE_GLASS_ATOM_HEXADECIMAL_FLOATING_LITERAL,
+    NICATE_GLASS_ATOM_HEXADECIMAL_LITERAL,
+    NICATE_GLASS_ATOM_ID,
+    NICATE_GLASS_ATOM_OCTAL_LITERAL,
+    NICATE_GLASS_ATOM_STRING_LITERAL,
+    NICATE_GLASS_KW_BREAK,
+    NICATE_GLASS_KW_CASE,
+    NICATE_GLASS_KW_CONTINUE,
+    NICATE_GLASS_KW_DEFAULT,
+    NICATE_GLASS_KW_DO,
+    NICATE_GLASS_KW_ELSE,
+    NICATE_GLASS_KW_ENUM,
+    NICATE_GLASS_KW_FUN,
+    NICATE_GLASS_KW_GOTO,
+    NICATE_GLASS_KW_IF,
+    NICATE_GLASS_KW_LET,
+    NICATE_GLASS_KW_RETURN,
+    NICATE_GLASS_KW_STRUCT,
+    NICATE_GLASS_KW_SWITCH,
+    NICATE_GLASS_KW_UNION,
+    NICATE_GLASS_KW_WHILE,
+    NICATE_GLASS_SYM_AMPERSAND,
+    NICATE_GLASS_SYM_AMPERSAND_BE,
+    NICATE_GLASS_SYM_ARROW,
+    NICATE_GLASS_SYM_AT,
+    NICATE_GLASS_SYM_BANG,
+    NICATE_GLASS_SYM_BE,
+    NICATE_GLASS_SYM_CARET,
+    NICATE_GLASS_SYM_CARET_BE,
+    NICATE_GLASS_SYM_COLON,
+    NICATE_GLASS_SYM_COMMA,
+    NICATE_GLASS_SYM_DECR,
+    NICATE_GLASS_SYM_DOT,
+    NICATE_GLASS_SYM_ELLIPSIS,
+    NICATE_GLASS_SYM_EQ,
+    NICATE_GLASS_SYM_GE,
+    NICATE_GLASS_SYM_GT,
+    NICATE_GLASS_SYM_INCR,
+    NICATE_GLASS_SYM_LBRACE,
+    NICATE_GLASS_SYM_LBRACKET,
+    NICATE_GLASS_SYM_LE,
+    NICATE_GLASS_SYM_LOGICAL_AND,
+    NICATE_GLASS_SYM_LOGICAL_OR,
+    NICATE_GLASS_SYM_LPAREN,
+    NICATE_GLASS_SYM_LSHIFT,
+    NICATE_GLASS_SYM_LSHIFT_BE,
+    NICATE_GLASS_SYM_LT,
+    NICATE_GLASS_SYM_MINUS,
+    NICATE_GLASS_SYM_MINUS_BE,
+    NICATE_GLASS_SYM_NE,
+    NICATE_GLASS_SYM_PERCENT,
+    NICATE_GLASS_SYM_PERCENT_BE,
+    NICATE_GLASS_SYM_PIPE,
+    NICATE_GLASS_SYM_PIPE_BE,
+    NICATE_GLASS_SYM_PLUS,
+    NICATE_GLASS_SYM_PLUS_BE,
+    NICATE_GLASS_SYM_RBRACE,
+    NICATE_GLASS_SYM_RBRACKET,
+    NICATE_GLASS_SYM_RPAREN,
+    NICATE_GLASS_SYM_RSHIFT,
+    NICATE_GLASS_SYM_RSHIFT_BE,
+    NICATE_GLASS_SYM_SEMICOLON,
+    NICATE_GLASS_SYM_SLASH,
+    NICATE_GLASS_SYM_SLASH_BE,
+    NICATE_GLASS_SYM_STAR,
+    NICATE_GLASS_SYM_STAR_BE,
+    NICATE_GLASS_SYM_TILDE,
+    NICATE_GLASS_TREE_ATTR,
+    NICATE_GLASS_TREE_COMPOUND_STMT,
+    NICATE_GLASS_TREE_ENUM_LIST,
+    NICATE_GLASS_TREE_ENUMERATOR,
+    NICATE_GLASS_TREE_EXPR_LIST,
+    NICATE_GLASS_TREE_STMT_LIST,
+    NICATE_GLASS_TREE_TAG_ADDRESSOF_EXPR,
+    NICATE_GLASS_TREE_TAG_ANNOTATED_STMT,
+    NICATE_GLASS_TREE_TAG_ARRAY_LITERAL,
+    NICATE_GLASS_TREE_TAG_ATTR_EXPR,
+    NICATE_GLASS_TREE_TAG_BIT_AND_ASSIGN,
+    NICATE_GLASS_TREE_TAG_BIT_AND_EXPR,
+    NICATE_GLASS_TREE_TAG_BIT_IOR_EXPR,
+    NICATE_GLASS_TREE_TAG_BIT_NOT_EXPR,
+    NICATE_GLASS_TREE_TAG_BIT_OR_ASSIGN,
+    NICATE_GLASS_TREE_TAG_BIT_XOR_ASSIGN,
+    NICATE_GLASS_TREE_TAG_BIT_XOR_EXPR,
+    NICATE_GLASS_TREE_TAG_BREAK_STMT,
+    NICATE_GLASS_TREE_TAG_CALL_EXPR,
+    NICATE_GLASS_TREE_TAG_CASE_STMT,
+    NICATE_GLASS_TREE_TAG_CONTINUE_STMT,
+    NICATE_GLASS_TREE_TAG_DECLARATION,
+    NICATE_GLASS_TREE_TAG_DEFAULT_STMT,
+    NICATE_GLASS_TREE_TAG_DIVIDE_ASSIGN,
+    NICATE_GLASS_TREE_TAG_DIVIDE_EXPR,
+    NICATE_GLASS_TREE_TAG_DO_STMT,
+    NICATE_GLASS_TREE_TAG_ENUM_BODY,
+    NICATE_GLASS_TREE_TAG_ENUM_STMT,
+    NICATE_GLASS_TREE_TAG_EQ_EXPR,
+    NICATE_GLASS_TREE_TAG_EXPR_STMT,
+    NICATE_GLASS_TREE_TAG_FIXED_FUN_SIG,
+    NICATE_GLASS_TREE_TAG_FUN_STMT,
+    NICATE_GLASS_TREE_TAG_GE_EXPR,
+    NICATE_GLASS_TREE_TAG_GOTO_STMT,
+    NICATE_GLASS_TREE_TAG_GT_EXPR,
+    NICATE_GLASS_TREE_TAG_IF_ELSE_STMT,
+    NICATE_GLASS_TREE_TAG_IF_STMT,
+    NICATE_GLASS_TREE_TAG_INDEX_EXPR,
+    NICATE_GLASS_TREE_TAG_INITIALIZED_DECLARATION,
+    NICATE_GLASS_TREE_TAG_LABELED_STMT,
+    NICATE_GLASS_TREE_TAG_LE_EXPR,
+    NICATE_GLASS_TREE_TAG_LEFT_SHIFT_ASSIGN,
+    NICATE_GLASS_TREE_TAG_LEFT_SHIFT_EXPR,
+    NICATE_GLASS_TREE_TAG_LOG_AND_EXPR,
+    NICATE_GLASS_TREE_TAG_LOG_NOT_EXPR,
+    NICATE_GLASS_TREE_TAG_LOG_OR_EXPR,
+    NICATE_GLASS_TREE_TAG_LT_EXPR,
+    NICATE_GLASS_TREE_TAG_MEMBER_EXPR,
+    NICATE_GLASS_TREE_TAG_MINUS_ASSIGN,
+    NICATE_GLASS_TREE_TAG_MINUS_EXPR,
+    NICATE_GLASS_TREE_TAG_MODULO_ASSIGN,
+    NICATE_GLASS_TREE_TAG_MODULO_EXPR,
+    NICATE_GLASS_TREE_TAG_NE_EXPR,
+    NICATE_GLASS_TREE_TAG_PAREN_EXPR,
+    NICATE_GLASS_TREE_TAG_PLUS_ASSIGN,
+    NICATE_GLASS_TREE_TAG_PLUS_EXPR,
+    NICATE_GLASS_TREE_TAG_POST_DECR_EXPR,
+    NICATE_GLASS_TREE_TAG_POST_INCR_EXPR,
+    NICATE_GLASS_TREE_TAG_PRE_DECR_EXPR,
+    NICATE_GLASS_TREE_TAG_PRE_INCR_EXPR,
+    NICATE_GLASS_TREE_TAG_RETURN_STMT,
+    NICATE_GLASS_TREE_TAG_RIGHT_SHIFT_ASSIGN,
+    NICATE_GLASS_TREE_TAG_RIGHT_SHIFT_EXPR,
+    NICATE_GLASS_TREE_TAG_SIMPLE_ASSIGN,
+    NICATE_GLASS_TREE_TAG_STRUCT_BODY,
+    NICATE_GLASS_TREE_TAG_STRUCT_STMT,
+    NICATE_GLASS_TREE_TAG_SWITCH_STMT,
+    NICATE_GLASS_TREE_TAG_TIMES_ASSIGN,
+    NICATE_GLASS_TREE_TAG_TIMES_EXPR,
+    NICATE_GLASS_TREE_TAG_UNARY_MINUS_EXPR,
+    NICATE_GLASS_TREE_TAG_UNARY_PLUS_EXPR,
+    NICATE_GLASS_TREE_TAG_UNION_STMT,
+    NICATE_GLASS_TREE_TAG_UNTYPED_ID,
+    NICATE_GLASS_TREE_TAG_VARIADIC_FUN_SIG,
+    NICATE_GLASS_TREE_TAG_WHILE_STMT,
+    NICATE_GLASS_TREE_TU,
+    NICATE_GLASS_TREE_TYPED_ID,
+    NICATE_GLASS_TREE_TYPED_ID_LIST,
+};
+
+struct NicateGlassAst
+{
+    NicateGlassAstType type;
+    size_t total_tokens;
+    size_t num_children;
+    __extension__ union { const char *raw; NicateGlassAst **children; };
+};
+
+static NicateGlassAst nicate_glass_nothing = {NICATE_GLASS_NOTHING, 0, 0, {""}};
+
+NicateGlassNothing *nicate_glass_create_nothing(Pool *pool)
+{
+    (void)pool;
+    return (NicateGlassNothing *)&nicate_glass_nothing;
+}
+static NicateGlassAst *nicate_glass_create_terminal(Pool *pool, NicateGlassAstType type, const char *raw, bool dup)
+{
+    NicateGlassAst rv;
+    memset(&rv, 0, sizeof(rv));
+    rv.type = type;
+    rv.total_tokens = 1;
+    rv.num_children = 0;
+    if (dup)
+        raw = pool_intern_string(pool, raw);
+    rv.raw = raw;
+    return (NicateGlassAst *)(const NicateGlassAst *)pool_intern(pool, &rv, sizeof(rv));
+}
+static NicateGlassAst *nicate_glass_create_nonterminal(Pool *pool, NicateGlassAstType type, size_t nargs, NicateGlassAst **args)
+{
+    NicateGlassAst rv;
+    size_t i, only = (size_t)-2;
+    assert (nargs >= 2);
+    for (i = 0; i < nargs; ++i)
+    {
+        if (!nicate_glass_is_nothing(args[i]))
+        {
+            if (only == (size_t)-2)
+            {
+                only = i;
+            }
+            else
+            {
+                only = (size_t)-1;
+                break;
+            }
+        }
+
+    }
+    assert (only != (size_t)-2);
+    if (only != (size_t)-1)
+    {
+        return args[only];
+    }
+    memset(&rv, 0, sizeof(rv));
+    rv.type = type;
+    rv.total_tokens = 0;
+    for (i = 0; i < nargs; ++i)
+    {
+        rv.total_tokens += args[i]->total_tokens;
+    }
+    rv.num_children = nargs;
+    rv.children = (NicateGlassAst **)pool_intern(pool, args, nargs * sizeof(NicateGlassAst *));
+    return (NicateGlassAst *)(const NicateGlassAst *)pool_intern(pool, &rv, sizeof(rv));
+}
+NicateGlassAtomBinaryLiteral *nicate_glass_create_atom_binary_literal(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomBinaryLiteral *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_BINARY_LITERAL, raw, true);
+}
+NicateGlassAtomCharacterLiteral *nicate_glass_create_atom_character_literal(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomCharacterLiteral *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_CHARACTER_LITERAL, raw, true);
+}
+NicateGlassAtomComment *nicate_glass_create_atom_comment(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomComment *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_COMMENT, raw, true);
+}
+NicateGlassAtomDecimalFloatingLiteral *nicate_glass_create_atom_decimal_floating_literal(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomDecimalFloatingLiteral *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_DECIMAL_FLOATING_LITERAL, raw, true);
+}
+NicateGlassAtomDecimalLiteral *nicate_glass_create_atom_decimal_literal(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomDecimalLiteral *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_DECIMAL_LITERAL, raw, true);
+}
+NicateGlassAtomHexadecimalFloatingLiteral *nicate_glass_create_atom_hexadecimal_floating_literal(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomHexadecimalFloatingLiteral *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_HEXADECIMAL_FLOATING_LITERAL, raw, true);
+}
+NicateGlassAtomHexadecimalLiteral *nicate_glass_create_atom_hexadecimal_literal(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomHexadecimalLiteral *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_HEXADECIMAL_LITERAL, raw, true);
+}
+NicateGlassAtomId *nicate_glass_create_atom_id(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomId *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_ID, raw, true);
+}
+NicateGlassAtomOctalLiteral *nicate_glass_create_atom_octal_literal(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomOctalLiteral *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_OCTAL_LITERAL, raw, true);
+}
+NicateGlassAtomStringLiteral *nicate_glass_create_atom_string_literal(Pool *pool, const char *raw)
+{
+    return (NicateGlassAtomStringLiteral *)nicate_glass_create_terminal(pool, NICATE_GLASS_ATOM_STRING_LITERAL, raw, true);
+}
+NicateGlassKwBreak *nicate_glass_create_kw_break(Pool *pool)
+{
+    return (NicateGlassKwBreak *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_BREAK, "break", false);
+}
+NicateGlassKwCase *nicate_glass_create_kw_case(Pool *pool)
+{
+    return (NicateGlassKwCase *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_CASE, "case", false);
+}
+NicateGlassKwContinue *nicate_glass_create_kw_continue(Pool *pool)
+{
+    return (NicateGlassKwContinue *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_CONTINUE, "continue", false);
+}
+NicateGlassKwDefault *nicate_glass_create_kw_default(Pool *pool)
+{
+    return (NicateGlassKwDefault *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_DEFAULT, "default", false);
+}
+NicateGlassKwDo *nicate_glass_create_kw_do(Pool *pool)
+{
+    return (NicateGlassKwDo *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_DO, "do", false);
+}
+NicateGlassKwElse *nicate_glass_create_kw_else(Pool *pool)
+{
+    return (NicateGlassKwElse *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_ELSE, "else", false);
+}
+NicateGlassKwEnum *nicate_glass_create_kw_enum(Pool *pool)
+{
+    return (NicateGlassKwEnum *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_ENUM, "enum", false);
+}
+NicateGlassKwFun *nicate_glass_create_kw_fun(Pool *pool)
+{
+    return (NicateGlassKwFun *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_FUN, "fun", false);
+}
+NicateGlassKwGoto *nicate_glass_create_kw_goto(Pool *pool)
+{
+    return (NicateGlassKwGoto *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_GOTO, "goto", false);
+}
+NicateGlassKwIf *nicate_glass_create_kw_if(Pool *pool)
+{
+    return (NicateGlassKwIf *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_IF, "if", false);
+}
+NicateGlassKwLet *nicate_glass_create_kw_let(Pool *pool)
+{
+    return (NicateGlassKwLet *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_LET, "let", false);
+}
+NicateGlassKwReturn *nicate_glass_create_kw_return(Pool *pool)
+{
+    return (NicateGlassKwReturn *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_RETURN, "return", false);
+}
+NicateGlassKwStruct *nicate_glass_create_kw_struct(Pool *pool)
+{
+    return (NicateGlassKwStruct *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_STRUCT, "struct", false);
+}
+NicateGlassKwSwitch *nicate_glass_create_kw_switch(Pool *pool)
+{
+    return (NicateGlassKwSwitch *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_SWITCH, "switch", false);
+}
+NicateGlassKwUnion *nicate_glass_create_kw_union(Pool *pool)
+{
+    return (NicateGlassKwUnion *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_UNION, "union", false);
+}
+NicateGlassKwWhile *nicate_glass_create_kw_while(Pool *pool)
+{
+    return (NicateGlassKwWhile *)nicate_glass_create_terminal(pool, NICATE_GLASS_KW_WHILE, "while", false);
+}
+NicateGlassSymAmpersand *nicate_glass_create_sym_ampersand(Pool *pool)
+{
+    return (NicateGlassSymAmpersand *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_AMPERSAND, "&", false);
+}
+NicateGlassSymAmpersandBe *nicate_glass_create_sym_ampersand_be(Pool *pool)
+{
+    return (NicateGlassSymAmpersandBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_AMPERSAND_BE, "&=", false);
+}
+NicateGlassSymArrow *nicate_glass_create_sym_arrow(Pool *pool)
+{
+    return (NicateGlassSymArrow *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_ARROW, "->", false);
+}
+NicateGlassSymAt *nicate_glass_create_sym_at(Pool *pool)
+{
+    return (NicateGlassSymAt *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_AT, "@", false);
+}
+NicateGlassSymBang *nicate_glass_create_sym_bang(Pool *pool)
+{
+    return (NicateGlassSymBang *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_BANG, "!", false);
+}
+NicateGlassSymBe *nicate_glass_create_sym_be(Pool *pool)
+{
+    return (NicateGlassSymBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_BE, "=", false);
+}
+NicateGlassSymCaret *nicate_glass_create_sym_caret(Pool *pool)
+{
+    return (NicateGlassSymCaret *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_CARET, "^", false);
+}
+NicateGlassSymCaretBe *nicate_glass_create_sym_caret_be(Pool *pool)
+{
+    return (NicateGlassSymCaretBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_CARET_BE, "^=", false);
+}
+NicateGlassSymColon *nicate_glass_create_sym_colon(Pool *pool)
+{
+    return (NicateGlassSymColon *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_COLON, ":", false);
+}
+NicateGlassSymComma *nicate_glass_create_sym_comma(Pool *pool)
+{
+    return (NicateGlassSymComma *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_COMMA, ",", false);
+}
+NicateGlassSymDecr *nicate_glass_create_sym_decr(Pool *pool)
+{
+    return (NicateGlassSymDecr *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_DECR, "--", false);
+}
+NicateGlassSymDot *nicate_glass_create_sym_dot(Pool *pool)
+{
+    return (NicateGlassSymDot *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_DOT, ".", false);
+}
+NicateGlassSymEllipsis *nicate_glass_create_sym_ellipsis(Pool *pool)
+{
+    return (NicateGlassSymEllipsis *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_ELLIPSIS, "...", false);
+}
+NicateGlassSymEq *nicate_glass_create_sym_eq(Pool *pool)
+{
+    return (NicateGlassSymEq *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_EQ, "==", false);
+}
+NicateGlassSymGe *nicate_glass_create_sym_ge(Pool *pool)
+{
+    return (NicateGlassSymGe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_GE, ">=", false);
+}
+NicateGlassSymGt *nicate_glass_create_sym_gt(Pool *pool)
+{
+    return (NicateGlassSymGt *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_GT, ">", false);
+}
+NicateGlassSymIncr *nicate_glass_create_sym_incr(Pool *pool)
+{
+    return (NicateGlassSymIncr *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_INCR, "++", false);
+}
+NicateGlassSymLbrace *nicate_glass_create_sym_lbrace(Pool *pool)
+{
+    return (NicateGlassSymLbrace *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LBRACE, "{", false);
+}
+NicateGlassSymLbracket *nicate_glass_create_sym_lbracket(Pool *pool)
+{
+    return (NicateGlassSymLbracket *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LBRACKET, "[", false);
+}
+NicateGlassSymLe *nicate_glass_create_sym_le(Pool *pool)
+{
+    return (NicateGlassSymLe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LE, "<=", false);
+}
+NicateGlassSymLogicalAnd *nicate_glass_create_sym_logical_and(Pool *pool)
+{
+    return (NicateGlassSymLogicalAnd *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LOGICAL_AND, "&&", false);
+}
+NicateGlassSymLogicalOr *nicate_glass_create_sym_logical_or(Pool *pool)
+{
+    return (NicateGlassSymLogicalOr *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LOGICAL_OR, "||", false);
+}
+NicateGlassSymLparen *nicate_glass_create_sym_lparen(Pool *pool)
+{
+    return (NicateGlassSymLparen *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LPAREN, "(", false);
+}
+NicateGlassSymLshift *nicate_glass_create_sym_lshift(Pool *pool)
+{
+    return (NicateGlassSymLshift *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LSHIFT, "<<", false);
+}
+NicateGlassSymLshiftBe *nicate_glass_create_sym_lshift_be(Pool *pool)
+{
+    return (NicateGlassSymLshiftBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LSHIFT_BE, "<<=", false);
+}
+NicateGlassSymLt *nicate_glass_create_sym_lt(Pool *pool)
+{
+    return (NicateGlassSymLt *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_LT, "<", false);
+}
+NicateGlassSymMinus *nicate_glass_create_sym_minus(Pool *pool)
+{
+    return (NicateGlassSymMinus *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_MINUS, "-", false);
+}
+NicateGlassSymMinusBe *nicate_glass_create_sym_minus_be(Pool *pool)
+{
+    return (NicateGlassSymMinusBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_MINUS_BE, "-=", false);
+}
+NicateGlassSymNe *nicate_glass_create_sym_ne(Pool *pool)
+{
+    return (NicateGlassSymNe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_NE, "!=", false);
+}
+NicateGlassSymPercent *nicate_glass_create_sym_percent(Pool *pool)
+{
+    return (NicateGlassSymPercent *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_PERCENT, "%", false);
+}
+NicateGlassSymPercentBe *nicate_glass_create_sym_percent_be(Pool *pool)
+{
+    return (NicateGlassSymPercentBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_PERCENT_BE, "%=", false);
+}
+NicateGlassSymPipe *nicate_glass_create_sym_pipe(Pool *pool)
+{
+    return (NicateGlassSymPipe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_PIPE, "|", false);
+}
+NicateGlassSymPipeBe *nicate_glass_create_sym_pipe_be(Pool *pool)
+{
+    return (NicateGlassSymPipeBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_PIPE_BE, "|=", false);
+}
+NicateGlassSymPlus *nicate_glass_create_sym_plus(Pool *pool)
+{
+    return (NicateGlassSymPlus *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_PLUS, "+", false);
+}
+NicateGlassSymPlusBe *nicate_glass_create_sym_plus_be(Pool *pool)
+{
+    return (NicateGlassSymPlusBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_PLUS_BE, "+=", false);
+}
+NicateGlassSymRbrace *nicate_glass_create_sym_rbrace(Pool *pool)
+{
+    return (NicateGlassSymRbrace *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_RBRACE, "}", false);
+}
+NicateGlassSymRbracket *nicate_glass_create_sym_rbracket(Pool *pool)
+{
+    return (NicateGlassSymRbracket *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_RBRACKET, "]", false);
+}
+NicateGlassSymRparen *nicate_glass_create_sym_rparen(Pool *pool)
+{
+    return (NicateGlassSymRparen *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_RPAREN, ")", false);
+}
+NicateGlassSymRshift *nicate_glass_create_sym_rshift(Pool *pool)
+{
+    return (NicateGlassSymRshift *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_RSHIFT, ">>", false);
+}
+NicateGlassSymRshiftBe *nicate_glass_create_sym_rshift_be(Pool *pool)
+{
+    return (NicateGlassSymRshiftBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_RSHIFT_BE, ">>=", false);
+}
+NicateGlassSymSemicolon *nicate_glass_create_sym_semicolon(Pool *pool)
+{
+    return (NicateGlassSymSemicolon *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_SEMICOLON, ";", false);
+}
+NicateGlassSymSlash *nicate_glass_create_sym_slash(Pool *pool)
+{
+    return (NicateGlassSymSlash *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_SLASH, "/", false);
+}
+NicateGlassSymSlashBe *nicate_glass_create_sym_slash_be(Pool *pool)
+{
+    return (NicateGlassSymSlashBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_SLASH_BE, "/=", false);
+}
+NicateGlassSymStar *nicate_glass_create_sym_star(Pool *pool)
+{
+    return (NicateGlassSymStar *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_STAR, "*", false);
+}
+NicateGlassSymStarBe *nicate_glass_create_sym_star_be(Pool *pool)
+{
+    return (NicateGlassSymStarBe *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_STAR_BE, "*=", false);
+}
+NicateGlassSymTilde *nicate_glass_create_sym_tilde(Pool *pool)
+{
+    return (NicateGlassSymTilde *)nicate_glass_create_terminal(pool, NICATE_GLASS_SYM_TILDE, "~", false);
+}
+NicateGlassTreeAttr *nicate_glass_create_tree_attr(Pool *pool, NicateGlassSymAt *sym_at, NicateGlassAtomId *atom_id, NicateGlassOptLparen *opt_lparen, NicateGlassSlaveExprList *slave_expr_list, NicateGlassSlaveRparen *slave_rparen)
+{
+    NicateGlassAst *args[5] = {(NicateGlassAst *)sym_at, (NicateGlassAst *)atom_id, (NicateGlassAst *)opt_lparen, (NicateGlassAst *)slave_expr_list, (NicateGlassAst *)slave_rparen};
+    assert (nicate_glass_is_sym_at((NicateGlassAst *)sym_at));
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_opt_lparen((NicateGlassAst *)opt_lparen));
+    assert (nicate_glass_is_slave_expr_list((NicateGlassAst *)slave_expr_list));
+    assert (nicate_glass_is_slave_rparen((NicateGlassAst *)slave_rparen));
+    return (NicateGlassTreeAttr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_ATTR, 5, args);
+}
+NicateGlassTreeCompoundStmt *nicate_glass_create_tree_compound_stmt(Pool *pool, NicateGlassSymLbrace *sym_lbrace, NicateGlassOptStmtList *opt_stmt_list, NicateGlassSymRbrace *sym_rbrace)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)sym_lbrace, (NicateGlassAst *)opt_stmt_list, (NicateGlassAst *)sym_rbrace};
+    assert (nicate_glass_is_sym_lbrace((NicateGlassAst *)sym_lbrace));
+    assert (nicate_glass_is_opt_stmt_list((NicateGlassAst *)opt_stmt_list));
+    assert (nicate_glass_is_sym_rbrace((NicateGlassAst *)sym_rbrace));
+    return (NicateGlassTreeCompoundStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_COMPOUND_STMT, 3, args);
+}
+NicateGlassTreeEnumList *nicate_glass_create_tree_enum_list(Pool *pool, NicateGlassOptEnumList *opt_enum_list, NicateGlassSlaveComma *slave_comma, NicateGlassTreeEnumerator *tree_enumerator)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)opt_enum_list, (NicateGlassAst *)slave_comma, (NicateGlassAst *)tree_enumerator};
+    assert (nicate_glass_is_opt_enum_list((NicateGlassAst *)opt_enum_list));
+    assert (nicate_glass_is_slave_comma((NicateGlassAst *)slave_comma));
+    assert (nicate_glass_is_tree_enumerator((NicateGlassAst *)tree_enumerator));
+    return (NicateGlassTreeEnumList *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_ENUM_LIST, 3, args);
+}
+NicateGlassTreeEnumerator *nicate_glass_create_tree_enumerator(Pool *pool, NicateGlassAtomId *atom_id, NicateGlassOptBe *opt_be, NicateGlassSlaveExpr *slave_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)atom_id, (NicateGlassAst *)opt_be, (NicateGlassAst *)slave_expr};
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_opt_be((NicateGlassAst *)opt_be));
+    assert (nicate_glass_is_slave_expr((NicateGlassAst *)slave_expr));
+    return (NicateGlassTreeEnumerator *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_ENUMERATOR, 3, args);
+}
+NicateGlassTreeExprList *nicate_glass_create_tree_expr_list(Pool *pool, NicateGlassOptExprList *opt_expr_list, NicateGlassSlaveComma *slave_comma, NicateGlassAliasExpr *alias_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)opt_expr_list, (NicateGlassAst *)slave_comma, (NicateGlassAst *)alias_expr};
+    assert (nicate_glass_is_opt_expr_list((NicateGlassAst *)opt_expr_list));
+    assert (nicate_glass_is_slave_comma((NicateGlassAst *)slave_comma));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    return (NicateGlassTreeExprList *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_EXPR_LIST, 3, args);
+}
+NicateGlassTreeStmtList *nicate_glass_create_tree_stmt_list(Pool *pool, NicateGlassOptStmtList *opt_stmt_list, NicateGlassAnyStmt *any_stmt)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)opt_stmt_list, (NicateGlassAst *)any_stmt};
+    assert (nicate_glass_is_opt_stmt_list((NicateGlassAst *)opt_stmt_list));
+    assert (nicate_glass_is_any_stmt((NicateGlassAst *)any_stmt));
+    return (NicateGlassTreeStmtList *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_STMT_LIST, 2, args);
+}
+NicateGlassTreeTagAddressofExpr *nicate_glass_create_tree_tag_addressof_expr(Pool *pool, NicateGlassSymAmpersand *sym_ampersand, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)sym_ampersand, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_sym_ampersand((NicateGlassAst *)sym_ampersand));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagAddressofExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_ADDRESSOF_EXPR, 2, args);
+}
+NicateGlassTreeTagAnnotatedStmt *nicate_glass_create_tree_tag_annotated_stmt(Pool *pool, NicateGlassTreeAttr *tree_attr, NicateGlassAnyAttrStmt *any_attr_stmt)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)tree_attr, (NicateGlassAst *)any_attr_stmt};
+    assert (nicate_glass_is_tree_attr((NicateGlassAst *)tree_attr));
+    assert (nicate_glass_is_any_attr_stmt((NicateGlassAst *)any_attr_stmt));
+    return (NicateGlassTreeTagAnnotatedStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_ANNOTATED_STMT, 2, args);
+}
+NicateGlassTreeTagArrayLiteral *nicate_glass_create_tree_tag_array_literal(Pool *pool, NicateGlassSymLbracket *sym_lbracket, NicateGlassOptExprList *opt_expr_list, NicateGlassSymRbracket *sym_rbracket)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)sym_lbracket, (NicateGlassAst *)opt_expr_list, (NicateGlassAst *)sym_rbracket};
+    assert (nicate_glass_is_sym_lbracket((NicateGlassAst *)sym_lbracket));
+    assert (nicate_glass_is_opt_expr_list((NicateGlassAst *)opt_expr_list));
+    assert (nicate_glass_is_sym_rbracket((NicateGlassAst *)sym_rbracket));
+    return (NicateGlassTreeTagArrayLiteral *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_ARRAY_LITERAL, 3, args);
+}
+NicateGlassTreeTagAttrExpr *nicate_glass_create_tree_tag_attr_expr(Pool *pool, NicateGlassAnyQuasipostfixExpr *any_quasipostfix_expr, NicateGlassTreeAttr *tree_attr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)any_quasipostfix_expr, (NicateGlassAst *)tree_attr};
+    assert (nicate_glass_is_any_quasipostfix_expr((NicateGlassAst *)any_quasipostfix_expr));
+    assert (nicate_glass_is_tree_attr((NicateGlassAst *)tree_attr));
+    return (NicateGlassTreeTagAttrExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_ATTR_EXPR, 2, args);
+}
+NicateGlassTreeTagBitAndAssign *nicate_glass_create_tree_tag_bit_and_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymAmpersandBe *sym_ampersand_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_ampersand_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_ampersand_be((NicateGlassAst *)sym_ampersand_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagBitAndAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_BIT_AND_ASSIGN, 3, args);
+}
+NicateGlassTreeTagBitAndExpr *nicate_glass_create_tree_tag_bit_and_expr(Pool *pool, NicateGlassAnyBitwiseAndExpr *any_bitwise_and_expr, NicateGlassSymAmpersand *sym_ampersand, NicateGlassAnyCmpExpr *any_cmp_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_bitwise_and_expr, (NicateGlassAst *)sym_ampersand, (NicateGlassAst *)any_cmp_expr};
+    assert (nicate_glass_is_any_bitwise_and_expr((NicateGlassAst *)any_bitwise_and_expr));
+    assert (nicate_glass_is_sym_ampersand((NicateGlassAst *)sym_ampersand));
+    assert (nicate_glass_is_any_cmp_expr((NicateGlassAst *)any_cmp_expr));
+    return (NicateGlassTreeTagBitAndExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_BIT_AND_EXPR, 3, args);
+}
+NicateGlassTreeTagBitIorExpr *nicate_glass_create_tree_tag_bit_ior_expr(Pool *pool, NicateGlassAnyBitwiseIorExpr *any_bitwise_ior_expr, NicateGlassSymPipe *sym_pipe, NicateGlassAnyBitwiseXorExpr *any_bitwise_xor_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_bitwise_ior_expr, (NicateGlassAst *)sym_pipe, (NicateGlassAst *)any_bitwise_xor_expr};
+    assert (nicate_glass_is_any_bitwise_ior_expr((NicateGlassAst *)any_bitwise_ior_expr));
+    assert (nicate_glass_is_sym_pipe((NicateGlassAst *)sym_pipe));
+    assert (nicate_glass_is_any_bitwise_xor_expr((NicateGlassAst *)any_bitwise_xor_expr));
+    return (NicateGlassTreeTagBitIorExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_BIT_IOR_EXPR, 3, args);
+}
+NicateGlassTreeTagBitNotExpr *nicate_glass_create_tree_tag_bit_not_expr(Pool *pool, NicateGlassSymTilde *sym_tilde, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)sym_tilde, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_sym_tilde((NicateGlassAst *)sym_tilde));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagBitNotExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_BIT_NOT_EXPR, 2, args);
+}
+NicateGlassTreeTagBitOrAssign *nicate_glass_create_tree_tag_bit_or_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymPipeBe *sym_pipe_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_pipe_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_pipe_be((NicateGlassAst *)sym_pipe_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagBitOrAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_BIT_OR_ASSIGN, 3, args);
+}
+NicateGlassTreeTagBitXorAssign *nicate_glass_create_tree_tag_bit_xor_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymCaretBe *sym_caret_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_caret_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_caret_be((NicateGlassAst *)sym_caret_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagBitXorAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_BIT_XOR_ASSIGN, 3, args);
+}
+NicateGlassTreeTagBitXorExpr *nicate_glass_create_tree_tag_bit_xor_expr(Pool *pool, NicateGlassAnyBitwiseXorExpr *any_bitwise_xor_expr, NicateGlassSymCaret *sym_caret, NicateGlassAnyBitwiseAndExpr *any_bitwise_and_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_bitwise_xor_expr, (NicateGlassAst *)sym_caret, (NicateGlassAst *)any_bitwise_and_expr};
+    assert (nicate_glass_is_any_bitwise_xor_expr((NicateGlassAst *)any_bitwise_xor_expr));
+    assert (nicate_glass_is_sym_caret((NicateGlassAst *)sym_caret));
+    assert (nicate_glass_is_any_bitwise_and_expr((NicateGlassAst *)any_bitwise_and_expr));
+    return (NicateGlassTreeTagBitXorExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_BIT_XOR_EXPR, 3, args);
+}
+NicateGlassTreeTagBreakStmt *nicate_glass_create_tree_tag_break_stmt(Pool *pool, NicateGlassKwBreak *kw_break, NicateGlassSymSemicolon *sym_semicolon)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)kw_break, (NicateGlassAst *)sym_semicolon};
+    assert (nicate_glass_is_kw_break((NicateGlassAst *)kw_break));
+    assert (nicate_glass_is_sym_semicolon((NicateGlassAst *)sym_semicolon));
+    return (NicateGlassTreeTagBreakStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_BREAK_STMT, 2, args);
+}
+NicateGlassTreeTagCallExpr *nicate_glass_create_tree_tag_call_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymLparen *sym_lparen, NicateGlassOptExprList *opt_expr_list, NicateGlassSymRparen *sym_rparen)
+{
+    NicateGlassAst *args[4] = {(NicateGlassAst *)any_postfix_expr, (NicateGlassAst *)sym_lparen, (NicateGlassAst *)opt_expr_list, (NicateGlassAst *)sym_rparen};
+    assert (nicate_glass_is_any_postfix_expr((NicateGlassAst *)any_postfix_expr));
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_opt_expr_list((NicateGlassAst *)opt_expr_list));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    return (NicateGlassTreeTagCallExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_CALL_EXPR, 4, args);
+}
+NicateGlassTreeTagCaseStmt *nicate_glass_create_tree_tag_case_stmt(Pool *pool, NicateGlassKwCase *kw_case, NicateGlassAliasExpr *alias_expr, NicateGlassSymColon *sym_colon, NicateGlassAnyStmt *any_stmt)
+{
+    NicateGlassAst *args[4] = {(NicateGlassAst *)kw_case, (NicateGlassAst *)alias_expr, (NicateGlassAst *)sym_colon, (NicateGlassAst *)any_stmt};
+    assert (nicate_glass_is_kw_case((NicateGlassAst *)kw_case));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    assert (nicate_glass_is_sym_colon((NicateGlassAst *)sym_colon));
+    assert (nicate_glass_is_any_stmt((NicateGlassAst *)any_stmt));
+    return (NicateGlassTreeTagCaseStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_CASE_STMT, 4, args);
+}
+NicateGlassTreeTagContinueStmt *nicate_glass_create_tree_tag_continue_stmt(Pool *pool, NicateGlassKwContinue *kw_continue, NicateGlassSymSemicolon *sym_semicolon)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)kw_continue, (NicateGlassAst *)sym_semicolon};
+    assert (nicate_glass_is_kw_continue((NicateGlassAst *)kw_continue));
+    assert (nicate_glass_is_sym_semicolon((NicateGlassAst *)sym_semicolon));
+    return (NicateGlassTreeTagContinueStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_CONTINUE_STMT, 2, args);
+}
+NicateGlassTreeTagDeclaration *nicate_glass_create_tree_tag_declaration(Pool *pool, NicateGlassKwLet *kw_let, NicateGlassTreeTypedId *tree_typed_id, NicateGlassSymSemicolon *sym_semicolon)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)kw_let, (NicateGlassAst *)tree_typed_id, (NicateGlassAst *)sym_semicolon};
+    assert (nicate_glass_is_kw_let((NicateGlassAst *)kw_let));
+    assert (nicate_glass_is_tree_typed_id((NicateGlassAst *)tree_typed_id));
+    assert (nicate_glass_is_sym_semicolon((NicateGlassAst *)sym_semicolon));
+    return (NicateGlassTreeTagDeclaration *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_DECLARATION, 3, args);
+}
+NicateGlassTreeTagDefaultStmt *nicate_glass_create_tree_tag_default_stmt(Pool *pool, NicateGlassKwDefault *kw_default, NicateGlassSymColon *sym_colon, NicateGlassAnyStmt *any_stmt)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)kw_default, (NicateGlassAst *)sym_colon, (NicateGlassAst *)any_stmt};
+    assert (nicate_glass_is_kw_default((NicateGlassAst *)kw_default));
+    assert (nicate_glass_is_sym_colon((NicateGlassAst *)sym_colon));
+    assert (nicate_glass_is_any_stmt((NicateGlassAst *)any_stmt));
+    return (NicateGlassTreeTagDefaultStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_DEFAULT_STMT, 3, args);
+}
+NicateGlassTreeTagDivideAssign *nicate_glass_create_tree_tag_divide_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymSlashBe *sym_slash_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_slash_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_slash_be((NicateGlassAst *)sym_slash_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagDivideAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_DIVIDE_ASSIGN, 3, args);
+}
+NicateGlassTreeTagDivideExpr *nicate_glass_create_tree_tag_divide_expr(Pool *pool, NicateGlassAnyMulExpr *any_mul_expr, NicateGlassSymSlash *sym_slash, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_mul_expr, (NicateGlassAst *)sym_slash, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_any_mul_expr((NicateGlassAst *)any_mul_expr));
+    assert (nicate_glass_is_sym_slash((NicateGlassAst *)sym_slash));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagDivideExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_DIVIDE_EXPR, 3, args);
+}
+NicateGlassTreeTagDoStmt *nicate_glass_create_tree_tag_do_stmt(Pool *pool, NicateGlassKwDo *kw_do, NicateGlassTreeCompoundStmt *tree_compound_stmt, NicateGlassKwWhile *kw_while, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassSymSemicolon *sym_semicolon)
+{
+    NicateGlassAst *args[7] = {(NicateGlassAst *)kw_do, (NicateGlassAst *)tree_compound_stmt, (NicateGlassAst *)kw_while, (NicateGlassAst *)sym_lparen, (NicateGlassAst *)alias_expr, (NicateGlassAst *)sym_rparen, (NicateGlassAst *)sym_semicolon};
+    assert (nicate_glass_is_kw_do((NicateGlassAst *)kw_do));
+    assert (nicate_glass_is_tree_compound_stmt((NicateGlassAst *)tree_compound_stmt));
+    assert (nicate_glass_is_kw_while((NicateGlassAst *)kw_while));
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    assert (nicate_glass_is_sym_semicolon((NicateGlassAst *)sym_semicolon));
+    return (NicateGlassTreeTagDoStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_DO_STMT, 7, args);
+}
+NicateGlassTreeTagEnumBody *nicate_glass_create_tree_tag_enum_body(Pool *pool, NicateGlassSymLbrace *sym_lbrace, NicateGlassOptEnumList *opt_enum_list, NicateGlassSymRbrace *sym_rbrace)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)sym_lbrace, (NicateGlassAst *)opt_enum_list, (NicateGlassAst *)sym_rbrace};
+    assert (nicate_glass_is_sym_lbrace((NicateGlassAst *)sym_lbrace));
+    assert (nicate_glass_is_opt_enum_list((NicateGlassAst *)opt_enum_list));
+    assert (nicate_glass_is_sym_rbrace((NicateGlassAst *)sym_rbrace));
+    return (NicateGlassTreeTagEnumBody *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_ENUM_BODY, 3, args);
+}
+NicateGlassTreeTagEnumStmt *nicate_glass_create_tree_tag_enum_stmt(Pool *pool, NicateGlassKwEnum *kw_enum, NicateGlassAtomId *atom_id, NicateGlassAnyMaybeEnumBody *any_maybe_enum_body)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)kw_enum, (NicateGlassAst *)atom_id, (NicateGlassAst *)any_maybe_enum_body};
+    assert (nicate_glass_is_kw_enum((NicateGlassAst *)kw_enum));
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_any_maybe_enum_body((NicateGlassAst *)any_maybe_enum_body));
+    return (NicateGlassTreeTagEnumStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_ENUM_STMT, 3, args);
+}
+NicateGlassTreeTagEqExpr *nicate_glass_create_tree_tag_eq_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymEq *sym_eq, NicateGlassAnyShiftExpr *any_shift_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_shift_expr1, (NicateGlassAst *)sym_eq, (NicateGlassAst *)any_shift_expr2};
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr1));
+    assert (nicate_glass_is_sym_eq((NicateGlassAst *)sym_eq));
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr2));
+    return (NicateGlassTreeTagEqExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_EQ_EXPR, 3, args);
+}
+NicateGlassTreeTagExprStmt *nicate_glass_create_tree_tag_expr_stmt(Pool *pool, NicateGlassAnyAssign *any_assign, NicateGlassSymSemicolon *sym_semicolon)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)any_assign, (NicateGlassAst *)sym_semicolon};
+    assert (nicate_glass_is_any_assign((NicateGlassAst *)any_assign));
+    assert (nicate_glass_is_sym_semicolon((NicateGlassAst *)sym_semicolon));
+    return (NicateGlassTreeTagExprStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_EXPR_STMT, 2, args);
+}
+NicateGlassTreeTagFixedFunSig *nicate_glass_create_tree_tag_fixed_fun_sig(Pool *pool, NicateGlassSymLparen *sym_lparen, NicateGlassOptTypedIdList *opt_typed_id_list, NicateGlassSymRparen *sym_rparen, NicateGlassSymArrow *sym_arrow, NicateGlassAliasExpr *alias_expr)
+{
+    NicateGlassAst *args[5] = {(NicateGlassAst *)sym_lparen, (NicateGlassAst *)opt_typed_id_list, (NicateGlassAst *)sym_rparen, (NicateGlassAst *)sym_arrow, (NicateGlassAst *)alias_expr};
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_opt_typed_id_list((NicateGlassAst *)opt_typed_id_list));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    assert (nicate_glass_is_sym_arrow((NicateGlassAst *)sym_arrow));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    return (NicateGlassTreeTagFixedFunSig *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_FIXED_FUN_SIG, 5, args);
+}
+NicateGlassTreeTagFunStmt *nicate_glass_create_tree_tag_fun_stmt(Pool *pool, NicateGlassKwFun *kw_fun, NicateGlassAtomId *atom_id, NicateGlassAnyFunSig *any_fun_sig, NicateGlassAnyMaybeCompoundStmt *any_maybe_compound_stmt)
+{
+    NicateGlassAst *args[4] = {(NicateGlassAst *)kw_fun, (NicateGlassAst *)atom_id, (NicateGlassAst *)any_fun_sig, (NicateGlassAst *)any_maybe_compound_stmt};
+    assert (nicate_glass_is_kw_fun((NicateGlassAst *)kw_fun));
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_any_fun_sig((NicateGlassAst *)any_fun_sig));
+    assert (nicate_glass_is_any_maybe_compound_stmt((NicateGlassAst *)any_maybe_compound_stmt));
+    return (NicateGlassTreeTagFunStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_FUN_STMT, 4, args);
+}
+NicateGlassTreeTagGeExpr *nicate_glass_create_tree_tag_ge_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymGe *sym_ge, NicateGlassAnyShiftExpr *any_shift_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_shift_expr1, (NicateGlassAst *)sym_ge, (NicateGlassAst *)any_shift_expr2};
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr1));
+    assert (nicate_glass_is_sym_ge((NicateGlassAst *)sym_ge));
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr2));
+    return (NicateGlassTreeTagGeExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_GE_EXPR, 3, args);
+}
+NicateGlassTreeTagGotoStmt *nicate_glass_create_tree_tag_goto_stmt(Pool *pool, NicateGlassKwGoto *kw_goto, NicateGlassAtomId *atom_id, NicateGlassSymSemicolon *sym_semicolon)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)kw_goto, (NicateGlassAst *)atom_id, (NicateGlassAst *)sym_semicolon};
+    assert (nicate_glass_is_kw_goto((NicateGlassAst *)kw_goto));
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_sym_semicolon((NicateGlassAst *)sym_semicolon));
+    return (NicateGlassTreeTagGotoStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_GOTO_STMT, 3, args);
+}
+NicateGlassTreeTagGtExpr *nicate_glass_create_tree_tag_gt_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymGt *sym_gt, NicateGlassAnyShiftExpr *any_shift_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_shift_expr1, (NicateGlassAst *)sym_gt, (NicateGlassAst *)any_shift_expr2};
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr1));
+    assert (nicate_glass_is_sym_gt((NicateGlassAst *)sym_gt));
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr2));
+    return (NicateGlassTreeTagGtExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_GT_EXPR, 3, args);
+}
+NicateGlassTreeTagIfElseStmt *nicate_glass_create_tree_tag_if_else_stmt(Pool *pool, NicateGlassKwIf *kw_if, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassTreeCompoundStmt *tree_compound_stmt, NicateGlassKwElse *kw_else, NicateGlassAnyIfOrCompoundStmt *any_if_or_compound_stmt)
+{
+    NicateGlassAst *args[7] = {(NicateGlassAst *)kw_if, (NicateGlassAst *)sym_lparen, (NicateGlassAst *)alias_expr, (NicateGlassAst *)sym_rparen, (NicateGlassAst *)tree_compound_stmt, (NicateGlassAst *)kw_else, (NicateGlassAst *)any_if_or_compound_stmt};
+    assert (nicate_glass_is_kw_if((NicateGlassAst *)kw_if));
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    assert (nicate_glass_is_tree_compound_stmt((NicateGlassAst *)tree_compound_stmt));
+    assert (nicate_glass_is_kw_else((NicateGlassAst *)kw_else));
+    assert (nicate_glass_is_any_if_or_compound_stmt((NicateGlassAst *)any_if_or_compound_stmt));
+    return (NicateGlassTreeTagIfElseStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_IF_ELSE_STMT, 7, args);
+}
+NicateGlassTreeTagIfStmt *nicate_glass_create_tree_tag_if_stmt(Pool *pool, NicateGlassKwIf *kw_if, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassTreeCompoundStmt *tree_compound_stmt)
+{
+    NicateGlassAst *args[5] = {(NicateGlassAst *)kw_if, (NicateGlassAst *)sym_lparen, (NicateGlassAst *)alias_expr, (NicateGlassAst *)sym_rparen, (NicateGlassAst *)tree_compound_stmt};
+    assert (nicate_glass_is_kw_if((NicateGlassAst *)kw_if));
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    assert (nicate_glass_is_tree_compound_stmt((NicateGlassAst *)tree_compound_stmt));
+    return (NicateGlassTreeTagIfStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_IF_STMT, 5, args);
+}
+NicateGlassTreeTagIndexExpr *nicate_glass_create_tree_tag_index_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymLbracket *sym_lbracket, NicateGlassOptExprList *opt_expr_list, NicateGlassSymRbracket *sym_rbracket)
+{
+    NicateGlassAst *args[4] = {(NicateGlassAst *)any_postfix_expr, (NicateGlassAst *)sym_lbracket, (NicateGlassAst *)opt_expr_list, (NicateGlassAst *)sym_rbracket};
+    assert (nicate_glass_is_any_postfix_expr((NicateGlassAst *)any_postfix_expr));
+    assert (nicate_glass_is_sym_lbracket((NicateGlassAst *)sym_lbracket));
+    assert (nicate_glass_is_opt_expr_list((NicateGlassAst *)opt_expr_list));
+    assert (nicate_glass_is_sym_rbracket((NicateGlassAst *)sym_rbracket));
+    return (NicateGlassTreeTagIndexExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_INDEX_EXPR, 4, args);
+}
+NicateGlassTreeTagInitializedDeclaration *nicate_glass_create_tree_tag_initialized_declaration(Pool *pool, NicateGlassKwLet *kw_let, NicateGlassAnyMaybeTypedId *any_maybe_typed_id, NicateGlassSymBe *sym_be, NicateGlassAliasExpr *alias_expr, NicateGlassSymSemicolon *sym_semicolon)
+{
+    NicateGlassAst *args[5] = {(NicateGlassAst *)kw_let, (NicateGlassAst *)any_maybe_typed_id, (NicateGlassAst *)sym_be, (NicateGlassAst *)alias_expr, (NicateGlassAst *)sym_semicolon};
+    assert (nicate_glass_is_kw_let((NicateGlassAst *)kw_let));
+    assert (nicate_glass_is_any_maybe_typed_id((NicateGlassAst *)any_maybe_typed_id));
+    assert (nicate_glass_is_sym_be((NicateGlassAst *)sym_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    assert (nicate_glass_is_sym_semicolon((NicateGlassAst *)sym_semicolon));
+    return (NicateGlassTreeTagInitializedDeclaration *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_INITIALIZED_DECLARATION, 5, args);
+}
+NicateGlassTreeTagLabeledStmt *nicate_glass_create_tree_tag_labeled_stmt(Pool *pool, NicateGlassAtomId *atom_id, NicateGlassSymColon *sym_colon, NicateGlassAnyStmt *any_stmt)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)atom_id, (NicateGlassAst *)sym_colon, (NicateGlassAst *)any_stmt};
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_sym_colon((NicateGlassAst *)sym_colon));
+    assert (nicate_glass_is_any_stmt((NicateGlassAst *)any_stmt));
+    return (NicateGlassTreeTagLabeledStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_LABELED_STMT, 3, args);
+}
+NicateGlassTreeTagLeExpr *nicate_glass_create_tree_tag_le_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymLe *sym_le, NicateGlassAnyShiftExpr *any_shift_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_shift_expr1, (NicateGlassAst *)sym_le, (NicateGlassAst *)any_shift_expr2};
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr1));
+    assert (nicate_glass_is_sym_le((NicateGlassAst *)sym_le));
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr2));
+    return (NicateGlassTreeTagLeExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_LE_EXPR, 3, args);
+}
+NicateGlassTreeTagLeftShiftAssign *nicate_glass_create_tree_tag_left_shift_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymLshiftBe *sym_lshift_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_lshift_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_lshift_be((NicateGlassAst *)sym_lshift_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagLeftShiftAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_LEFT_SHIFT_ASSIGN, 3, args);
+}
+NicateGlassTreeTagLeftShiftExpr *nicate_glass_create_tree_tag_left_shift_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr, NicateGlassSymLshift *sym_lshift, NicateGlassAnyAddExpr *any_add_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_shift_expr, (NicateGlassAst *)sym_lshift, (NicateGlassAst *)any_add_expr};
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr));
+    assert (nicate_glass_is_sym_lshift((NicateGlassAst *)sym_lshift));
+    assert (nicate_glass_is_any_add_expr((NicateGlassAst *)any_add_expr));
+    return (NicateGlassTreeTagLeftShiftExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_LEFT_SHIFT_EXPR, 3, args);
+}
+NicateGlassTreeTagLogAndExpr *nicate_glass_create_tree_tag_log_and_expr(Pool *pool, NicateGlassAnyLogicalAndExpr *any_logical_and_expr, NicateGlassSymLogicalAnd *sym_logical_and, NicateGlassAnyBitwiseIorExpr *any_bitwise_ior_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_logical_and_expr, (NicateGlassAst *)sym_logical_and, (NicateGlassAst *)any_bitwise_ior_expr};
+    assert (nicate_glass_is_any_logical_and_expr((NicateGlassAst *)any_logical_and_expr));
+    assert (nicate_glass_is_sym_logical_and((NicateGlassAst *)sym_logical_and));
+    assert (nicate_glass_is_any_bitwise_ior_expr((NicateGlassAst *)any_bitwise_ior_expr));
+    return (NicateGlassTreeTagLogAndExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_LOG_AND_EXPR, 3, args);
+}
+NicateGlassTreeTagLogNotExpr *nicate_glass_create_tree_tag_log_not_expr(Pool *pool, NicateGlassSymBang *sym_bang, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)sym_bang, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_sym_bang((NicateGlassAst *)sym_bang));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagLogNotExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_LOG_NOT_EXPR, 2, args);
+}
+NicateGlassTreeTagLogOrExpr *nicate_glass_create_tree_tag_log_or_expr(Pool *pool, NicateGlassAnyLogicalOrExpr *any_logical_or_expr, NicateGlassSymLogicalOr *sym_logical_or, NicateGlassAnyLogicalAndExpr *any_logical_and_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_logical_or_expr, (NicateGlassAst *)sym_logical_or, (NicateGlassAst *)any_logical_and_expr};
+    assert (nicate_glass_is_any_logical_or_expr((NicateGlassAst *)any_logical_or_expr));
+    assert (nicate_glass_is_sym_logical_or((NicateGlassAst *)sym_logical_or));
+    assert (nicate_glass_is_any_logical_and_expr((NicateGlassAst *)any_logical_and_expr));
+    return (NicateGlassTreeTagLogOrExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_LOG_OR_EXPR, 3, args);
+}
+NicateGlassTreeTagLtExpr *nicate_glass_create_tree_tag_lt_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymLt *sym_lt, NicateGlassAnyShiftExpr *any_shift_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_shift_expr1, (NicateGlassAst *)sym_lt, (NicateGlassAst *)any_shift_expr2};
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr1));
+    assert (nicate_glass_is_sym_lt((NicateGlassAst *)sym_lt));
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr2));
+    return (NicateGlassTreeTagLtExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_LT_EXPR, 3, args);
+}
+NicateGlassTreeTagMemberExpr *nicate_glass_create_tree_tag_member_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymDot *sym_dot, NicateGlassAtomId *atom_id)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_postfix_expr, (NicateGlassAst *)sym_dot, (NicateGlassAst *)atom_id};
+    assert (nicate_glass_is_any_postfix_expr((NicateGlassAst *)any_postfix_expr));
+    assert (nicate_glass_is_sym_dot((NicateGlassAst *)sym_dot));
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    return (NicateGlassTreeTagMemberExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_MEMBER_EXPR, 3, args);
+}
+NicateGlassTreeTagMinusAssign *nicate_glass_create_tree_tag_minus_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymMinusBe *sym_minus_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_minus_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_minus_be((NicateGlassAst *)sym_minus_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagMinusAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_MINUS_ASSIGN, 3, args);
+}
+NicateGlassTreeTagMinusExpr *nicate_glass_create_tree_tag_minus_expr(Pool *pool, NicateGlassAnyAddExpr *any_add_expr, NicateGlassSymMinus *sym_minus, NicateGlassAnyMulExpr *any_mul_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_add_expr, (NicateGlassAst *)sym_minus, (NicateGlassAst *)any_mul_expr};
+    assert (nicate_glass_is_any_add_expr((NicateGlassAst *)any_add_expr));
+    assert (nicate_glass_is_sym_minus((NicateGlassAst *)sym_minus));
+    assert (nicate_glass_is_any_mul_expr((NicateGlassAst *)any_mul_expr));
+    return (NicateGlassTreeTagMinusExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_MINUS_EXPR, 3, args);
+}
+NicateGlassTreeTagModuloAssign *nicate_glass_create_tree_tag_modulo_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymPercentBe *sym_percent_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_percent_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_percent_be((NicateGlassAst *)sym_percent_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagModuloAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_MODULO_ASSIGN, 3, args);
+}
+NicateGlassTreeTagModuloExpr *nicate_glass_create_tree_tag_modulo_expr(Pool *pool, NicateGlassAnyMulExpr *any_mul_expr, NicateGlassSymPercent *sym_percent, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_mul_expr, (NicateGlassAst *)sym_percent, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_any_mul_expr((NicateGlassAst *)any_mul_expr));
+    assert (nicate_glass_is_sym_percent((NicateGlassAst *)sym_percent));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagModuloExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_MODULO_EXPR, 3, args);
+}
+NicateGlassTreeTagNeExpr *nicate_glass_create_tree_tag_ne_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymNe *sym_ne, NicateGlassAnyShiftExpr *any_shift_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_shift_expr1, (NicateGlassAst *)sym_ne, (NicateGlassAst *)any_shift_expr2};
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr1));
+    assert (nicate_glass_is_sym_ne((NicateGlassAst *)sym_ne));
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr2));
+    return (NicateGlassTreeTagNeExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_NE_EXPR, 3, args);
+}
+NicateGlassTreeTagParenExpr *nicate_glass_create_tree_tag_paren_expr(Pool *pool, NicateGlassSymLparen *sym_lparen, NicateGlassAnyAssign *any_assign, NicateGlassSymRparen *sym_rparen)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)sym_lparen, (NicateGlassAst *)any_assign, (NicateGlassAst *)sym_rparen};
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_any_assign((NicateGlassAst *)any_assign));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    return (NicateGlassTreeTagParenExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_PAREN_EXPR, 3, args);
+}
+NicateGlassTreeTagPlusAssign *nicate_glass_create_tree_tag_plus_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymPlusBe *sym_plus_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_plus_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_plus_be((NicateGlassAst *)sym_plus_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagPlusAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_PLUS_ASSIGN, 3, args);
+}
+NicateGlassTreeTagPlusExpr *nicate_glass_create_tree_tag_plus_expr(Pool *pool, NicateGlassAnyAddExpr *any_add_expr, NicateGlassSymPlus *sym_plus, NicateGlassAnyMulExpr *any_mul_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_add_expr, (NicateGlassAst *)sym_plus, (NicateGlassAst *)any_mul_expr};
+    assert (nicate_glass_is_any_add_expr((NicateGlassAst *)any_add_expr));
+    assert (nicate_glass_is_sym_plus((NicateGlassAst *)sym_plus));
+    assert (nicate_glass_is_any_mul_expr((NicateGlassAst *)any_mul_expr));
+    return (NicateGlassTreeTagPlusExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_PLUS_EXPR, 3, args);
+}
+NicateGlassTreeTagPostDecrExpr *nicate_glass_create_tree_tag_post_decr_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymDecr *sym_decr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)any_postfix_expr, (NicateGlassAst *)sym_decr};
+    assert (nicate_glass_is_any_postfix_expr((NicateGlassAst *)any_postfix_expr));
+    assert (nicate_glass_is_sym_decr((NicateGlassAst *)sym_decr));
+    return (NicateGlassTreeTagPostDecrExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_POST_DECR_EXPR, 2, args);
+}
+NicateGlassTreeTagPostIncrExpr *nicate_glass_create_tree_tag_post_incr_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymIncr *sym_incr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)any_postfix_expr, (NicateGlassAst *)sym_incr};
+    assert (nicate_glass_is_any_postfix_expr((NicateGlassAst *)any_postfix_expr));
+    assert (nicate_glass_is_sym_incr((NicateGlassAst *)sym_incr));
+    return (NicateGlassTreeTagPostIncrExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_POST_INCR_EXPR, 2, args);
+}
+NicateGlassTreeTagPreDecrExpr *nicate_glass_create_tree_tag_pre_decr_expr(Pool *pool, NicateGlassSymDecr *sym_decr, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)sym_decr, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_sym_decr((NicateGlassAst *)sym_decr));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagPreDecrExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_PRE_DECR_EXPR, 2, args);
+}
+NicateGlassTreeTagPreIncrExpr *nicate_glass_create_tree_tag_pre_incr_expr(Pool *pool, NicateGlassSymIncr *sym_incr, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)sym_incr, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_sym_incr((NicateGlassAst *)sym_incr));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagPreIncrExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_PRE_INCR_EXPR, 2, args);
+}
+NicateGlassTreeTagReturnStmt *nicate_glass_create_tree_tag_return_stmt(Pool *pool, NicateGlassKwReturn *kw_return, NicateGlassOptExpr *opt_expr, NicateGlassSymSemicolon *sym_semicolon)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)kw_return, (NicateGlassAst *)opt_expr, (NicateGlassAst *)sym_semicolon};
+    assert (nicate_glass_is_kw_return((NicateGlassAst *)kw_return));
+    assert (nicate_glass_is_opt_expr((NicateGlassAst *)opt_expr));
+    assert (nicate_glass_is_sym_semicolon((NicateGlassAst *)sym_semicolon));
+    return (NicateGlassTreeTagReturnStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_RETURN_STMT, 3, args);
+}
+NicateGlassTreeTagRightShiftAssign *nicate_glass_create_tree_tag_right_shift_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymRshiftBe *sym_rshift_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_rshift_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_rshift_be((NicateGlassAst *)sym_rshift_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagRightShiftAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_RIGHT_SHIFT_ASSIGN, 3, args);
+}
+NicateGlassTreeTagRightShiftExpr *nicate_glass_create_tree_tag_right_shift_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr, NicateGlassSymRshift *sym_rshift, NicateGlassAnyAddExpr *any_add_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_shift_expr, (NicateGlassAst *)sym_rshift, (NicateGlassAst *)any_add_expr};
+    assert (nicate_glass_is_any_shift_expr((NicateGlassAst *)any_shift_expr));
+    assert (nicate_glass_is_sym_rshift((NicateGlassAst *)sym_rshift));
+    assert (nicate_glass_is_any_add_expr((NicateGlassAst *)any_add_expr));
+    return (NicateGlassTreeTagRightShiftExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_RIGHT_SHIFT_EXPR, 3, args);
+}
+NicateGlassTreeTagSimpleAssign *nicate_glass_create_tree_tag_simple_assign(Pool *pool, NicateGlassAliasExpr *alias_expr, NicateGlassSymBe *sym_be, NicateGlassAnyAssign *any_assign)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr, (NicateGlassAst *)sym_be, (NicateGlassAst *)any_assign};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    assert (nicate_glass_is_sym_be((NicateGlassAst *)sym_be));
+    assert (nicate_glass_is_any_assign((NicateGlassAst *)any_assign));
+    return (NicateGlassTreeTagSimpleAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_SIMPLE_ASSIGN, 3, args);
+}
+NicateGlassTreeTagStructBody *nicate_glass_create_tree_tag_struct_body(Pool *pool, NicateGlassSymLbrace *sym_lbrace, NicateGlassOptTypedIdList *opt_typed_id_list, NicateGlassSymRbrace *sym_rbrace)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)sym_lbrace, (NicateGlassAst *)opt_typed_id_list, (NicateGlassAst *)sym_rbrace};
+    assert (nicate_glass_is_sym_lbrace((NicateGlassAst *)sym_lbrace));
+    assert (nicate_glass_is_opt_typed_id_list((NicateGlassAst *)opt_typed_id_list));
+    assert (nicate_glass_is_sym_rbrace((NicateGlassAst *)sym_rbrace));
+    return (NicateGlassTreeTagStructBody *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_STRUCT_BODY, 3, args);
+}
+NicateGlassTreeTagStructStmt *nicate_glass_create_tree_tag_struct_stmt(Pool *pool, NicateGlassKwStruct *kw_struct, NicateGlassAtomId *atom_id, NicateGlassAnyMaybeStructBody *any_maybe_struct_body)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)kw_struct, (NicateGlassAst *)atom_id, (NicateGlassAst *)any_maybe_struct_body};
+    assert (nicate_glass_is_kw_struct((NicateGlassAst *)kw_struct));
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_any_maybe_struct_body((NicateGlassAst *)any_maybe_struct_body));
+    return (NicateGlassTreeTagStructStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_STRUCT_STMT, 3, args);
+}
+NicateGlassTreeTagSwitchStmt *nicate_glass_create_tree_tag_switch_stmt(Pool *pool, NicateGlassKwSwitch *kw_switch, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassTreeCompoundStmt *tree_compound_stmt)
+{
+    NicateGlassAst *args[5] = {(NicateGlassAst *)kw_switch, (NicateGlassAst *)sym_lparen, (NicateGlassAst *)alias_expr, (NicateGlassAst *)sym_rparen, (NicateGlassAst *)tree_compound_stmt};
+    assert (nicate_glass_is_kw_switch((NicateGlassAst *)kw_switch));
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    assert (nicate_glass_is_tree_compound_stmt((NicateGlassAst *)tree_compound_stmt));
+    return (NicateGlassTreeTagSwitchStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_SWITCH_STMT, 5, args);
+}
+NicateGlassTreeTagTimesAssign *nicate_glass_create_tree_tag_times_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymStarBe *sym_star_be, NicateGlassAliasExpr *alias_expr2)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)alias_expr1, (NicateGlassAst *)sym_star_be, (NicateGlassAst *)alias_expr2};
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr1));
+    assert (nicate_glass_is_sym_star_be((NicateGlassAst *)sym_star_be));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr2));
+    return (NicateGlassTreeTagTimesAssign *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_TIMES_ASSIGN, 3, args);
+}
+NicateGlassTreeTagTimesExpr *nicate_glass_create_tree_tag_times_expr(Pool *pool, NicateGlassAnyMulExpr *any_mul_expr, NicateGlassSymStar *sym_star, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)any_mul_expr, (NicateGlassAst *)sym_star, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_any_mul_expr((NicateGlassAst *)any_mul_expr));
+    assert (nicate_glass_is_sym_star((NicateGlassAst *)sym_star));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagTimesExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_TIMES_EXPR, 3, args);
+}
+NicateGlassTreeTagUnaryMinusExpr *nicate_glass_create_tree_tag_unary_minus_expr(Pool *pool, NicateGlassSymMinus *sym_minus, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)sym_minus, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_sym_minus((NicateGlassAst *)sym_minus));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagUnaryMinusExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_UNARY_MINUS_EXPR, 2, args);
+}
+NicateGlassTreeTagUnaryPlusExpr *nicate_glass_create_tree_tag_unary_plus_expr(Pool *pool, NicateGlassSymPlus *sym_plus, NicateGlassAnyUnaryExpr *any_unary_expr)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)sym_plus, (NicateGlassAst *)any_unary_expr};
+    assert (nicate_glass_is_sym_plus((NicateGlassAst *)sym_plus));
+    assert (nicate_glass_is_any_unary_expr((NicateGlassAst *)any_unary_expr));
+    return (NicateGlassTreeTagUnaryPlusExpr *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_UNARY_PLUS_EXPR, 2, args);
+}
+NicateGlassTreeTagUnionStmt *nicate_glass_create_tree_tag_union_stmt(Pool *pool, NicateGlassKwUnion *kw_union, NicateGlassAtomId *atom_id, NicateGlassAnyMaybeStructBody *any_maybe_struct_body)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)kw_union, (NicateGlassAst *)atom_id, (NicateGlassAst *)any_maybe_struct_body};
+    assert (nicate_glass_is_kw_union((NicateGlassAst *)kw_union));
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_any_maybe_struct_body((NicateGlassAst *)any_maybe_struct_body));
+    return (NicateGlassTreeTagUnionStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_UNION_STMT, 3, args);
+}
+NicateGlassTreeTagUntypedId *nicate_glass_create_tree_tag_untyped_id(Pool *pool, NicateGlassAtomId *atom_id, NicateGlassSymColon *sym_colon)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)atom_id, (NicateGlassAst *)sym_colon};
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_sym_colon((NicateGlassAst *)sym_colon));
+    return (NicateGlassTreeTagUntypedId *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_UNTYPED_ID, 2, args);
+}
+NicateGlassTreeTagVariadicFunSig *nicate_glass_create_tree_tag_variadic_fun_sig(Pool *pool, NicateGlassSymLparen *sym_lparen, NicateGlassTreeTypedIdList *tree_typed_id_list, NicateGlassSymComma *sym_comma, NicateGlassSymEllipsis *sym_ellipsis, NicateGlassSymRparen *sym_rparen, NicateGlassSymArrow *sym_arrow, NicateGlassAliasExpr *alias_expr)
+{
+    NicateGlassAst *args[7] = {(NicateGlassAst *)sym_lparen, (NicateGlassAst *)tree_typed_id_list, (NicateGlassAst *)sym_comma, (NicateGlassAst *)sym_ellipsis, (NicateGlassAst *)sym_rparen, (NicateGlassAst *)sym_arrow, (NicateGlassAst *)alias_expr};
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_tree_typed_id_list((NicateGlassAst *)tree_typed_id_list));
+    assert (nicate_glass_is_sym_comma((NicateGlassAst *)sym_comma));
+    assert (nicate_glass_is_sym_ellipsis((NicateGlassAst *)sym_ellipsis));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    assert (nicate_glass_is_sym_arrow((NicateGlassAst *)sym_arrow));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    return (NicateGlassTreeTagVariadicFunSig *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_VARIADIC_FUN_SIG, 7, args);
+}
+NicateGlassTreeTagWhileStmt *nicate_glass_create_tree_tag_while_stmt(Pool *pool, NicateGlassKwWhile *kw_while, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassTreeCompoundStmt *tree_compound_stmt)
+{
+    NicateGlassAst *args[5] = {(NicateGlassAst *)kw_while, (NicateGlassAst *)sym_lparen, (NicateGlassAst *)alias_expr, (NicateGlassAst *)sym_rparen, (NicateGlassAst *)tree_compound_stmt};
+    assert (nicate_glass_is_kw_while((NicateGlassAst *)kw_while));
+    assert (nicate_glass_is_sym_lparen((NicateGlassAst *)sym_lparen));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    assert (nicate_glass_is_sym_rparen((NicateGlassAst *)sym_rparen));
+    assert (nicate_glass_is_tree_compound_stmt((NicateGlassAst *)tree_compound_stmt));
+    return (NicateGlassTreeTagWhileStmt *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TAG_WHILE_STMT, 5, args);
+}
+NicateGlassTreeTu *nicate_glass_create_tree_tu(Pool *pool, NicateGlassOptTu *opt_tu, NicateGlassAnyStmt *any_stmt)
+{
+    NicateGlassAst *args[2] = {(NicateGlassAst *)opt_tu, (NicateGlassAst *)any_stmt};
+    assert (nicate_glass_is_opt_tu((NicateGlassAst *)opt_tu));
+    assert (nicate_glass_is_any_stmt((NicateGlassAst *)any_stmt));
+    return (NicateGlassTreeTu *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TU, 2, args);
+}
+NicateGlassTreeTypedId *nicate_glass_create_tree_typed_id(Pool *pool, NicateGlassAtomId *atom_id, NicateGlassSymColon *sym_colon, NicateGlassAliasExpr *alias_expr)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)atom_id, (NicateGlassAst *)sym_colon, (NicateGlassAst *)alias_expr};
+    assert (nicate_glass_is_atom_id((NicateGlassAst *)atom_id));
+    assert (nicate_glass_is_sym_colon((NicateGlassAst *)sym_colon));
+    assert (nicate_glass_is_alias_expr((NicateGlassAst *)alias_expr));
+    return (NicateGlassTreeTypedId *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TYPED_ID, 3, args);
+}
+NicateGlassTreeTypedIdList *nicate_glass_create_tree_typed_id_list(Pool *pool, NicateGlassOptTypedIdList *opt_typed_id_list, NicateGlassSlaveComma *slave_comma, NicateGlassTreeTypedId *tree_typed_id)
+{
+    NicateGlassAst *args[3] = {(NicateGlassAst *)opt_typed_id_list, (NicateGlassAst *)slave_comma, (NicateGlassAst *)tree_typed_id};
+    assert (nicate_glass_is_opt_typed_id_list((NicateGlassAst *)opt_typed_id_list));
+    assert (nicate_glass_is_slave_comma((NicateGlassAst *)slave_comma));
+    assert (nicate_glass_is_tree_typed_id((NicateGlassAst *)tree_typed_id));
+    return (NicateGlassTreeTypedIdList *)nicate_glass_create_nonterminal(pool, NICATE_GLASS_TREE_TYPED_ID_LIST, 3, args);
+}
+bool nicate_glass_is_nothing(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_NOTHING;
+}
+bool nicate_glass_is_alias_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_logical_or_expr(ast);
+}
+bool nicate_glass_is_any_add_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_mul_expr(ast) || nicate_glass_is_tree_tag_plus_expr(ast) || nicate_glass_is_tree_tag_minus_expr(ast);
+}
+bool nicate_glass_is_any_assign(NicateGlassAst *ast)
+{
+    return nicate_glass_is_tree_tag_simple_assign(ast) || nicate_glass_is_tree_tag_times_assign(ast) || nicate_glass_is_tree_tag_divide_assign(ast) || nicate_glass_is_tree_tag_modulo_assign(ast) || nicate_glass_is_tree_tag_plus_assign(ast) || nicate_glass_is_tree_tag_minus_assign(ast) || nicate_glass_is_tree_tag_left_shift_assign(ast) || nicate_glass_is_tree_tag_right_shift_assign(ast) || nicate_glass_is_tree_tag_bit_and_assign(ast) || nicate_glass_is_tree_tag_bit_xor_assign(ast) || nicate_glass_is_tree_tag_bit_or_assign(ast) || nicate_glass_is_alias_expr(ast);
+}
+bool nicate_glass_is_any_attr_stmt(NicateGlassAst *ast)
+{
+    return nicate_glass_is_tree_tag_annotated_stmt(ast) || nicate_glass_is_tree_tag_union_stmt(ast) || nicate_glass_is_tree_tag_struct_stmt(ast) || nicate_glass_is_tree_tag_enum_stmt(ast) || nicate_glass_is_tree_tag_fun_stmt(ast) || nicate_glass_is_tree_tag_declaration(ast) || nicate_glass_is_tree_tag_initialized_declaration(ast) || nicate_glass_is_sym_semicolon(ast);
+}
+bool nicate_glass_is_any_bitwise_and_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_cmp_expr(ast) || nicate_glass_is_tree_tag_bit_and_expr(ast);
+}
+bool nicate_glass_is_any_bitwise_ior_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_bitwise_xor_expr(ast) || nicate_glass_is_tree_tag_bit_ior_expr(ast);
+}
+bool nicate_glass_is_any_bitwise_xor_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_bitwise_and_expr(ast) || nicate_glass_is_tree_tag_bit_xor_expr(ast);
+}
+bool nicate_glass_is_any_cmp_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_shift_expr(ast) || nicate_glass_is_tree_tag_lt_expr(ast) || nicate_glass_is_tree_tag_gt_expr(ast) || nicate_glass_is_tree_tag_le_expr(ast) || nicate_glass_is_tree_tag_ge_expr(ast) || nicate_glass_is_tree_tag_eq_expr(ast) || nicate_glass_is_tree_tag_ne_expr(ast);
+}
+bool nicate_glass_is_any_fun_sig(NicateGlassAst *ast)
+{
+    return nicate_glass_is_tree_tag_fixed_fun_sig(ast) || nicate_glass_is_tree_tag_variadic_fun_sig(ast);
+}
+bool nicate_glass_is_any_if_or_compound_stmt(NicateGlassAst *ast)
+{
+    return nicate_glass_is_tree_compound_stmt(ast) || nicate_glass_is_tree_tag_if_stmt(ast) || nicate_glass_is_tree_tag_if_else_stmt(ast);
+}
+bool nicate_glass_is_any_literal(NicateGlassAst *ast)
+{
+    return nicate_glass_is_atom_decimal_floating_literal(ast) || nicate_glass_is_atom_hexadecimal_floating_literal(ast) || nicate_glass_is_atom_decimal_literal(ast) || nicate_glass_is_atom_octal_literal(ast) || nicate_glass_is_atom_hexadecimal_literal(ast) || nicate_glass_is_atom_binary_literal(ast) || nicate_glass_is_atom_character_literal(ast) || nicate_glass_is_atom_string_literal(ast);
+}
+bool nicate_glass_is_any_logical_and_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_bitwise_ior_expr(ast) || nicate_glass_is_tree_tag_log_and_expr(ast);
+}
+bool nicate_glass_is_any_logical_or_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_logical_and_expr(ast) || nicate_glass_is_tree_tag_log_or_expr(ast);
+}
+bool nicate_glass_is_any_maybe_compound_stmt(NicateGlassAst *ast)
+{
+    return nicate_glass_is_sym_semicolon(ast) || nicate_glass_is_tree_compound_stmt(ast);
+}
+bool nicate_glass_is_any_maybe_enum_body(NicateGlassAst *ast)
+{
+    return nicate_glass_is_sym_semicolon(ast) || nicate_glass_is_tree_tag_enum_body(ast);
+}
+bool nicate_glass_is_any_maybe_struct_body(NicateGlassAst *ast)
+{
+    return nicate_glass_is_sym_semicolon(ast) || nicate_glass_is_tree_tag_struct_body(ast);
+}
+bool nicate_glass_is_any_maybe_typed_id(NicateGlassAst *ast)
+{
+    return nicate_glass_is_tree_typed_id(ast) || nicate_glass_is_tree_tag_untyped_id(ast);
+}
+bool nicate_glass_is_any_mul_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_unary_expr(ast) || nicate_glass_is_tree_tag_times_expr(ast) || nicate_glass_is_tree_tag_divide_expr(ast) || nicate_glass_is_tree_tag_modulo_expr(ast);
+}
+bool nicate_glass_is_any_noattr_stmt(NicateGlassAst *ast)
+{
+    return nicate_glass_is_atom_comment(ast) || nicate_glass_is_tree_tag_expr_stmt(ast) || nicate_glass_is_tree_tag_labeled_stmt(ast) || nicate_glass_is_tree_tag_default_stmt(ast) || nicate_glass_is_tree_tag_case_stmt(ast) || nicate_glass_is_tree_tag_while_stmt(ast) || nicate_glass_is_tree_tag_do_stmt(ast) || nicate_glass_is_tree_tag_goto_stmt(ast) || nicate_glass_is_tree_tag_break_stmt(ast) || nicate_glass_is_tree_tag_continue_stmt(ast) || nicate_glass_is_tree_tag_return_stmt(ast) || nicate_glass_is_tree_tag_switch_stmt(ast) || nicate_glass_is_any_if_or_compound_stmt(ast);
+}
+bool nicate_glass_is_any_postfix_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_primary_expr(ast) || nicate_glass_is_tree_tag_index_expr(ast) || nicate_glass_is_tree_tag_call_expr(ast) || nicate_glass_is_tree_tag_member_expr(ast) || nicate_glass_is_tree_tag_post_incr_expr(ast) || nicate_glass_is_tree_tag_post_decr_expr(ast);
+}
+bool nicate_glass_is_any_primary_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_atom_id(ast) || nicate_glass_is_any_literal(ast) || nicate_glass_is_tree_tag_paren_expr(ast) || nicate_glass_is_tree_tag_array_literal(ast);
+}
+bool nicate_glass_is_any_quasipostfix_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_postfix_expr(ast) || nicate_glass_is_tree_tag_attr_expr(ast);
+}
+bool nicate_glass_is_any_shift_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_add_expr(ast) || nicate_glass_is_tree_tag_left_shift_expr(ast) || nicate_glass_is_tree_tag_right_shift_expr(ast);
+}
+bool nicate_glass_is_any_stmt(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_attr_stmt(ast) || nicate_glass_is_any_noattr_stmt(ast);
+}
+bool nicate_glass_is_any_unary_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_quasipostfix_expr(ast) || nicate_glass_is_tree_tag_pre_incr_expr(ast) || nicate_glass_is_tree_tag_pre_decr_expr(ast) || nicate_glass_is_tree_tag_addressof_expr(ast) || nicate_glass_is_tree_tag_unary_plus_expr(ast) || nicate_glass_is_tree_tag_unary_minus_expr(ast) || nicate_glass_is_tree_tag_bit_not_expr(ast) || nicate_glass_is_tree_tag_log_not_expr(ast);
+}
+bool nicate_glass_is_atom_binary_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_BINARY_LITERAL;
+}
+bool nicate_glass_is_atom_character_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_CHARACTER_LITERAL;
+}
+bool nicate_glass_is_atom_comment(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_COMMENT;
+}
+bool nicate_glass_is_atom_decimal_floating_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_DECIMAL_FLOATING_LITERAL;
+}
+bool nicate_glass_is_atom_decimal_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_DECIMAL_LITERAL;
+}
+bool nicate_glass_is_atom_hexadecimal_floating_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_HEXADECIMAL_FLOATING_LITERAL;
+}
+bool nicate_glass_is_atom_hexadecimal_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_HEXADECIMAL_LITERAL;
+}
+bool nicate_glass_is_atom_id(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_ID;
+}
+bool nicate_glass_is_atom_octal_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_OCTAL_LITERAL;
+}
+bool nicate_glass_is_atom_string_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_ATOM_STRING_LITERAL;
+}
+bool nicate_glass_is_kw_break(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_BREAK;
+}
+bool nicate_glass_is_kw_case(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_CASE;
+}
+bool nicate_glass_is_kw_continue(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_CONTINUE;
+}
+bool nicate_glass_is_kw_default(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_DEFAULT;
+}
+bool nicate_glass_is_kw_do(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_DO;
+}
+bool nicate_glass_is_kw_else(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_ELSE;
+}
+bool nicate_glass_is_kw_enum(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_ENUM;
+}
+bool nicate_glass_is_kw_fun(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_FUN;
+}
+bool nicate_glass_is_kw_goto(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_GOTO;
+}
+bool nicate_glass_is_kw_if(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_IF;
+}
+bool nicate_glass_is_kw_let(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_LET;
+}
+bool nicate_glass_is_kw_return(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_RETURN;
+}
+bool nicate_glass_is_kw_struct(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_STRUCT;
+}
+bool nicate_glass_is_kw_switch(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_SWITCH;
+}
+bool nicate_glass_is_kw_union(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_UNION;
+}
+bool nicate_glass_is_kw_while(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_KW_WHILE;
+}
+bool nicate_glass_is_opt_be(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_sym_be(ast);
+}
+bool nicate_glass_is_opt_enum_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_tree_enum_list(ast);
+}
+bool nicate_glass_is_opt_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_alias_expr(ast);
+}
+bool nicate_glass_is_opt_expr_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_tree_expr_list(ast);
+}
+bool nicate_glass_is_opt_lparen(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_sym_lparen(ast);
+}
+bool nicate_glass_is_opt_stmt_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_tree_stmt_list(ast);
+}
+bool nicate_glass_is_opt_tu(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_tree_tu(ast);
+}
+bool nicate_glass_is_opt_typed_id_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_tree_typed_id_list(ast);
+}
+bool nicate_glass_is_slave_comma(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_sym_comma(ast);
+}
+bool nicate_glass_is_slave_expr(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_alias_expr(ast);
+}
+bool nicate_glass_is_slave_expr_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_tree_expr_list(ast);
+}
+bool nicate_glass_is_slave_rparen(NicateGlassAst *ast)
+{
+    return nicate_glass_is_nothing(ast) || nicate_glass_is_sym_rparen(ast);
+}
+bool nicate_glass_is_sym_ampersand(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_AMPERSAND;
+}
+bool nicate_glass_is_sym_ampersand_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_AMPERSAND_BE;
+}
+bool nicate_glass_is_sym_arrow(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_ARROW;
+}
+bool nicate_glass_is_sym_at(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_AT;
+}
+bool nicate_glass_is_sym_bang(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_BANG;
+}
+bool nicate_glass_is_sym_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_BE;
+}
+bool nicate_glass_is_sym_caret(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_CARET;
+}
+bool nicate_glass_is_sym_caret_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_CARET_BE;
+}
+bool nicate_glass_is_sym_colon(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_COLON;
+}
+bool nicate_glass_is_sym_comma(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_COMMA;
+}
+bool nicate_glass_is_sym_decr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_DECR;
+}
+bool nicate_glass_is_sym_dot(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_DOT;
+}
+bool nicate_glass_is_sym_ellipsis(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_ELLIPSIS;
+}
+bool nicate_glass_is_sym_eq(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_EQ;
+}
+bool nicate_glass_is_sym_ge(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_GE;
+}
+bool nicate_glass_is_sym_gt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_GT;
+}
+bool nicate_glass_is_sym_incr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_INCR;
+}
+bool nicate_glass_is_sym_lbrace(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LBRACE;
+}
+bool nicate_glass_is_sym_lbracket(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LBRACKET;
+}
+bool nicate_glass_is_sym_le(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LE;
+}
+bool nicate_glass_is_sym_logical_and(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LOGICAL_AND;
+}
+bool nicate_glass_is_sym_logical_or(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LOGICAL_OR;
+}
+bool nicate_glass_is_sym_lparen(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LPAREN;
+}
+bool nicate_glass_is_sym_lshift(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LSHIFT;
+}
+bool nicate_glass_is_sym_lshift_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LSHIFT_BE;
+}
+bool nicate_glass_is_sym_lt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_LT;
+}
+bool nicate_glass_is_sym_minus(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_MINUS;
+}
+bool nicate_glass_is_sym_minus_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_MINUS_BE;
+}
+bool nicate_glass_is_sym_ne(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_NE;
+}
+bool nicate_glass_is_sym_percent(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_PERCENT;
+}
+bool nicate_glass_is_sym_percent_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_PERCENT_BE;
+}
+bool nicate_glass_is_sym_pipe(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_PIPE;
+}
+bool nicate_glass_is_sym_pipe_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_PIPE_BE;
+}
+bool nicate_glass_is_sym_plus(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_PLUS;
+}
+bool nicate_glass_is_sym_plus_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_PLUS_BE;
+}
+bool nicate_glass_is_sym_rbrace(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_RBRACE;
+}
+bool nicate_glass_is_sym_rbracket(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_RBRACKET;
+}
+bool nicate_glass_is_sym_rparen(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_RPAREN;
+}
+bool nicate_glass_is_sym_rshift(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_RSHIFT;
+}
+bool nicate_glass_is_sym_rshift_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_RSHIFT_BE;
+}
+bool nicate_glass_is_sym_semicolon(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_SEMICOLON;
+}
+bool nicate_glass_is_sym_slash(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_SLASH;
+}
+bool nicate_glass_is_sym_slash_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_SLASH_BE;
+}
+bool nicate_glass_is_sym_star(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_STAR;
+}
+bool nicate_glass_is_sym_star_be(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_STAR_BE;
+}
+bool nicate_glass_is_sym_tilde(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_SYM_TILDE;
+}
+bool nicate_glass_is_tree_attr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_ATTR;
+}
+bool nicate_glass_is_tree_compound_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_COMPOUND_STMT;
+}
+bool nicate_glass_is_tree_enum_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_tree_enumerator(ast) || ast->type == NICATE_GLASS_TREE_ENUM_LIST;
+}
+bool nicate_glass_is_tree_enumerator(NicateGlassAst *ast)
+{
+    return nicate_glass_is_atom_id(ast) || ast->type == NICATE_GLASS_TREE_ENUMERATOR;
+}
+bool nicate_glass_is_tree_expr_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_alias_expr(ast) || ast->type == NICATE_GLASS_TREE_EXPR_LIST;
+}
+bool nicate_glass_is_tree_stmt_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_stmt(ast) || ast->type == NICATE_GLASS_TREE_STMT_LIST;
+}
+bool nicate_glass_is_tree_tag_addressof_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_ADDRESSOF_EXPR;
+}
+bool nicate_glass_is_tree_tag_annotated_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_ANNOTATED_STMT;
+}
+bool nicate_glass_is_tree_tag_array_literal(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_ARRAY_LITERAL;
+}
+bool nicate_glass_is_tree_tag_attr_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_ATTR_EXPR;
+}
+bool nicate_glass_is_tree_tag_bit_and_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_BIT_AND_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_bit_and_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_BIT_AND_EXPR;
+}
+bool nicate_glass_is_tree_tag_bit_ior_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_BIT_IOR_EXPR;
+}
+bool nicate_glass_is_tree_tag_bit_not_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_BIT_NOT_EXPR;
+}
+bool nicate_glass_is_tree_tag_bit_or_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_BIT_OR_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_bit_xor_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_BIT_XOR_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_bit_xor_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_BIT_XOR_EXPR;
+}
+bool nicate_glass_is_tree_tag_break_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_BREAK_STMT;
+}
+bool nicate_glass_is_tree_tag_call_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_CALL_EXPR;
+}
+bool nicate_glass_is_tree_tag_case_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_CASE_STMT;
+}
+bool nicate_glass_is_tree_tag_continue_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_CONTINUE_STMT;
+}
+bool nicate_glass_is_tree_tag_declaration(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_DECLARATION;
+}
+bool nicate_glass_is_tree_tag_default_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_DEFAULT_STMT;
+}
+bool nicate_glass_is_tree_tag_divide_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_DIVIDE_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_divide_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_DIVIDE_EXPR;
+}
+bool nicate_glass_is_tree_tag_do_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_DO_STMT;
+}
+bool nicate_glass_is_tree_tag_enum_body(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_ENUM_BODY;
+}
+bool nicate_glass_is_tree_tag_enum_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_ENUM_STMT;
+}
+bool nicate_glass_is_tree_tag_eq_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_EQ_EXPR;
+}
+bool nicate_glass_is_tree_tag_expr_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_EXPR_STMT;
+}
+bool nicate_glass_is_tree_tag_fixed_fun_sig(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_FIXED_FUN_SIG;
+}
+bool nicate_glass_is_tree_tag_fun_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_FUN_STMT;
+}
+bool nicate_glass_is_tree_tag_ge_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_GE_EXPR;
+}
+bool nicate_glass_is_tree_tag_goto_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_GOTO_STMT;
+}
+bool nicate_glass_is_tree_tag_gt_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_GT_EXPR;
+}
+bool nicate_glass_is_tree_tag_if_else_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_IF_ELSE_STMT;
+}
+bool nicate_glass_is_tree_tag_if_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_IF_STMT;
+}
+bool nicate_glass_is_tree_tag_index_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_INDEX_EXPR;
+}
+bool nicate_glass_is_tree_tag_initialized_declaration(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_INITIALIZED_DECLARATION;
+}
+bool nicate_glass_is_tree_tag_labeled_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_LABELED_STMT;
+}
+bool nicate_glass_is_tree_tag_le_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_LE_EXPR;
+}
+bool nicate_glass_is_tree_tag_left_shift_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_LEFT_SHIFT_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_left_shift_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_LEFT_SHIFT_EXPR;
+}
+bool nicate_glass_is_tree_tag_log_and_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_LOG_AND_EXPR;
+}
+bool nicate_glass_is_tree_tag_log_not_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_LOG_NOT_EXPR;
+}
+bool nicate_glass_is_tree_tag_log_or_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_LOG_OR_EXPR;
+}
+bool nicate_glass_is_tree_tag_lt_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_LT_EXPR;
+}
+bool nicate_glass_is_tree_tag_member_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_MEMBER_EXPR;
+}
+bool nicate_glass_is_tree_tag_minus_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_MINUS_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_minus_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_MINUS_EXPR;
+}
+bool nicate_glass_is_tree_tag_modulo_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_MODULO_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_modulo_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_MODULO_EXPR;
+}
+bool nicate_glass_is_tree_tag_ne_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_NE_EXPR;
+}
+bool nicate_glass_is_tree_tag_paren_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_PAREN_EXPR;
+}
+bool nicate_glass_is_tree_tag_plus_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_PLUS_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_plus_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_PLUS_EXPR;
+}
+bool nicate_glass_is_tree_tag_post_decr_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_POST_DECR_EXPR;
+}
+bool nicate_glass_is_tree_tag_post_incr_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_POST_INCR_EXPR;
+}
+bool nicate_glass_is_tree_tag_pre_decr_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_PRE_DECR_EXPR;
+}
+bool nicate_glass_is_tree_tag_pre_incr_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_PRE_INCR_EXPR;
+}
+bool nicate_glass_is_tree_tag_return_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_RETURN_STMT;
+}
+bool nicate_glass_is_tree_tag_right_shift_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_RIGHT_SHIFT_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_right_shift_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_RIGHT_SHIFT_EXPR;
+}
+bool nicate_glass_is_tree_tag_simple_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_SIMPLE_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_struct_body(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_STRUCT_BODY;
+}
+bool nicate_glass_is_tree_tag_struct_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_STRUCT_STMT;
+}
+bool nicate_glass_is_tree_tag_switch_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_SWITCH_STMT;
+}
+bool nicate_glass_is_tree_tag_times_assign(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_TIMES_ASSIGN;
+}
+bool nicate_glass_is_tree_tag_times_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_TIMES_EXPR;
+}
+bool nicate_glass_is_tree_tag_unary_minus_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_UNARY_MINUS_EXPR;
+}
+bool nicate_glass_is_tree_tag_unary_plus_expr(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_UNARY_PLUS_EXPR;
+}
+bool nicate_glass_is_tree_tag_union_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_UNION_STMT;
+}
+bool nicate_glass_is_tree_tag_untyped_id(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_UNTYPED_ID;
+}
+bool nicate_glass_is_tree_tag_variadic_fun_sig(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_VARIADIC_FUN_SIG;
+}
+bool nicate_glass_is_tree_tag_while_stmt(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TAG_WHILE_STMT;
+}
+bool nicate_glass_is_tree_tu(NicateGlassAst *ast)
+{
+    return nicate_glass_is_any_stmt(ast) || ast->type == NICATE_GLASS_TREE_TU;
+}
+bool nicate_glass_is_tree_typed_id(NicateGlassAst *ast)
+{
+    return ast->type == NICATE_GLASS_TREE_TYPED_ID;
+}
+bool nicate_glass_is_tree_typed_id_list(NicateGlassAst *ast)
+{
+    return nicate_glass_is_tree_typed_id(ast) || ast->type == NICATE_GLASS_TREE_TYPED_ID_LIST;
+}
+typedef struct IndentationInfo IndentationInfo;
+struct IndentationInfo
+{
+    size_t indentation;
+    const char *prev;
+    NicateGlassAstType prev_parent;
+};
+static void nicate_glass_emit_impl_impl(const char *next, NicateGlassAstType next_parent, FILE *fp, IndentationInfo *info)
+{
+    const char *const prev = info->prev;
+    NicateGlassAstType const prev_parent = info->prev_parent;
+    if (!*next)
+        return;
+    if (strcmp(next, "}") == 0)
+        info->indentation--;
+    if (prev)
+    {
+        bool newline = false;
+        bool no_space = false;
+        (void)prev_parent;
+        if (newline)
+        {
+            size_t i;
+            fputc('\n', fp);
+            for (i = 0; i < info->indentation; ++i)
+                fputs("    ", fp);
+        }
+        else if (!no_space)
+            fputc(' ', fp);
+    }
+    if (strcmp(next, "{") == 0)
+        info->indentation++;
+    info->prev = next;
+    info->prev_parent = next_parent;
+    fputs(next, fp);
+}
+static void nicate_glass_emit_impl(NicateGlassAst *ast, NicateGlassAstType parent, FILE *fp, IndentationInfo *info)
+{
+    size_t i;
+    if (ast->num_children == 0)
+    {
+         nicate_glass_emit_impl_impl(ast->raw, parent, fp, info);
+    }
+    for (i = 0; i < ast->num_children; ++i)
+    {
+        nicate_glass_emit_impl(ast->children[i], ast->type, fp, info);
+    }
+}
+void nicate_glass_emit(NicateGlassAst *ast, FILE *fp)
+{
+    IndentationInfo info;
+    memset(&info, 0, sizeof(info));
+    nicate_glass_emit_impl(ast, NICATE_GLASS_NOTHING, fp, &info);
+    fputc('\n', fp);
+}
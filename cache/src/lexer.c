@@ -0,0 +1,1329 @@
+#include "lexer.h"
+/*
+    Copyright © 2015 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mre.h"
+#include "pool.h"
+#include "PMurHash.h"
+#include "simd.h"
+#include "util.h"
+
+
+typedef struct Keyword Keyword;
+typedef struct Keywords Keywords;
+
+struct Keyword
+{
+    /* NULL for an empty slot. */
+    char *text;
+    size_t len;
+    size_t sym;
+    /* The rule that matches the text instead, now that `sym` is gone. */
+    size_t general;
+};
+
+/*
+    Literal rules (such as keywords) that a more general rule (such as
+    identifiers) also matches are left out of the DFA, which would
+    otherwise need states to tell them apart. Instead, each match of the
+    general rule is looked up in a perfect hash of their text.
+
+    The hash picks a bucket, and each bucket has a displacement chosen
+    so that no two keywords share a slot; so a lookup is one hash and
+    one comparison. Shared by a Lexicon and its Tokenizers.
+*/
+struct Keywords
+{
+    size_t refcount;
+    uint32_t seed;
+    /* Powers of 2, less 1. */
+    size_t bucket_mask;
+    size_t slot_mask;
+    uint32_t *disps;
+    Keyword *slots;
+    size_t min_len;
+    size_t max_len;
+    /* Indexed by symbol id: whether any keyword is matched by it. */
+    bool *general;
+};
+
+struct Lexicon
+{
+    char **names;
+    size_t num_names;
+    /* Indexed by symbol id; such tokens are never surfaced. */
+    bool *skip;
+    MreRuntime *runtime;
+    /* NULL if there are none. */
+    Keywords *keywords;
+};
+
+struct Tokenizer
+{
+    MreRuntime *runtime;
+    bool *skip;
+    size_t num_names;
+    Keywords *keywords;
+    /*
+        The input is at `data`, which is usually the owned `buffer`, but
+        may be borrowed from the caller or mapped from a file instead.
+
+        When streaming, `data` is the latest chunk, unless a token began
+        in an earlier one. Then `data` is the buffer, holding just that
+        token's bytes onward, and the unread part of the chunk is kept
+        aside until the buffer has been used up.
+    */
+    const char *data;
+    char *buffer;
+    const char *chunk;
+    size_t chunk_len;
+    void *map;
+    size_t map_len;
+    /* The offset of `data[0]` in the whole input. */
+    size_t buffer_base;
+    size_t buffer_start;
+    size_t buffer_end;
+    size_t buffer_cap;
+    bool finished;
+    /* Whether `data` holds the whole input, from offset 0. */
+    bool whole;
+
+    /* The line of the current token, and the offset that line starts at. */
+    size_t line;
+    size_t line_start;
+    /* The offset of each newline, built by the first `tokenizer_locate`. */
+    size_t *newlines;
+    size_t num_newlines;
+};
+
+
+static size_t keyword_slot(Keywords *kw, uint32_t hash)
+{
+    uint32_t disp = kw->disps[hash & kw->bucket_mask];
+    return ((hash >> 16) + disp * ((hash >> 8) | 1)) & kw->slot_mask;
+}
+
+/*
+    Try to place every keyword with the current seed and sizes, handling
+    the fullest buckets first. Returns false if some bucket would not fit.
+*/
+static bool keywords_place(Keywords *kw, size_t num, Keyword *words, uint32_t *hashes, size_t *next)
+{
+    size_t num_buckets = kw->bucket_mask + 1;
+    size_t num_slots = kw->slot_mask + 1;
+    size_t *heads = (size_t *)malloc(num_buckets * sizeof(size_t));
+    size_t *sizes = (size_t *)calloc(num_buckets, sizeof(size_t));
+    size_t i, j, b, size, max_size = 0;
+    bool ok = true;
+    for (b = 0; b < num_buckets; ++b)
+    {
+        heads[b] = num;
+    }
+    for (i = 0; i < num; ++i)
+    {
+        hashes[i] = PMurHash32(kw->seed, words[i].text, (int)words[i].len);
+        b = hashes[i] & kw->bucket_mask;
+        next[i] = heads[b];
+        heads[b] = i;
+        if (++sizes[b] > max_size)
+        {
+            max_size = sizes[b];
+        }
+    }
+    memset(kw->slots, 0, num_slots * sizeof(Keyword));
+    for (size = max_size; ok && size; --size)
+    {
+        for (b = 0; ok && b < num_buckets; ++b)
+        {
+            if (sizes[b] != size)
+            {
+                continue;
+            }
+            for (kw->disps[b] = 0; kw->disps[b] < 4 * num_slots; kw->disps[b]++)
+            {
+                for (i = heads[b]; i != num; i = next[i])
+                {
+                    Keyword *slot = &kw->slots[keyword_slot(kw, hashes[i])];
+                    if (slot->text)
+                    {
+                        break;
+                    }
+                    *slot = words[i];
+                }
+                if (i == num)
+                {
+                    break;
+                }
+                for (j = heads[b]; j != i; j = next[j])
+                {
+                    memset(&kw->slots[keyword_slot(kw, hashes[j])], 0, sizeof(Keyword));
+                }
+            }
+            ok = kw->disps[b] < 4 * num_slots;
+        }
+    }
+    free(sizes);
+    free(heads);
+    return ok;
+}
+
+/* Takes ownership of the text of the keywords, but not the array. */
+static Keywords *keywords_create(size_t num_names, size_t num, Keyword *words)
+{
+    Keywords *kw = (Keywords *)calloc(1, sizeof(*kw));
+    uint32_t *hashes = (uint32_t *)malloc(num * sizeof(uint32_t));
+    size_t *next = (size_t *)malloc(num * sizeof(size_t));
+    size_t num_slots = 2;
+    size_t i;
+    kw->refcount = 1;
+    kw->general = (bool *)calloc(num_names, sizeof(bool));
+    kw->min_len = (size_t)-1;
+    for (i = 0; i < num; ++i)
+    {
+        kw->general[words[i].general] = true;
+        if (words[i].len < kw->min_len)
+        {
+            kw->min_len = words[i].len;
+        }
+        if (words[i].len > kw->max_len)
+        {
+            kw->max_len = words[i].len;
+        }
+    }
+    while (num_slots < 2 * num)
+    {
+        num_slots *= 2;
+    }
+    while (true)
+    {
+        kw->slot_mask = num_slots - 1;
+        kw->bucket_mask = (num_slots > 4 ? num_slots / 4 : 1) - 1;
+        kw->disps = (uint32_t *)calloc(kw->bucket_mask + 1, sizeof(uint32_t));
+        kw->slots = (Keyword *)calloc(num_slots, sizeof(Keyword));
+        for (kw->seed = 0; kw->seed < 16; kw->seed++)
+        {
+            if (keywords_place(kw, num, words, hashes, next))
+            {
+                free(next);
+                free(hashes);
+                return kw;
+            }
+        }
+        free(kw->slots);
+        free(kw->disps);
+        num_slots *= 2;
+    }
+}
+
+static void keywords_destroy(Keywords *kw)
+{
+    size_t i;
+    if (!kw || __sync_sub_and_fetch(&kw->refcount, 1))
+    {
+        return;
+    }
+    for (i = 0; i <= kw->slot_mask; ++i)
+    {
+        free(kw->slots[i].text);
+    }
+    free(kw->slots);
+    free(kw->disps);
+    free(kw->general);
+    free(kw);
+}
+
+static Keywords *keywords_share(Keywords *kw)
+{
+    if (kw)
+    {
+        __sync_fetch_and_add(&kw->refcount, 1);
+    }
+    return kw;
+}
+
+static size_t keywords_find(Keywords *kw, size_t sym, const char *text, size_t len)
+{
+    Keyword *slot;
+    if (!kw->general[sym] || len < kw->min_len || len > kw->max_len)
+    {
+        return sym;
+    }
+    slot = &kw->slots[keyword_slot(kw, PMurHash32(kw->seed, text, (int)len))];
+    if (slot->text && slot->general == sym && slot->len == len && !memcmp(slot->text, text, len))
+    {
+        return slot->sym;
+    }
+    return sym;
+}
+
+/*
+    Find the literal rules that can be left out of the DFA, and replace
+    them with `nfa_fail` so that the other rules keep their ids.
+
+    A literal can go if an earlier rule matches its text, since then it
+    never wins. It can also go if a later rule that is not a literal
+    matches its text, since then the first such rule will match exactly
+    where the literal would have, and can be told apart by its text.
+*/
+static Keywords *find_keywords(Pool *p, size_t num_symbols, Nfa **nfas)
+{
+    Keywords *rv = NULL;
+    MultiNfa *m;
+    MreRuntime *probe;
+    MreOptions options;
+    Nfa **general = (Nfa **)malloc(num_symbols * sizeof(Nfa *));
+    Keyword *words = (Keyword *)calloc(num_symbols, sizeof(Keyword));
+    size_t num_words = 0;
+    size_t num_literals = 0;
+    size_t i, j;
+    for (i = 0; i < num_symbols; ++i)
+    {
+        size_t len = nfa_literal(nfas[i], NULL);
+        general[i] = nfas[i];
+        if (len)
+        {
+            general[i] = nfa_fail(p);
+            num_literals++;
+        }
+    }
+    if (!num_literals || num_literals == num_symbols)
+    {
+        free(words);
+        free(general);
+        return NULL;
+    }
+
+    m = multi_nfa_create_glushkov();
+    multi_nfa_add_all(m, num_symbols, general);
+    mre_options_init(&options);
+    options.engine = MRE_ENGINE_LAZY_DFA;
+    probe = mre_runtime_create(m, &options);
+    multi_nfa_destroy(m);
+    if (!probe)
+    {
+        /* The general rules are invalid by themselves; let them fail later. */
+        free(words);
+        free(general);
+        return NULL;
+    }
+    for (i = 0; i < num_symbols; ++i)
+    {
+        size_t len = nfa_literal(nfas[i], NULL);
+        char *text;
+        size_t match = 0;
+        if (!len)
+        {
+            continue;
+        }
+        text = (char *)malloc(len);
+        nfa_literal(nfas[i], text);
+        for (j = 0; j < num_words; ++j)
+        {
+            if (words[j].len == len && !memcmp(words[j].text, text, len))
+            {
+                break;
+            }
+        }
+        if (j == num_words)
+        {
+            mre_runtime_reset(probe);
+            if (mre_runtime_scan(probe, text, len) == len && mre_runtime_match_len(probe) == len)
+            {
+                match = mre_runtime_match_id(probe);
+            }
+        }
+        if (j < num_words || (match && match < i + 1))
+        {
+            /* Shadowed by an earlier rule. */
+            nfas[i] = general[i];
+            free(text);
+            continue;
+        }
+        if (!match)
+        {
+            free(text);
+            continue;
+        }
+        nfas[i] = general[i];
+        words[num_words].text = text;
+        words[num_words].len = len;
+        words[num_words].sym = i + 1;
+        words[num_words].general = match;
+        num_words++;
+    }
+    mre_runtime_destroy(probe);
+    if (num_words)
+    {
+        rv = keywords_create(num_symbols + 1, num_words, words);
+    }
+    free(words);
+    free(general);
+    return rv;
+}
+
+/* If `keywords` is not NULL, the keywords are taken out of the rules. */
+static MultiNfa *build_multi_nfa(size_t num_symbols, Symbol *symbols, Keywords **keywords)
+{
+    Pool *p = pool_create();
+    MultiNfa *m = multi_nfa_create_glushkov();
+    Nfa **nfas = (Nfa **)calloc(num_symbols, sizeof(*nfas));
+    size_t i;
+    for (i = 0; i < num_symbols; ++i)
+    {
+        nfas[i] = nfa_parse_regex(p, symbols[i].regex);
+    }
+    if (keywords)
+    {
+        *keywords = find_keywords(p, num_symbols, nfas);
+    }
+    i = multi_nfa_add_all(m, num_symbols, nfas);
+    (void)i;
+    assert (i == 1);
+    free(nfas);
+    pool_destroy(p);
+    return m;
+}
+
+static MreRuntime *build_runtime(size_t num_symbols, Symbol *symbols, const MreOptions *options, Keywords **keywords)
+{
+    MultiNfa *m = build_multi_nfa(num_symbols, symbols, keywords);
+    MreRuntime *rv = mre_runtime_create(m, options);
+    multi_nfa_destroy(m);
+    return rv;
+}
+
+MreSearch *lexicon_search_create(size_t num_symbols, Symbol *symbols, const MreOptions *options)
+{
+    MultiNfa *m = build_multi_nfa(num_symbols, symbols, NULL);
+    MreSearch *rv = mre_search_create(m, options);
+    multi_nfa_destroy(m);
+    return rv;
+}
+
+Lexicon *lexicon_create(size_t num_symbols, Symbol *symbols)
+{
+    return lexicon_create_with_options(num_symbols, symbols, NULL);
+}
+
+Lexicon *lexicon_create_with_options(size_t num_symbols, Symbol *symbols, const MreOptions *options)
+{
+    return lexicon_create_with_skip(num_symbols, symbols, options, 0, NULL);
+}
+
+Lexicon *lexicon_create_with_skip(size_t num_symbols, Symbol *symbols, const MreOptions *options, size_t num_skip, const size_t *skip)
+{
+    size_t i;
+    Lexicon *rv = (Lexicon *)calloc(1, sizeof(*rv));
+    rv->names = (char **)calloc(num_symbols + 1, sizeof(char *));
+    rv->names[0] = (char *)"error";
+    for (i = 1; i <= num_symbols; ++i)
+    {
+        rv->names[i] = strdup(symbols[i - 1].name);
+    }
+    rv->num_names = num_symbols + 1;
+    rv->skip = (bool *)calloc(rv->num_names, sizeof(bool));
+    for (i = 0; i < num_skip; ++i)
+    {
+        assert (0 < skip[i] && skip[i] < rv->num_names);
+        rv->skip[skip[i]] = true;
+    }
+    rv->runtime = build_runtime(num_symbols, symbols, options, &rv->keywords);
+    if (!rv->runtime)
+    {
+        keywords_destroy(rv->keywords);
+        for (i = 1; i <= num_symbols; ++i)
+        {
+            free(rv->names[i]);
+        }
+        free(rv->names);
+        free(rv->skip);
+        free(rv);
+        return NULL;
+    }
+    return rv;
+}
+
+void lexicon_destroy(Lexicon *lex)
+{
+    size_t i;
+    mre_runtime_destroy(lex->runtime);
+    keywords_destroy(lex->keywords);
+    for (i = lex->num_names - 1; i > 0; i--)
+    {
+        free(lex->names[i]);
+    }
+    free(lex->names);
+    free(lex->skip);
+    free(lex);
+}
+
+const char *lexicon_name(Lexicon *lex, size_t idx)
+{
+    return lex->names[idx];
+}
+
+
+Tokenizer *tokenizer_create(Lexicon *lex)
+{
+    Tokenizer *rv = (Tokenizer *)calloc(1, sizeof(*rv));
+    rv->runtime = mre_runtime_clone(lex->runtime);
+    rv->skip = (bool *)memdup(lex->skip, lex->num_names * sizeof(bool));
+    rv->num_names = lex->num_names;
+    rv->keywords = keywords_share(lex->keywords);
+    rv->buffer_cap = 4096;
+    rv->buffer = (char *)calloc(rv->buffer_cap, 1);
+    rv->data = rv->buffer;
+    rv->buffer_start = 0;
+    rv->buffer_end = 0;
+    rv->line = 1;
+    return rv;
+}
+
+Tokenizer *tokenizer_clone(Tokenizer *tok)
+{
+    Tokenizer *rv = (Tokenizer *)calloc(1, sizeof(*rv));
+    rv->runtime = mre_runtime_clone(tok->runtime);
+    rv->skip = (bool *)memdup(tok->skip, tok->num_names * sizeof(bool));
+    rv->num_names = tok->num_names;
+    rv->keywords = keywords_share(tok->keywords);
+    rv->buffer_cap = 4096;
+    rv->buffer = (char *)calloc(rv->buffer_cap, 1);
+    rv->data = rv->buffer;
+    rv->buffer_start = 0;
+    rv->buffer_end = 0;
+    rv->line = 1;
+    return rv;
+}
+
+static void unmap(Tokenizer *tok)
+{
+    if (tok->map)
+    {
+        munmap(tok->map, tok->map_len);
+        tok->map = NULL;
+        tok->map_len = 0;
+    }
+}
+
+void tokenizer_destroy(Tokenizer *tok)
+{
+    unmap(tok);
+    free(tok->buffer);
+    free(tok->newlines);
+    free(tok->skip);
+    keywords_destroy(tok->keywords);
+    mre_runtime_destroy(tok->runtime);
+    free(tok);
+}
+
+static void recap(Tokenizer *tok, size_t len);
+static void uncarry(Tokenizer *tok);
+
+/* Carry over as much of the chunk as the current token needs. */
+static void carry_more(Tokenizer *tok)
+{
+    while (tok->chunk_len && mre_runtime_hopeful(tok->runtime))
+    {
+        size_t n = mre_runtime_scan(tok->runtime, tok->chunk, tok->chunk_len);
+        recap(tok, n);
+        memcpy(tok->buffer + tok->buffer_end, tok->chunk, n);
+        tok->buffer_end += n;
+        tok->chunk += n;
+        tok->chunk_len -= n;
+    }
+}
+
+static void rescan(Tokenizer *tok, size_t from)
+{
+    /*
+        Note: If called from `tokenizer_feed_slice`, it is possible that we
+        have not actually fed all the characters before `from`. However, in
+        this case, `mre_runtime_hopeful` must have returned false.
+    */
+    if (from < tok->buffer_end)
+    {
+        (void)mre_runtime_scan(tok->runtime, tok->data + from, tok->buffer_end - from);
+    }
+    carry_more(tok);
+    if (tok->finished)
+    {
+        mre_runtime_finish(tok->runtime);
+    }
+}
+
+static void advance(Tokenizer *tok)
+{
+    const char *text = tok->data + tok->buffer_start;
+    size_t len = tokenizer_text_len(tok);
+    size_t lines = simd_count_byte(text, len, '\n');
+    if (lines)
+    {
+        size_t last = len;
+        while (text[--last] != '\n')
+        {
+        }
+        tok->line += lines;
+        tok->line_start = tok->buffer_base + tok->buffer_start + last + 1;
+    }
+    tok->buffer_start += len;
+    /*
+        Could jiggle the buffer here, but we probably *don't* want to in
+        the case where they feed us the whole buffer up front, and if being
+        fed incrementally, they will call `tokenize_feed_slice` soon.
+    */
+    uncarry(tok);
+    mre_runtime_reset_at(tok->runtime, tok->buffer_base + tok->buffer_start);
+    rescan(tok, tok->buffer_start);
+}
+
+/* Consume any tokens that the lexicon says to skip. */
+static void skip_tokens(Tokenizer *tok)
+{
+    while (!mre_runtime_hopeful(tok->runtime)
+            && tok->skip[tokenizer_sym(tok)]
+            && tokenizer_text_len(tok))
+    {
+        advance(tok);
+    }
+}
+
+static void refeed(Tokenizer *tok, size_t from)
+{
+    rescan(tok, from);
+    skip_tokens(tok);
+}
+
+void tokenizer_feed(Tokenizer *tok, const char *str)
+{
+    tokenizer_feed_slice(tok, str, strlen(str));
+}
+
+static void recap(Tokenizer *tok, size_t len)
+{
+    if (tok->buffer_start == tok->buffer_end)
+    {
+        tok->buffer_base += tok->buffer_start;
+        tok->buffer_start = 0;
+        tok->buffer_end = 0;
+    }
+    if (tok->buffer_end + len <= tok->buffer_cap)
+    {
+        return;
+    }
+    if (tok->buffer_start)
+    {
+        if (tok->buffer_end - tok->buffer_start + len < tok->buffer_cap)
+        {
+            memmove(tok->buffer, tok->buffer + tok->buffer_start, tok->buffer_end - tok->buffer_start);
+            tok->buffer_base += tok->buffer_start;
+            tok->buffer_end -= tok->buffer_start;
+            tok->buffer_start = 0;
+            return;
+        }
+    }
+
+    {
+        char *new_buffer;
+        size_t new_cap = tok->buffer_cap;
+        size_t min_cap = len + (tok->buffer_end - tok->buffer_start);
+        while (min_cap > new_cap)
+        {
+            new_cap *= 2;
+        }
+        assert (new_cap > tok->buffer_cap);
+        if (!tok->buffer_start)
+        {
+            new_buffer = (char *)realloc(tok->buffer, new_cap);
+        }
+        else
+        {
+            new_buffer = (char *)calloc(new_cap, 1);
+            memcpy(new_buffer, tok->buffer + tok->buffer_start, tok->buffer_end - tok->buffer_start);
+            tok->buffer_base += tok->buffer_start;
+            tok->buffer_end -= tok->buffer_start;
+            tok->buffer_start = 0;
+            free(tok->buffer);
+        }
+        tok->buffer = new_buffer;
+        tok->buffer_cap = new_cap;
+        tok->data = new_buffer;
+        return;
+    }
+}
+
+void tokenizer_feed_slice(Tokenizer *tok, const char *str, size_t len)
+{
+    size_t old_buffer_end;
+    assert (!tok->finished);
+    assert (tok->data == tok->buffer && !tok->chunk_len);
+    recap(tok, len);
+    memcpy(tok->buffer + tok->buffer_end, str, len);
+    old_buffer_end = tok->buffer_end;
+    tok->buffer_end += len;
+    refeed(tok, old_buffer_end);
+}
+
+void tokenizer_feed_char(Tokenizer *tok, char c)
+{
+    tokenizer_feed_slice(tok, &c, 1);
+}
+
+/* Start reading straight from the chunk, if the buffer is used up. */
+static void uncarry(Tokenizer *tok)
+{
+    if (tok->data != tok->buffer || tok->buffer_start != tok->buffer_end || !tok->chunk_len)
+    {
+        return;
+    }
+    tok->buffer_base += tok->buffer_end;
+    tok->data = tok->chunk;
+    tok->buffer_start = 0;
+    tok->buffer_end = tok->chunk_len;
+    tok->chunk = NULL;
+    tok->chunk_len = 0;
+}
+
+void tokenizer_feed_chunk(Tokenizer *tok, const char *str, size_t len)
+{
+    assert (!tok->finished);
+    assert (!tok->map);
+    if (tok->data != tok->buffer)
+    {
+        /* What is left of the old chunk, already scanned, must be kept. */
+        const char *old = tok->data + tok->buffer_start;
+        size_t keep = tok->buffer_end - tok->buffer_start;
+        tok->buffer_base += tok->buffer_start;
+        tok->data = tok->buffer;
+        tok->buffer_start = 0;
+        tok->buffer_end = 0;
+        recap(tok, keep);
+        memcpy(tok->buffer, old, keep);
+        tok->buffer_end = keep;
+    }
+    else if (tok->chunk_len)
+    {
+        /* Not scanned yet; `tokenizer_pop` will do that. */
+        recap(tok, tok->chunk_len);
+        memcpy(tok->buffer + tok->buffer_end, tok->chunk, tok->chunk_len);
+        tok->buffer_end += tok->chunk_len;
+    }
+    tok->chunk = str;
+    tok->chunk_len = len;
+    if (tok->buffer_start == tok->buffer_end)
+    {
+        uncarry(tok);
+        refeed(tok, 0);
+    }
+    else
+    {
+        carry_more(tok);
+        skip_tokens(tok);
+    }
+}
+
+bool tokenizer_ready(Tokenizer *tok)
+{
+    return !mre_runtime_hopeful(tok->runtime);
+}
+
+size_t tokenizer_sym(Tokenizer *tok)
+{
+    size_t sym = mre_runtime_match_id(tok->runtime);
+    if (tok->keywords)
+    {
+        return keywords_find(tok->keywords, sym, tokenizer_text_start(tok), mre_runtime_match_len(tok->runtime));
+    }
+    return sym;
+}
+
+const char *tokenizer_text_start(Tokenizer *tok)
+{
+    return tok->data + tok->buffer_start;
+}
+
+size_t tokenizer_text_len(Tokenizer *tok)
+{
+    if (tok->buffer_start == tok->buffer_end)
+    {
+        return 0;
+    }
+    return mre_runtime_match_len(tok->runtime);
+}
+
+bool tokenizer_group(Tokenizer *tok, size_t group, size_t *start, size_t *len)
+{
+    /* A keyword is its own symbol, with no groups. */
+    if (tokenizer_sym(tok) != mre_runtime_match_id(tok->runtime))
+    {
+        return false;
+    }
+    return mre_runtime_match_group(tok->runtime, group, start, len);
+}
+
+void tokenizer_pop(Tokenizer *tok)
+{
+    advance(tok);
+    skip_tokens(tok);
+}
+
+size_t tokenizer_next_batch(Tokenizer *tok, size_t max, uint32_t *syms, uint32_t *offsets, uint32_t *lens)
+{
+    size_t n = 0;
+    while (n < max && !mre_runtime_hopeful(tok->runtime))
+    {
+        size_t offset = tok->buffer_base + tok->buffer_start;
+        size_t len = tokenizer_text_len(tok);
+        if (offset + len > UINT32_MAX)
+        {
+            break;
+        }
+        syms[n] = tokenizer_sym(tok);
+        offsets[n] = offset;
+        lens[n] = len;
+        n++;
+        if (!len)
+        {
+            break;
+        }
+        tokenizer_pop(tok);
+    }
+    return n;
+}
+
+void tokenizer_finish(Tokenizer *tok)
+{
+    tok->finished = true;
+    mre_runtime_finish(tok->runtime);
+    skip_tokens(tok);
+}
+
+void tokenizer_borrow(Tokenizer *tok, const char *str, size_t len)
+{
+    tokenizer_reset(tok);
+    tok->data = str;
+    tok->buffer_end = len;
+    tok->finished = true;
+    tok->whole = true;
+    refeed(tok, 0);
+}
+
+bool tokenizer_map_file(Tokenizer *tok, const char *path)
+{
+    struct stat st;
+    void *map = NULL;
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        return false;
+    }
+    if (fstat(fd, &st) == -1)
+    {
+        close(fd);
+        return false;
+    }
+    if (st.st_size)
+    {
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+    }
+    close(fd);
+    tokenizer_borrow(tok, map ? (const char *)map : "", st.st_size);
+    tok->map = map;
+    tok->map_len = st.st_size;
+    return true;
+}
+
+void tokenizer_reset(Tokenizer *tok)
+{
+    unmap(tok);
+    tok->data = tok->buffer;
+    tok->chunk = NULL;
+    tok->chunk_len = 0;
+    tok->buffer_base = 0;
+    tok->buffer_start = 0;
+    tok->buffer_end = 0;
+    tok->finished = false;
+    tok->whole = false;
+    tok->line = 1;
+    tok->line_start = 0;
+    free(tok->newlines);
+    tok->newlines = NULL;
+    tok->num_newlines = 0;
+    mre_runtime_reset(tok->runtime);
+}
+
+size_t tokenizer_steps(Tokenizer *tok)
+{
+    return mre_runtime_steps(tok->runtime);
+}
+
+size_t tokenizer_offset(Tokenizer *tok)
+{
+    return tok->buffer_base + tok->buffer_start;
+}
+
+size_t tokenizer_line(Tokenizer *tok)
+{
+    return tok->line;
+}
+
+size_t tokenizer_col(Tokenizer *tok)
+{
+    return tokenizer_offset(tok) - tok->line_start + 1;
+}
+
+void tokenizer_locate(Tokenizer *tok, size_t offset, size_t *line, size_t *col)
+{
+    size_t lo = 0, hi;
+    assert (tok->whole && offset <= tok->buffer_end);
+    if (!tok->newlines)
+    {
+        size_t i, n = simd_count_byte(tok->data, tok->buffer_end, '\n');
+        const char *p = tok->data;
+        tok->newlines = (size_t *)malloc((n + 1) * sizeof(size_t));
+        for (i = 0; i < n; ++i)
+        {
+            p = (const char *)memchr(p, '\n', tok->data + tok->buffer_end - p);
+            tok->newlines[i] = p - tok->data;
+            p++;
+        }
+        tok->num_newlines = n;
+    }
+    /* Find how many newlines come before `offset`. */
+    hi = tok->num_newlines;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (tok->newlines[mid] < offset)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    *line = lo + 1;
+    *col = lo ? offset - tok->newlines[lo - 1] : offset + 1;
+}
+
+
+/* The tokens of a TokenStream, or the new ones for part of it. */
+typedef struct TokenList TokenList;
+struct TokenList
+{
+    size_t num;
+    size_t cap;
+    size_t *syms;
+    size_t *starts;
+    size_t *lens;
+    /*
+        One past the last byte that was read to decide the token, or one
+        past the end of the text if it was read up to the end. Only edits
+        before this can change the token.
+    */
+    size_t *reach;
+    /* The greatest `reach` up to and including each token. */
+    size_t *max_reach;
+};
+
+struct TokenStream
+{
+    Tokenizer *tok;
+    char *text;
+    size_t text_len;
+    size_t text_cap;
+    TokenList tokens;
+    TokenList fresh;
+};
+
+static void token_list_reserve(TokenList *tl, size_t num)
+{
+    if (num <= tl->cap)
+    {
+        return;
+    }
+    while (tl->cap < num)
+    {
+        tl->cap = tl->cap ? tl->cap * 2 : 64;
+    }
+    tl->syms = (size_t *)realloc(tl->syms, tl->cap * sizeof(size_t));
+    tl->starts = (size_t *)realloc(tl->starts, tl->cap * sizeof(size_t));
+    tl->lens = (size_t *)realloc(tl->lens, tl->cap * sizeof(size_t));
+    tl->reach = (size_t *)realloc(tl->reach, tl->cap * sizeof(size_t));
+    tl->max_reach = (size_t *)realloc(tl->max_reach, tl->cap * sizeof(size_t));
+}
+
+static void token_list_free(TokenList *tl)
+{
+    free(tl->max_reach);
+    free(tl->reach);
+    free(tl->lens);
+    free(tl->starts);
+    free(tl->syms);
+}
+
+static void token_list_push(TokenList *tl, size_t sym, size_t start, size_t len, size_t reach)
+{
+    token_list_reserve(tl, tl->num + 1);
+    tl->syms[tl->num] = sym;
+    tl->starts[tl->num] = start;
+    tl->lens[tl->num] = len;
+    tl->reach[tl->num] = reach;
+    tl->num++;
+}
+
+TokenStream *token_stream_create(Lexicon *lex)
+{
+    TokenStream *rv = (TokenStream *)calloc(1, sizeof(*rv));
+    rv->tok = tokenizer_create(lex);
+    /* Skipped tokens are still restart points, so keep them all. */
+    memset(rv->tok->skip, 0, rv->tok->num_names * sizeof(bool));
+    rv->text_cap = 64;
+    rv->text = (char *)malloc(rv->text_cap);
+    token_list_reserve(&rv->tokens, 1);
+    token_list_reserve(&rv->fresh, 1);
+    return rv;
+}
+
+void token_stream_destroy(TokenStream *ts)
+{
+    token_list_free(&ts->fresh);
+    token_list_free(&ts->tokens);
+    free(ts->text);
+    tokenizer_destroy(ts->tok);
+    free(ts);
+}
+
+/*
+    Lex from `start` into `out`, until a token starts at or after `end`,
+    or, at or after `sync_from`, where a token of `sync` (if not NULL)
+    starts less `shift`, looking from index `*j` on. Returns where that
+    token starts.
+*/
+static size_t lex_span(Tokenizer *tok, const char *text, size_t text_len, size_t start, size_t end,
+        TokenList *out, const TokenList *sync, size_t sync_from, size_t shift, size_t *j)
+{
+    size_t base = start;
+    size_t steps = tokenizer_steps(tok);
+    tokenizer_borrow(tok, text + base, text_len - base);
+    while (true)
+    {
+        size_t q = base + tokenizer_offset(tok);
+        size_t len = tokenizer_text_len(tok);
+        size_t reach = q + (tokenizer_steps(tok) - steps);
+        if (q >= end)
+        {
+            return q;
+        }
+        if (sync && q >= sync_from)
+        {
+            /* Unsigned wraparound makes a negative shift work too. */
+            size_t sync_q = q - shift;
+            while (*j < sync->num && sync->starts[*j] < sync_q)
+            {
+                ++*j;
+            }
+            if (*j < sync->num && sync->starts[*j] == sync_q)
+            {
+                return q;
+            }
+        }
+        if (reach >= text_len)
+        {
+            reach = text_len + 1;
+        }
+        steps = tokenizer_steps(tok);
+        if (!len)
+        {
+            token_list_push(out, 0, q, 1, reach);
+            base = q + 1;
+            tokenizer_borrow(tok, text + base, text_len - base);
+            continue;
+        }
+        token_list_push(out, tokenizer_sym(tok), q, len, reach);
+        tokenizer_pop(tok);
+    }
+}
+
+/*
+    Lex into `ts->fresh` from `start`, stopping at the first token that
+    starts at or after `sync_from` where an old token starts after the
+    edit; old offsets are new ones less `ins_len` plus `del_len`.
+
+    Returns the index of that old token, or the number of old tokens if
+    the end of the text was reached first.
+*/
+static size_t token_stream_lex(TokenStream *ts, size_t start, size_t old_from, size_t sync_from, size_t ins_len, size_t del_len)
+{
+    size_t j = old_from;
+    size_t q;
+    ts->fresh.num = 0;
+    q = lex_span(ts->tok, ts->text, ts->text_len, start, ts->text_len, &ts->fresh, &ts->tokens, sync_from, ins_len - del_len, &j);
+    /* No old token starts at the end, so that is never a match. */
+    return q == ts->text_len ? ts->tokens.num : j;
+}
+
+/* Replace old tokens `[first, last)` with the fresh ones. */
+static void token_stream_splice(TokenStream *ts, size_t first, size_t last, size_t ins_len, size_t del_len)
+{
+    TokenList *tl = &ts->tokens;
+    TokenList *fresh = &ts->fresh;
+    size_t tail = tl->num - last;
+    size_t num = first + fresh->num + tail;
+    size_t i;
+    token_list_reserve(tl, num);
+    memmove(tl->syms + first + fresh->num, tl->syms + last, tail * sizeof(size_t));
+    memmove(tl->starts + first + fresh->num, tl->starts + last, tail * sizeof(size_t));
+    memmove(tl->lens + first + fresh->num, tl->lens + last, tail * sizeof(size_t));
+    memmove(tl->reach + first + fresh->num, tl->reach + last, tail * sizeof(size_t));
+    memcpy(tl->syms + first, fresh->syms, fresh->num * sizeof(size_t));
+    memcpy(tl->starts + first, fresh->starts, fresh->num * sizeof(size_t));
+    memcpy(tl->lens + first, fresh->lens, fresh->num * sizeof(size_t));
+    memcpy(tl->reach + first, fresh->reach, fresh->num * sizeof(size_t));
+    tl->num = num;
+    for (i = first + fresh->num; i < num; ++i)
+    {
+        tl->starts[i] = tl->starts[i] + ins_len - del_len;
+        tl->reach[i] = tl->reach[i] + ins_len - del_len;
+    }
+    for (i = first; i < num; ++i)
+    {
+        size_t prev = i ? tl->max_reach[i - 1] : 0;
+        tl->max_reach[i] = tl->reach[i] > prev ? tl->reach[i] : prev;
+    }
+}
+
+static void token_list_append(TokenList *tl, const TokenList *from, size_t first)
+{
+    size_t n = from->num - first;
+    token_list_reserve(tl, tl->num + n);
+    memcpy(tl->syms + tl->num, from->syms + first, n * sizeof(size_t));
+    memcpy(tl->starts + tl->num, from->starts + first, n * sizeof(size_t));
+    memcpy(tl->lens + tl->num, from->lens + first, n * sizeof(size_t));
+    memcpy(tl->reach + tl->num, from->reach + first, n * sizeof(size_t));
+    tl->num += n;
+}
+
+static void token_stream_reserve_text(TokenStream *ts, size_t len)
+{
+    if (len > ts->text_cap)
+    {
+        while (len > ts->text_cap)
+        {
+            ts->text_cap *= 2;
+        }
+        ts->text = (char *)realloc(ts->text, ts->text_cap);
+    }
+}
+
+/* Below this, a chunk is not worth a thread. */
+#define TOKEN_CHUNK_MIN 4096
+
+/*
+    A part of the text, lexed as if a token started at `start`, until
+    the first token at or after `end`, which starts at `next`.
+*/
+typedef struct TokenChunk TokenChunk;
+struct TokenChunk
+{
+    TokenStream *ts;
+    Tokenizer *tok;
+    size_t start;
+    size_t end;
+    size_t next;
+    TokenList tokens;
+};
+
+static void *token_chunk_work(void *arg)
+{
+    TokenChunk *c = (TokenChunk *)arg;
+    c->next = lex_span(c->tok, c->ts->text, c->ts->text_len, c->start, c->end, &c->tokens, NULL, 0, 0, NULL);
+    return NULL;
+}
+
+void token_stream_set_parallel(TokenStream *ts, const char *text, size_t len, size_t num_threads)
+{
+    TokenChunk chunks[MRE_MAX_THREADS];
+    pthread_t threads[MRE_MAX_THREADS];
+    bool started[MRE_MAX_THREADS];
+    TokenList *out = &ts->fresh;
+    TokenList tmp;
+    size_t num_chunks = num_threads;
+    size_t i, p;
+    if (num_chunks > MRE_MAX_THREADS)
+    {
+        num_chunks = MRE_MAX_THREADS;
+    }
+    if (num_chunks > len / TOKEN_CHUNK_MIN)
+    {
+        num_chunks = len / TOKEN_CHUNK_MIN;
+    }
+    if (num_chunks < 2)
+    {
+        token_stream_set(ts, text, len);
+        return;
+    }
+    token_stream_reserve_text(ts, len);
+    memcpy(ts->text, text, len);
+    ts->text_len = len;
+
+    /* The calling thread lexes the first chunk, straight into `out`. */
+    memset(chunks, 0, num_chunks * sizeof(TokenChunk));
+    for (i = 0; i < num_chunks; ++i)
+    {
+        TokenChunk *c = &chunks[i];
+        c->ts = ts;
+        c->tok = i ? tokenizer_clone(ts->tok) : ts->tok;
+        c->start = len / num_chunks * i;
+        c->end = i + 1 < num_chunks ? len / num_chunks * (i + 1) : len;
+        token_list_reserve(&c->tokens, 1);
+        started[i] = i && !pthread_create(&threads[i], NULL, token_chunk_work, c);
+    }
+    out->num = 0;
+    p = lex_span(ts->tok, ts->text, len, 0, chunks[0].end, out, NULL, 0, 0, NULL);
+
+    /*
+        Each chunk after the first is right from the first of its tokens
+        that starts where a token really does; until then, lex again.
+    */
+    for (i = 1; i < num_chunks; ++i)
+    {
+        TokenChunk *c = &chunks[i];
+        size_t j = 0;
+        if (started[i])
+        {
+            pthread_join(threads[i], NULL);
+        }
+        else
+        {
+            token_chunk_work(c);
+        }
+        if (p < c->end)
+        {
+            p = lex_span(ts->tok, ts->text, len, p, c->end, out, &c->tokens, 0, 0, &j);
+            if (p < c->end)
+            {
+                token_list_append(out, &c->tokens, j);
+                p = c->next;
+            }
+        }
+        tokenizer_destroy(c->tok);
+        token_list_free(&c->tokens);
+    }
+    assert (p == len);
+
+    tmp = ts->tokens;
+    ts->tokens = *out;
+    *out = tmp;
+    out->num = 0;
+    for (i = 0; i < ts->tokens.num; ++i)
+    {
+        size_t prev = i ? ts->tokens.max_reach[i - 1] : 0;
+        ts->tokens.max_reach[i] = ts->tokens.reach[i] > prev ? ts->tokens.reach[i] : prev;
+    }
+}
+
+void token_stream_set(TokenStream *ts, const char *text, size_t len)
+{
+    size_t first, num_removed, num_added;
+    token_stream_edit(ts, 0, ts->text_len, text, len, &first, &num_removed, &num_added);
+}
+
+void token_stream_edit(TokenStream *ts, size_t offset, size_t del_len, const char *ins, size_t ins_len,
+        size_t *first, size_t *num_removed, size_t *num_added)
+{
+    TokenList *tl = &ts->tokens;
+    size_t lo = 0, hi = tl->num;
+    size_t last;
+    assert (offset + del_len <= ts->text_len);
+
+    token_stream_reserve_text(ts, ts->text_len - del_len + ins_len);
+    memmove(ts->text + offset + ins_len, ts->text + offset + del_len, ts->text_len - offset - del_len);
+    memcpy(ts->text + offset, ins, ins_len);
+    ts->text_len = ts->text_len - del_len + ins_len;
+
+    /* The first token whose lookahead reached the edit. */
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (tl->max_reach[mid] > offset)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+    *first = lo;
+    last = token_stream_lex(ts, lo < tl->num ? tl->starts[lo] : offset, lo, offset + ins_len, ins_len, del_len);
+    *num_removed = last - lo;
+    *num_added = ts->fresh.num;
+    token_stream_splice(ts, lo, last, ins_len, del_len);
+}
+
+const char *token_stream_text(TokenStream *ts)
+{
+    return ts->text;
+}
+
+size_t token_stream_text_len(TokenStream *ts)
+{
+    return ts->text_len;
+}
+
+size_t token_stream_size(TokenStream *ts)
+{
+    return ts->tokens.num;
+}
+
+size_t token_stream_sym(TokenStream *ts, size_t idx)
+{
+    return ts->tokens.syms[idx];
+}
+
+size_t token_stream_offset(TokenStream *ts, size_t idx)
+{
+    return ts->tokens.starts[idx];
+}
+
+size_t token_stream_len(TokenStream *ts, size_t idx)
+{
+    return ts->tokens.lens[idx];
+}
+
+size_t token_stream_steps(TokenStream *ts)
+{
+    return tokenizer_steps(ts->tok);
+}
@@ -0,0 +1,336 @@
+#include "mre_internal.h"
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitset.h"
+
+
+#define WORD_BITS (sizeof(size_t) * 8)
+
+
+static void set_bit(size_t *set, size_t i)
+{
+    set[i / WORD_BITS] |= (size_t)1 << (i % WORD_BITS);
+}
+
+/* The only member of `set`, or `num_words * WORD_BITS` if not just one. */
+static size_t only_bit(const size_t *set, size_t num_words)
+{
+    size_t rv = num_words * WORD_BITS;
+    size_t w;
+    for (w = 0; w < num_words; ++w)
+    {
+        if (!set[w])
+        {
+            continue;
+        }
+        if (rv != num_words * WORD_BITS || (set[w] & (set[w] - 1)))
+        {
+            return num_words * WORD_BITS;
+        }
+        rv = w * WORD_BITS + __builtin_ctzl(set[w]);
+    }
+    return rv;
+}
+
+/* Add the positions of the edges of every state in `states` to `set`. */
+static void add_positions(NfaGraph *g, const size_t *edge_pos, BitSet *states, size_t *set)
+{
+    size_t s, e;
+    for (s = bitset_find_next(states, 0); s < g->num_states; s = bitset_find_next(states, s + 1))
+    {
+        for (e = g->char_start[s]; e != g->char_start[s + 1]; ++e)
+        {
+            set_bit(set, edge_pos[e]);
+        }
+    }
+}
+
+/* Fill in the tables of `b`, once its positions are numbered. */
+static void fill_positions(NfaGraph *g, MreBitNfa *b, const size_t *targets, CharBitSet *labels, const size_t *edge_pos)
+{
+    size_t p;
+    b->start = (size_t *)calloc(b->num_words, sizeof(size_t));
+    b->moves = (size_t *)calloc(g->num_classes * b->num_words, sizeof(size_t));
+    b->follows = (size_t *)calloc(b->num_positions * b->num_words + 1, sizeof(size_t));
+    b->accepts = (size_t *)calloc(b->num_positions + 1, sizeof(size_t));
+    b->shifts = (size_t *)calloc(b->num_words, sizeof(size_t));
+    b->finals = (size_t *)calloc(b->num_words, sizeof(size_t));
+    for (p = 0; p < b->num_positions; ++p)
+    {
+        size_t c;
+        BitSet *closure = nfa_graph_closure(g, targets[p]);
+        for (c = 0; c < g->num_classes; ++c)
+        {
+            if (char_bitset_test(&labels[p], c))
+            {
+                set_bit(&b->moves[c * b->num_words], p);
+            }
+        }
+        add_positions(g, edge_pos, closure, &b->follows[p * b->num_words]);
+        b->accepts[p] = nfa_graph_accept(g, closure);
+        if (b->accepts[p])
+        {
+            set_bit(b->finals, p);
+        }
+        if (only_bit(&b->follows[p * b->num_words], b->num_words) == p + 1)
+        {
+            set_bit(b->shifts, p);
+        }
+    }
+    add_positions(g, edge_pos, nfa_graph_closure(g, 0), b->start);
+}
+
+static void free_positions(MreBitNfa *b)
+{
+    free(b->finals);
+    free(b->shifts);
+    free(b->accepts);
+    free(b->follows);
+    free(b->moves);
+    free(b->start);
+}
+
+/*
+    Renumber the positions of `b` so that as many as possible of those
+    with a single follow are just before it, making runs of literals
+    into runs of positions. Returns the new number of each position.
+*/
+static size_t *order_chains(MreBitNfa *b)
+{
+    const size_t n = b->num_positions;
+    const size_t none = b->num_words * WORD_BITS;
+    size_t *next = (size_t *)malloc((n + 1) * sizeof(size_t));
+    bool *has_prev = (bool *)calloc(n + 1, sizeof(bool));
+    size_t *order = (size_t *)malloc((n + 1) * sizeof(size_t));
+    size_t p, q, k = 0;
+    for (p = 0; p < n; ++p)
+    {
+        order[p] = none;
+        next[p] = only_bit(&b->follows[p * b->num_words], b->num_words);
+        if (next[p] == p || (next[p] != none && has_prev[next[p]]))
+        {
+            next[p] = none;
+        }
+        if (next[p] != none)
+        {
+            has_prev[next[p]] = true;
+        }
+    }
+    /* Each chain from its head; what is left over is cycles. */
+    for (p = 0; p < n; ++p)
+    {
+        if (has_prev[p])
+        {
+            continue;
+        }
+        for (q = p; q != none && order[q] == none; q = next[q])
+        {
+            order[q] = k++;
+        }
+    }
+    for (p = 0; p < n; ++p)
+    {
+        for (q = p; q != none && order[q] == none; q = next[q])
+        {
+            order[q] = k++;
+        }
+    }
+    free(has_prev);
+    free(next);
+    return order;
+}
+
+MreRules *multi_nfa_to_bits(MultiNfa *m, size_t max_bytes)
+{
+    MreRules *rv;
+    MreBitNfa *b;
+    NfaGraph *g = nfa_graph_create(m);
+    const size_t n = g->num_states;
+    const size_t num_edges = g->char_start[n];
+    size_t *edge_pos;
+    size_t *targets;
+    CharBitSet *labels;
+    size_t *same_target;
+    size_t *heads;
+    size_t s, e, f, p;
+
+    /* The same restrictions as the lazy engine. */
+    if (!g->num_accept || nfa_graph_accept(g, nfa_graph_closure(g, 0)))
+    {
+        nfa_graph_destroy(g);
+        return NULL;
+    }
+    rv = (MreRules *)calloc(1, sizeof(*rv));
+    b = (MreBitNfa *)calloc(1, sizeof(*b));
+    edge_pos = (size_t *)calloc(num_edges + 1, sizeof(size_t));
+    targets = (size_t *)calloc(num_edges + 1, sizeof(size_t));
+    labels = (CharBitSet *)calloc(num_edges + 1, sizeof(CharBitSet));
+    same_target = (size_t *)calloc(num_edges + 1, sizeof(size_t));
+    heads = (size_t *)malloc(n * sizeof(size_t));
+    rv->refcount = 1;
+
+    /*
+        A position for each distinct target and label, where the label of
+        an edge is the classes of all the edges from its state to that
+        target. Edges with the same position are interchangeable, since
+        what comes after only depends on the target. For an NFA from
+        `multi_nfa_create_glushkov` there is one position per state.
+    */
+    for (s = 0; s < n; ++s)
+    {
+        heads[s] = num_edges;
+    }
+    for (s = 0; s < n; ++s)
+    {
+        for (e = g->char_start[s]; e != g->char_start[s + 1]; ++e)
+        {
+            size_t t = g->char_to[e];
+            CharBitSet label;
+            for (f = g->char_start[s]; g->char_to[f] != t; ++f)
+            {
+            }
+            if (f != e)
+            {
+                edge_pos[e] = edge_pos[f];
+                continue;
+            }
+            char_bitset_erase(&label);
+            for (; f != g->char_start[s + 1]; ++f)
+            {
+                if (g->char_to[f] == t)
+                {
+                    char_bitset_set(&label, g->char_class[f]);
+                }
+            }
+            for (p = heads[t]; p != num_edges && memcmp(&labels[p], &label, sizeof(label)); p = same_target[p])
+            {
+            }
+            if (p == num_edges)
+            {
+                p = b->num_positions++;
+                targets[p] = t;
+                labels[p] = label;
+                same_target[p] = heads[t];
+                heads[t] = p;
+            }
+            edge_pos[e] = p;
+        }
+    }
+    b->num_words = (b->num_positions + WORD_BITS - 1) / WORD_BITS;
+    if (!b->num_words)
+    {
+        b->num_words = 1;
+    }
+    rv->num_classes = g->num_classes;
+    memcpy(rv->classes, g->classes, sizeof(rv->classes));
+    rv->bits = b;
+    if (max_bytes && b->num_positions * b->num_words * sizeof(size_t) > max_bytes)
+    {
+        /* The follows table is the only part that grows quadratically. */
+        free(rv);
+        free(b);
+        rv = NULL;
+    }
+    else
+    {
+        size_t *order;
+        size_t *new_targets = (size_t *)calloc(b->num_positions + 1, sizeof(size_t));
+        CharBitSet *new_labels = (CharBitSet *)calloc(b->num_positions + 1, sizeof(CharBitSet));
+        fill_positions(g, b, targets, labels, edge_pos);
+        order = order_chains(b);
+        free_positions(b);
+        for (p = 0; p < b->num_positions; ++p)
+        {
+            new_targets[order[p]] = targets[p];
+            new_labels[order[p]] = labels[p];
+        }
+        for (e = 0; e < num_edges; ++e)
+        {
+            edge_pos[e] = order[edge_pos[e]];
+        }
+        fill_positions(g, b, new_targets, new_labels, edge_pos);
+        free(new_labels);
+        free(new_targets);
+        free(order);
+    }
+    free(heads);
+    free(same_target);
+    free(labels);
+    free(targets);
+    free(edge_pos);
+    nfa_graph_destroy(g);
+    return rv;
+}
+
+void bit_nfa_destroy(MreBitNfa *b)
+{
+    free_positions(b);
+    free(b);
+}
+
+bool bit_nfa_step(MreBitNfa *b, const size_t *cur, size_t ci, size_t *next, size_t *accept)
+{
+    const size_t num_words = b->num_words;
+    const size_t *moves = &b->moves[ci * num_words];
+    size_t rv = 0;
+    size_t carry = 0;
+    size_t any = 0;
+    size_t w, i;
+    /* Positions that only lead to the next one move all at once. */
+    for (w = 0; w < num_words; ++w)
+    {
+        size_t bits = cur[w] & moves[w] & b->shifts[w];
+        next[w] = (bits << 1) | carry;
+        carry = bits >> (WORD_BITS - 1);
+    }
+    for (w = 0; w < num_words; ++w)
+    {
+        size_t fired = cur[w] & moves[w];
+        size_t bits = fired & ~b->shifts[w];
+        size_t finals = fired & b->finals[w];
+        while (bits)
+        {
+            const size_t *follow = &b->follows[(w * WORD_BITS + __builtin_ctzl(bits)) * num_words];
+            bits &= bits - 1;
+            for (i = 0; i < num_words; ++i)
+            {
+                next[i] |= follow[i];
+            }
+        }
+        while (finals)
+        {
+            size_t a = b->accepts[w * WORD_BITS + __builtin_ctzl(finals)];
+            finals &= finals - 1;
+            if (!rv || a < rv)
+            {
+                rv = a;
+            }
+        }
+    }
+    *accept = rv;
+    for (w = 0; w < num_words; ++w)
+    {
+        any |= next[w];
+    }
+    return any != 0;
+}
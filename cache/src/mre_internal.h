@@ -0,0 +1,340 @@
+#pragma once
+/*
+    Copyright © 2015 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "fwd.h"
+
+
+typedef struct MreState MreState;
+typedef struct MreDfa MreDfa;
+typedef struct MreRules MreRules;
+typedef struct MreAccel MreAccel;
+typedef struct NfaGraph NfaGraph;
+typedef struct StateMap StateMap;
+typedef struct MreLazyCache MreLazyCache;
+typedef struct MreBitNfa MreBitNfa;
+typedef struct MreTagOp MreTagOp;
+typedef struct MreTags MreTags;
+typedef struct MreTagBuilder MreTagBuilder;
+typedef struct NfaLiterals NfaLiterals;
+
+/*
+    It is illegal to construct a state table:
+      - that accepts the empty string, or
+      - that does not accept anything.
+
+    Gotos are indexed by byte class, not by byte.
+*/
+struct MreState
+{
+    size_t accept;
+    unsigned char first_goto, last_goto;
+    size_t *some_gotos;
+};
+
+/* The DFA as built, before it is compiled into MreRules. */
+struct MreDfa
+{
+    /* Maps each byte to its equivalence class. */
+    unsigned char classes[256];
+    size_t num_classes;
+    size_t num_states;
+    MreState *states;
+    /* Only if some rule has groups, in which case it is not minimized. */
+    MreTags *tags;
+};
+
+/*
+    Capture tags, Laurikari style. Each NFA state of a rule with groups
+    has a register for each tag of the rule (its groups' starts and ends,
+    in order), holding the offset at which the tag was last passed on
+    the way to that state.
+
+    So each DFA transition copies the registers of each of its new NFA
+    states from those of the one old state it is taken to come from,
+    except for tags passed on the way, which get the offset after the
+    byte. Of the old states that could lead to a new one, the lowest is
+    chosen, which is only a tie break: if a token can be split between
+    groups in more than one way, which one is reported is unspecified.
+
+    An op sets register `dst` to `src`, or to the current offset if that
+    is MRE_TAG_NOW, or to MRE_TAG_UNSET. If `src` is also written by the
+    same transition, its old value is saved to `saved` first.
+*/
+#define MRE_TAG_NOW ((size_t)-1)
+#define MRE_TAG_UNSET ((size_t)-2)
+struct MreTagOp
+{
+    size_t dst;
+    size_t src;
+    size_t saved;
+};
+struct MreTags
+{
+    size_t num_regs;
+    size_t num_saved;
+    /* From rule 1: how many groups, and the registers of its accept. */
+    size_t num_rules;
+    size_t *groups;
+    size_t *accept_regs;
+    /*
+        The ops of state `s` on class `c` are from `op_start[s * k + c]`
+        up to the next one, where `k` is the number of classes. Those
+        from `op_start[k * num_states]` to `num_ops` set up the start.
+    */
+    size_t *op_start;
+    MreTagOp *ops;
+    size_t num_ops;
+};
+
+
+/*
+    A state that goes back to itself on every byte in a few ranges, so
+    runs of those bytes can be skipped all at once. Ranges are inclusive.
+*/
+#define MRE_ACCEL_RANGES 4
+struct MreAccel
+{
+    unsigned char num_ranges;
+    unsigned char lo[MRE_ACCEL_RANGES];
+    unsigned char hi[MRE_ACCEL_RANGES];
+};
+
+/*
+    The compiled rules: a single allocation, never modified once built
+    except for `refcount`, which is atomic so that runtimes on different
+    threads may share the rules.
+
+    States are numbered so that the flags need no lookup:
+      - state 0 is fail, and state 1 is start;
+      - states 1 through `num_hopeful` have some goto other than fail;
+      - states `first_accept` and above accept `accepts[s - first_accept]`.
+    In between start and the accepting states are the other hopeful
+    ones, and the accepting states that are not hopeful come last.
+
+    The goto of state `s` on class `c` is at `s * num_classes + c` in the
+    table, whose entries are `width` bytes wide: 1, 2 or 4, as needed for
+    `num_states`.
+
+    Every state has an entry in `accels`; `num_ranges` is 0 if it can not
+    be accelerated.
+*/
+struct MreRules
+{
+    size_t refcount;
+    unsigned char classes[256];
+    size_t num_classes;
+    size_t num_states;
+    size_t num_hopeful;
+    size_t first_accept;
+    size_t width;
+    const size_t *accepts;
+    const void *table;
+    const MreAccel *accels;
+    /* Only for the lazy engine, in which case there is no table. */
+    NfaGraph *graph;
+    /* Only for the bit-parallel engine; likewise. */
+    MreBitNfa *bits;
+    /* Only if some rule has groups; as in the DFA but renumbered. */
+    MreTags *tags;
+};
+
+/*
+    The NFA, flattened once into compressed-sparse-row form.
+
+    The epsilon targets of state `i` are `eps_to[eps_start[i]]` up to
+    `eps_to[eps_start[i + 1]]`, and likewise for character edges, which
+    are sorted by byte class and carry a class instead of a byte.
+
+    State 0 is the start state, and states 1 through `num_accept` are
+    the accept states, in rule order.
+*/
+struct NfaGraph
+{
+    size_t num_states;
+    size_t num_accept;
+    size_t num_classes;
+    unsigned char classes[256];
+    unsigned char reps[256];
+
+    size_t *eps_start;
+    size_t *eps_to;
+    size_t *char_start;
+    unsigned char *char_class;
+    size_t *char_to;
+
+    /*
+        Only if some rule has groups, else NULL: the tag of each epsilon
+        edge (as in `eps_to`, 0 for none, else 1 more than the tag), how
+        many groups each rule has (from 1), and the rule each state is
+        part of (0 for the start state).
+    */
+    size_t *eps_tag;
+    size_t *groups;
+    size_t *owner;
+
+    /*
+        Epsilon closures, with the states that have no character edges
+        (other than accept states) already removed. Computed on demand,
+        unless `nfa_graph_close_all` has been called.
+    */
+    BitSet **closures;
+    BitSet *scratch;
+    size_t *stack;
+};
+
+
+Nfa *nfa_class_set(Pool *pool, CharBitSet *cbs);
+
+/*
+    What every string that some rules match has in common, so that a
+    search can look for it first. The texts are cut short to at most
+    NFA_LITERAL_MAX bytes, which keeps them true.
+*/
+#define NFA_LITERAL_MAX 32
+struct NfaLiterals
+{
+    /* If nothing matches, the rest is meaningless. */
+    bool never;
+    /* If only `prefix` matches; it is then not cut short. */
+    bool exact;
+    /* Every match starts with `prefix`, ends with `suffix`, and has `factor` in it. */
+    size_t prefix_len, suffix_len, factor_len;
+    char prefix[NFA_LITERAL_MAX];
+    char suffix[NFA_LITERAL_MAX];
+    char factor[NFA_LITERAL_MAX];
+    /* The length of the longest match, or (size_t)-1 if unbounded. */
+    size_t max_len;
+};
+
+/* For all the rules added so far. */
+const NfaLiterals *multi_nfa_literals(MultiNfa *m);
+
+/*
+    These return NULL if the rules are invalid (see `mre_runtime_create`),
+    or if they would take more than the budget of the options, in which
+    case `*too_big` is set.
+*/
+MreDfa *multi_nfa_to_dfa(MultiNfa *m, const MreOptions *options, bool *too_big);
+/*
+    The same, but a match may start anywhere: the start state is always
+    in the set, so the DFA never fails and accepts wherever the first
+    match ends.
+*/
+MreDfa *multi_nfa_to_search_dfa(MultiNfa *m, const MreOptions *options);
+void mre_dfa_minimize(MreDfa *dfa);
+void mre_dfa_destroy(MreDfa *dfa);
+MreRules *mre_rules_compile(MreDfa *dfa);
+/*
+    The options to build with: the defaults if `options` is NULL, and
+    for MRE_ENGINE_AUTO without a budget, the default budget, in which
+    case they are copied to `buf`.
+*/
+const MreOptions *mre_options_resolve(const MreOptions *options, MreOptions *buf);
+/* Returns NULL if the rules are invalid. */
+MreRules *multi_nfa_to_lazy(MultiNfa *m);
+/* Also returns NULL if it would take more than `max_bytes` (if not 0). */
+MreRules *multi_nfa_to_bits(MultiNfa *m, size_t max_bytes);
+
+NfaGraph *nfa_graph_create(MultiNfa *m);
+void nfa_graph_destroy(NfaGraph *g);
+BitSet *nfa_graph_closure(NfaGraph *g, size_t from);
+/* Afterwards, the graph is read-only and may be shared between threads. */
+void nfa_graph_close_all(NfaGraph *g);
+size_t nfa_graph_accept(NfaGraph *g, BitSet *states);
+
+/* Interns sets of NFA states as consecutive DFA state numbers. */
+StateMap *statemap_create(void);
+void statemap_destroy(StateMap *sm);
+size_t statemap_intern(StateMap *sm, BitSet *bs);
+/* Returns `(size_t)-1` if the set has not been interned. */
+size_t statemap_find(StateMap *sm, BitSet *bs);
+void statemap_index(StateMap *sm, size_t i, BitSet *bs);
+size_t statemap_size(StateMap *sm);
+
+/*
+    A bounded cache of DFA states, built from a shared NfaGraph as they
+    are reached. When full, it is flushed and the states are renumbered;
+    only the fail state (0) and start state (1) keep their numbers.
+*/
+MreLazyCache *lazy_cache_create(NfaGraph *g, size_t max_states);
+void lazy_cache_destroy(MreLazyCache *c);
+/* The new cache contains state `*state` of the old one, renumbered. */
+MreLazyCache *lazy_cache_clone(MreLazyCache *c, size_t *state);
+size_t lazy_cache_goto(MreLazyCache *c, size_t state, size_t ci);
+size_t lazy_cache_accept(MreLazyCache *c, size_t state);
+bool lazy_cache_hopeful(MreLazyCache *c, size_t state);
+/* State numbers from before a flush mean nothing after it. */
+size_t lazy_cache_flushes(MreLazyCache *c);
+
+/*
+    The NFA, simulated directly instead of being turned into a DFA, so
+    its size never depends on how the rules combine.
+
+    A position is a target of character edges, together with the classes
+    that reach it from a single state; edges that agree on both are the
+    same position. Sets of positions are `num_words` words each:
+      - `start` is the positions in the closure of the start state;
+      - row `c` of `moves` is the positions with an edge on class `c`;
+      - row `p` of `follows` is the positions in the closure of the
+        target of position `p`, and `accepts[p]` is the rule that the
+        closure accepts, or 0; `finals` is the positions where that is
+        not 0;
+      - `shifts` is the positions whose follows are just the position
+        after them. Positions are numbered so that literals make runs.
+    So a step is the union of the follows of `cur & moves[c]`: a shift
+    for those in `shifts`, and a row of `num_words` words for each of
+    the rest. Each step costs O(num_words) plus O(num_words) for every
+    active position not in `shifts`.
+*/
+struct MreBitNfa
+{
+    size_t num_positions;
+    size_t num_words;
+    size_t *start;
+    size_t *moves;
+    size_t *follows;
+    size_t *accepts;
+    size_t *shifts;
+    size_t *finals;
+};
+
+void bit_nfa_destroy(MreBitNfa *b);
+/*
+    Set `next` to the positions after `cur` on class `ci`, and `*accept`
+    to the rule they accept, or 0. Returns whether `next` is not empty.
+*/
+bool bit_nfa_step(MreBitNfa *b, const size_t *cur, size_t ci, size_t *next, size_t *accept);
+
+/*
+    For the DFA builder: call `tag_builder_goto` for every class of every
+    state in order, starting from state 1 (start), since the fail state
+    has none. Then call `tag_builder_finish`.
+*/
+MreTagBuilder *tag_builder_create(NfaGraph *g, size_t num_classes);
+void tag_builder_goto(MreTagBuilder *b, BitSet *from, size_t ci, BitSet *to);
+MreTags *tag_builder_finish(MreTagBuilder *b);
+/* An estimate of the memory used so far, for the budget. */
+size_t tag_builder_bytes(MreTagBuilder *b);
+void mre_tags_destroy(MreTags *t);
+/* Whether state `s` has ops on class `ci` (in `num_classes`). */
+bool mre_tags_any(MreTags *t, size_t num_classes, size_t s, size_t ci);
@@ -0,0 +1,338 @@
+#include "mre_internal.h"
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "util.h"
+
+
+/*
+    Hopcroft's partition refinement.
+
+    Blocks are contiguous ranges of `elems`. While a splitter is being
+    applied, the states of a block that have been marked are moved to
+    the front of its range, so `[first, mid)` is the marked part and
+    `[mid, end)` is the rest.
+*/
+typedef struct Partition Partition;
+struct Partition
+{
+    size_t num_blocks;
+    size_t *elems;
+    size_t *loc;
+    size_t *blk;
+    size_t *first;
+    size_t *mid;
+    size_t *end;
+};
+
+typedef struct Worklist Worklist;
+struct Worklist
+{
+    size_t num_classes;
+    size_t size;
+    size_t *blocks;
+    size_t *classes;
+    unsigned char *pending;
+};
+
+
+static size_t get_goto(MreState *state, size_t ci)
+{
+    if (state->first_goto <= ci && ci <= state->last_goto)
+    {
+        return state->some_gotos[ci - state->first_goto];
+    }
+    return 0;
+}
+
+static void worklist_push(Worklist *w, size_t b, size_t c)
+{
+    if (w->pending[b * w->num_classes + c])
+        return;
+    w->pending[b * w->num_classes + c] = 1;
+    w->blocks[w->size] = b;
+    w->classes[w->size] = c;
+    w->size++;
+}
+
+static void mark(Partition *p, size_t s, size_t *touched, size_t *num_touched)
+{
+    size_t x = p->blk[s];
+    size_t pos = p->loc[s];
+    size_t other;
+    if (pos < p->mid[x])
+        return;
+    if (p->mid[x] == p->first[x])
+        touched[(*num_touched)++] = x;
+    other = p->elems[p->mid[x]];
+    p->elems[pos] = other;
+    p->loc[other] = pos;
+    p->elems[p->mid[x]] = s;
+    p->loc[s] = p->mid[x];
+    p->mid[x]++;
+}
+
+static void split(Partition *p, Worklist *w, size_t x)
+{
+    size_t y, i, c;
+    if (p->mid[x] == p->end[x])
+    {
+        p->mid[x] = p->first[x];
+        return;
+    }
+    y = p->num_blocks++;
+    p->first[y] = p->first[x];
+    p->end[y] = p->mid[x];
+    p->mid[y] = p->first[y];
+    p->first[x] = p->mid[x];
+    for (i = p->first[y]; i < p->end[y]; ++i)
+    {
+        p->blk[p->elems[i]] = y;
+    }
+    for (c = 0; c < w->num_classes; ++c)
+    {
+        if (w->pending[x * w->num_classes + c])
+        {
+            worklist_push(w, y, c);
+        }
+        else if (p->end[y] - p->first[y] < p->end[x] - p->first[x])
+        {
+            worklist_push(w, y, c);
+        }
+        else
+        {
+            worklist_push(w, x, c);
+        }
+    }
+}
+
+void mre_dfa_minimize(MreDfa *dfa)
+{
+    const size_t n = dfa->num_states;
+    const size_t k = dfa->num_classes;
+    size_t *delta = (size_t *)malloc(n * k * sizeof(*delta));
+    size_t *inv_start = (size_t *)calloc(n * k + 1, sizeof(*inv_start));
+    size_t *inv_src = (size_t *)malloc(n * k * sizeof(*inv_src));
+    size_t *splitter = (size_t *)malloc(n * sizeof(*splitter));
+    size_t *touched = (size_t *)malloc(n * sizeof(*touched));
+    size_t *renumber = (size_t *)malloc(n * sizeof(*renumber));
+    size_t *reps = (size_t *)malloc(n * sizeof(*reps));
+    Partition p;
+    Worklist w;
+    MreState *states;
+    size_t num_new;
+    size_t s, c, i;
+
+    /* Dense transitions, and their inverse bucketed by (class, target). */
+    for (s = 0; s < n; ++s)
+    {
+        for (c = 0; c < k; ++c)
+        {
+            size_t t = get_goto(&dfa->states[s], c);
+            delta[s * k + c] = t;
+            inv_start[c * n + t + 1]++;
+        }
+    }
+    for (i = 0; i < n * k; ++i)
+    {
+        inv_start[i + 1] += inv_start[i];
+    }
+    {
+        size_t *fill = (size_t *)memdup(inv_start, n * k * sizeof(*fill));
+        for (s = 0; s < n; ++s)
+        {
+            for (c = 0; c < k; ++c)
+            {
+                inv_src[fill[c * n + delta[s * k + c]]++] = s;
+            }
+        }
+        free(fill);
+    }
+
+    /* The initial partition is by accept id. */
+    p.num_blocks = 0;
+    p.elems = (size_t *)malloc(n * sizeof(*p.elems));
+    p.loc = (size_t *)malloc(n * sizeof(*p.loc));
+    p.blk = (size_t *)malloc(n * sizeof(*p.blk));
+    p.first = (size_t *)malloc(n * sizeof(*p.first));
+    p.mid = (size_t *)malloc(n * sizeof(*p.mid));
+    p.end = (size_t *)malloc(n * sizeof(*p.end));
+    {
+        /* Counting sort, so states stay in order within each block. */
+        size_t max_accept = 0;
+        size_t *fill;
+        for (s = 0; s < n; ++s)
+        {
+            if (dfa->states[s].accept > max_accept)
+                max_accept = dfa->states[s].accept;
+        }
+        fill = (size_t *)calloc(max_accept + 2, sizeof(*fill));
+        for (s = 0; s < n; ++s)
+        {
+            fill[dfa->states[s].accept + 1]++;
+        }
+        for (i = 0; i <= max_accept; ++i)
+        {
+            fill[i + 1] += fill[i];
+        }
+        for (s = 0; s < n; ++s)
+        {
+            p.elems[fill[dfa->states[s].accept]++] = s;
+        }
+        free(fill);
+    }
+    for (i = 0; i < n; ++i)
+    {
+        s = p.elems[i];
+        p.loc[s] = i;
+        if (!i || dfa->states[p.elems[i - 1]].accept != dfa->states[s].accept)
+        {
+            p.first[p.num_blocks] = i;
+            p.mid[p.num_blocks] = i;
+            p.num_blocks++;
+        }
+        p.blk[s] = p.num_blocks - 1;
+        p.end[p.num_blocks - 1] = i + 1;
+    }
+
+    w.num_classes = k;
+    w.size = 0;
+    w.blocks = (size_t *)malloc(n * k * sizeof(*w.blocks));
+    w.classes = (size_t *)malloc(n * k * sizeof(*w.classes));
+    w.pending = (unsigned char *)calloc(n * k, 1);
+    for (i = 0; i < p.num_blocks; ++i)
+    {
+        for (c = 0; c < k; ++c)
+        {
+            worklist_push(&w, i, c);
+        }
+    }
+
+    while (w.size)
+    {
+        size_t b, len, num_touched = 0;
+        w.size--;
+        b = w.blocks[w.size];
+        c = w.classes[w.size];
+        w.pending[b * k + c] = 0;
+
+        /* Marking reorders blocks, possibly including this one. */
+        len = p.end[b] - p.first[b];
+        memcpy(splitter, p.elems + p.first[b], len * sizeof(*splitter));
+        for (i = 0; i < len; ++i)
+        {
+            size_t t = splitter[i];
+            size_t j;
+            for (j = inv_start[c * n + t]; j < inv_start[c * n + t + 1]; ++j)
+            {
+                mark(&p, inv_src[j], touched, &num_touched);
+            }
+        }
+        for (i = 0; i < num_touched; ++i)
+        {
+            split(&p, &w, touched[i]);
+        }
+    }
+
+    /* Keep fail as 0 and start as 1; otherwise number by first appearance. */
+    assert (p.blk[0] != p.blk[1]);
+    for (i = 0; i < p.num_blocks; ++i)
+    {
+        renumber[i] = (size_t)-1;
+    }
+    renumber[p.blk[0]] = 0;
+    reps[0] = 0;
+    renumber[p.blk[1]] = 1;
+    reps[1] = 1;
+    num_new = 2;
+    for (s = 2; s < n; ++s)
+    {
+        if (renumber[p.blk[s]] == (size_t)-1)
+        {
+            reps[num_new] = s;
+            renumber[p.blk[s]] = num_new++;
+        }
+    }
+    assert (num_new == p.num_blocks);
+
+    states = (MreState *)calloc(num_new, sizeof(*states));
+    for (i = 0; i < num_new; ++i)
+    {
+        size_t gotos[256];
+        unsigned char first_goto = 255;
+        unsigned char last_goto = 0;
+        s = reps[i];
+        states[i].accept = dfa->states[s].accept;
+        for (c = 0; c < k; ++c)
+        {
+            gotos[c] = renumber[p.blk[delta[s * k + c]]];
+            if (gotos[c])
+            {
+                if (c < first_goto)
+                {
+                    first_goto = c;
+                }
+                if (c > last_goto)
+                {
+                    last_goto = c;
+                }
+            }
+        }
+        states[i].first_goto = first_goto;
+        states[i].last_goto = last_goto;
+        if (first_goto == 255 && last_goto == 0)
+        {
+            states[i].some_gotos = NULL;
+        }
+        else
+        {
+            size_t num_gotos = last_goto - first_goto + 1;
+            states[i].some_gotos = (size_t *)memdup(&gotos[first_goto], num_gotos * sizeof(size_t));
+        }
+    }
+
+    for (s = n; s--; )
+    {
+        free(dfa->states[s].some_gotos);
+    }
+    free(dfa->states);
+    dfa->states = states;
+    dfa->num_states = num_new;
+
+    free(w.pending);
+    free(w.classes);
+    free(w.blocks);
+    free(p.end);
+    free(p.mid);
+    free(p.first);
+    free(p.blk);
+    free(p.loc);
+    free(p.elems);
+    free(reps);
+    free(renumber);
+    free(touched);
+    free(splitter);
+    free(inv_src);
+    free(inv_start);
+    free(delta);
+}
@@ -0,0 +1,1741 @@
+#include "mre.h"
+#include "mre_internal.h"
+/*
+    Copyright © 2015 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <pthread.h>
+
+#include "bitset.h"
+#include "hashmap.h"
+#include "pool.h"
+#include "util.h"
+
+
+/* The DFA builder relies on this being 0. */
+#define NFA_START 0
+
+typedef enum NfaKind NfaKind;
+typedef struct NfaPair NfaPair;
+typedef struct NfaCaptureKey NfaCaptureKey;
+typedef struct NfaEpsilonKey NfaEpsilonKey;
+typedef struct NfaCharKey NfaCharKey;
+typedef struct NfaPosition NfaPosition;
+typedef struct NfaPositions NfaPositions;
+typedef struct NfaFragment NfaFragment;
+
+enum NfaKind
+{
+    NFA_KIND_TEXT,
+    NFA_KIND_CLASS,
+    NFA_KIND_ALT,
+    NFA_KIND_CAT,
+    NFA_KIND_OPT,
+    NFA_KIND_STAR,
+    NFA_KIND_PLUS,
+    NFA_KIND_CAPTURE,
+};
+
+/*
+    An Nfa is just a node in a DAG of references to its operands, so
+    building one never copies anything. It is only turned into states
+    and edges when it is added to a MultiNfa.
+
+    The `num_*` fields are how many edges `nfa_emit` will add for this
+    node, so the MultiNfa can reserve space up front.
+*/
+struct Nfa
+{
+    NfaKind kind;
+    /* NFA_KIND_TEXT; the text is interned in the same pool. */
+    const char *text;
+    size_t len;
+    /* NFA_KIND_CLASS */
+    CharBitSet cbs;
+    /* everything else; `b` only for ALT and CAT */
+    Nfa *a;
+    Nfa *b;
+    /* NFA_KIND_CAPTURE */
+    size_t group;
+
+    size_t num_epsilons;
+    size_t num_chars;
+    /* The highest group number in this node, or 0. */
+    size_t num_groups;
+};
+struct NfaEpsilonKey
+{
+    /* `tag` is 0, or 1 more than the tag passed along the edge. */
+    size_t from, to, tag;
+};
+struct NfaCharKey
+{
+    /* avoid padding */
+    size_t from, ch, to;
+};
+struct NfaPair
+{
+    Nfa *a;
+    Nfa *b;
+};
+struct NfaCaptureKey
+{
+    Nfa *inner;
+    size_t group;
+};
+/*
+    All rules, already flattened. State NFA_START is shared by all rules;
+    the accept state of each rule is recorded in `accepts`.
+*/
+struct MultiNfa
+{
+    /* Whether `multi_nfa_add` uses `glushkov_emit` instead of `nfa_emit`. */
+    bool glushkov;
+    size_t num_states;
+    size_t num_accept;
+    size_t *accepts;
+    /* Parallel to `accepts`: how many groups each rule has. */
+    size_t *groups;
+    size_t accepts_cap;
+    NfaEpsilonKey *epsilons;
+    size_t num_epsilons;
+    size_t epsilons_cap;
+    NfaCharKey *chars;
+    size_t num_chars;
+    size_t chars_cap;
+    NfaLiterals literals;
+};
+
+
+static Nfa *nfa_alloc(Pool *pool, NfaKind kind)
+{
+    Nfa *rv = (Nfa *)calloc(1, sizeof(*rv));
+    rv->kind = kind;
+    pool_free(pool, free, rv);
+    return rv;
+}
+static Nfa *nfa_alloc_unary(Pool *pool, NfaKind kind, const void *str, size_t len)
+{
+    Nfa *inner = (assert (len == sizeof(inner)), *(Nfa **)str);
+    Nfa *rv = nfa_alloc(pool, kind);
+    rv->a = inner;
+    rv->num_epsilons = inner->num_epsilons;
+    rv->num_chars = inner->num_chars;
+    rv->num_groups = inner->num_groups;
+    return rv;
+}
+static Nfa *nfa_alloc_binary(Pool *pool, NfaKind kind, const void *str, size_t len)
+{
+    NfaPair p = (assert (len == sizeof(p)), *(NfaPair *)str);
+    Nfa *rv = nfa_alloc(pool, kind);
+    rv->a = p.a;
+    rv->b = p.b;
+    rv->num_epsilons = p.a->num_epsilons + p.b->num_epsilons;
+    rv->num_chars = p.a->num_chars + p.b->num_chars;
+    rv->num_groups = p.a->num_groups > p.b->num_groups ? p.a->num_groups : p.b->num_groups;
+    return rv;
+}
+
+static void *transform_text(Pool *pool, const void *str, size_t len, void *context)
+{
+    Nfa *rv = nfa_alloc(pool, NFA_KIND_TEXT);
+    (void)context;
+    rv->text = (const char *)str;
+    rv->len = len;
+    rv->num_epsilons = !len;
+    rv->num_chars = len;
+    return rv;
+}
+static void *transform_class(Pool *pool, const void *str, size_t len, void *context)
+{
+    Nfa *rv = nfa_alloc(pool, NFA_KIND_CLASS);
+    size_t i;
+    (void)context;
+    assert (sizeof(rv->cbs) == len);
+    memcpy(&rv->cbs, str, len);
+    for (i = 0; i < 256; ++i)
+    {
+        if (char_bitset_test(&rv->cbs, i))
+        {
+            rv->num_chars++;
+        }
+    }
+    return rv;
+}
+static void *transform_alt(Pool *pool, const void *str, size_t len, void *context)
+{
+    (void)context;
+    return nfa_alloc_binary(pool, NFA_KIND_ALT, str, len);
+}
+static void *transform_cat(Pool *pool, const void *str, size_t len, void *context)
+{
+    (void)context;
+    return nfa_alloc_binary(pool, NFA_KIND_CAT, str, len);
+}
+/* TODO figure out which of these should be kept */
+static void *transform_opt(Pool *pool, const void *str, size_t len, void *context)
+{
+    Nfa *rv = nfa_alloc_unary(pool, NFA_KIND_OPT, str, len);
+    (void)context;
+    rv->num_epsilons += 1;
+    return rv;
+}
+static void *transform_star(Pool *pool, const void *str, size_t len, void *context)
+{
+    Nfa *rv = nfa_alloc_unary(pool, NFA_KIND_STAR, str, len);
+    (void)context;
+    rv->num_epsilons += 2;
+    return rv;
+}
+static void *transform_plus(Pool *pool, const void *str, size_t len, void *context)
+{
+    Nfa *rv = nfa_alloc_unary(pool, NFA_KIND_PLUS, str, len);
+    (void)context;
+    rv->num_epsilons += 3;
+    return rv;
+}
+
+static void *transform_capture(Pool *pool, const void *str, size_t len, void *context)
+{
+    NfaCaptureKey k = (assert (len == sizeof(k)), *(NfaCaptureKey *)str);
+    Nfa *rv = nfa_alloc(pool, NFA_KIND_CAPTURE);
+    (void)context;
+    rv->a = k.inner;
+    rv->group = k.group;
+    rv->num_epsilons = k.inner->num_epsilons + 2;
+    rv->num_chars = k.inner->num_chars;
+    rv->num_groups = k.inner->num_groups > k.group ? k.inner->num_groups : k.group;
+    return rv;
+}
+
+static CharBitSet char_bitset_from(const char *str, size_t len)
+{
+    CharBitSet rv;
+    size_t i;
+    char_bitset_erase(&rv);
+
+    for (i = 0; i < len; ++i)
+    {
+        unsigned char c = str[i];
+        char_bitset_set(&rv, c);
+    }
+
+    return rv;
+}
+
+Nfa *nfa_fail(Pool *pool)
+{
+    return nfa_class_slice(pool, "", 0);
+}
+Nfa *nfa_epsilon(Pool *pool)
+{
+    return nfa_text_slice(pool, "", 0);
+}
+Nfa *nfa_char(Pool *pool, char c)
+{
+    return nfa_text_slice(pool, &c, 1);
+}
+Nfa *nfa_any_char(Pool *pool)
+{
+    return nfa_class_compl(pool, "");
+}
+Nfa *nfa_text(Pool *pool, const char *str)
+{
+    return nfa_text_slice(pool, str, strlen(str));
+}
+Nfa *nfa_class(Pool *pool, const char *str)
+{
+    return nfa_class_slice(pool, str, strlen(str));
+}
+Nfa *nfa_class_compl(Pool *pool, const char *str)
+{
+    return nfa_class_compl_slice(pool, str, strlen(str));
+}
+Nfa *nfa_text_slice(Pool *pool, const char *str, size_t len)
+{
+    return (Nfa *)pool_intern_map(pool, transform_text, str, len, NULL);
+}
+Nfa *nfa_class_slice(Pool *pool, const char *str, size_t len)
+{
+    CharBitSet cbs = char_bitset_from(str, len);
+    return nfa_class_set(pool, &cbs);
+}
+Nfa *nfa_class_compl_slice(Pool *pool, const char *str, size_t len)
+{
+    CharBitSet cbs = char_bitset_from(str, len);
+    char_bitset_invert(&cbs);
+    return nfa_class_set(pool, &cbs);
+}
+Nfa *nfa_class_set(Pool *pool, CharBitSet *cbs)
+{
+    return (Nfa *)pool_intern_map(pool, transform_class, cbs, sizeof(*cbs), NULL);
+}
+Nfa *nfa_alt(Pool *pool, Nfa *a, Nfa *b)
+{
+    NfaPair p;
+    p.a = a;
+    p.b = b;
+    return (Nfa *)pool_intern_map(pool, transform_alt, &p, sizeof(p), NULL);
+}
+Nfa *nfa_cat(Pool *pool, Nfa *left, Nfa *right)
+{
+    NfaPair p;
+    p.a = left;
+    p.b = right;
+    return (Nfa *)pool_intern_map(pool, transform_cat, &p, sizeof(p), NULL);
+}
+Nfa *nfa_opt(Pool *pool, Nfa *inner)
+{
+    return (Nfa *)pool_intern_map(pool, transform_opt, &inner, sizeof(inner), NULL);
+}
+Nfa *nfa_star(Pool *pool, Nfa *inner)
+{
+    return (Nfa *)pool_intern_map(pool, transform_star, &inner, sizeof(inner), NULL);
+}
+Nfa *nfa_plus(Pool *pool, Nfa *inner)
+{
+    return (Nfa *)pool_intern_map(pool, transform_plus, &inner, sizeof(inner), NULL);
+}
+Nfa *nfa_capture(Pool *pool, Nfa *inner, size_t group)
+{
+    NfaCaptureKey k;
+    assert (0 < group && group <= MRE_MAX_GROUPS);
+    k.inner = inner;
+    k.group = group;
+    return (Nfa *)pool_intern_map(pool, transform_capture, &k, sizeof(k), NULL);
+}
+
+static size_t literal_len(Nfa *nfa, char *buf)
+{
+    size_t left, right;
+    switch (nfa->kind)
+    {
+    case NFA_KIND_TEXT:
+        if (buf)
+        {
+            memcpy(buf, nfa->text, nfa->len);
+        }
+        return nfa->len;
+    case NFA_KIND_CLASS:
+        if (nfa->num_chars != 1)
+        {
+            return (size_t)-1;
+        }
+        if (buf)
+        {
+            size_t c = 0;
+            while (!char_bitset_test(&nfa->cbs, c))
+            {
+                c++;
+            }
+            *buf = (char)c;
+        }
+        return 1;
+    case NFA_KIND_CAT:
+        left = literal_len(nfa->a, buf);
+        if (left == (size_t)-1)
+        {
+            return left;
+        }
+        right = literal_len(nfa->b, buf ? buf + left : NULL);
+        if (right == (size_t)-1)
+        {
+            return right;
+        }
+        return left + right;
+    default:
+        return (size_t)-1;
+    }
+}
+size_t nfa_literal(Nfa *nfa, char *buf)
+{
+    size_t rv = literal_len(nfa, NULL);
+    if (rv == (size_t)-1)
+    {
+        return 0;
+    }
+    if (buf)
+    {
+        literal_len(nfa, buf);
+    }
+    return rv;
+}
+
+/* `a` then `b`, cut short at the start if `keep_end`, else at the end. */
+static size_t literals_join(char *dst, const char *a, size_t a_len, const char *b, size_t b_len, bool keep_end)
+{
+    char tmp[2 * NFA_LITERAL_MAX];
+    size_t len, skip;
+    if (a_len > NFA_LITERAL_MAX)
+    {
+        a += keep_end ? a_len - NFA_LITERAL_MAX : 0;
+        a_len = NFA_LITERAL_MAX;
+    }
+    if (b_len > NFA_LITERAL_MAX)
+    {
+        b += keep_end ? b_len - NFA_LITERAL_MAX : 0;
+        b_len = NFA_LITERAL_MAX;
+    }
+    len = a_len + b_len;
+    skip = keep_end && len > NFA_LITERAL_MAX ? len - NFA_LITERAL_MAX : 0;
+    memcpy(tmp, a, a_len);
+    memcpy(tmp + a_len, b, b_len);
+    len -= skip;
+    if (len > NFA_LITERAL_MAX)
+    {
+        len = NFA_LITERAL_MAX;
+    }
+    memcpy(dst, tmp + skip, len);
+    return len;
+}
+
+/* The longest text that is in both `a` and `b`. */
+static size_t literals_common(char *dst, const char *a, size_t a_len, const char *b, size_t b_len)
+{
+    size_t best = 0, best_at = 0;
+    size_t i, j, k;
+    for (i = 0; i < a_len; ++i)
+    {
+        for (j = 0; j < b_len; ++j)
+        {
+            for (k = 0; i + k < a_len && j + k < b_len && a[i + k] == b[j + k]; ++k)
+            {
+            }
+            if (k > best)
+            {
+                best = k;
+                best_at = i;
+            }
+        }
+    }
+    memmove(dst, a + best_at, best);
+    return best;
+}
+
+static void literals_text(NfaLiterals *rv, const char *text, size_t len)
+{
+    memset(rv, 0, sizeof(*rv));
+    rv->exact = len <= NFA_LITERAL_MAX;
+    rv->prefix_len = literals_join(rv->prefix, text, len, "", 0, false);
+    rv->suffix_len = literals_join(rv->suffix, text, len, "", 0, true);
+    rv->factor_len = literals_join(rv->factor, text, len, "", 0, false);
+    rv->max_len = len;
+}
+
+/* Either `a` or `b`; `rv` may be either of them. */
+static void literals_alt(NfaLiterals *rv, const NfaLiterals *a, const NfaLiterals *b)
+{
+    NfaLiterals tmp;
+    size_t n;
+    if (a->never || b->never)
+    {
+        *rv = a->never ? *b : *a;
+        return;
+    }
+    memset(&tmp, 0, sizeof(tmp));
+    for (n = 0; n < a->prefix_len && n < b->prefix_len && a->prefix[n] == b->prefix[n]; ++n)
+    {
+    }
+    tmp.prefix_len = n;
+    memcpy(tmp.prefix, a->prefix, n);
+    for (n = 0; n < a->suffix_len && n < b->suffix_len && a->suffix[a->suffix_len - 1 - n] == b->suffix[b->suffix_len - 1 - n]; ++n)
+    {
+    }
+    tmp.suffix_len = n;
+    memcpy(tmp.suffix, a->suffix + a->suffix_len - n, n);
+    tmp.exact = a->exact && b->exact && a->prefix_len == b->prefix_len && tmp.prefix_len == a->prefix_len;
+    tmp.factor_len = literals_common(tmp.factor, a->factor, a->factor_len, b->factor, b->factor_len);
+    if (tmp.prefix_len > tmp.factor_len)
+    {
+        tmp.factor_len = literals_join(tmp.factor, tmp.prefix, tmp.prefix_len, "", 0, false);
+    }
+    if (tmp.suffix_len > tmp.factor_len)
+    {
+        tmp.factor_len = literals_join(tmp.factor, tmp.suffix, tmp.suffix_len, "", 0, false);
+    }
+    tmp.max_len = a->max_len > b->max_len ? a->max_len : b->max_len;
+    *rv = tmp;
+}
+
+/* `a` then `b`. */
+static void literals_cat(NfaLiterals *rv, const NfaLiterals *a, const NfaLiterals *b)
+{
+    char join[NFA_LITERAL_MAX];
+    size_t join_len;
+    memset(rv, 0, sizeof(*rv));
+    if (a->never || b->never)
+    {
+        rv->never = true;
+        return;
+    }
+    rv->exact = a->exact && b->exact && a->prefix_len + b->prefix_len <= NFA_LITERAL_MAX;
+    if (a->exact)
+    {
+        rv->prefix_len = literals_join(rv->prefix, a->prefix, a->prefix_len, b->prefix, b->prefix_len, false);
+    }
+    else
+    {
+        rv->prefix_len = literals_join(rv->prefix, a->prefix, a->prefix_len, "", 0, false);
+    }
+    if (b->exact)
+    {
+        rv->suffix_len = literals_join(rv->suffix, a->suffix, a->suffix_len, b->suffix, b->suffix_len, true);
+    }
+    else
+    {
+        rv->suffix_len = literals_join(rv->suffix, b->suffix, b->suffix_len, "", 0, true);
+    }
+    rv->factor_len = literals_join(rv->factor, a->factor, a->factor_len, "", 0, false);
+    if (b->factor_len > rv->factor_len)
+    {
+        rv->factor_len = literals_join(rv->factor, b->factor, b->factor_len, "", 0, false);
+    }
+    join_len = literals_join(join, a->suffix, a->suffix_len, b->prefix, b->prefix_len, false);
+    if (join_len > rv->factor_len)
+    {
+        rv->factor_len = literals_join(rv->factor, join, join_len, "", 0, false);
+    }
+    rv->max_len = a->max_len == (size_t)-1 || b->max_len == (size_t)-1 ? (size_t)-1 : a->max_len + b->max_len;
+}
+
+static void nfa_literals(Nfa *nfa, NfaLiterals *rv)
+{
+    NfaLiterals a, b;
+    switch (nfa->kind)
+    {
+    case NFA_KIND_TEXT:
+        literals_text(rv, nfa->text, nfa->len);
+        return;
+    case NFA_KIND_CLASS:
+        if (nfa->num_chars == 1)
+        {
+            char c;
+            literal_len(nfa, &c);
+            literals_text(rv, &c, 1);
+            return;
+        }
+        memset(rv, 0, sizeof(*rv));
+        rv->never = !nfa->num_chars;
+        rv->max_len = 1;
+        return;
+    case NFA_KIND_ALT:
+        nfa_literals(nfa->a, &a);
+        nfa_literals(nfa->b, &b);
+        literals_alt(rv, &a, &b);
+        return;
+    case NFA_KIND_CAT:
+        nfa_literals(nfa->a, &a);
+        nfa_literals(nfa->b, &b);
+        literals_cat(rv, &a, &b);
+        return;
+    case NFA_KIND_OPT:
+    case NFA_KIND_STAR:
+    case NFA_KIND_PLUS:
+        nfa_literals(nfa->a, &a);
+        memset(rv, 0, sizeof(*rv));
+        rv->never = a.never && nfa->kind == NFA_KIND_PLUS;
+        rv->max_len = a.max_len && nfa->kind != NFA_KIND_OPT ? (size_t)-1 : a.max_len;
+        if (nfa->kind == NFA_KIND_PLUS)
+        {
+            /* Every repeat has them, and there is at least one. */
+            rv->prefix_len = a.prefix_len;
+            memcpy(rv->prefix, a.prefix, a.prefix_len);
+            rv->suffix_len = a.suffix_len;
+            memcpy(rv->suffix, a.suffix, a.suffix_len);
+            rv->factor_len = a.factor_len;
+            memcpy(rv->factor, a.factor, a.factor_len);
+        }
+        return;
+    case NFA_KIND_CAPTURE:
+        nfa_literals(nfa->a, rv);
+        return;
+    }
+    abort();
+}
+
+
+static void multi_nfa_reserve(MultiNfa *m, size_t accepts, size_t epsilons, size_t chars)
+{
+    if (m->num_accept + accepts > m->accepts_cap)
+    {
+        size_t want = m->num_accept + accepts;
+        m->accepts_cap = m->accepts_cap * 2 > want ? m->accepts_cap * 2 : want;
+        m->accepts = (size_t *)realloc(m->accepts, m->accepts_cap * sizeof(*m->accepts));
+        m->groups = (size_t *)realloc(m->groups, m->accepts_cap * sizeof(*m->groups));
+    }
+    if (m->num_epsilons + epsilons > m->epsilons_cap)
+    {
+        size_t want = m->num_epsilons + epsilons;
+        m->epsilons_cap = m->epsilons_cap * 2 > want ? m->epsilons_cap * 2 : want;
+        m->epsilons = (NfaEpsilonKey *)realloc(m->epsilons, m->epsilons_cap * sizeof(*m->epsilons));
+    }
+    if (m->num_chars + chars > m->chars_cap)
+    {
+        size_t want = m->num_chars + chars;
+        m->chars_cap = m->chars_cap * 2 > want ? m->chars_cap * 2 : want;
+        m->chars = (NfaCharKey *)realloc(m->chars, m->chars_cap * sizeof(*m->chars));
+    }
+}
+static size_t multi_nfa_alloc_id(MultiNfa *m)
+{
+    return m->num_states++;
+}
+static void multi_nfa_add_tag(MultiNfa *m, size_t from, size_t to, size_t tag)
+{
+    NfaEpsilonKey *e = &m->epsilons[m->num_epsilons++];
+    assert (m->num_epsilons <= m->epsilons_cap);
+    e->from = from;
+    e->to = to;
+    e->tag = tag;
+}
+static void multi_nfa_add_epsilon(MultiNfa *m, size_t from, size_t to)
+{
+    multi_nfa_add_tag(m, from, to, 0);
+}
+static void multi_nfa_add_char(MultiNfa *m, size_t from, size_t to, unsigned char ch)
+{
+    NfaCharKey *e = &m->chars[m->num_chars++];
+    assert (m->num_chars <= m->chars_cap);
+    e->from = from;
+    e->ch = ch;
+    e->to = to;
+}
+/*
+    Add the states and edges for `nfa`, so that the paths from `start`
+    to `accept` spell exactly its language.
+
+    This never adds an edge into `start` or out of `accept` (unless they
+    are the same state), so callers can share them between operands.
+*/
+static void nfa_emit(MultiNfa *m, Nfa *nfa, size_t start, size_t accept)
+{
+    switch (nfa->kind)
+    {
+    case NFA_KIND_TEXT:
+        if (!nfa->len)
+        {
+            multi_nfa_add_epsilon(m, start, accept);
+        }
+        else
+        {
+            const char *s = nfa->text;
+            size_t len = nfa->len;
+            size_t from = start;
+            while (--len)
+            {
+                size_t to = multi_nfa_alloc_id(m);
+                multi_nfa_add_char(m, from, to, *s++);
+                from = to;
+            }
+            multi_nfa_add_char(m, from, accept, *s);
+        }
+        break;
+    case NFA_KIND_CLASS:
+        {
+            size_t i;
+            for (i = 0; i < 256; ++i)
+            {
+                if (char_bitset_test(&nfa->cbs, i))
+                {
+                    multi_nfa_add_char(m, start, accept, i);
+                }
+            }
+        }
+        break;
+    case NFA_KIND_ALT:
+        nfa_emit(m, nfa->a, start, accept);
+        nfa_emit(m, nfa->b, start, accept);
+        break;
+    case NFA_KIND_CAT:
+        {
+            size_t middle = multi_nfa_alloc_id(m);
+            nfa_emit(m, nfa->a, start, middle);
+            nfa_emit(m, nfa->b, middle, accept);
+        }
+        break;
+    case NFA_KIND_OPT:
+        multi_nfa_add_epsilon(m, start, accept);
+        nfa_emit(m, nfa->a, start, accept);
+        break;
+    case NFA_KIND_STAR:
+        {
+            /*
+                start --> loop --> accept
+                          |  ^
+                          \==/
+            */
+            size_t loop = multi_nfa_alloc_id(m);
+            multi_nfa_add_epsilon(m, start, loop);
+            nfa_emit(m, nfa->a, loop, loop);
+            multi_nfa_add_epsilon(m, loop, accept);
+        }
+        break;
+    case NFA_KIND_PLUS:
+        {
+            /*
+                start --> in=====out --> accept
+                          ^       |
+                           \-----/
+            */
+            size_t in = multi_nfa_alloc_id(m);
+            size_t out = multi_nfa_alloc_id(m);
+            multi_nfa_add_epsilon(m, start, in);
+            nfa_emit(m, nfa->a, in, out);
+            multi_nfa_add_epsilon(m, out, in);
+            multi_nfa_add_epsilon(m, out, accept);
+        }
+        break;
+    case NFA_KIND_CAPTURE:
+        {
+            /*
+                start --open--> in=====out --close--> accept
+            */
+            size_t in = multi_nfa_alloc_id(m);
+            size_t out = multi_nfa_alloc_id(m);
+            multi_nfa_add_tag(m, start, in, 2 * (nfa->group - 1) + 1);
+            nfa_emit(m, nfa->a, in, out);
+            multi_nfa_add_tag(m, out, accept, 2 * (nfa->group - 1) + 2);
+        }
+        break;
+    }
+}
+
+/*
+    For the Glushkov construction, each character of text and each class
+    is a position, with a state of its own; every edge into that state
+    is labelled with that character or class.
+*/
+struct NfaPosition
+{
+    size_t state;
+    Nfa *node;
+    unsigned char ch;
+};
+struct NfaPositions
+{
+    NfaPosition *items;
+    size_t num;
+    size_t cap;
+};
+/*
+    The positions a fragment of the regex can begin and end with, and
+    whether it matches the empty string. The follow edges between its own
+    positions are already added.
+*/
+struct NfaFragment
+{
+    size_t *first;
+    size_t num_first;
+    size_t *last;
+    size_t num_last;
+    bool nullable;
+};
+
+static size_t glushkov_position(MultiNfa *m, NfaPositions *ps, Nfa *node, unsigned char ch)
+{
+    NfaPosition *p;
+    if (ps->num == ps->cap)
+    {
+        ps->cap = ps->cap ? 2 * ps->cap : 16;
+        ps->items = (NfaPosition *)realloc(ps->items, ps->cap * sizeof(*ps->items));
+    }
+    p = &ps->items[ps->num];
+    p->state = multi_nfa_alloc_id(m);
+    p->node = node;
+    p->ch = ch;
+    return ps->num++;
+}
+
+static void glushkov_edge(MultiNfa *m, NfaPositions *ps, size_t from, size_t to)
+{
+    NfaPosition *p = &ps->items[to];
+    size_t i;
+    if (p->node->kind == NFA_KIND_TEXT)
+    {
+        multi_nfa_reserve(m, 0, 0, 1);
+        multi_nfa_add_char(m, from, p->state, p->ch);
+        return;
+    }
+    multi_nfa_reserve(m, 0, 0, p->node->num_chars);
+    for (i = 0; i < 256; ++i)
+    {
+        if (char_bitset_test(&p->node->cbs, i))
+        {
+            multi_nfa_add_char(m, from, p->state, i);
+        }
+    }
+}
+
+/* Add an edge from each of the `last` positions to each of the `first`. */
+static void glushkov_follow(MultiNfa *m, NfaPositions *ps, NfaFragment *from, NfaFragment *to)
+{
+    size_t i, j;
+    for (i = 0; i < from->num_last; ++i)
+    {
+        for (j = 0; j < to->num_first; ++j)
+        {
+            glushkov_edge(m, ps, ps->items[from->last[i]].state, to->first[j]);
+        }
+    }
+}
+
+static size_t *glushkov_join(size_t *a, size_t num_a, size_t *b, size_t num_b)
+{
+    size_t *rv = (size_t *)malloc((num_a + num_b + 1) * sizeof(size_t));
+    memcpy(rv, a, num_a * sizeof(size_t));
+    memcpy(rv + num_a, b, num_b * sizeof(size_t));
+    return rv;
+}
+
+static void glushkov_free(NfaFragment *f)
+{
+    free(f->first);
+    free(f->last);
+}
+
+/*
+    Like `nfa_emit`, but builds a position automaton, which has no epsilon
+    edges at all: a path through the regex goes straight from position to
+    position. Shared nodes are emitted once per use, as there.
+*/
+static NfaFragment glushkov_emit(MultiNfa *m, NfaPositions *ps, Nfa *nfa)
+{
+    NfaFragment rv, a, b;
+    memset(&rv, 0, sizeof(rv));
+    switch (nfa->kind)
+    {
+    case NFA_KIND_TEXT:
+        rv.nullable = !nfa->len;
+        rv.first = (size_t *)malloc(sizeof(size_t));
+        rv.last = (size_t *)malloc(sizeof(size_t));
+        if (nfa->len)
+        {
+            size_t i, p = glushkov_position(m, ps, nfa, nfa->text[0]);
+            rv.first[rv.num_first++] = p;
+            for (i = 1; i < nfa->len; ++i)
+            {
+                size_t q = glushkov_position(m, ps, nfa, nfa->text[i]);
+                glushkov_edge(m, ps, ps->items[p].state, q);
+                p = q;
+            }
+            rv.last[rv.num_last++] = p;
+        }
+        break;
+    case NFA_KIND_CLASS:
+        rv.first = (size_t *)malloc(sizeof(size_t));
+        rv.last = (size_t *)malloc(sizeof(size_t));
+        if (nfa->num_chars)
+        {
+            size_t p = glushkov_position(m, ps, nfa, 0);
+            rv.first[rv.num_first++] = p;
+            rv.last[rv.num_last++] = p;
+        }
+        break;
+    case NFA_KIND_ALT:
+        a = glushkov_emit(m, ps, nfa->a);
+        b = glushkov_emit(m, ps, nfa->b);
+        rv.first = glushkov_join(a.first, a.num_first, b.first, b.num_first);
+        rv.num_first = a.num_first + b.num_first;
+        rv.last = glushkov_join(a.last, a.num_last, b.last, b.num_last);
+        rv.num_last = a.num_last + b.num_last;
+        rv.nullable = a.nullable || b.nullable;
+        glushkov_free(&a);
+        glushkov_free(&b);
+        break;
+    case NFA_KIND_CAT:
+        a = glushkov_emit(m, ps, nfa->a);
+        b = glushkov_emit(m, ps, nfa->b);
+        glushkov_follow(m, ps, &a, &b);
+        rv.first = glushkov_join(a.first, a.num_first, b.first, a.nullable ? b.num_first : 0);
+        rv.num_first = a.num_first + (a.nullable ? b.num_first : 0);
+        rv.last = glushkov_join(b.last, b.num_last, a.last, b.nullable ? a.num_last : 0);
+        rv.num_last = b.num_last + (b.nullable ? a.num_last : 0);
+        rv.nullable = a.nullable && b.nullable;
+        glushkov_free(&a);
+        glushkov_free(&b);
+        break;
+    case NFA_KIND_OPT:
+        rv = glushkov_emit(m, ps, nfa->a);
+        rv.nullable = true;
+        break;
+    case NFA_KIND_STAR:
+    case NFA_KIND_PLUS:
+        rv = glushkov_emit(m, ps, nfa->a);
+        glushkov_follow(m, ps, &rv, &rv);
+        if (nfa->kind == NFA_KIND_STAR)
+        {
+            rv.nullable = true;
+        }
+        break;
+    case NFA_KIND_CAPTURE:
+        /* Rules with groups are always emitted by `nfa_emit`. */
+        abort();
+    }
+    return rv;
+}
+
+
+MultiNfa *multi_nfa_create(void)
+{
+    MultiNfa *rv = (MultiNfa *)calloc(1, sizeof(*rv));
+    rv->num_states = 1;
+    rv->num_accept = 0;
+    rv->literals.never = true;
+    return rv;
+}
+
+MultiNfa *multi_nfa_create_glushkov(void)
+{
+    MultiNfa *rv = multi_nfa_create();
+    rv->glushkov = true;
+    return rv;
+}
+
+void multi_nfa_destroy(MultiNfa *m)
+{
+    free(m->chars);
+    free(m->epsilons);
+    free(m->groups);
+    free(m->accepts);
+    free(m);
+}
+
+size_t multi_nfa_add(MultiNfa *m, Nfa *nfa)
+{
+    /*
+        S======A1--1
+        |
+        \======A2--2
+    */
+    size_t accept;
+    NfaLiterals literals;
+    nfa_literals(nfa, &literals);
+    literals_alt(&m->literals, &m->literals, &literals);
+    multi_nfa_reserve(m, 1, nfa->num_epsilons, nfa->num_chars);
+    accept = multi_nfa_alloc_id(m);
+    m->groups[m->num_accept] = nfa->num_groups;
+    m->accepts[m->num_accept++] = accept;
+    /* Tags go on epsilon edges, which a position automaton lacks. */
+    if (m->glushkov && !nfa->num_groups)
+    {
+        NfaPositions ps;
+        NfaFragment f;
+        size_t i;
+        memset(&ps, 0, sizeof(ps));
+        f = glushkov_emit(m, &ps, nfa);
+        for (i = 0; i < f.num_first; ++i)
+        {
+            glushkov_edge(m, &ps, NFA_START, f.first[i]);
+        }
+        /* The only epsilons: the DFA builder wants one accept per rule. */
+        multi_nfa_reserve(m, 0, f.num_last + 1, 0);
+        for (i = 0; i < f.num_last; ++i)
+        {
+            multi_nfa_add_epsilon(m, ps.items[f.last[i]].state, accept);
+        }
+        if (f.nullable)
+        {
+            multi_nfa_add_epsilon(m, NFA_START, accept);
+        }
+        glushkov_free(&f);
+        free(ps.items);
+        return m->num_accept;
+    }
+    nfa_emit(m, nfa, NFA_START, accept);
+    return m->num_accept;
+}
+
+const NfaLiterals *multi_nfa_literals(MultiNfa *m)
+{
+    return &m->literals;
+}
+
+size_t multi_nfa_add_all(MultiNfa *m, size_t num_nfas, Nfa **nfas)
+{
+    size_t epsilons = 0, chars = 0;
+    size_t first = m->num_accept + 1;
+    size_t i;
+    for (i = 0; i < num_nfas; ++i)
+    {
+        epsilons += nfas[i]->num_epsilons;
+        chars += nfas[i]->num_chars;
+    }
+    multi_nfa_reserve(m, num_nfas, epsilons, chars);
+    for (i = 0; i < num_nfas; ++i)
+    {
+        size_t j = multi_nfa_add(m, nfas[i]);
+        (void)j;
+        assert (j == first + i);
+    }
+    return first;
+}
+
+/* Here be dragons. */
+
+static int char_key_group_compare(const void *a, const void *b)
+{
+    const NfaCharKey *l = (const NfaCharKey *)a;
+    const NfaCharKey *r = (const NfaCharKey *)b;
+    if (l->from != r->from)
+        return l->from < r->from ? -1 : 1;
+    if (l->to != r->to)
+        return l->to < r->to ? -1 : 1;
+    if (l->ch != r->ch)
+        return l->ch < r->ch ? -1 : 1;
+    return 0;
+}
+static int char_key_class_compare(const void *a, const void *b)
+{
+    const NfaCharKey *l = (const NfaCharKey *)a;
+    const NfaCharKey *r = (const NfaCharKey *)b;
+    if (l->from != r->from)
+        return l->from < r->from ? -1 : 1;
+    if (l->ch != r->ch)
+        return l->ch < r->ch ? -1 : 1;
+    if (l->to != r->to)
+        return l->to < r->to ? -1 : 1;
+    return 0;
+}
+static void refine_classes(unsigned char *classes, size_t *num_classes, CharBitSet *cbs)
+{
+    size_t members[256] = {0};
+    size_t hits[256] = {0};
+    size_t remap[256];
+    size_t b;
+    for (b = 0; b < 256; ++b)
+    {
+        members[classes[b]]++;
+        if (char_bitset_test(cbs, b))
+        {
+            hits[classes[b]]++;
+        }
+    }
+    for (b = 0; b < 256; ++b)
+    {
+        remap[b] = b;
+    }
+    for (b = 0; b < 256; ++b)
+    {
+        size_t old = classes[b];
+        if (!char_bitset_test(cbs, b) || hits[old] == members[old])
+        {
+            continue;
+        }
+        if (remap[old] == old)
+        {
+            remap[old] = (*num_classes)++;
+        }
+        classes[b] = remap[old];
+    }
+}
+/*
+    Partition the bytes so that two bytes share a class if and only if
+    every character edge in the NFA either accepts both or neither.
+
+    Classes are numbered in order of their smallest byte, so byte 0 is
+    always in class 0.
+
+    The edges must be sorted by `char_key_group_compare`.
+*/
+static size_t compute_classes(NfaCharKey *edges, size_t num_edges, unsigned char *classes, unsigned char *reps)
+{
+    size_t num_classes = 1;
+    size_t renumber[256];
+    size_t i, b;
+
+    memset(classes, 0, 256);
+    for (i = 0; i < num_edges; )
+    {
+        CharBitSet cbs;
+        size_t j;
+        char_bitset_erase(&cbs);
+        for (j = i; j < num_edges && edges[j].from == edges[i].from && edges[j].to == edges[i].to; ++j)
+        {
+            char_bitset_set(&cbs, edges[j].ch);
+        }
+        refine_classes(classes, &num_classes, &cbs);
+        i = j;
+    }
+
+    for (i = 0; i < num_classes; ++i)
+    {
+        renumber[i] = (size_t)-1;
+    }
+    num_classes = 0;
+    for (b = 0; b < 256; ++b)
+    {
+        if (renumber[classes[b]] == (size_t)-1)
+        {
+            reps[num_classes] = b;
+            renumber[classes[b]] = num_classes++;
+        }
+        classes[b] = renumber[classes[b]];
+    }
+    return num_classes;
+}
+
+NfaGraph *nfa_graph_create(MultiNfa *m)
+{
+    NfaGraph *rv = (NfaGraph *)calloc(1, sizeof(*rv));
+    const size_t n = m->num_states;
+    size_t num_eps = m->num_epsilons;
+    size_t num_chars = m->num_chars;
+    NfaCharKey *edges = (NfaCharKey *)calloc(num_chars + 1, sizeof(*edges));
+    size_t *renumber = (size_t *)calloc(n, sizeof(*renumber));
+    size_t i, j;
+
+    rv->num_states = n;
+    rv->num_accept = m->num_accept;
+
+    /* Renumber so that states 1 through num_accept are the accepts. */
+    for (i = 0; i < m->num_accept; ++i)
+    {
+        renumber[m->accepts[i]] = i + 1;
+    }
+    for (i = 1, j = m->num_accept + 1; i < n; ++i)
+    {
+        if (!renumber[i])
+        {
+            renumber[i] = j++;
+        }
+    }
+
+    /* Only if some rule has groups: which rule each state is part of. */
+    for (i = 0; i < m->num_accept; ++i)
+    {
+        if (m->groups[i])
+        {
+            break;
+        }
+    }
+    if (i < m->num_accept)
+    {
+        rv->groups = (size_t *)calloc(m->num_accept + 1, sizeof(*rv->groups));
+        rv->owner = (size_t *)calloc(n, sizeof(*rv->owner));
+        rv->eps_tag = (size_t *)calloc(num_eps + 1, sizeof(*rv->eps_tag));
+        memcpy(rv->groups + 1, m->groups, m->num_accept * sizeof(*rv->groups));
+        /* `multi_nfa_add` allocates the accept state of a rule first. */
+        for (i = 0, j = 0; i < n; ++i)
+        {
+            if (j < m->num_accept && m->accepts[j] == i)
+            {
+                j++;
+            }
+            rv->owner[renumber[i]] = j;
+        }
+    }
+
+    /* epsilon edges, bucketed by source */
+    rv->eps_start = (size_t *)calloc(n + 1, sizeof(*rv->eps_start));
+    rv->eps_to = (size_t *)calloc(num_eps + 1, sizeof(*rv->eps_to));
+    for (i = 0; i < num_eps; ++i)
+    {
+        rv->eps_start[renumber[m->epsilons[i].from] + 1]++;
+    }
+    for (i = 0; i < n; ++i)
+    {
+        rv->eps_start[i + 1] += rv->eps_start[i];
+    }
+    {
+        size_t *fill = (size_t *)memdup(rv->eps_start, (n + 1) * sizeof(*fill));
+        for (i = 0; i < num_eps; ++i)
+        {
+            size_t f = fill[renumber[m->epsilons[i].from]]++;
+            rv->eps_to[f] = renumber[m->epsilons[i].to];
+            if (rv->eps_tag)
+            {
+                rv->eps_tag[f] = m->epsilons[i].tag;
+            }
+        }
+        free(fill);
+    }
+
+    for (i = 0; i < num_chars; ++i)
+    {
+        edges[i].from = renumber[m->chars[i].from];
+        edges[i].ch = m->chars[i].ch;
+        edges[i].to = renumber[m->chars[i].to];
+    }
+    free(renumber);
+
+    /* character edges: find classes, then bucket by source and class */
+    qsort(edges, num_chars, sizeof(*edges), char_key_group_compare);
+    rv->num_classes = compute_classes(edges, num_chars, rv->classes, rv->reps);
+    for (i = 0; i < num_chars; ++i)
+    {
+        edges[i].ch = rv->classes[edges[i].ch];
+    }
+    qsort(edges, num_chars, sizeof(*edges), char_key_class_compare);
+    rv->char_start = (size_t *)calloc(n + 1, sizeof(*rv->char_start));
+    rv->char_class = (unsigned char *)calloc(num_chars + 1, sizeof(*rv->char_class));
+    rv->char_to = (size_t *)calloc(num_chars + 1, sizeof(*rv->char_to));
+    for (i = 0, j = 0; i < num_chars; ++i)
+    {
+        if (j && edges[i].from == edges[j - 1].from && edges[i].ch == edges[j - 1].ch && edges[i].to == edges[j - 1].to)
+        {
+            continue;
+        }
+        edges[j++] = edges[i];
+    }
+    num_chars = j;
+    for (i = 0; i < num_chars; ++i)
+    {
+        rv->char_start[edges[i].from + 1]++;
+        rv->char_class[i] = edges[i].ch;
+        rv->char_to[i] = edges[i].to;
+    }
+    for (i = 0; i < n; ++i)
+    {
+        rv->char_start[i + 1] += rv->char_start[i];
+    }
+    free(edges);
+
+    rv->closures = (BitSet **)calloc(n, sizeof(*rv->closures));
+    rv->scratch = bitset_create(n);
+    rv->stack = (size_t *)calloc(n, sizeof(*rv->stack));
+    return rv;
+}
+
+void nfa_graph_destroy(NfaGraph *g)
+{
+    size_t i;
+    for (i = g->num_states; i--; )
+    {
+        if (g->closures[i])
+        {
+            bitset_destroy(g->closures[i]);
+        }
+    }
+    free(g->closures);
+    free(g->stack);
+    bitset_destroy(g->scratch);
+    free(g->eps_tag);
+    free(g->owner);
+    free(g->groups);
+    free(g->char_to);
+    free(g->char_class);
+    free(g->char_start);
+    free(g->eps_to);
+    free(g->eps_start);
+    free(g);
+}
+
+static bool nfa_graph_useful(NfaGraph *g, size_t s)
+{
+    /* Remove states without char transitions (allows much more merging). */
+    if (s > 0 && s <= g->num_accept)
+    {
+        return true;
+    }
+    return g->char_start[s] != g->char_start[s + 1];
+}
+
+BitSet *nfa_graph_closure(NfaGraph *g, size_t from)
+{
+    BitSet *seen = g->scratch;
+    BitSet *rv;
+    size_t top = 0;
+
+    if (g->closures[from])
+    {
+        return g->closures[from];
+    }
+
+    rv = bitset_create(g->num_states);
+    bitset_erase(seen);
+    bitset_set(seen, from);
+    g->stack[top++] = from;
+    while (top)
+    {
+        size_t s = g->stack[--top];
+        size_t e;
+        if (nfa_graph_useful(g, s))
+        {
+            bitset_set(rv, s);
+        }
+        for (e = g->eps_start[s]; e != g->eps_start[s + 1]; ++e)
+        {
+            size_t to = g->eps_to[e];
+            if (!bitset_test(seen, to))
+            {
+                bitset_set(seen, to);
+                g->stack[top++] = to;
+            }
+        }
+    }
+    g->closures[from] = rv;
+    return rv;
+}
+
+void nfa_graph_close_all(NfaGraph *g)
+{
+    size_t e;
+    (void)nfa_graph_closure(g, NFA_START);
+    for (e = 0; e < g->char_start[g->num_states]; ++e)
+    {
+        (void)nfa_graph_closure(g, g->char_to[e]);
+    }
+}
+
+size_t nfa_graph_accept(NfaGraph *g, BitSet *states)
+{
+    size_t i = bitset_find_next(states, 1);
+    if (i <= g->num_accept)
+    {
+        return i;
+    }
+    return 0;
+}
+
+struct StateMap
+{
+    HashMap *hash;
+    HashKey *vec;
+    size_t vec_cap;
+};
+StateMap *statemap_create(void)
+{
+    StateMap *rv = (StateMap *)calloc(1, sizeof(*rv));
+    rv->hash = map_create();
+    rv->vec_cap = 16;
+    rv->vec = (HashKey *)calloc(rv->vec_cap, sizeof(*rv->vec));
+    return rv;
+}
+
+void statemap_destroy(StateMap *sm)
+{
+    map_destroy(sm->hash);
+    free(sm->vec);
+    free(sm);
+}
+
+size_t statemap_intern(StateMap *sm, BitSet *bs)
+{
+    HashKey key = bitset_as_key(bs);
+    size_t old_size = map_size(sm->hash);
+    HashEntry *entry = map_entry(sm->hash, key, SEARCH_OR_INSERT);
+    size_t new_size = map_size(sm->hash);
+    if (old_size != new_size)
+    {
+        entry->value.ptr = (void *)old_size;
+        if (old_size == sm->vec_cap)
+        {
+            size_t old_cap = sm->vec_cap;
+            size_t new_cap = old_cap * 2;
+            HashKey *new_vec = (HashKey *)realloc(sm->vec, new_cap * sizeof(*new_vec));
+            memset(new_vec + old_cap, '\0', old_cap * sizeof(*new_vec));
+            sm->vec = new_vec;
+            sm->vec_cap = new_cap;
+        }
+        sm->vec[old_size] = entry->key;
+    }
+    return (size_t)entry->value.ptr;
+}
+
+size_t statemap_find(StateMap *sm, BitSet *bs)
+{
+    HashEntry *entry = map_entry(sm->hash, bitset_as_key(bs), SEARCH_ONLY);
+    if (!entry)
+    {
+        return (size_t)-1;
+    }
+    return (size_t)entry->value.ptr;
+}
+
+void statemap_index(StateMap *sm, size_t i, BitSet *bs)
+{
+    HashKey in_key = sm->vec[i];
+    HashKey out_key = bitset_as_key(bs);
+    /* Yes, it really is that simple. */
+    memcpy(out_key.data, in_key.data, out_key.len);
+}
+
+size_t statemap_size(StateMap *sm)
+{
+    return map_size(sm->hash);
+}
+
+
+/*
+    Successor sets are computed a batch of DFA states at a time, possibly
+    by several threads, but only ever interned by the calling thread, in
+    the same order as if there were no batching. So the result does not
+    depend on the number of threads.
+*/
+typedef struct DfaBatch DfaBatch;
+struct DfaBatch
+{
+    NfaGraph *graph;
+    StateMap *state_map;
+    size_t first;
+    size_t count;
+    /* Next slot to claim; shared between the threads. */
+    size_t claim;
+    /* Slot `i`, class `c` is at `i * num_classes + c`. */
+    BitSet **next_states;
+    bool *next_touched;
+    /* Whether a match may also start after every byte. */
+    bool unanchored;
+};
+
+static void *dfa_batch_work(void *arg)
+{
+    DfaBatch *b = (DfaBatch *)arg;
+    NfaGraph *graph = b->graph;
+    const size_t num_states = graph->num_states;
+    const size_t num_classes = graph->num_classes;
+    BitSet *current_states = bitset_create(num_states);
+    size_t slot;
+    while ((slot = __sync_fetch_and_add(&b->claim, 1)) < b->count)
+    {
+        BitSet **next_states = &b->next_states[slot * num_classes];
+        bool *next_touched = &b->next_touched[slot * num_classes];
+        size_t si;
+        statemap_index(b->state_map, b->first + slot, current_states);
+        /* Every class's successor set in a single pass over the members. */
+        for (si = bitset_find_next(current_states, 0); si < num_states; si = bitset_find_next(current_states, si + 1))
+        {
+            size_t e;
+            for (e = graph->char_start[si]; e != graph->char_start[si + 1]; ++e)
+            {
+                size_t ec = graph->char_class[e];
+                bitset_or_eq(next_states[ec], nfa_graph_closure(graph, graph->char_to[e]));
+                next_touched[ec] = true;
+            }
+        }
+        if (b->unanchored)
+        {
+            size_t c;
+            for (c = 0; c < num_classes; ++c)
+            {
+                bitset_or_eq(next_states[c], nfa_graph_closure(graph, NFA_START));
+                next_touched[c] = true;
+            }
+        }
+    }
+    bitset_destroy(current_states);
+    return NULL;
+}
+
+static void dfa_batch_run(DfaBatch *b, size_t num_threads)
+{
+    pthread_t threads[MRE_MAX_THREADS];
+    size_t num_started;
+    b->claim = 0;
+    if (num_threads > b->count)
+    {
+        num_threads = b->count;
+    }
+    /* The calling thread is one of the workers. */
+    for (num_started = 0; num_started + 1 < num_threads; ++num_started)
+    {
+        if (pthread_create(&threads[num_started], NULL, dfa_batch_work, b))
+        {
+            /* Not fatal; the remaining workers will do the rest. */
+            break;
+        }
+    }
+    dfa_batch_work(b);
+    while (num_started--)
+    {
+        pthread_join(threads[num_started], NULL);
+    }
+}
+
+static bool multi_nfa_to_dfa_impl(MultiNfa *m, MreDfa *dfa, const MreOptions *options, bool unanchored, bool *too_big)
+{
+    /*
+        Input:
+        state 0 is start
+        states 1 thorugh m->num_accept are accept
+
+        Output:
+        state 0 is fail
+        state 1 is start
+        any state may be accept
+     */
+    const size_t num_accept = m->num_accept;
+    const size_t num_states = m->num_states;
+    size_t num_threads = options->num_threads;
+    MreState *rv;
+    size_t num_classes;
+    size_t batch_cap;
+    size_t state_bytes;
+    size_t c;
+    bool invalid = false;
+    MreTagBuilder *tags = NULL;
+
+
+    /* setup */
+    BitSet *did_accept = bitset_create(num_accept);
+    NfaGraph *graph = nfa_graph_create(m);
+    BitSet *current_states = bitset_create(num_states);
+    StateMap *state_map = statemap_create();
+    DfaBatch batch;
+
+    if (num_threads < 1)
+    {
+        num_threads = 1;
+    }
+    if (num_threads > MRE_MAX_THREADS)
+    {
+        num_threads = MRE_MAX_THREADS;
+    }
+    if (num_threads > 1)
+    {
+        /* The workers must not write to the graph. */
+        nfa_graph_close_all(graph);
+    }
+    batch_cap = num_threads == 1 ? 1 : 16 * num_threads;
+
+    num_classes = graph->num_classes;
+    /*
+        What each state found will cost by the time it is compiled: its
+        NFA states in the map, and a goto for each class in both the DFA
+        and the compiled table (minimization only ever shrinks them).
+    */
+    state_bytes = sizeof(MreState) + (num_states + 7) / 8 + 2 * num_classes * sizeof(size_t);
+    if (graph->groups && !unanchored)
+    {
+        tags = tag_builder_create(graph, num_classes);
+    }
+    dfa->num_classes = num_classes;
+    memcpy(dfa->classes, graph->classes, sizeof(dfa->classes));
+    batch.graph = graph;
+    batch.state_map = state_map;
+    batch.unanchored = unanchored;
+    batch.next_states = (BitSet **)calloc(batch_cap * num_classes, sizeof(*batch.next_states));
+    batch.next_touched = (bool *)calloc(batch_cap * num_classes, sizeof(*batch.next_touched));
+    for (c = 0; c < batch_cap * num_classes; ++c)
+    {
+        batch.next_states[c] = bitset_create(num_states);
+    }
+
+    /* fail = 0 */
+    (void)statemap_intern(state_map, current_states);
+    bitset_or_eq(current_states, nfa_graph_closure(graph, NFA_START));
+    if (nfa_graph_accept(graph, current_states))
+    {
+        invalid = true;
+    }
+    /* start = 1*/
+    if (!statemap_intern(state_map, current_states))
+        abort();
+
+
+    /* main loop */
+    {
+        size_t rv_cap = 16;
+        rv = (MreState *)calloc(rv_cap, sizeof(*rv));
+        size_t i;
+        /* fail has no gotos */
+        rv[0].first_goto = 255;
+        rv[0].last_goto = 0;
+        /* statemap keeps growing as we go */
+        for (i = 1; !invalid; )
+        {
+            size_t found = statemap_size(state_map);
+            size_t bytes = found * state_bytes + (tags ? tag_builder_bytes(tags) : 0);
+            size_t slot;
+            if (options->progress && !options->progress(options->progress_data, i, found, bytes))
+            {
+                *too_big = true;
+                break;
+            }
+            if ((options->max_states && found > options->max_states)
+                    || (options->max_bytes && bytes > options->max_bytes))
+            {
+                *too_big = true;
+                break;
+            }
+            if (i == found)
+            {
+                break;
+            }
+            batch.first = i;
+            batch.count = statemap_size(state_map) - i;
+            if (batch.count > batch_cap)
+            {
+                batch.count = batch_cap;
+            }
+            dfa_batch_run(&batch, num_threads);
+
+            for (slot = 0; slot < batch.count; ++slot, ++i)
+            {
+                BitSet **next_states = &batch.next_states[slot * num_classes];
+                bool *next_touched = &batch.next_touched[slot * num_classes];
+                MreState *rvi;
+                size_t next_gotos[256];
+                unsigned char first_goto = 255;
+                unsigned char last_goto = 0;
+                if (i == rv_cap)
+                {
+                    size_t old_rv_bytes = rv_cap * sizeof(*rv);
+                    size_t new_rv_cap = rv_cap * 2;
+                    MreState *new_rv = (MreState *)realloc(rv, new_rv_cap * sizeof(*rv));
+                    memset((char *)new_rv + old_rv_bytes, '\0', old_rv_bytes);
+                    rv_cap = new_rv_cap;
+                    rv = new_rv;
+                }
+                rvi = &rv[i];
+                statemap_index(state_map, i, current_states);
+                rvi->accept = nfa_graph_accept(graph, current_states);
+                if (rvi->accept)
+                {
+                    bitset_set(did_accept, rvi->accept - 1);
+                }
+                for (c = 0; c < num_classes; ++c)
+                {
+                    if (tags)
+                    {
+                        tag_builder_goto(tags, current_states, c, next_touched[c] ? next_states[c] : NULL);
+                    }
+                    if (!next_touched[c])
+                    {
+                        next_gotos[c] = 0;
+                        continue;
+                    }
+                    next_gotos[c] = statemap_intern(state_map, next_states[c]);
+                    bitset_erase(next_states[c]);
+                    next_touched[c] = false;
+                    if (next_gotos[c])
+                    {
+                        if (c < first_goto)
+                        {
+                            first_goto = c;
+                        }
+                        if (c > last_goto)
+                        {
+                            last_goto = c;
+                        }
+                    }
+                }
+                rvi->first_goto = first_goto;
+                rvi->last_goto = last_goto;
+                if (first_goto == 255 && last_goto == 0)
+                {
+                    rvi->some_gotos = NULL;
+                }
+                else
+                {
+                    size_t num_gotos = last_goto - first_goto + 1;
+                    assert (first_goto <= last_goto);
+                    rvi->some_gotos = (size_t *)memdup(&next_gotos[first_goto], num_gotos * sizeof(size_t));
+                }
+            }
+        }
+        dfa->num_states = i;
+    }
+
+
+    /* teardown */
+    if (!*too_big && !bitset_any(did_accept))
+    {
+        /* TODO warn about partials */
+        invalid = true;
+    }
+
+    if (tags)
+    {
+        dfa->tags = tag_builder_finish(tags);
+    }
+    statemap_destroy(state_map);
+    for (c = batch_cap * num_classes; c--; )
+    {
+        bitset_destroy(batch.next_states[c]);
+    }
+    free(batch.next_touched);
+    free(batch.next_states);
+    bitset_destroy(current_states);
+    nfa_graph_destroy(graph);
+    bitset_destroy(did_accept);
+
+    dfa->states = rv;
+    return !invalid && !*too_big;
+}
+
+static MreDfa *multi_nfa_to_dfa_mode(MultiNfa *m, const MreOptions *options, bool unanchored, bool *too_big)
+{
+    MreDfa *rv;
+    *too_big = false;
+    if (!m->num_accept)
+    {
+        return NULL;
+    }
+    rv = (MreDfa *)calloc(1, sizeof(*rv));
+    if (!multi_nfa_to_dfa_impl(m, rv, options, unanchored, too_big))
+    {
+        mre_dfa_destroy(rv);
+        return NULL;
+    }
+    /* Merging states would mix up their registers. */
+    if (!rv->tags)
+    {
+        mre_dfa_minimize(rv);
+    }
+    return rv;
+}
+
+MreDfa *multi_nfa_to_dfa(MultiNfa *m, const MreOptions *options, bool *too_big)
+{
+    return multi_nfa_to_dfa_mode(m, options, false, too_big);
+}
+
+MreDfa *multi_nfa_to_search_dfa(MultiNfa *m, const MreOptions *options)
+{
+    bool too_big;
+    return multi_nfa_to_dfa_mode(m, options, true, &too_big);
+}
+
+void mre_dfa_destroy(MreDfa *dfa)
+{
+    size_t i;
+    for (i = dfa->num_states; i--; )
+    {
+        free(dfa->states[i].some_gotos);
+    }
+    free(dfa->states);
+    if (dfa->tags)
+    {
+        mre_tags_destroy(dfa->tags);
+    }
+    free(dfa);
+}
+
+MreRules *multi_nfa_to_lazy(MultiNfa *m)
+{
+    MreRules *rv = (MreRules *)calloc(1, sizeof(*rv));
+    NfaGraph *graph = nfa_graph_create(m);
+    rv->refcount = 1;
+    nfa_graph_close_all(graph);
+    /* The same restrictions as the full DFA, minus the partials check. */
+    if (!graph->num_accept || nfa_graph_accept(graph, nfa_graph_closure(graph, NFA_START)))
+    {
+        nfa_graph_destroy(graph);
+        free(rv);
+        return NULL;
+    }
+    rv->num_classes = graph->num_classes;
+    memcpy(rv->classes, graph->classes, sizeof(rv->classes));
+    rv->graph = graph;
+    return rv;
+}
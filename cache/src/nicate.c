@@ -0,0 +1 @@
+/* stub file to build library */
@@ -0,0 +1,212 @@
+#include "simd.h"
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_X86 1
+#include <immintrin.h>
+#else
+#define SIMD_X86 0
+#endif
+
+
+typedef size_t (*SkipRangesFn)(const char *buf, size_t len, size_t num_ranges, const unsigned char *lo, const unsigned char *hi);
+typedef size_t (*CountByteFn)(const char *buf, size_t len, char c);
+
+static size_t skip_ranges_scalar(const char *buf, size_t len, size_t num_ranges, const unsigned char *lo, const unsigned char *hi)
+{
+    size_t i;
+    for (i = 0; i < len; ++i)
+    {
+        unsigned char c = buf[i];
+        size_t r;
+        for (r = 0; r < num_ranges; ++r)
+        {
+            /* Unsigned wraparound makes this one comparison. */
+            if ((unsigned char)(c - lo[r]) <= (unsigned char)(hi[r] - lo[r]))
+            {
+                break;
+            }
+        }
+        if (r == num_ranges)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+#if SIMD_X86
+/*
+    Same trick as the scalar version: `c - lo <= hi - lo`, where the
+    unsigned comparison `a <= b` is `min(a, b) == a`.
+*/
+__attribute__((target("sse2")))
+static size_t skip_ranges_sse2(const char *buf, size_t len, size_t num_ranges, const unsigned char *lo, const unsigned char *hi)
+{
+    __m128i lo_v[4], span_v[4];
+    size_t i = 0, r;
+    for (r = 0; r < num_ranges; ++r)
+    {
+        lo_v[r] = _mm_set1_epi8(lo[r]);
+        span_v[r] = _mm_set1_epi8(hi[r] - lo[r]);
+    }
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)(buf + i));
+        __m128i in = _mm_setzero_si128();
+        unsigned mask;
+        for (r = 0; r < num_ranges; ++r)
+        {
+            __m128i d = _mm_sub_epi8(x, lo_v[r]);
+            in = _mm_or_si128(in, _mm_cmpeq_epi8(_mm_min_epu8(d, span_v[r]), d));
+        }
+        mask = ~(unsigned)_mm_movemask_epi8(in) & 0xFFFFu;
+        if (mask)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return i + skip_ranges_scalar(buf + i, len - i, num_ranges, lo, hi);
+}
+
+__attribute__((target("avx2")))
+static size_t skip_ranges_avx2(const char *buf, size_t len, size_t num_ranges, const unsigned char *lo, const unsigned char *hi)
+{
+    __m256i lo_v[4], span_v[4];
+    size_t i = 0, r;
+    for (r = 0; r < num_ranges; ++r)
+    {
+        lo_v[r] = _mm256_set1_epi8(lo[r]);
+        span_v[r] = _mm256_set1_epi8(hi[r] - lo[r]);
+    }
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(buf + i));
+        __m256i in = _mm256_setzero_si256();
+        unsigned mask;
+        for (r = 0; r < num_ranges; ++r)
+        {
+            __m256i d = _mm256_sub_epi8(x, lo_v[r]);
+            in = _mm256_or_si256(in, _mm256_cmpeq_epi8(_mm256_min_epu8(d, span_v[r]), d));
+        }
+        mask = ~(unsigned)_mm256_movemask_epi8(in);
+        if (mask)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return i + skip_ranges_scalar(buf + i, len - i, num_ranges, lo, hi);
+}
+#endif
+
+static SkipRangesFn pick_skip_ranges(void)
+{
+#if SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return skip_ranges_avx2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return skip_ranges_sse2;
+    }
+#endif
+    return skip_ranges_scalar;
+}
+
+/* Racing threads all store the same value. */
+static SkipRangesFn skip_ranges_impl;
+
+size_t simd_skip_ranges(const char *buf, size_t len, size_t num_ranges, const unsigned char *lo, const unsigned char *hi)
+{
+    if (!skip_ranges_impl)
+    {
+        skip_ranges_impl = pick_skip_ranges();
+    }
+    return skip_ranges_impl(buf, len, num_ranges, lo, hi);
+}
+
+
+static size_t count_byte_scalar(const char *buf, size_t len, char c)
+{
+    size_t i, n = 0;
+    for (i = 0; i < len; ++i)
+    {
+        n += buf[i] == c;
+    }
+    return n;
+}
+
+#if SIMD_X86
+__attribute__((target("sse2")))
+static size_t count_byte_sse2(const char *buf, size_t len, char c)
+{
+    __m128i c_v = _mm_set1_epi8(c);
+    size_t i = 0, n = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)(buf + i));
+        n += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(x, c_v)));
+    }
+    return n + count_byte_scalar(buf + i, len - i, c);
+}
+
+__attribute__((target("avx2")))
+static size_t count_byte_avx2(const char *buf, size_t len, char c)
+{
+    __m256i c_v = _mm256_set1_epi8(c);
+    size_t i = 0, n = 0;
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(buf + i));
+        n += __builtin_popcount((unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, c_v)));
+    }
+    return n + count_byte_scalar(buf + i, len - i, c);
+}
+#endif
+
+static CountByteFn pick_count_byte(void)
+{
+#if SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return count_byte_avx2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return count_byte_sse2;
+    }
+#endif
+    return count_byte_scalar;
+}
+
+static CountByteFn count_byte_impl;
+
+size_t simd_count_byte(const char *buf, size_t len, char c)
+{
+    if (!count_byte_impl)
+    {
+        count_byte_impl = pick_count_byte();
+    }
+    return count_byte_impl(buf, len, c);
+}
@@ -0,0 +1,33 @@
+#pragma once
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stddef.h>
+
+
+/*
+    Returns the length of the longest prefix of `buf` whose bytes all lie
+    in one of the inclusive ranges `lo[i]` through `hi[i]`.
+
+    Uses SSE2 or AVX2 when the CPU has them, checked at the first call.
+*/
+size_t simd_skip_ranges(const char *buf, size_t len, size_t num_ranges, const unsigned char *lo, const unsigned char *hi);
+/* Returns the number of times `c` occurs in `buf`, likewise. */
+size_t simd_count_byte(const char *buf, size_t len, char c);
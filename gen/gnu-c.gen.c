@@ -0,0 +1,4321 @@
+/* Generated file, edit cache/gram/gnu-c.gram instead. */
+#include "gnu-c.gen.h"
+
+/*
+    Copyright © 2015-2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "pool.h"
+
+
+/* Concrete types only. */
+typedef enum GnuCAstType GnuCAstType;
+enum GnuCAstType
+{
+    GNU_C_NOTHING,
+    GNU_C_ATOM_ADDRESS_SPACE,
+    GNU_C_ATOM_BINARY_CONSTANT,
+    GNU_C_ATOM_CHARACTER_CONSTANT,
+    GNU_C_ATOM_COMMENT,
+    GNU_C_ATOM_DECIMAL_CONSTANT,
+    GNU_C_ATOM_DECIMAL_FLOATING_CONSTANT,
+    GNU_C_ATOM_HEXADECIMAL_CONSTANT,
+    GNU_C_ATOM_HEXADECIMAL_FLOATING_CONSTANT,
+    GNU_C_ATOM_IDENTIFIER,
+    GNU_C_ATOM_OCTAL_CONSTANT,
+    GNU_C_ATOM_STRING_LITERAL,
+    GNU_C_ATOM_TYPEDEF_NAME,
+    GNU_C_KW_ACCUM,
+    GNU_C_KW_ALIGNAS,
+    GNU_C_KW_ALIGNOF,
+    GNU_C_KW_ASM,
+    GNU_C_KW_ATOMIC_AS_QUALIFIER,
+    GNU_C_KW_ATOMIC_AS_SPECIFIER,
+    GNU_C_KW_ATTRIBUTE,
+    GNU_C_KW_AUTO,
+    GNU_C_KW_AUTO_TYPE,
+    GNU_C_KW_BOOL,
+    GNU_C_KW_BREAK,
+    GNU_C_KW_BUILTIN_CHOOSE_EXPR,
+    GNU_C_KW_BUILTIN_COMPLEX,
+    GNU_C_KW_BUILTIN_OFFSETOF,
+    GNU_C_KW_BUILTIN_SHUFFLE,
+    GNU_C_KW_BUILTIN_TYPES_COMPATIBLE_P,
+    GNU_C_KW_BUILTIN_VA_ARG,
+    GNU_C_KW_CASE,
+    GNU_C_KW_CHAR,
+    GNU_C_KW_COMPLEX,
+    GNU_C_KW_CONST,
+    GNU_C_KW_CONTINUE,
+    GNU_C_KW_DECIMAL128,
+    GNU_C_KW_DECIMAL32,
+    GNU_C_KW_DECIMAL64,
+    GNU_C_KW_DEFAULT,
+    GNU_C_KW_DO,
+    GNU_C_KW_DOUBLE,
+    GNU_C_KW_ELSE,
+    GNU_C_KW_ENUM,
+    GNU_C_KW_EXTENSION,
+    GNU_C_KW_EXTERN,
+    GNU_C_KW_FLOAT,
+    GNU_C_KW_FOR,
+    GNU_C_KW_FRACT,
+    GNU_C_KW_FUNC,
+    GNU_C_KW_FUNCTION,
+    GNU_C_KW_GENERIC,
+    GNU_C_KW_GOTO,
+    GNU_C_KW_IF,
+    GNU_C_KW_IMAG,
+    GNU_C_KW_INLINE,
+    GNU_C_KW_INT,
+    GNU_C_KW_LABEL,
+    GNU_C_KW_LONG,
+    GNU_C_KW_NORETURN,
+    GNU_C_KW_PRETTY_FUNCTION,
+    GNU_C_KW_REAL,
+    GNU_C_KW_REGISTER,
+    GNU_C_KW_RESTRICT,
+    GNU_C_KW_RETURN,
+    GNU_C_KW_SAT,
+    GNU_C_KW_SHORT,
+    GNU_C_KW_SIGNED,
+    GNU_C_KW_SIZEOF,
+    GNU_C_KW_STATIC,
+    GNU_C_KW_STATIC_ASSERT,
+    GNU_C_KW_STRUCT,
+    GNU_C_KW_SWITCH,
+    GNU_C_KW_THREAD,
+    GNU_C_KW_THREAD_LOCAL,
+    GNU_C_KW_TYPEDEF,
+    GNU_C_KW_TYPEOF,
+    GNU_C_KW_UNION,
+    GNU_C_KW_UNSIGNED,
+    GNU_C_KW_VOID,
+    GNU_C_KW_VOLATILE,
+    GNU_C_KW_WHILE,
+    GNU_C_SYM_AMPERSAND,
+    GNU_C_SYM_AMPERSAND_ASSIGN,
+    GNU_C_SYM_ARROW,
+    GNU_C_SYM_ASSIGN,
+    GNU_C_SYM_BANG,
+    GNU_C_SYM_CARET,
+    GNU_C_SYM_CARET_ASSIGN,
+    GNU_C_SYM_COLON,
+    GNU_C_SYM_COMMA,
+    GNU_C_SYM_DECR,
+    GNU_C_SYM_DOT,
+    GNU_C_SYM_ELLIPSIS,
+    GNU_C_SYM_EQ,
+    GNU_C_SYM_GE,
+    GNU_C_SYM_GT,
+    GNU_C_SYM_INCR,
+    GNU_C_SYM_LBRACE,
+    GNU_C_SYM_LBRACKET,
+    GNU_C_SYM_LE,
+    GNU_C_SYM_LOGICAL_AND,
+    GNU_C_SYM_LOGICAL_OR,
+    GNU_C_SYM_LPAREN,
+    GNU_C_SYM_LSHIFT,
+    GNU_C_SYM_LSHIFT_ASSIGN,
+    GNU_C_SYM_LT,
+    GNU_C_SYM_MINUS,
+    GNU_C_SYM_MINUS_ASSIGN,
+    GNU_C_SYM_NE,
+    GNU_C_SYM_PERCENT,
+    GNU_C_SYM_PERCENT_ASSIGN,
+    GNU_C_SYM_PIPE,
+    GNU_C_SYM_PIPE_ASSIGN,
+    GNU_C_SYM_PLUS,
+    GNU_C_SYM_PLUS_ASSIGN,
+    GNU_C_SYM_QUERY,
+    GNU_C_SYM_RBRACE,
+    GNU_C_SYM_RBRACKET,
+    GNU_C_SYM_RPAREN,
+    GNU_C_SYM_RSHIFT,
+    GNU_C_SYM_RSHIFT_ASSIGN,
+    GNU_C_SYM_SEMICOLON,
+    GNU_C_SYM_SLASH,
+    GNU_C_SYM_SLASH_ASSIGN,
+    GNU_C_SYM_STAR,
+    GNU_C_SYM_STAR_ASSIGN,
+    GNU_C_SYM_TILDE,
+    GNU_C_TREE_ASM_DEFINITION,
+    GNU_C_TREE_ASM_GOTO_ARGUMENT,
+    GNU_C_TREE_ATOMIC_TYPE_SPECIFIER,
+    GNU_C_TREE_ATTRIBUTE,
+    GNU_C_TREE_ATTRIBUTES,
+    GNU_C_TREE_BLOCK_ITEM_LIST,
+    GNU_C_TREE_COMPOUND_STATEMENT,
+    GNU_C_TREE_CONDITION,
+    GNU_C_TREE_DECLARATION,
+    GNU_C_TREE_DECLARATION_LIST,
+    GNU_C_TREE_DECLARATOR,
+    GNU_C_TREE_DESIGNATED_INITIALIZER,
+    GNU_C_TREE_DESIGNATOR_LIST,
+    GNU_C_TREE_DO_STATEMENT,
+    GNU_C_TREE_EXPRESSION_STATEMENT,
+    GNU_C_TREE_EXTERNAL_DECLARATIONS,
+    GNU_C_TREE_GENERIC_SELECTION,
+    GNU_C_TREE_HEAD_DECLARATION_SPECIFIERS,
+    GNU_C_TREE_IF_ELSE_STATEMENT,
+    GNU_C_TREE_IF_ELSE_STATEMENT_EXCEPT_IF,
+    GNU_C_TREE_IF_STATEMENT,
+    GNU_C_TREE_LABEL_DECLARATION,
+    GNU_C_TREE_LABEL_DECLARATIONS,
+    GNU_C_TREE_LABELS,
+    GNU_C_TREE_NESTED_FUNCTION_DEFINITION,
+    GNU_C_TREE_PARAMETER_FORWARD_DECLARATION,
+    GNU_C_TREE_PARAMETER_FORWARD_DECLARATIONS,
+    GNU_C_TREE_POINTER,
+    GNU_C_TREE_SIMPLE_ASM_EXPR,
+    GNU_C_TREE_STATEMENT,
+    GNU_C_TREE_STATEMENT_EXCEPT_IF,
+    GNU_C_TREE_STATIC_ASSERT_DECLARATION,
+    GNU_C_TREE_STRUCT_DECLARATION_LIST,
+    GNU_C_TREE_SWITCH_STATEMENT,
+    GNU_C_TREE_SWITCH_STATEMENT_EXCEPT_IF,
+    GNU_C_TREE_TAG_ABSTRACT_PARAMETER_DECLARATION,
+    GNU_C_TREE_TAG_ACTUAL_CAST_EXPRESSION,
+    GNU_C_TREE_TAG_ADDRESSOF_EXPRESSION,
+    GNU_C_TREE_TAG_ALIGNAS_EXPR_SPECIFIER,
+    GNU_C_TREE_TAG_ALIGNAS_TYPE_SPECIFIER,
+    GNU_C_TREE_TAG_ALIGNOF_EXPRESSION_EXPRESSION,
+    GNU_C_TREE_TAG_ALIGNOF_TYPE_EXPRESSION,
+    GNU_C_TREE_TAG_ANONYMOUS_ASM_OPERAND,
+    GNU_C_TREE_TAG_ARRAY_DIRECT_ABSTRACT_DECLARATOR,
+    GNU_C_TREE_TAG_ARRAY_DIRECT_DECLARATOR,
+    GNU_C_TREE_TAG_ARRAY_ELEMENT_DESIGNATOR,
+    GNU_C_TREE_TAG_ARRAY_MEMBER_OFFSET_DESIGNATOR,
+    GNU_C_TREE_TAG_ARRAY_RANGE_DESIGNATOR,
+    GNU_C_TREE_TAG_ASM_ARGUMENT_OUT,
+    GNU_C_TREE_TAG_ASM_ARGUMENT_OUT_IN,
+    GNU_C_TREE_TAG_ASM_ARGUMENT_OUT_IN_CLOBBER,
+    GNU_C_TREE_TAG_ASM_COMMON_STATEMENT,
+    GNU_C_TREE_TAG_ASM_GOTO_STATEMENT,
+    GNU_C_TREE_TAG_ATTRIB_WITH_ARG,
+    GNU_C_TREE_TAG_BIT_AND_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_BIT_AND_EXPRESSION,
+    GNU_C_TREE_TAG_BIT_IOR_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_BIT_IOR_EXPRESSION,
+    GNU_C_TREE_TAG_BIT_NOT_EXPRESSION,
+    GNU_C_TREE_TAG_BIT_XOR_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_BIT_XOR_EXPRESSION,
+    GNU_C_TREE_TAG_BITFIELD_DECLARATOR,
+    GNU_C_TREE_TAG_BRACED_INITIALIZER,
+    GNU_C_TREE_TAG_BRACED_INITIALIZER_COMMA,
+    GNU_C_TREE_TAG_BREAK_STATEMENT,
+    GNU_C_TREE_TAG_BUILTIN_CHOOSE_EXPR_EXPRESSION,
+    GNU_C_TREE_TAG_BUILTIN_COMPLEX_EXPRESSION,
+    GNU_C_TREE_TAG_BUILTIN_MIX_SHUFFLE_EXPRESSION,
+    GNU_C_TREE_TAG_BUILTIN_OFFSETOF_EXPRESSION,
+    GNU_C_TREE_TAG_BUILTIN_SIMPLE_SHUFFLE_EXPRESSION,
+    GNU_C_TREE_TAG_BUILTIN_TYPES_COMPATIBLE_P_EXPRESSION,
+    GNU_C_TREE_TAG_BUILTIN_VA_ARG_EXPRESSION,
+    GNU_C_TREE_TAG_C99_DESIGNATION,
+    GNU_C_TREE_TAG_CALL_EXPRESSION,
+    GNU_C_TREE_TAG_CASE_LABEL,
+    GNU_C_TREE_TAG_CASE_RANGE_LABEL,
+    GNU_C_TREE_TAG_COMPOUND_LITERAL,
+    GNU_C_TREE_TAG_COMPOUND_LITERAL_COMMA,
+    GNU_C_TREE_TAG_COMPUTED_GOTO_STATEMENT,
+    GNU_C_TREE_TAG_CONCRETE_PARAMETER_DECLARATION,
+    GNU_C_TREE_TAG_CONTINUE_STATEMENT,
+    GNU_C_TREE_TAG_DEFAULT_GENERIC_ASSOCIATION,
+    GNU_C_TREE_TAG_DEFAULT_LABEL,
+    GNU_C_TREE_TAG_DEREF_EXPRESSION,
+    GNU_C_TREE_TAG_DIRECT_MEMBER_EXPRESSION,
+    GNU_C_TREE_TAG_DIVIDE_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_DIVIDE_EXPRESSION,
+    GNU_C_TREE_TAG_EQ_EXPRESSION,
+    GNU_C_TREE_TAG_EXTENSION_EXPRESSION,
+    GNU_C_TREE_TAG_EXTENSION_EXTERNAL_DECLARATION,
+    GNU_C_TREE_TAG_EXTENSION_NESTED_DECLARATION,
+    GNU_C_TREE_TAG_EXTENSION_STRUCT_DECLARATION,
+    GNU_C_TREE_TAG_FOR_DECL_STATEMENT,
+    GNU_C_TREE_TAG_FOR_DECL_STATEMENT_EXCEPT_IF,
+    GNU_C_TREE_TAG_FOR_EXPR_STATEMENT,
+    GNU_C_TREE_TAG_FOR_EXPR_STATEMENT_EXCEPT_IF,
+    GNU_C_TREE_TAG_FORWARD_ENUM_SPECIFIER,
+    GNU_C_TREE_TAG_FORWARD_PARAM_FUN_DIRECT_ABSTRACT_DECLARATOR,
+    GNU_C_TREE_TAG_FORWARD_PARAM_FUN_DIRECT_DECLARATOR,
+    GNU_C_TREE_TAG_FORWARD_STRUCT_OR_UNION_SPECIFIER,
+    GNU_C_TREE_TAG_FULL_ENUM_SPECIFIER,
+    GNU_C_TREE_TAG_FULL_STRUCT_OR_UNION_SPECIFIER,
+    GNU_C_TREE_TAG_FUN_DIRECT_ABSTRACT_DECLARATOR,
+    GNU_C_TREE_TAG_FUN_DIRECT_DECLARATOR,
+    GNU_C_TREE_TAG_GE_EXPRESSION,
+    GNU_C_TREE_TAG_GNU_DESIGNATION,
+    GNU_C_TREE_TAG_GNU_STATEMENT_EXPRESSION,
+    GNU_C_TREE_TAG_GOTO_STATEMENT,
+    GNU_C_TREE_TAG_GT_EXPRESSION,
+    GNU_C_TREE_TAG_HEAD_TAIL_DECLARATION_SPECIFIERS,
+    GNU_C_TREE_TAG_IMAG_EXPRESSION,
+    GNU_C_TREE_TAG_IMPLICIT_INT_DECLARATION,
+    GNU_C_TREE_TAG_IMPLICIT_INT_FUNCTION_DEFINITION,
+    GNU_C_TREE_TAG_INDEX_EXPRESSION,
+    GNU_C_TREE_TAG_INDIRECT_MEMBER_EXPRESSION,
+    GNU_C_TREE_TAG_INITIALIZED_DECLARATOR,
+    GNU_C_TREE_TAG_INITIALIZED_ENUMERATOR,
+    GNU_C_TREE_TAG_LABEL_ADDRESS_EXPRESSION,
+    GNU_C_TREE_TAG_LE_EXPRESSION,
+    GNU_C_TREE_TAG_LEFT_SHIFT_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_LEFT_SHIFT_EXPRESSION,
+    GNU_C_TREE_TAG_LEGACY_FUN_DIRECT_DECLARATOR,
+    GNU_C_TREE_TAG_LOG_AND_EXPRESSION,
+    GNU_C_TREE_TAG_LOG_NOT_EXPRESSION,
+    GNU_C_TREE_TAG_LOG_OR_EXPRESSION,
+    GNU_C_TREE_TAG_LT_EXPRESSION,
+    GNU_C_TREE_TAG_MEMBER_DECLARATION,
+    GNU_C_TREE_TAG_MEMBER_DECLARATOR,
+    GNU_C_TREE_TAG_MEMBER_DESIGNATOR,
+    GNU_C_TREE_TAG_MINUS_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_MINUS_EXPRESSION,
+    GNU_C_TREE_TAG_MODULO_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_MODULO_EXPRESSION,
+    GNU_C_TREE_TAG_MULTI_ASM_CLOBBERS,
+    GNU_C_TREE_TAG_MULTI_ASM_GOTO_OPERANDS,
+    GNU_C_TREE_TAG_MULTI_ASM_OPERANDS,
+    GNU_C_TREE_TAG_MULTI_ATTRIBUTE_LIST,
+    GNU_C_TREE_TAG_MULTI_ENUMERATOR_LIST,
+    GNU_C_TREE_TAG_MULTI_EXPR_LIST,
+    GNU_C_TREE_TAG_MULTI_GENERIC_ASSOC_LIST,
+    GNU_C_TREE_TAG_MULTI_IDENTIFIER_LIST,
+    GNU_C_TREE_TAG_MULTI_INIT_DECLARATOR_LIST,
+    GNU_C_TREE_TAG_MULTI_INITIALIZER_LIST,
+    GNU_C_TREE_TAG_MULTI_PARAMETER_LIST,
+    GNU_C_TREE_TAG_MULTI_STRUCT_DECLARATOR,
+    GNU_C_TREE_TAG_NAMED_ASM_OPERAND,
+    GNU_C_TREE_TAG_NAMED_LABEL,
+    GNU_C_TREE_TAG_NAMED_MEMBER_OFFSET_DESIGNATOR,
+    GNU_C_TREE_TAG_NE_EXPRESSION,
+    GNU_C_TREE_TAG_ONLY_HEAD_DECLARATION_SPECIFIERS,
+    GNU_C_TREE_TAG_PAREN_DIRECT_ABSTRACT_DECLARATOR,
+    GNU_C_TREE_TAG_PAREN_DIRECT_DECLARATOR,
+    GNU_C_TREE_TAG_PAREN_EXPRESSION,
+    GNU_C_TREE_TAG_PLUS_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_PLUS_EXPRESSION,
+    GNU_C_TREE_TAG_POINTER_ABSTRACT_DECLARATOR,
+    GNU_C_TREE_TAG_POST_DECR_EXPRESSION,
+    GNU_C_TREE_TAG_POST_INCR_EXPRESSION,
+    GNU_C_TREE_TAG_PRE_DECR_EXPRESSION,
+    GNU_C_TREE_TAG_PRE_INCR_EXPRESSION,
+    GNU_C_TREE_TAG_Q_LIST_QUALIFIER,
+    GNU_C_TREE_TAG_REAL_EXPRESSION,
+    GNU_C_TREE_TAG_RETURN_STATEMENT,
+    GNU_C_TREE_TAG_REVERSE_STATIC_ARRAY_DECLARATOR,
+    GNU_C_TREE_TAG_RIGHT_SHIFT_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_RIGHT_SHIFT_EXPRESSION,
+    GNU_C_TREE_TAG_SIMPLE_ARRAY_DECLARATOR,
+    GNU_C_TREE_TAG_SIMPLE_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_SIZEOF_EXPRESSION_EXPRESSION,
+    GNU_C_TREE_TAG_SIZEOF_TYPE_EXPRESSION,
+    GNU_C_TREE_TAG_SQ_LIST_QUALIFIER,
+    GNU_C_TREE_TAG_SQ_LIST_SPECIFIER,
+    GNU_C_TREE_TAG_STAR_ARRAY_DECLARATOR,
+    GNU_C_TREE_TAG_STATIC_ARRAY_DECLARATOR,
+    GNU_C_TREE_TAG_TERNARY_EXPRESSION,
+    GNU_C_TREE_TAG_TIMES_ASSIGNMENT_EXPRESSION,
+    GNU_C_TREE_TAG_TIMES_EXPRESSION,
+    GNU_C_TREE_TAG_TYPE_GENERIC_ASSOCIATION,
+    GNU_C_TREE_TAG_TYPEOF_EXPR_SPECIFIER,
+    GNU_C_TREE_TAG_TYPEOF_TYPE_SPECIFIER,
+    GNU_C_TREE_TAG_UNARY_MINUS_EXPRESSION,
+    GNU_C_TREE_TAG_UNARY_PLUS_EXPRESSION,
+    GNU_C_TREE_TAG_UNINITIALIZED_DECLARATOR,
+    GNU_C_TREE_TAG_VARIADIC_PARAMETER_LIST,
+    GNU_C_TREE_TAIL_DECLARATION_SPECIFIERS,
+    GNU_C_TREE_TYPE_NAME,
+    GNU_C_TREE_WHILE_STATEMENT,
+    GNU_C_TREE_WHILE_STATEMENT_EXCEPT_IF,
+};
+
+struct GnuCAst
+{
+    GnuCAstType type;
+    size_t total_tokens;
+    size_t num_children;
+    __extension__ union { const char *raw; GnuCAst **children; };
+};
+
+static GnuCAst gnu_c_nothing = {GNU_C_NOTHING, 0, 0, {""}};
+
+GnuCNothing *gnu_c_create_nothing(Pool *pool)
+{
+    (void)pool;
+    return (GnuCNothing *)&gnu_c_nothing;
+}
+static GnuCAst *gnu_c_create_terminal(Pool *pool, GnuCAstType type, const char *raw, bool dup)
+{
+    GnuCAst rv;
+    memset(&rv, 0, sizeof(rv));
+    rv.type = type;
+    rv.total_tokens = 1;
+    rv.num_children = 0;
+    if (dup)
+        raw = pool_intern_string(pool, raw);
+    rv.raw = raw;
+    return (GnuCAst *)(const GnuCAst *)pool_intern(pool, &rv, sizeof(rv));
+}
+static GnuCAst *gnu_c_create_nonterminal(Pool *pool, GnuCAstType type, size_t nargs, GnuCAst **args)
+{
+    GnuCAst rv;
+    size_t i, only = (size_t)-2;
+    assert (nargs >= 2);
+    for (i = 0; i < nargs; ++i)
+    {
+        if (!gnu_c_is_nothing(args[i]))
+        {
+            if (only == (size_t)-2)
+            {
+                only = i;
+            }
+            else
+            {
+                only = (size_t)-1;
+                break;
+            }
+        }
+
+    }
+    assert (only != (size_t)-2);
+    if (only != (size_t)-1)
+    {
+        return args[only];
+    }
+    memset(&rv, 0, sizeof(rv));
+    rv.type = type;
+    rv.total_tokens = 0;
+    for (i = 0; i < nargs; ++i)
+    {
+        rv.total_tokens += args[i]->total_tokens;
+    }
+    rv.num_children = nargs;
+    rv.children = (GnuCAst **)pool_intern(pool, args, nargs * sizeof(GnuCAst *));
+    return (GnuCAst *)(const GnuCAst *)pool_intern(pool, &rv, sizeof(rv));
+}
+GnuCAtomAddressSpace *gnu_c_create_atom_address_space(Pool *pool, const char *raw)
+{
+    return (GnuCAtomAddressSpace *)gnu_c_create_terminal(pool, GNU_C_ATOM_ADDRESS_SPACE, raw, true);
+}
+GnuCAtomBinaryConstant *gnu_c_create_atom_binary_constant(Pool *pool, const char *raw)
+{
+    return (GnuCAtomBinaryConstant *)gnu_c_create_terminal(pool, GNU_C_ATOM_BINARY_CONSTANT, raw, true);
+}
+GnuCAtomCharacterConstant *gnu_c_create_atom_character_constant(Pool *pool, const char *raw)
+{
+    return (GnuCAtomCharacterConstant *)gnu_c_create_terminal(pool, GNU_C_ATOM_CHARACTER_CONSTANT, raw, true);
+}
+GnuCAtomComment *gnu_c_create_atom_comment(Pool *pool, const char *raw)
+{
+    return (GnuCAtomComment *)gnu_c_create_terminal(pool, GNU_C_ATOM_COMMENT, raw, true);
+}
+GnuCAtomDecimalConstant *gnu_c_create_atom_decimal_constant(Pool *pool, const char *raw)
+{
+    return (GnuCAtomDecimalConstant *)gnu_c_create_terminal(pool, GNU_C_ATOM_DECIMAL_CONSTANT, raw, true);
+}
+GnuCAtomDecimalFloatingConstant *gnu_c_create_atom_decimal_floating_constant(Pool *pool, const char *raw)
+{
+    return (GnuCAtomDecimalFloatingConstant *)gnu_c_create_terminal(pool, GNU_C_ATOM_DECIMAL_FLOATING_CONSTANT, raw, true);
+}
+GnuCAtomHexadecimalConstant *gnu_c_create_atom_hexadecimal_constant(Pool *pool, const char *raw)
+{
+    return (GnuCAtomHexadecimalConstant *)gnu_c_create_terminal(pool, GNU_C_ATOM_HEXADECIMAL_CONSTANT, raw, true);
+}
+GnuCAtomHexadecimalFloatingConstant *gnu_c_create_atom_hexadecimal_floating_constant(Pool *pool, const char *raw)
+{
+    return (GnuCAtomHexadecimalFloatingConstant *)gnu_c_create_terminal(pool, GNU_C_ATOM_HEXADECIMAL_FLOATING_CONSTANT, raw, true);
+}
+GnuCAtomIdentifier *gnu_c_create_atom_identifier(Pool *pool, const char *raw)
+{
+    return (GnuCAtomIdentifier *)gnu_c_create_terminal(pool, GNU_C_ATOM_IDENTIFIER, raw, true);
+}
+GnuCAtomOctalConstant *gnu_c_create_atom_octal_constant(Pool *pool, const char *raw)
+{
+    return (GnuCAtomOctalConstant *)gnu_c_create_terminal(pool, GNU_C_ATOM_OCTAL_CONSTANT, raw, true);
+}
+GnuCAtomStringLiteral *gnu_c_create_atom_string_literal(Pool *pool, const char *raw)
+{
+    return (GnuCAtomStringLiteral *)gnu_c_create_terminal(pool, GNU_C_ATOM_STRING_LITERAL, raw, true);
+}
+GnuCAtomTypedefName *gnu_c_create_atom_typedef_name(Pool *pool, const char *raw)
+{
+    return (GnuCAtomTypedefName *)gnu_c_create_terminal(pool, GNU_C_ATOM_TYPEDEF_NAME, raw, true);
+}
+GnuCKwAccum *gnu_c_create_kw_accum(Pool *pool)
+{
+    return (GnuCKwAccum *)gnu_c_create_terminal(pool, GNU_C_KW_ACCUM, "_Accum", false);
+}
+GnuCKwAlignas *gnu_c_create_kw_alignas(Pool *pool)
+{
+    return (GnuCKwAlignas *)gnu_c_create_terminal(pool, GNU_C_KW_ALIGNAS, "_Alignas", false);
+}
+GnuCKwAlignof *gnu_c_create_kw_alignof(Pool *pool)
+{
+    return (GnuCKwAlignof *)gnu_c_create_terminal(pool, GNU_C_KW_ALIGNOF, "__alignof__", false);
+}
+GnuCKwAsm *gnu_c_create_kw_asm(Pool *pool)
+{
+    return (GnuCKwAsm *)gnu_c_create_terminal(pool, GNU_C_KW_ASM, "asm", false);
+}
+GnuCKwAtomicAsQualifier *gnu_c_create_kw_atomic_as_qualifier(Pool *pool)
+{
+    return (GnuCKwAtomicAsQualifier *)gnu_c_create_terminal(pool, GNU_C_KW_ATOMIC_AS_QUALIFIER, "_Atomic_as_qualifier", false);
+}
+GnuCKwAtomicAsSpecifier *gnu_c_create_kw_atomic_as_specifier(Pool *pool)
+{
+    return (GnuCKwAtomicAsSpecifier *)gnu_c_create_terminal(pool, GNU_C_KW_ATOMIC_AS_SPECIFIER, "_Atomic_as_specifier", false);
+}
+GnuCKwAttribute *gnu_c_create_kw_attribute(Pool *pool)
+{
+    return (GnuCKwAttribute *)gnu_c_create_terminal(pool, GNU_C_KW_ATTRIBUTE, "__attribute__", false);
+}
+GnuCKwAuto *gnu_c_create_kw_auto(Pool *pool)
+{
+    return (GnuCKwAuto *)gnu_c_create_terminal(pool, GNU_C_KW_AUTO, "auto", false);
+}
+GnuCKwAutoType *gnu_c_create_kw_auto_type(Pool *pool)
+{
+    return (GnuCKwAutoType *)gnu_c_create_terminal(pool, GNU_C_KW_AUTO_TYPE, "__auto_type", false);
+}
+GnuCKwBool *gnu_c_create_kw_bool(Pool *pool)
+{
+    return (GnuCKwBool *)gnu_c_create_terminal(pool, GNU_C_KW_BOOL, "_Bool", false);
+}
+GnuCKwBreak *gnu_c_create_kw_break(Pool *pool)
+{
+    return (GnuCKwBreak *)gnu_c_create_terminal(pool, GNU_C_KW_BREAK, "break", false);
+}
+GnuCKwBuiltinChooseExpr *gnu_c_create_kw_builtin_choose_expr(Pool *pool)
+{
+    return (GnuCKwBuiltinChooseExpr *)gnu_c_create_terminal(pool, GNU_C_KW_BUILTIN_CHOOSE_EXPR, "__builtin_choose_expr", false);
+}
+GnuCKwBuiltinComplex *gnu_c_create_kw_builtin_complex(Pool *pool)
+{
+    return (GnuCKwBuiltinComplex *)gnu_c_create_terminal(pool, GNU_C_KW_BUILTIN_COMPLEX, "__builtin_complex", false);
+}
+GnuCKwBuiltinOffsetof *gnu_c_create_kw_builtin_offsetof(Pool *pool)
+{
+    return (GnuCKwBuiltinOffsetof *)gnu_c_create_terminal(pool, GNU_C_KW_BUILTIN_OFFSETOF, "__builtin_offsetof", false);
+}
+GnuCKwBuiltinShuffle *gnu_c_create_kw_builtin_shuffle(Pool *pool)
+{
+    return (GnuCKwBuiltinShuffle *)gnu_c_create_terminal(pool, GNU_C_KW_BUILTIN_SHUFFLE, "__builtin_shuffle", false);
+}
+GnuCKwBuiltinTypesCompatibleP *gnu_c_create_kw_builtin_types_compatible_p(Pool *pool)
+{
+    return (GnuCKwBuiltinTypesCompatibleP *)gnu_c_create_terminal(pool, GNU_C_KW_BUILTIN_TYPES_COMPATIBLE_P, "__builtin_types_compatible_p", false);
+}
+GnuCKwBuiltinVaArg *gnu_c_create_kw_builtin_va_arg(Pool *pool)
+{
+    return (GnuCKwBuiltinVaArg *)gnu_c_create_terminal(pool, GNU_C_KW_BUILTIN_VA_ARG, "__builtin_va_arg", false);
+}
+GnuCKwCase *gnu_c_create_kw_case(Pool *pool)
+{
+    return (GnuCKwCase *)gnu_c_create_terminal(pool, GNU_C_KW_CASE, "case", false);
+}
+GnuCKwChar *gnu_c_create_kw_char(Pool *pool)
+{
+    return (GnuCKwChar *)gnu_c_create_terminal(pool, GNU_C_KW_CHAR, "char", false);
+}
+GnuCKwComplex *gnu_c_create_kw_complex(Pool *pool)
+{
+    return (GnuCKwComplex *)gnu_c_create_terminal(pool, GNU_C_KW_COMPLEX, "_Complex", false);
+}
+GnuCKwConst *gnu_c_create_kw_const(Pool *pool)
+{
+    return (GnuCKwConst *)gnu_c_create_terminal(pool, GNU_C_KW_CONST, "const", false);
+}
+GnuCKwContinue *gnu_c_create_kw_continue(Pool *pool)
+{
+    return (GnuCKwContinue *)gnu_c_create_terminal(pool, GNU_C_KW_CONTINUE, "continue", false);
+}
+GnuCKwDecimal128 *gnu_c_create_kw_decimal128(Pool *pool)
+{
+    return (GnuCKwDecimal128 *)gnu_c_create_terminal(pool, GNU_C_KW_DECIMAL128, "_Decimal128", false);
+}
+GnuCKwDecimal32 *gnu_c_create_kw_decimal32(Pool *pool)
+{
+    return (GnuCKwDecimal32 *)gnu_c_create_terminal(pool, GNU_C_KW_DECIMAL32, "_Decimal32", false);
+}
+GnuCKwDecimal64 *gnu_c_create_kw_decimal64(Pool *pool)
+{
+    return (GnuCKwDecimal64 *)gnu_c_create_terminal(pool, GNU_C_KW_DECIMAL64, "_Decimal64", false);
+}
+GnuCKwDefault *gnu_c_create_kw_default(Pool *pool)
+{
+    return (GnuCKwDefault *)gnu_c_create_terminal(pool, GNU_C_KW_DEFAULT, "default", false);
+}
+GnuCKwDo *gnu_c_create_kw_do(Pool *pool)
+{
+    return (GnuCKwDo *)gnu_c_create_terminal(pool, GNU_C_KW_DO, "do", false);
+}
+GnuCKwDouble *gnu_c_create_kw_double(Pool *pool)
+{
+    return (GnuCKwDouble *)gnu_c_create_terminal(pool, GNU_C_KW_DOUBLE, "double", false);
+}
+GnuCKwElse *gnu_c_create_kw_else(Pool *pool)
+{
+    return (GnuCKwElse *)gnu_c_create_terminal(pool, GNU_C_KW_ELSE, "else", false);
+}
+GnuCKwEnum *gnu_c_create_kw_enum(Pool *pool)
+{
+    return (GnuCKwEnum *)gnu_c_create_terminal(pool, GNU_C_KW_ENUM, "enum", false);
+}
+GnuCKwExtension *gnu_c_create_kw_extension(Pool *pool)
+{
+    return (GnuCKwExtension *)gnu_c_create_terminal(pool, GNU_C_KW_EXTENSION, "__extension__", false);
+}
+GnuCKwExtern *gnu_c_create_kw_extern(Pool *pool)
+{
+    return (GnuCKwExtern *)gnu_c_create_terminal(pool, GNU_C_KW_EXTERN, "extern", false);
+}
+GnuCKwFloat *gnu_c_create_kw_float(Pool *pool)
+{
+    return (GnuCKwFloat *)gnu_c_create_terminal(pool, GNU_C_KW_FLOAT, "float", false);
+}
+GnuCKwFor *gnu_c_create_kw_for(Pool *pool)
+{
+    return (GnuCKwFor *)gnu_c_create_terminal(pool, GNU_C_KW_FOR, "for", false);
+}
+GnuCKwFract *gnu_c_create_kw_fract(Pool *pool)
+{
+    return (GnuCKwFract *)gnu_c_create_terminal(pool, GNU_C_KW_FRACT, "_Fract", false);
+}
+GnuCKwFunc *gnu_c_create_kw_func(Pool *pool)
+{
+    return (GnuCKwFunc *)gnu_c_create_terminal(pool, GNU_C_KW_FUNC, "__func__", false);
+}
+GnuCKwFunction *gnu_c_create_kw_function(Pool *pool)
+{
+    return (GnuCKwFunction *)gnu_c_create_terminal(pool, GNU_C_KW_FUNCTION, "__FUNCTION__", false);
+}
+GnuCKwGeneric *gnu_c_create_kw_generic(Pool *pool)
+{
+    return (GnuCKwGeneric *)gnu_c_create_terminal(pool, GNU_C_KW_GENERIC, "_Generic", false);
+}
+GnuCKwGoto *gnu_c_create_kw_goto(Pool *pool)
+{
+    return (GnuCKwGoto *)gnu_c_create_terminal(pool, GNU_C_KW_GOTO, "goto", false);
+}
+GnuCKwIf *gnu_c_create_kw_if(Pool *pool)
+{
+    return (GnuCKwIf *)gnu_c_create_terminal(pool, GNU_C_KW_IF, "if", false);
+}
+GnuCKwImag *gnu_c_create_kw_imag(Pool *pool)
+{
+    return (GnuCKwImag *)gnu_c_create_terminal(pool, GNU_C_KW_IMAG, "__imag__", false);
+}
+GnuCKwInline *gnu_c_create_kw_inline(Pool *pool)
+{
+    return (GnuCKwInline *)gnu_c_create_terminal(pool, GNU_C_KW_INLINE, "inline", false);
+}
+GnuCKwInt *gnu_c_create_kw_int(Pool *pool)
+{
+    return (GnuCKwInt *)gnu_c_create_terminal(pool, GNU_C_KW_INT, "int", false);
+}
+GnuCKwLabel *gnu_c_create_kw_label(Pool *pool)
+{
+    return (GnuCKwLabel *)gnu_c_create_terminal(pool, GNU_C_KW_LABEL, "__label__", false);
+}
+GnuCKwLong *gnu_c_create_kw_long(Pool *pool)
+{
+    return (GnuCKwLong *)gnu_c_create_terminal(pool, GNU_C_KW_LONG, "long", false);
+}
+GnuCKwNoreturn *gnu_c_create_kw_noreturn(Pool *pool)
+{
+    return (GnuCKwNoreturn *)gnu_c_create_terminal(pool, GNU_C_KW_NORETURN, "_Noreturn", false);
+}
+GnuCKwPrettyFunction *gnu_c_create_kw_pretty_function(Pool *pool)
+{
+    return (GnuCKwPrettyFunction *)gnu_c_create_terminal(pool, GNU_C_KW_PRETTY_FUNCTION, "__PRETTY_FUNCTION__", false);
+}
+GnuCKwReal *gnu_c_create_kw_real(Pool *pool)
+{
+    return (GnuCKwReal *)gnu_c_create_terminal(pool, GNU_C_KW_REAL, "__real__", false);
+}
+GnuCKwRegister *gnu_c_create_kw_register(Pool *pool)
+{
+    return (GnuCKwRegister *)gnu_c_create_terminal(pool, GNU_C_KW_REGISTER, "register", false);
+}
+GnuCKwRestrict *gnu_c_create_kw_restrict(Pool *pool)
+{
+    return (GnuCKwRestrict *)gnu_c_create_terminal(pool, GNU_C_KW_RESTRICT, "restrict", false);
+}
+GnuCKwReturn *gnu_c_create_kw_return(Pool *pool)
+{
+    return (GnuCKwReturn *)gnu_c_create_terminal(pool, GNU_C_KW_RETURN, "return", false);
+}
+GnuCKwSat *gnu_c_create_kw_sat(Pool *pool)
+{
+    return (GnuCKwSat *)gnu_c_create_terminal(pool, GNU_C_KW_SAT, "_Sat", false);
+}
+GnuCKwShort *gnu_c_create_kw_short(Pool *pool)
+{
+    return (GnuCKwShort *)gnu_c_create_terminal(pool, GNU_C_KW_SHORT, "short", false);
+}
+GnuCKwSigned *gnu_c_create_kw_signed(Pool *pool)
+{
+    return (GnuCKwSigned *)gnu_c_create_terminal(pool, GNU_C_KW_SIGNED, "signed", false);
+}
+GnuCKwSizeof *gnu_c_create_kw_sizeof(Pool *pool)
+{
+    return (GnuCKwSizeof *)gnu_c_create_terminal(pool, GNU_C_KW_SIZEOF, "sizeof", false);
+}
+GnuCKwStatic *gnu_c_create_kw_static(Pool *pool)
+{
+    return (GnuCKwStatic *)gnu_c_create_terminal(pool, GNU_C_KW_STATIC, "static", false);
+}
+GnuCKwStaticAssert *gnu_c_create_kw_static_assert(Pool *pool)
+{
+    return (GnuCKwStaticAssert *)gnu_c_create_terminal(pool, GNU_C_KW_STATIC_ASSERT, "_Static_assert", false);
+}
+GnuCKwStruct *gnu_c_create_kw_struct(Pool *pool)
+{
+    return (GnuCKwStruct *)gnu_c_create_terminal(pool, GNU_C_KW_STRUCT, "struct", false);
+}
+GnuCKwSwitch *gnu_c_create_kw_switch(Pool *pool)
+{
+    return (GnuCKwSwitch *)gnu_c_create_terminal(pool, GNU_C_KW_SWITCH, "switch", false);
+}
+GnuCKwThread *gnu_c_create_kw_thread(Pool *pool)
+{
+    return (GnuCKwThread *)gnu_c_create_terminal(pool, GNU_C_KW_THREAD, "__thread", false);
+}
+GnuCKwThreadLocal *gnu_c_create_kw_thread_local(Pool *pool)
+{
+    return (GnuCKwThreadLocal *)gnu_c_create_terminal(pool, GNU_C_KW_THREAD_LOCAL, "_Thread_local", false);
+}
+GnuCKwTypedef *gnu_c_create_kw_typedef(Pool *pool)
+{
+    return (GnuCKwTypedef *)gnu_c_create_terminal(pool, GNU_C_KW_TYPEDEF, "typedef", false);
+}
+GnuCKwTypeof *gnu_c_create_kw_typeof(Pool *pool)
+{
+    return (GnuCKwTypeof *)gnu_c_create_terminal(pool, GNU_C_KW_TYPEOF, "typeof", false);
+}
+GnuCKwUnion *gnu_c_create_kw_union(Pool *pool)
+{
+    return (GnuCKwUnion *)gnu_c_create_terminal(pool, GNU_C_KW_UNION, "union", false);
+}
+GnuCKwUnsigned *gnu_c_create_kw_unsigned(Pool *pool)
+{
+    return (GnuCKwUnsigned *)gnu_c_create_terminal(pool, GNU_C_KW_UNSIGNED, "unsigned", false);
+}
+GnuCKwVoid *gnu_c_create_kw_void(Pool *pool)
+{
+    return (GnuCKwVoid *)gnu_c_create_terminal(pool, GNU_C_KW_VOID, "void", false);
+}
+GnuCKwVolatile *gnu_c_create_kw_volatile(Pool *pool)
+{
+    return (GnuCKwVolatile *)gnu_c_create_terminal(pool, GNU_C_KW_VOLATILE, "volatile", false);
+}
+GnuCKwWhile *gnu_c_create_kw_while(Pool *pool)
+{
+    return (GnuCKwWhile *)gnu_c_create_terminal(pool, GNU_C_KW_WHILE, "while", false);
+}
+GnuCSymAmpersand *gnu_c_create_sym_ampersand(Pool *pool)
+{
+    return (GnuCSymAmpersand *)gnu_c_create_terminal(pool, GNU_C_SYM_AMPERSAND, "&", false);
+}
+GnuCSymAmpersandAssign *gnu_c_create_sym_ampersand_assign(Pool *pool)
+{
+    return (GnuCSymAmpersandAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_AMPERSAND_ASSIGN, "&=", false);
+}
+GnuCSymArrow *gnu_c_create_sym_arrow(Pool *pool)
+{
+    return (GnuCSymArrow *)gnu_c_create_terminal(pool, GNU_C_SYM_ARROW, "->", false);
+}
+GnuCSymAssign *gnu_c_create_sym_assign(Pool *pool)
+{
+    return (GnuCSymAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_ASSIGN, "=", false);
+}
+GnuCSymBang *gnu_c_create_sym_bang(Pool *pool)
+{
+    return (GnuCSymBang *)gnu_c_create_terminal(pool, GNU_C_SYM_BANG, "!", false);
+}
+GnuCSymCaret *gnu_c_create_sym_caret(Pool *pool)
+{
+    return (GnuCSymCaret *)gnu_c_create_terminal(pool, GNU_C_SYM_CARET, "^", false);
+}
+GnuCSymCaretAssign *gnu_c_create_sym_caret_assign(Pool *pool)
+{
+    return (GnuCSymCaretAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_CARET_ASSIGN, "^=", false);
+}
+GnuCSymColon *gnu_c_create_sym_colon(Pool *pool)
+{
+    return (GnuCSymColon *)gnu_c_create_terminal(pool, GNU_C_SYM_COLON, ":", false);
+}
+GnuCSymComma *gnu_c_create_sym_comma(Pool *pool)
+{
+    return (GnuCSymComma *)gnu_c_create_terminal(pool, GNU_C_SYM_COMMA, ",", false);
+}
+GnuCSymDecr *gnu_c_create_sym_decr(Pool *pool)
+{
+    return (GnuCSymDecr *)gnu_c_create_terminal(pool, GNU_C_SYM_DECR, "--", false);
+}
+GnuCSymDot *gnu_c_create_sym_dot(Pool *pool)
+{
+    return (GnuCSymDot *)gnu_c_create_terminal(pool, GNU_C_SYM_DOT, ".", false);
+}
+GnuCSymEllipsis *gnu_c_create_sym_ellipsis(Pool *pool)
+{
+    return (GnuCSymEllipsis *)gnu_c_create_terminal(pool, GNU_C_SYM_ELLIPSIS, "...", false);
+}
+GnuCSymEq *gnu_c_create_sym_eq(Pool *pool)
+{
+    return (GnuCSymEq *)gnu_c_create_terminal(pool, GNU_C_SYM_EQ, "==", false);
+}
+GnuCSymGe *gnu_c_create_sym_ge(Pool *pool)
+{
+    return (GnuCSymGe *)gnu_c_create_terminal(pool, GNU_C_SYM_GE, ">=", false);
+}
+GnuCSymGt *gnu_c_create_sym_gt(Pool *pool)
+{
+    return (GnuCSymGt *)gnu_c_create_terminal(pool, GNU_C_SYM_GT, ">", false);
+}
+GnuCSymIncr *gnu_c_create_sym_incr(Pool *pool)
+{
+    return (GnuCSymIncr *)gnu_c_create_terminal(pool, GNU_C_SYM_INCR, "++", false);
+}
+GnuCSymLbrace *gnu_c_create_sym_lbrace(Pool *pool)
+{
+    return (GnuCSymLbrace *)gnu_c_create_terminal(pool, GNU_C_SYM_LBRACE, "{", false);
+}
+GnuCSymLbracket *gnu_c_create_sym_lbracket(Pool *pool)
+{
+    return (GnuCSymLbracket *)gnu_c_create_terminal(pool, GNU_C_SYM_LBRACKET, "[", false);
+}
+GnuCSymLe *gnu_c_create_sym_le(Pool *pool)
+{
+    return (GnuCSymLe *)gnu_c_create_terminal(pool, GNU_C_SYM_LE, "<=", false);
+}
+GnuCSymLogicalAnd *gnu_c_create_sym_logical_and(Pool *pool)
+{
+    return (GnuCSymLogicalAnd *)gnu_c_create_terminal(pool, GNU_C_SYM_LOGICAL_AND, "&&", false);
+}
+GnuCSymLogicalOr *gnu_c_create_sym_logical_or(Pool *pool)
+{
+    return (GnuCSymLogicalOr *)gnu_c_create_terminal(pool, GNU_C_SYM_LOGICAL_OR, "||", false);
+}
+GnuCSymLparen *gnu_c_create_sym_lparen(Pool *pool)
+{
+    return (GnuCSymLparen *)gnu_c_create_terminal(pool, GNU_C_SYM_LPAREN, "(", false);
+}
+GnuCSymLshift *gnu_c_create_sym_lshift(Pool *pool)
+{
+    return (GnuCSymLshift *)gnu_c_create_terminal(pool, GNU_C_SYM_LSHIFT, "<<", false);
+}
+GnuCSymLshiftAssign *gnu_c_create_sym_lshift_assign(Pool *pool)
+{
+    return (GnuCSymLshiftAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_LSHIFT_ASSIGN, "<<=", false);
+}
+GnuCSymLt *gnu_c_create_sym_lt(Pool *pool)
+{
+    return (GnuCSymLt *)gnu_c_create_terminal(pool, GNU_C_SYM_LT, "<", false);
+}
+GnuCSymMinus *gnu_c_create_sym_minus(Pool *pool)
+{
+    return (GnuCSymMinus *)gnu_c_create_terminal(pool, GNU_C_SYM_MINUS, "-", false);
+}
+GnuCSymMinusAssign *gnu_c_create_sym_minus_assign(Pool *pool)
+{
+    return (GnuCSymMinusAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_MINUS_ASSIGN, "-=", false);
+}
+GnuCSymNe *gnu_c_create_sym_ne(Pool *pool)
+{
+    return (GnuCSymNe *)gnu_c_create_terminal(pool, GNU_C_SYM_NE, "!=", false);
+}
+GnuCSymPercent *gnu_c_create_sym_percent(Pool *pool)
+{
+    return (GnuCSymPercent *)gnu_c_create_terminal(pool, GNU_C_SYM_PERCENT, "%", false);
+}
+GnuCSymPercentAssign *gnu_c_create_sym_percent_assign(Pool *pool)
+{
+    return (GnuCSymPercentAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_PERCENT_ASSIGN, "%=", false);
+}
+GnuCSymPipe *gnu_c_create_sym_pipe(Pool *pool)
+{
+    return (GnuCSymPipe *)gnu_c_create_terminal(pool, GNU_C_SYM_PIPE, "|", false);
+}
+GnuCSymPipeAssign *gnu_c_create_sym_pipe_assign(Pool *pool)
+{
+    return (GnuCSymPipeAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_PIPE_ASSIGN, "|=", false);
+}
+GnuCSymPlus *gnu_c_create_sym_plus(Pool *pool)
+{
+    return (GnuCSymPlus *)gnu_c_create_terminal(pool, GNU_C_SYM_PLUS, "+", false);
+}
+GnuCSymPlusAssign *gnu_c_create_sym_plus_assign(Pool *pool)
+{
+    return (GnuCSymPlusAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_PLUS_ASSIGN, "+=", false);
+}
+GnuCSymQuery *gnu_c_create_sym_query(Pool *pool)
+{
+    return (GnuCSymQuery *)gnu_c_create_terminal(pool, GNU_C_SYM_QUERY, "?", false);
+}
+GnuCSymRbrace *gnu_c_create_sym_rbrace(Pool *pool)
+{
+    return (GnuCSymRbrace *)gnu_c_create_terminal(pool, GNU_C_SYM_RBRACE, "}", false);
+}
+GnuCSymRbracket *gnu_c_create_sym_rbracket(Pool *pool)
+{
+    return (GnuCSymRbracket *)gnu_c_create_terminal(pool, GNU_C_SYM_RBRACKET, "]", false);
+}
+GnuCSymRparen *gnu_c_create_sym_rparen(Pool *pool)
+{
+    return (GnuCSymRparen *)gnu_c_create_terminal(pool, GNU_C_SYM_RPAREN, ")", false);
+}
+GnuCSymRshift *gnu_c_create_sym_rshift(Pool *pool)
+{
+    return (GnuCSymRshift *)gnu_c_create_terminal(pool, GNU_C_SYM_RSHIFT, ">>", false);
+}
+GnuCSymRshiftAssign *gnu_c_create_sym_rshift_assign(Pool *pool)
+{
+    return (GnuCSymRshiftAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_RSHIFT_ASSIGN, ">>=", false);
+}
+GnuCSymSemicolon *gnu_c_create_sym_semicolon(Pool *pool)
+{
+    return (GnuCSymSemicolon *)gnu_c_create_terminal(pool, GNU_C_SYM_SEMICOLON, ";", false);
+}
+GnuCSymSlash *gnu_c_create_sym_slash(Pool *pool)
+{
+    return (GnuCSymSlash *)gnu_c_create_terminal(pool, GNU_C_SYM_SLASH, "/", false);
+}
+GnuCSymSlashAssign *gnu_c_create_sym_slash_assign(Pool *pool)
+{
+    return (GnuCSymSlashAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_SLASH_ASSIGN, "/=", false);
+}
+GnuCSymStar *gnu_c_create_sym_star(Pool *pool)
+{
+    return (GnuCSymStar *)gnu_c_create_terminal(pool, GNU_C_SYM_STAR, "*", false);
+}
+GnuCSymStarAssign *gnu_c_create_sym_star_assign(Pool *pool)
+{
+    return (GnuCSymStarAssign *)gnu_c_create_terminal(pool, GNU_C_SYM_STAR_ASSIGN, "*=", false);
+}
+GnuCSymTilde *gnu_c_create_sym_tilde(Pool *pool)
+{
+    return (GnuCSymTilde *)gnu_c_create_terminal(pool, GNU_C_SYM_TILDE, "~", false);
+}
+GnuCTreeAsmDefinition *gnu_c_create_tree_asm_definition(Pool *pool, GnuCTreeSimpleAsmExpr *tree_simple_asm_expr, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[2] = {(GnuCAst *)tree_simple_asm_expr, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_tree_simple_asm_expr((GnuCAst *)tree_simple_asm_expr));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeAsmDefinition *)gnu_c_create_nonterminal(pool, GNU_C_TREE_ASM_DEFINITION, 2, args);
+}
+GnuCTreeAsmGotoArgument *gnu_c_create_tree_asm_goto_argument(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymColon *sym_colon1, GnuCSymColon *sym_colon2, GnuCOptAsmOperands *opt_asm_operands, GnuCSymColon *sym_colon3, GnuCOptAsmClobbers *opt_asm_clobbers, GnuCSymColon *sym_colon4, GnuCAnyAsmGotoOperands *any_asm_goto_operands)
+{
+    GnuCAst *args[8] = {(GnuCAst *)alias_asm_string_literal, (GnuCAst *)sym_colon1, (GnuCAst *)sym_colon2, (GnuCAst *)opt_asm_operands, (GnuCAst *)sym_colon3, (GnuCAst *)opt_asm_clobbers, (GnuCAst *)sym_colon4, (GnuCAst *)any_asm_goto_operands};
+    assert (gnu_c_is_alias_asm_string_literal((GnuCAst *)alias_asm_string_literal));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon1));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon2));
+    assert (gnu_c_is_opt_asm_operands((GnuCAst *)opt_asm_operands));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon3));
+    assert (gnu_c_is_opt_asm_clobbers((GnuCAst *)opt_asm_clobbers));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon4));
+    assert (gnu_c_is_any_asm_goto_operands((GnuCAst *)any_asm_goto_operands));
+    return (GnuCTreeAsmGotoArgument *)gnu_c_create_nonterminal(pool, GNU_C_TREE_ASM_GOTO_ARGUMENT, 8, args);
+}
+GnuCTreeAtomicTypeSpecifier *gnu_c_create_tree_atomic_type_specifier(Pool *pool, GnuCKwAtomicAsSpecifier *kw_atomic_as_specifier, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_atomic_as_specifier, (GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_atomic_as_specifier((GnuCAst *)kw_atomic_as_specifier));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeAtomicTypeSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_ATOMIC_TYPE_SPECIFIER, 4, args);
+}
+GnuCTreeAttribute *gnu_c_create_tree_attribute(Pool *pool, GnuCKwAttribute *kw_attribute, GnuCSymLparen *sym_lparen1, GnuCSymLparen *sym_lparen2, GnuCOptAttributeList *opt_attribute_list, GnuCSymRparen *sym_rparen1, GnuCSymRparen *sym_rparen2)
+{
+    GnuCAst *args[6] = {(GnuCAst *)kw_attribute, (GnuCAst *)sym_lparen1, (GnuCAst *)sym_lparen2, (GnuCAst *)opt_attribute_list, (GnuCAst *)sym_rparen1, (GnuCAst *)sym_rparen2};
+    assert (gnu_c_is_kw_attribute((GnuCAst *)kw_attribute));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen1));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen2));
+    assert (gnu_c_is_opt_attribute_list((GnuCAst *)opt_attribute_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen1));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen2));
+    return (GnuCTreeAttribute *)gnu_c_create_nonterminal(pool, GNU_C_TREE_ATTRIBUTE, 6, args);
+}
+GnuCTreeAttributes *gnu_c_create_tree_attributes(Pool *pool, GnuCOptAttributes *opt_attributes, GnuCTreeAttribute *tree_attribute)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_attributes, (GnuCAst *)tree_attribute};
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_tree_attribute((GnuCAst *)tree_attribute));
+    return (GnuCTreeAttributes *)gnu_c_create_nonterminal(pool, GNU_C_TREE_ATTRIBUTES, 2, args);
+}
+GnuCTreeBlockItemList *gnu_c_create_tree_block_item_list(Pool *pool, GnuCOptBlockItemList *opt_block_item_list, GnuCAnyBlockItem *any_block_item)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_block_item_list, (GnuCAst *)any_block_item};
+    assert (gnu_c_is_opt_block_item_list((GnuCAst *)opt_block_item_list));
+    assert (gnu_c_is_any_block_item((GnuCAst *)any_block_item));
+    return (GnuCTreeBlockItemList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_BLOCK_ITEM_LIST, 2, args);
+}
+GnuCTreeCompoundStatement *gnu_c_create_tree_compound_statement(Pool *pool, GnuCSymLbrace *sym_lbrace, GnuCOptLabelDeclarations *opt_label_declarations, GnuCOptBlockItemList *opt_block_item_list, GnuCSymRbrace *sym_rbrace)
+{
+    GnuCAst *args[4] = {(GnuCAst *)sym_lbrace, (GnuCAst *)opt_label_declarations, (GnuCAst *)opt_block_item_list, (GnuCAst *)sym_rbrace};
+    assert (gnu_c_is_sym_lbrace((GnuCAst *)sym_lbrace));
+    assert (gnu_c_is_opt_label_declarations((GnuCAst *)opt_label_declarations));
+    assert (gnu_c_is_opt_block_item_list((GnuCAst *)opt_block_item_list));
+    assert (gnu_c_is_sym_rbrace((GnuCAst *)sym_rbrace));
+    return (GnuCTreeCompoundStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_COMPOUND_STATEMENT, 4, args);
+}
+GnuCTreeCondition *gnu_c_create_tree_condition(Pool *pool, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[3] = {(GnuCAst *)sym_lparen, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeCondition *)gnu_c_create_nonterminal(pool, GNU_C_TREE_CONDITION, 3, args);
+}
+GnuCTreeDeclaration *gnu_c_create_tree_declaration(Pool *pool, GnuCAnyDeclarationSpecifiers *any_declaration_specifiers, GnuCOptInitDeclaratorList *opt_init_declarator_list, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_declaration_specifiers, (GnuCAst *)opt_init_declarator_list, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_any_declaration_specifiers((GnuCAst *)any_declaration_specifiers));
+    assert (gnu_c_is_opt_init_declarator_list((GnuCAst *)opt_init_declarator_list));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_DECLARATION, 3, args);
+}
+GnuCTreeDeclarationList *gnu_c_create_tree_declaration_list(Pool *pool, GnuCOptDeclarationList *opt_declaration_list, GnuCTreeDeclaration *tree_declaration)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_declaration_list, (GnuCAst *)tree_declaration};
+    assert (gnu_c_is_opt_declaration_list((GnuCAst *)opt_declaration_list));
+    assert (gnu_c_is_tree_declaration((GnuCAst *)tree_declaration));
+    return (GnuCTreeDeclarationList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_DECLARATION_LIST, 2, args);
+}
+GnuCTreeDeclarator *gnu_c_create_tree_declarator(Pool *pool, GnuCOptPointer *opt_pointer, GnuCAnyDirectDeclarator *any_direct_declarator)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_pointer, (GnuCAst *)any_direct_declarator};
+    assert (gnu_c_is_opt_pointer((GnuCAst *)opt_pointer));
+    assert (gnu_c_is_any_direct_declarator((GnuCAst *)any_direct_declarator));
+    return (GnuCTreeDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_DECLARATOR, 2, args);
+}
+GnuCTreeDesignatedInitializer *gnu_c_create_tree_designated_initializer(Pool *pool, GnuCOptDesignation *opt_designation, GnuCAnyInitializer *any_initializer)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_designation, (GnuCAst *)any_initializer};
+    assert (gnu_c_is_opt_designation((GnuCAst *)opt_designation));
+    assert (gnu_c_is_any_initializer((GnuCAst *)any_initializer));
+    return (GnuCTreeDesignatedInitializer *)gnu_c_create_nonterminal(pool, GNU_C_TREE_DESIGNATED_INITIALIZER, 2, args);
+}
+GnuCTreeDesignatorList *gnu_c_create_tree_designator_list(Pool *pool, GnuCOptDesignatorList *opt_designator_list, GnuCAnyDesignator *any_designator)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_designator_list, (GnuCAst *)any_designator};
+    assert (gnu_c_is_opt_designator_list((GnuCAst *)opt_designator_list));
+    assert (gnu_c_is_any_designator((GnuCAst *)any_designator));
+    return (GnuCTreeDesignatorList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_DESIGNATOR_LIST, 2, args);
+}
+GnuCTreeDoStatement *gnu_c_create_tree_do_statement(Pool *pool, GnuCKwDo *kw_do, GnuCTreeStatement *tree_statement, GnuCKwWhile *kw_while, GnuCTreeCondition *tree_condition, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[5] = {(GnuCAst *)kw_do, (GnuCAst *)tree_statement, (GnuCAst *)kw_while, (GnuCAst *)tree_condition, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_do((GnuCAst *)kw_do));
+    assert (gnu_c_is_tree_statement((GnuCAst *)tree_statement));
+    assert (gnu_c_is_kw_while((GnuCAst *)kw_while));
+    assert (gnu_c_is_tree_condition((GnuCAst *)tree_condition));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeDoStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_DO_STATEMENT, 5, args);
+}
+GnuCTreeExpressionStatement *gnu_c_create_tree_expression_statement(Pool *pool, GnuCOptExprList *opt_expr_list, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_expr_list, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeExpressionStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_EXPRESSION_STATEMENT, 2, args);
+}
+GnuCTreeExternalDeclarations *gnu_c_create_tree_external_declarations(Pool *pool, GnuCOptExternalDeclarations *opt_external_declarations, GnuCAnyExternalDeclaration *any_external_declaration)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_external_declarations, (GnuCAst *)any_external_declaration};
+    assert (gnu_c_is_opt_external_declarations((GnuCAst *)opt_external_declarations));
+    assert (gnu_c_is_any_external_declaration((GnuCAst *)any_external_declaration));
+    return (GnuCTreeExternalDeclarations *)gnu_c_create_nonterminal(pool, GNU_C_TREE_EXTERNAL_DECLARATIONS, 2, args);
+}
+GnuCTreeGenericSelection *gnu_c_create_tree_generic_selection(Pool *pool, GnuCKwGeneric *kw_generic, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression, GnuCSymComma *sym_comma, GnuCAnyGenericAssocList *any_generic_assoc_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[6] = {(GnuCAst *)kw_generic, (GnuCAst *)sym_lparen, (GnuCAst *)any_assignment_expression, (GnuCAst *)sym_comma, (GnuCAst *)any_generic_assoc_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_generic((GnuCAst *)kw_generic));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_generic_assoc_list((GnuCAst *)any_generic_assoc_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeGenericSelection *)gnu_c_create_nonterminal(pool, GNU_C_TREE_GENERIC_SELECTION, 6, args);
+}
+GnuCTreeHeadDeclarationSpecifiers *gnu_c_create_tree_head_declaration_specifiers(Pool *pool, GnuCOptHeadDeclarationSpecifiers *opt_head_declaration_specifiers, GnuCAnyHeadDeclarationSpecifier *any_head_declaration_specifier, GnuCOptAttributes *opt_attributes)
+{
+    GnuCAst *args[3] = {(GnuCAst *)opt_head_declaration_specifiers, (GnuCAst *)any_head_declaration_specifier, (GnuCAst *)opt_attributes};
+    assert (gnu_c_is_opt_head_declaration_specifiers((GnuCAst *)opt_head_declaration_specifiers));
+    assert (gnu_c_is_any_head_declaration_specifier((GnuCAst *)any_head_declaration_specifier));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    return (GnuCTreeHeadDeclarationSpecifiers *)gnu_c_create_nonterminal(pool, GNU_C_TREE_HEAD_DECLARATION_SPECIFIERS, 3, args);
+}
+GnuCTreeIfElseStatement *gnu_c_create_tree_if_else_statement(Pool *pool, GnuCKwIf *kw_if, GnuCTreeCondition *tree_condition, GnuCTreeStatementExceptIf *tree_statement_except_if, GnuCKwElse *kw_else, GnuCTreeStatement *tree_statement)
+{
+    GnuCAst *args[5] = {(GnuCAst *)kw_if, (GnuCAst *)tree_condition, (GnuCAst *)tree_statement_except_if, (GnuCAst *)kw_else, (GnuCAst *)tree_statement};
+    assert (gnu_c_is_kw_if((GnuCAst *)kw_if));
+    assert (gnu_c_is_tree_condition((GnuCAst *)tree_condition));
+    assert (gnu_c_is_tree_statement_except_if((GnuCAst *)tree_statement_except_if));
+    assert (gnu_c_is_kw_else((GnuCAst *)kw_else));
+    assert (gnu_c_is_tree_statement((GnuCAst *)tree_statement));
+    return (GnuCTreeIfElseStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_IF_ELSE_STATEMENT, 5, args);
+}
+GnuCTreeIfElseStatementExceptIf *gnu_c_create_tree_if_else_statement_except_if(Pool *pool, GnuCKwIf *kw_if, GnuCTreeCondition *tree_condition, GnuCTreeStatementExceptIf *tree_statement_except_if1, GnuCKwElse *kw_else, GnuCTreeStatementExceptIf *tree_statement_except_if2)
+{
+    GnuCAst *args[5] = {(GnuCAst *)kw_if, (GnuCAst *)tree_condition, (GnuCAst *)tree_statement_except_if1, (GnuCAst *)kw_else, (GnuCAst *)tree_statement_except_if2};
+    assert (gnu_c_is_kw_if((GnuCAst *)kw_if));
+    assert (gnu_c_is_tree_condition((GnuCAst *)tree_condition));
+    assert (gnu_c_is_tree_statement_except_if((GnuCAst *)tree_statement_except_if1));
+    assert (gnu_c_is_kw_else((GnuCAst *)kw_else));
+    assert (gnu_c_is_tree_statement_except_if((GnuCAst *)tree_statement_except_if2));
+    return (GnuCTreeIfElseStatementExceptIf *)gnu_c_create_nonterminal(pool, GNU_C_TREE_IF_ELSE_STATEMENT_EXCEPT_IF, 5, args);
+}
+GnuCTreeIfStatement *gnu_c_create_tree_if_statement(Pool *pool, GnuCKwIf *kw_if, GnuCTreeCondition *tree_condition, GnuCTreeStatement *tree_statement)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_if, (GnuCAst *)tree_condition, (GnuCAst *)tree_statement};
+    assert (gnu_c_is_kw_if((GnuCAst *)kw_if));
+    assert (gnu_c_is_tree_condition((GnuCAst *)tree_condition));
+    assert (gnu_c_is_tree_statement((GnuCAst *)tree_statement));
+    return (GnuCTreeIfStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_IF_STATEMENT, 3, args);
+}
+GnuCTreeLabelDeclaration *gnu_c_create_tree_label_declaration(Pool *pool, GnuCKwLabel *kw_label, GnuCAnyIdentifierList *any_identifier_list, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_label, (GnuCAst *)any_identifier_list, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_label((GnuCAst *)kw_label));
+    assert (gnu_c_is_any_identifier_list((GnuCAst *)any_identifier_list));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeLabelDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_LABEL_DECLARATION, 3, args);
+}
+GnuCTreeLabelDeclarations *gnu_c_create_tree_label_declarations(Pool *pool, GnuCOptLabelDeclarations *opt_label_declarations, GnuCTreeLabelDeclaration *tree_label_declaration)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_label_declarations, (GnuCAst *)tree_label_declaration};
+    assert (gnu_c_is_opt_label_declarations((GnuCAst *)opt_label_declarations));
+    assert (gnu_c_is_tree_label_declaration((GnuCAst *)tree_label_declaration));
+    return (GnuCTreeLabelDeclarations *)gnu_c_create_nonterminal(pool, GNU_C_TREE_LABEL_DECLARATIONS, 2, args);
+}
+GnuCTreeLabels *gnu_c_create_tree_labels(Pool *pool, GnuCOptLabels *opt_labels, GnuCAnyLabel *any_label)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_labels, (GnuCAst *)any_label};
+    assert (gnu_c_is_opt_labels((GnuCAst *)opt_labels));
+    assert (gnu_c_is_any_label((GnuCAst *)any_label));
+    return (GnuCTreeLabels *)gnu_c_create_nonterminal(pool, GNU_C_TREE_LABELS, 2, args);
+}
+GnuCTreeNestedFunctionDefinition *gnu_c_create_tree_nested_function_definition(Pool *pool, GnuCAnyDeclarationSpecifiers *any_declaration_specifiers, GnuCTreeDeclarator *tree_declarator, GnuCOptDeclarationList *opt_declaration_list, GnuCTreeCompoundStatement *tree_compound_statement)
+{
+    GnuCAst *args[4] = {(GnuCAst *)any_declaration_specifiers, (GnuCAst *)tree_declarator, (GnuCAst *)opt_declaration_list, (GnuCAst *)tree_compound_statement};
+    assert (gnu_c_is_any_declaration_specifiers((GnuCAst *)any_declaration_specifiers));
+    assert (gnu_c_is_tree_declarator((GnuCAst *)tree_declarator));
+    assert (gnu_c_is_opt_declaration_list((GnuCAst *)opt_declaration_list));
+    assert (gnu_c_is_tree_compound_statement((GnuCAst *)tree_compound_statement));
+    return (GnuCTreeNestedFunctionDefinition *)gnu_c_create_nonterminal(pool, GNU_C_TREE_NESTED_FUNCTION_DEFINITION, 4, args);
+}
+GnuCTreeParameterForwardDeclaration *gnu_c_create_tree_parameter_forward_declaration(Pool *pool, GnuCAnyParameterList *any_parameter_list, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[2] = {(GnuCAst *)any_parameter_list, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_any_parameter_list((GnuCAst *)any_parameter_list));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeParameterForwardDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_PARAMETER_FORWARD_DECLARATION, 2, args);
+}
+GnuCTreeParameterForwardDeclarations *gnu_c_create_tree_parameter_forward_declarations(Pool *pool, GnuCOptParameterForwardDeclarations *opt_parameter_forward_declarations, GnuCTreeParameterForwardDeclaration *tree_parameter_forward_declaration)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_parameter_forward_declarations, (GnuCAst *)tree_parameter_forward_declaration};
+    assert (gnu_c_is_opt_parameter_forward_declarations((GnuCAst *)opt_parameter_forward_declarations));
+    assert (gnu_c_is_tree_parameter_forward_declaration((GnuCAst *)tree_parameter_forward_declaration));
+    return (GnuCTreeParameterForwardDeclarations *)gnu_c_create_nonterminal(pool, GNU_C_TREE_PARAMETER_FORWARD_DECLARATIONS, 2, args);
+}
+GnuCTreePointer *gnu_c_create_tree_pointer(Pool *pool, GnuCSymStar *sym_star, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCOptPointer *opt_pointer)
+{
+    GnuCAst *args[3] = {(GnuCAst *)sym_star, (GnuCAst *)opt_type_qualifier_list, (GnuCAst *)opt_pointer};
+    assert (gnu_c_is_sym_star((GnuCAst *)sym_star));
+    assert (gnu_c_is_opt_type_qualifier_list((GnuCAst *)opt_type_qualifier_list));
+    assert (gnu_c_is_opt_pointer((GnuCAst *)opt_pointer));
+    return (GnuCTreePointer *)gnu_c_create_nonterminal(pool, GNU_C_TREE_POINTER, 3, args);
+}
+GnuCTreeSimpleAsmExpr *gnu_c_create_tree_simple_asm_expr(Pool *pool, GnuCKwAsm *kw_asm, GnuCSymLparen *sym_lparen, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_asm, (GnuCAst *)sym_lparen, (GnuCAst *)alias_asm_string_literal, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_asm((GnuCAst *)kw_asm));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_alias_asm_string_literal((GnuCAst *)alias_asm_string_literal));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeSimpleAsmExpr *)gnu_c_create_nonterminal(pool, GNU_C_TREE_SIMPLE_ASM_EXPR, 4, args);
+}
+GnuCTreeStatement *gnu_c_create_tree_statement(Pool *pool, GnuCOptLabels *opt_labels, GnuCAnyUnlabeledStatement *any_unlabeled_statement)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_labels, (GnuCAst *)any_unlabeled_statement};
+    assert (gnu_c_is_opt_labels((GnuCAst *)opt_labels));
+    assert (gnu_c_is_any_unlabeled_statement((GnuCAst *)any_unlabeled_statement));
+    return (GnuCTreeStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_STATEMENT, 2, args);
+}
+GnuCTreeStatementExceptIf *gnu_c_create_tree_statement_except_if(Pool *pool, GnuCOptLabels *opt_labels, GnuCAnyUnlabeledStatementExceptIf *any_unlabeled_statement_except_if)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_labels, (GnuCAst *)any_unlabeled_statement_except_if};
+    assert (gnu_c_is_opt_labels((GnuCAst *)opt_labels));
+    assert (gnu_c_is_any_unlabeled_statement_except_if((GnuCAst *)any_unlabeled_statement_except_if));
+    return (GnuCTreeStatementExceptIf *)gnu_c_create_nonterminal(pool, GNU_C_TREE_STATEMENT_EXCEPT_IF, 2, args);
+}
+GnuCTreeStaticAssertDeclaration *gnu_c_create_tree_static_assert_declaration(Pool *pool, GnuCKwStaticAssert *kw_static_assert, GnuCSymLparen *sym_lparen, GnuCAliasConstantExpression *alias_constant_expression, GnuCSymComma *sym_comma, GnuCAtomStringLiteral *atom_string_literal, GnuCSymRparen *sym_rparen, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[7] = {(GnuCAst *)kw_static_assert, (GnuCAst *)sym_lparen, (GnuCAst *)alias_constant_expression, (GnuCAst *)sym_comma, (GnuCAst *)atom_string_literal, (GnuCAst *)sym_rparen, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_static_assert((GnuCAst *)kw_static_assert));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_atom_string_literal((GnuCAst *)atom_string_literal));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeStaticAssertDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_STATIC_ASSERT_DECLARATION, 7, args);
+}
+GnuCTreeStructDeclarationList *gnu_c_create_tree_struct_declaration_list(Pool *pool, GnuCOptStructDeclarationList *opt_struct_declaration_list, GnuCAnyStructDeclaration *any_struct_declaration)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_struct_declaration_list, (GnuCAst *)any_struct_declaration};
+    assert (gnu_c_is_opt_struct_declaration_list((GnuCAst *)opt_struct_declaration_list));
+    assert (gnu_c_is_any_struct_declaration((GnuCAst *)any_struct_declaration));
+    return (GnuCTreeStructDeclarationList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_STRUCT_DECLARATION_LIST, 2, args);
+}
+GnuCTreeSwitchStatement *gnu_c_create_tree_switch_statement(Pool *pool, GnuCKwSwitch *kw_switch, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen, GnuCTreeStatement *tree_statement)
+{
+    GnuCAst *args[5] = {(GnuCAst *)kw_switch, (GnuCAst *)sym_lparen, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rparen, (GnuCAst *)tree_statement};
+    assert (gnu_c_is_kw_switch((GnuCAst *)kw_switch));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_tree_statement((GnuCAst *)tree_statement));
+    return (GnuCTreeSwitchStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_SWITCH_STATEMENT, 5, args);
+}
+GnuCTreeSwitchStatementExceptIf *gnu_c_create_tree_switch_statement_except_if(Pool *pool, GnuCKwSwitch *kw_switch, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen, GnuCTreeStatementExceptIf *tree_statement_except_if)
+{
+    GnuCAst *args[5] = {(GnuCAst *)kw_switch, (GnuCAst *)sym_lparen, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rparen, (GnuCAst *)tree_statement_except_if};
+    assert (gnu_c_is_kw_switch((GnuCAst *)kw_switch));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_tree_statement_except_if((GnuCAst *)tree_statement_except_if));
+    return (GnuCTreeSwitchStatementExceptIf *)gnu_c_create_nonterminal(pool, GNU_C_TREE_SWITCH_STATEMENT_EXCEPT_IF, 5, args);
+}
+GnuCTreeTagAbstractParameterDeclaration *gnu_c_create_tree_tag_abstract_parameter_declaration(Pool *pool, GnuCAnyDeclarationSpecifiers *any_declaration_specifiers, GnuCOptAbstractDeclarator *opt_abstract_declarator)
+{
+    GnuCAst *args[2] = {(GnuCAst *)any_declaration_specifiers, (GnuCAst *)opt_abstract_declarator};
+    assert (gnu_c_is_any_declaration_specifiers((GnuCAst *)any_declaration_specifiers));
+    assert (gnu_c_is_opt_abstract_declarator((GnuCAst *)opt_abstract_declarator));
+    return (GnuCTreeTagAbstractParameterDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ABSTRACT_PARAMETER_DECLARATION, 2, args);
+}
+GnuCTreeTagActualCastExpression *gnu_c_create_tree_tag_actual_cast_expression(Pool *pool, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[4] = {(GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagActualCastExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ACTUAL_CAST_EXPRESSION, 4, args);
+}
+GnuCTreeTagAddressofExpression *gnu_c_create_tree_tag_addressof_expression(Pool *pool, GnuCSymAmpersand *sym_ampersand, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_ampersand, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_ampersand((GnuCAst *)sym_ampersand));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagAddressofExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ADDRESSOF_EXPRESSION, 2, args);
+}
+GnuCTreeTagAlignasExprSpecifier *gnu_c_create_tree_tag_alignas_expr_specifier(Pool *pool, GnuCKwAlignas *kw_alignas, GnuCSymLparen *sym_lparen, GnuCAliasConstantExpression *alias_constant_expression, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_alignas, (GnuCAst *)sym_lparen, (GnuCAst *)alias_constant_expression, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_alignas((GnuCAst *)kw_alignas));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagAlignasExprSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ALIGNAS_EXPR_SPECIFIER, 4, args);
+}
+GnuCTreeTagAlignasTypeSpecifier *gnu_c_create_tree_tag_alignas_type_specifier(Pool *pool, GnuCKwAlignas *kw_alignas, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_alignas, (GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_alignas((GnuCAst *)kw_alignas));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagAlignasTypeSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ALIGNAS_TYPE_SPECIFIER, 4, args);
+}
+GnuCTreeTagAlignofExpressionExpression *gnu_c_create_tree_tag_alignof_expression_expression(Pool *pool, GnuCKwAlignof *kw_alignof, GnuCAnyNoCastExpression *any_no_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_alignof, (GnuCAst *)any_no_cast_expression};
+    assert (gnu_c_is_kw_alignof((GnuCAst *)kw_alignof));
+    assert (gnu_c_is_any_no_cast_expression((GnuCAst *)any_no_cast_expression));
+    return (GnuCTreeTagAlignofExpressionExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ALIGNOF_EXPRESSION_EXPRESSION, 2, args);
+}
+GnuCTreeTagAlignofTypeExpression *gnu_c_create_tree_tag_alignof_type_expression(Pool *pool, GnuCKwAlignof *kw_alignof, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_alignof, (GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_alignof((GnuCAst *)kw_alignof));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagAlignofTypeExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ALIGNOF_TYPE_EXPRESSION, 4, args);
+}
+GnuCTreeTagAnonymousAsmOperand *gnu_c_create_tree_tag_anonymous_asm_operand(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)alias_asm_string_literal, (GnuCAst *)sym_lparen, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_alias_asm_string_literal((GnuCAst *)alias_asm_string_literal));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagAnonymousAsmOperand *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ANONYMOUS_ASM_OPERAND, 4, args);
+}
+GnuCTreeTagArrayDirectAbstractDeclarator *gnu_c_create_tree_tag_array_direct_abstract_declarator(Pool *pool, GnuCOptDirectAbstractDeclarator *opt_direct_abstract_declarator, GnuCAnyArrayDeclarator *any_array_declarator)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_direct_abstract_declarator, (GnuCAst *)any_array_declarator};
+    assert (gnu_c_is_opt_direct_abstract_declarator((GnuCAst *)opt_direct_abstract_declarator));
+    assert (gnu_c_is_any_array_declarator((GnuCAst *)any_array_declarator));
+    return (GnuCTreeTagArrayDirectAbstractDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ARRAY_DIRECT_ABSTRACT_DECLARATOR, 2, args);
+}
+GnuCTreeTagArrayDirectDeclarator *gnu_c_create_tree_tag_array_direct_declarator(Pool *pool, GnuCAnyDirectDeclarator *any_direct_declarator, GnuCAnyArrayDeclarator *any_array_declarator)
+{
+    GnuCAst *args[2] = {(GnuCAst *)any_direct_declarator, (GnuCAst *)any_array_declarator};
+    assert (gnu_c_is_any_direct_declarator((GnuCAst *)any_direct_declarator));
+    assert (gnu_c_is_any_array_declarator((GnuCAst *)any_array_declarator));
+    return (GnuCTreeTagArrayDirectDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ARRAY_DIRECT_DECLARATOR, 2, args);
+}
+GnuCTreeTagArrayElementDesignator *gnu_c_create_tree_tag_array_element_designator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCAliasConstantExpression *alias_constant_expression, GnuCSymRbracket *sym_rbracket)
+{
+    GnuCAst *args[3] = {(GnuCAst *)sym_lbracket, (GnuCAst *)alias_constant_expression, (GnuCAst *)sym_rbracket};
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    return (GnuCTreeTagArrayElementDesignator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ARRAY_ELEMENT_DESIGNATOR, 3, args);
+}
+GnuCTreeTagArrayMemberOffsetDesignator *gnu_c_create_tree_tag_array_member_offset_designator(Pool *pool, GnuCAnyOffsetofMemberDesignator *any_offsetof_member_designator, GnuCSymLbracket *sym_lbracket, GnuCAnyExprList *any_expr_list, GnuCSymRbracket *sym_rbracket)
+{
+    GnuCAst *args[4] = {(GnuCAst *)any_offsetof_member_designator, (GnuCAst *)sym_lbracket, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rbracket};
+    assert (gnu_c_is_any_offsetof_member_designator((GnuCAst *)any_offsetof_member_designator));
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    return (GnuCTreeTagArrayMemberOffsetDesignator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ARRAY_MEMBER_OFFSET_DESIGNATOR, 4, args);
+}
+GnuCTreeTagArrayRangeDesignator *gnu_c_create_tree_tag_array_range_designator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCAliasConstantExpression *alias_constant_expression1, GnuCSymEllipsis *sym_ellipsis, GnuCAliasConstantExpression *alias_constant_expression2, GnuCSymRbracket *sym_rbracket)
+{
+    GnuCAst *args[5] = {(GnuCAst *)sym_lbracket, (GnuCAst *)alias_constant_expression1, (GnuCAst *)sym_ellipsis, (GnuCAst *)alias_constant_expression2, (GnuCAst *)sym_rbracket};
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression1));
+    assert (gnu_c_is_sym_ellipsis((GnuCAst *)sym_ellipsis));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression2));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    return (GnuCTreeTagArrayRangeDesignator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ARRAY_RANGE_DESIGNATOR, 5, args);
+}
+GnuCTreeTagAsmArgumentOut *gnu_c_create_tree_tag_asm_argument_out(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymColon *sym_colon, GnuCOptAsmOperands *opt_asm_operands)
+{
+    GnuCAst *args[3] = {(GnuCAst *)alias_asm_string_literal, (GnuCAst *)sym_colon, (GnuCAst *)opt_asm_operands};
+    assert (gnu_c_is_alias_asm_string_literal((GnuCAst *)alias_asm_string_literal));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    assert (gnu_c_is_opt_asm_operands((GnuCAst *)opt_asm_operands));
+    return (GnuCTreeTagAsmArgumentOut *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ASM_ARGUMENT_OUT, 3, args);
+}
+GnuCTreeTagAsmArgumentOutIn *gnu_c_create_tree_tag_asm_argument_out_in(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymColon *sym_colon1, GnuCOptAsmOperands *opt_asm_operands1, GnuCSymColon *sym_colon2, GnuCOptAsmOperands *opt_asm_operands2)
+{
+    GnuCAst *args[5] = {(GnuCAst *)alias_asm_string_literal, (GnuCAst *)sym_colon1, (GnuCAst *)opt_asm_operands1, (GnuCAst *)sym_colon2, (GnuCAst *)opt_asm_operands2};
+    assert (gnu_c_is_alias_asm_string_literal((GnuCAst *)alias_asm_string_literal));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon1));
+    assert (gnu_c_is_opt_asm_operands((GnuCAst *)opt_asm_operands1));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon2));
+    assert (gnu_c_is_opt_asm_operands((GnuCAst *)opt_asm_operands2));
+    return (GnuCTreeTagAsmArgumentOutIn *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ASM_ARGUMENT_OUT_IN, 5, args);
+}
+GnuCTreeTagAsmArgumentOutInClobber *gnu_c_create_tree_tag_asm_argument_out_in_clobber(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymColon *sym_colon1, GnuCOptAsmOperands *opt_asm_operands1, GnuCSymColon *sym_colon2, GnuCOptAsmOperands *opt_asm_operands2, GnuCSymColon *sym_colon3, GnuCOptAsmClobbers *opt_asm_clobbers)
+{
+    GnuCAst *args[7] = {(GnuCAst *)alias_asm_string_literal, (GnuCAst *)sym_colon1, (GnuCAst *)opt_asm_operands1, (GnuCAst *)sym_colon2, (GnuCAst *)opt_asm_operands2, (GnuCAst *)sym_colon3, (GnuCAst *)opt_asm_clobbers};
+    assert (gnu_c_is_alias_asm_string_literal((GnuCAst *)alias_asm_string_literal));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon1));
+    assert (gnu_c_is_opt_asm_operands((GnuCAst *)opt_asm_operands1));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon2));
+    assert (gnu_c_is_opt_asm_operands((GnuCAst *)opt_asm_operands2));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon3));
+    assert (gnu_c_is_opt_asm_clobbers((GnuCAst *)opt_asm_clobbers));
+    return (GnuCTreeTagAsmArgumentOutInClobber *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ASM_ARGUMENT_OUT_IN_CLOBBER, 7, args);
+}
+GnuCTreeTagAsmCommonStatement *gnu_c_create_tree_tag_asm_common_statement(Pool *pool, GnuCKwAsm *kw_asm, GnuCOptTypeQualifier *opt_type_qualifier, GnuCSymLparen *sym_lparen, GnuCAnyAsmArgument *any_asm_argument, GnuCSymRparen *sym_rparen, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[6] = {(GnuCAst *)kw_asm, (GnuCAst *)opt_type_qualifier, (GnuCAst *)sym_lparen, (GnuCAst *)any_asm_argument, (GnuCAst *)sym_rparen, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_asm((GnuCAst *)kw_asm));
+    assert (gnu_c_is_opt_type_qualifier((GnuCAst *)opt_type_qualifier));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_asm_argument((GnuCAst *)any_asm_argument));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagAsmCommonStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ASM_COMMON_STATEMENT, 6, args);
+}
+GnuCTreeTagAsmGotoStatement *gnu_c_create_tree_tag_asm_goto_statement(Pool *pool, GnuCKwAsm *kw_asm, GnuCOptTypeQualifier *opt_type_qualifier, GnuCKwGoto *kw_goto, GnuCSymLparen *sym_lparen, GnuCTreeAsmGotoArgument *tree_asm_goto_argument, GnuCSymRparen *sym_rparen, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[7] = {(GnuCAst *)kw_asm, (GnuCAst *)opt_type_qualifier, (GnuCAst *)kw_goto, (GnuCAst *)sym_lparen, (GnuCAst *)tree_asm_goto_argument, (GnuCAst *)sym_rparen, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_asm((GnuCAst *)kw_asm));
+    assert (gnu_c_is_opt_type_qualifier((GnuCAst *)opt_type_qualifier));
+    assert (gnu_c_is_kw_goto((GnuCAst *)kw_goto));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_asm_goto_argument((GnuCAst *)tree_asm_goto_argument));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagAsmGotoStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ASM_GOTO_STATEMENT, 7, args);
+}
+GnuCTreeTagAttribWithArg *gnu_c_create_tree_tag_attrib_with_arg(Pool *pool, GnuCAnyAnyWord *any_any_word, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)any_any_word, (GnuCAst *)sym_lparen, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_any_any_word((GnuCAst *)any_any_word));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagAttribWithArg *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ATTRIB_WITH_ARG, 4, args);
+}
+GnuCTreeTagBitAndAssignmentExpression *gnu_c_create_tree_tag_bit_and_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymAmpersandAssign *sym_ampersand_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_ampersand_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_ampersand_assign((GnuCAst *)sym_ampersand_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagBitAndAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BIT_AND_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagBitAndExpression *gnu_c_create_tree_tag_bit_and_expression(Pool *pool, GnuCAnyAndExpression *any_and_expression, GnuCSymAmpersand *sym_ampersand, GnuCAnyEqualityExpression *any_equality_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_and_expression, (GnuCAst *)sym_ampersand, (GnuCAst *)any_equality_expression};
+    assert (gnu_c_is_any_and_expression((GnuCAst *)any_and_expression));
+    assert (gnu_c_is_sym_ampersand((GnuCAst *)sym_ampersand));
+    assert (gnu_c_is_any_equality_expression((GnuCAst *)any_equality_expression));
+    return (GnuCTreeTagBitAndExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BIT_AND_EXPRESSION, 3, args);
+}
+GnuCTreeTagBitIorAssignmentExpression *gnu_c_create_tree_tag_bit_ior_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymPipeAssign *sym_pipe_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_pipe_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_pipe_assign((GnuCAst *)sym_pipe_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagBitIorAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BIT_IOR_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagBitIorExpression *gnu_c_create_tree_tag_bit_ior_expression(Pool *pool, GnuCAnyInclusiveOrExpression *any_inclusive_or_expression, GnuCSymPipe *sym_pipe, GnuCAnyExclusiveOrExpression *any_exclusive_or_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_inclusive_or_expression, (GnuCAst *)sym_pipe, (GnuCAst *)any_exclusive_or_expression};
+    assert (gnu_c_is_any_inclusive_or_expression((GnuCAst *)any_inclusive_or_expression));
+    assert (gnu_c_is_sym_pipe((GnuCAst *)sym_pipe));
+    assert (gnu_c_is_any_exclusive_or_expression((GnuCAst *)any_exclusive_or_expression));
+    return (GnuCTreeTagBitIorExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BIT_IOR_EXPRESSION, 3, args);
+}
+GnuCTreeTagBitNotExpression *gnu_c_create_tree_tag_bit_not_expression(Pool *pool, GnuCSymTilde *sym_tilde, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_tilde, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_tilde((GnuCAst *)sym_tilde));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagBitNotExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BIT_NOT_EXPRESSION, 2, args);
+}
+GnuCTreeTagBitXorAssignmentExpression *gnu_c_create_tree_tag_bit_xor_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymCaretAssign *sym_caret_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_caret_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_caret_assign((GnuCAst *)sym_caret_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagBitXorAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BIT_XOR_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagBitXorExpression *gnu_c_create_tree_tag_bit_xor_expression(Pool *pool, GnuCAnyExclusiveOrExpression *any_exclusive_or_expression, GnuCSymCaret *sym_caret, GnuCAnyAndExpression *any_and_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_exclusive_or_expression, (GnuCAst *)sym_caret, (GnuCAst *)any_and_expression};
+    assert (gnu_c_is_any_exclusive_or_expression((GnuCAst *)any_exclusive_or_expression));
+    assert (gnu_c_is_sym_caret((GnuCAst *)sym_caret));
+    assert (gnu_c_is_any_and_expression((GnuCAst *)any_and_expression));
+    return (GnuCTreeTagBitXorExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BIT_XOR_EXPRESSION, 3, args);
+}
+GnuCTreeTagBitfieldDeclarator *gnu_c_create_tree_tag_bitfield_declarator(Pool *pool, GnuCOptDeclarator *opt_declarator, GnuCSymColon *sym_colon, GnuCAliasConstantExpression *alias_constant_expression, GnuCOptAttributes *opt_attributes)
+{
+    GnuCAst *args[4] = {(GnuCAst *)opt_declarator, (GnuCAst *)sym_colon, (GnuCAst *)alias_constant_expression, (GnuCAst *)opt_attributes};
+    assert (gnu_c_is_opt_declarator((GnuCAst *)opt_declarator));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    return (GnuCTreeTagBitfieldDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BITFIELD_DECLARATOR, 4, args);
+}
+GnuCTreeTagBracedInitializer *gnu_c_create_tree_tag_braced_initializer(Pool *pool, GnuCSymLbrace *sym_lbrace, GnuCOptInitializerList *opt_initializer_list, GnuCSymRbrace *sym_rbrace)
+{
+    GnuCAst *args[3] = {(GnuCAst *)sym_lbrace, (GnuCAst *)opt_initializer_list, (GnuCAst *)sym_rbrace};
+    assert (gnu_c_is_sym_lbrace((GnuCAst *)sym_lbrace));
+    assert (gnu_c_is_opt_initializer_list((GnuCAst *)opt_initializer_list));
+    assert (gnu_c_is_sym_rbrace((GnuCAst *)sym_rbrace));
+    return (GnuCTreeTagBracedInitializer *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BRACED_INITIALIZER, 3, args);
+}
+GnuCTreeTagBracedInitializerComma *gnu_c_create_tree_tag_braced_initializer_comma(Pool *pool, GnuCSymLbrace *sym_lbrace, GnuCAnyInitializerList *any_initializer_list, GnuCSymComma *sym_comma, GnuCSymRbrace *sym_rbrace)
+{
+    GnuCAst *args[4] = {(GnuCAst *)sym_lbrace, (GnuCAst *)any_initializer_list, (GnuCAst *)sym_comma, (GnuCAst *)sym_rbrace};
+    assert (gnu_c_is_sym_lbrace((GnuCAst *)sym_lbrace));
+    assert (gnu_c_is_any_initializer_list((GnuCAst *)any_initializer_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_sym_rbrace((GnuCAst *)sym_rbrace));
+    return (GnuCTreeTagBracedInitializerComma *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BRACED_INITIALIZER_COMMA, 4, args);
+}
+GnuCTreeTagBreakStatement *gnu_c_create_tree_tag_break_statement(Pool *pool, GnuCKwBreak *kw_break, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_break, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_break((GnuCAst *)kw_break));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagBreakStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BREAK_STATEMENT, 2, args);
+}
+GnuCTreeTagBuiltinChooseExprExpression *gnu_c_create_tree_tag_builtin_choose_expr_expression(Pool *pool, GnuCKwBuiltinChooseExpr *kw_builtin_choose_expr, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression1, GnuCSymComma *sym_comma1, GnuCAnyAssignmentExpression *any_assignment_expression2, GnuCSymComma *sym_comma2, GnuCAnyAssignmentExpression *any_assignment_expression3, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[8] = {(GnuCAst *)kw_builtin_choose_expr, (GnuCAst *)sym_lparen, (GnuCAst *)any_assignment_expression1, (GnuCAst *)sym_comma1, (GnuCAst *)any_assignment_expression2, (GnuCAst *)sym_comma2, (GnuCAst *)any_assignment_expression3, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_builtin_choose_expr((GnuCAst *)kw_builtin_choose_expr));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression1));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma1));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression2));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma2));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression3));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagBuiltinChooseExprExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BUILTIN_CHOOSE_EXPR_EXPRESSION, 8, args);
+}
+GnuCTreeTagBuiltinComplexExpression *gnu_c_create_tree_tag_builtin_complex_expression(Pool *pool, GnuCKwBuiltinComplex *kw_builtin_complex, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression1, GnuCSymComma *sym_comma, GnuCAnyAssignmentExpression *any_assignment_expression2, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[6] = {(GnuCAst *)kw_builtin_complex, (GnuCAst *)sym_lparen, (GnuCAst *)any_assignment_expression1, (GnuCAst *)sym_comma, (GnuCAst *)any_assignment_expression2, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_builtin_complex((GnuCAst *)kw_builtin_complex));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression1));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression2));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagBuiltinComplexExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BUILTIN_COMPLEX_EXPRESSION, 6, args);
+}
+GnuCTreeTagBuiltinMixShuffleExpression *gnu_c_create_tree_tag_builtin_mix_shuffle_expression(Pool *pool, GnuCKwBuiltinShuffle *kw_builtin_shuffle, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression1, GnuCSymComma *sym_comma1, GnuCAnyAssignmentExpression *any_assignment_expression2, GnuCSymComma *sym_comma2, GnuCAnyAssignmentExpression *any_assignment_expression3, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[8] = {(GnuCAst *)kw_builtin_shuffle, (GnuCAst *)sym_lparen, (GnuCAst *)any_assignment_expression1, (GnuCAst *)sym_comma1, (GnuCAst *)any_assignment_expression2, (GnuCAst *)sym_comma2, (GnuCAst *)any_assignment_expression3, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_builtin_shuffle((GnuCAst *)kw_builtin_shuffle));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression1));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma1));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression2));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma2));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression3));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagBuiltinMixShuffleExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BUILTIN_MIX_SHUFFLE_EXPRESSION, 8, args);
+}
+GnuCTreeTagBuiltinOffsetofExpression *gnu_c_create_tree_tag_builtin_offsetof_expression(Pool *pool, GnuCKwBuiltinOffsetof *kw_builtin_offsetof, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymComma *sym_comma, GnuCAnyOffsetofMemberDesignator *any_offsetof_member_designator, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[6] = {(GnuCAst *)kw_builtin_offsetof, (GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_comma, (GnuCAst *)any_offsetof_member_designator, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_builtin_offsetof((GnuCAst *)kw_builtin_offsetof));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_offsetof_member_designator((GnuCAst *)any_offsetof_member_designator));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagBuiltinOffsetofExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BUILTIN_OFFSETOF_EXPRESSION, 6, args);
+}
+GnuCTreeTagBuiltinSimpleShuffleExpression *gnu_c_create_tree_tag_builtin_simple_shuffle_expression(Pool *pool, GnuCKwBuiltinShuffle *kw_builtin_shuffle, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression1, GnuCSymComma *sym_comma, GnuCAnyAssignmentExpression *any_assignment_expression2, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[6] = {(GnuCAst *)kw_builtin_shuffle, (GnuCAst *)sym_lparen, (GnuCAst *)any_assignment_expression1, (GnuCAst *)sym_comma, (GnuCAst *)any_assignment_expression2, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_builtin_shuffle((GnuCAst *)kw_builtin_shuffle));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression1));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression2));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagBuiltinSimpleShuffleExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BUILTIN_SIMPLE_SHUFFLE_EXPRESSION, 6, args);
+}
+GnuCTreeTagBuiltinTypesCompatiblePExpression *gnu_c_create_tree_tag_builtin_types_compatible_p_expression(Pool *pool, GnuCKwBuiltinTypesCompatibleP *kw_builtin_types_compatible_p, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name1, GnuCSymComma *sym_comma, GnuCTreeTypeName *tree_type_name2, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[6] = {(GnuCAst *)kw_builtin_types_compatible_p, (GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name1, (GnuCAst *)sym_comma, (GnuCAst *)tree_type_name2, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_builtin_types_compatible_p((GnuCAst *)kw_builtin_types_compatible_p));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name1));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name2));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagBuiltinTypesCompatiblePExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BUILTIN_TYPES_COMPATIBLE_P_EXPRESSION, 6, args);
+}
+GnuCTreeTagBuiltinVaArgExpression *gnu_c_create_tree_tag_builtin_va_arg_expression(Pool *pool, GnuCKwBuiltinVaArg *kw_builtin_va_arg, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression, GnuCSymComma *sym_comma, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[6] = {(GnuCAst *)kw_builtin_va_arg, (GnuCAst *)sym_lparen, (GnuCAst *)any_assignment_expression, (GnuCAst *)sym_comma, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_builtin_va_arg((GnuCAst *)kw_builtin_va_arg));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagBuiltinVaArgExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_BUILTIN_VA_ARG_EXPRESSION, 6, args);
+}
+GnuCTreeTagC99_Designation *gnu_c_create_tree_tag_c99_designation(Pool *pool, GnuCTreeDesignatorList *tree_designator_list, GnuCSymAssign *sym_assign)
+{
+    GnuCAst *args[2] = {(GnuCAst *)tree_designator_list, (GnuCAst *)sym_assign};
+    assert (gnu_c_is_tree_designator_list((GnuCAst *)tree_designator_list));
+    assert (gnu_c_is_sym_assign((GnuCAst *)sym_assign));
+    return (GnuCTreeTagC99_Designation *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_C99_DESIGNATION, 2, args);
+}
+GnuCTreeTagCallExpression *gnu_c_create_tree_tag_call_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymLparen *sym_lparen, GnuCOptExprList *opt_expr_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)any_postfix_expression, (GnuCAst *)sym_lparen, (GnuCAst *)opt_expr_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_any_postfix_expression((GnuCAst *)any_postfix_expression));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagCallExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_CALL_EXPRESSION, 4, args);
+}
+GnuCTreeTagCaseLabel *gnu_c_create_tree_tag_case_label(Pool *pool, GnuCKwCase *kw_case, GnuCAliasConstantExpression *alias_constant_expression, GnuCSymColon *sym_colon)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_case, (GnuCAst *)alias_constant_expression, (GnuCAst *)sym_colon};
+    assert (gnu_c_is_kw_case((GnuCAst *)kw_case));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    return (GnuCTreeTagCaseLabel *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_CASE_LABEL, 3, args);
+}
+GnuCTreeTagCaseRangeLabel *gnu_c_create_tree_tag_case_range_label(Pool *pool, GnuCKwCase *kw_case, GnuCAliasConstantExpression *alias_constant_expression1, GnuCSymEllipsis *sym_ellipsis, GnuCAliasConstantExpression *alias_constant_expression2, GnuCSymColon *sym_colon)
+{
+    GnuCAst *args[5] = {(GnuCAst *)kw_case, (GnuCAst *)alias_constant_expression1, (GnuCAst *)sym_ellipsis, (GnuCAst *)alias_constant_expression2, (GnuCAst *)sym_colon};
+    assert (gnu_c_is_kw_case((GnuCAst *)kw_case));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression1));
+    assert (gnu_c_is_sym_ellipsis((GnuCAst *)sym_ellipsis));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression2));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    return (GnuCTreeTagCaseRangeLabel *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_CASE_RANGE_LABEL, 5, args);
+}
+GnuCTreeTagCompoundLiteral *gnu_c_create_tree_tag_compound_literal(Pool *pool, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen, GnuCSymLbrace *sym_lbrace, GnuCOptInitializerList *opt_initializer_list, GnuCSymRbrace *sym_rbrace)
+{
+    GnuCAst *args[6] = {(GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen, (GnuCAst *)sym_lbrace, (GnuCAst *)opt_initializer_list, (GnuCAst *)sym_rbrace};
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_sym_lbrace((GnuCAst *)sym_lbrace));
+    assert (gnu_c_is_opt_initializer_list((GnuCAst *)opt_initializer_list));
+    assert (gnu_c_is_sym_rbrace((GnuCAst *)sym_rbrace));
+    return (GnuCTreeTagCompoundLiteral *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_COMPOUND_LITERAL, 6, args);
+}
+GnuCTreeTagCompoundLiteralComma *gnu_c_create_tree_tag_compound_literal_comma(Pool *pool, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen, GnuCSymLbrace *sym_lbrace, GnuCAnyInitializerList *any_initializer_list, GnuCSymComma *sym_comma, GnuCSymRbrace *sym_rbrace)
+{
+    GnuCAst *args[7] = {(GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen, (GnuCAst *)sym_lbrace, (GnuCAst *)any_initializer_list, (GnuCAst *)sym_comma, (GnuCAst *)sym_rbrace};
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_sym_lbrace((GnuCAst *)sym_lbrace));
+    assert (gnu_c_is_any_initializer_list((GnuCAst *)any_initializer_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_sym_rbrace((GnuCAst *)sym_rbrace));
+    return (GnuCTreeTagCompoundLiteralComma *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_COMPOUND_LITERAL_COMMA, 7, args);
+}
+GnuCTreeTagComputedGotoStatement *gnu_c_create_tree_tag_computed_goto_statement(Pool *pool, GnuCKwGoto *kw_goto, GnuCSymStar *sym_star, GnuCAnyExprList *any_expr_list, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_goto, (GnuCAst *)sym_star, (GnuCAst *)any_expr_list, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_goto((GnuCAst *)kw_goto));
+    assert (gnu_c_is_sym_star((GnuCAst *)sym_star));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagComputedGotoStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_COMPUTED_GOTO_STATEMENT, 4, args);
+}
+GnuCTreeTagConcreteParameterDeclaration *gnu_c_create_tree_tag_concrete_parameter_declaration(Pool *pool, GnuCAnyDeclarationSpecifiers *any_declaration_specifiers, GnuCTreeDeclarator *tree_declarator)
+{
+    GnuCAst *args[2] = {(GnuCAst *)any_declaration_specifiers, (GnuCAst *)tree_declarator};
+    assert (gnu_c_is_any_declaration_specifiers((GnuCAst *)any_declaration_specifiers));
+    assert (gnu_c_is_tree_declarator((GnuCAst *)tree_declarator));
+    return (GnuCTreeTagConcreteParameterDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_CONCRETE_PARAMETER_DECLARATION, 2, args);
+}
+GnuCTreeTagContinueStatement *gnu_c_create_tree_tag_continue_statement(Pool *pool, GnuCKwContinue *kw_continue, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_continue, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_continue((GnuCAst *)kw_continue));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagContinueStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_CONTINUE_STATEMENT, 2, args);
+}
+GnuCTreeTagDefaultGenericAssociation *gnu_c_create_tree_tag_default_generic_association(Pool *pool, GnuCKwDefault *kw_default, GnuCSymColon *sym_colon, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_default, (GnuCAst *)sym_colon, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_kw_default((GnuCAst *)kw_default));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagDefaultGenericAssociation *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_DEFAULT_GENERIC_ASSOCIATION, 3, args);
+}
+GnuCTreeTagDefaultLabel *gnu_c_create_tree_tag_default_label(Pool *pool, GnuCKwDefault *kw_default, GnuCSymColon *sym_colon)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_default, (GnuCAst *)sym_colon};
+    assert (gnu_c_is_kw_default((GnuCAst *)kw_default));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    return (GnuCTreeTagDefaultLabel *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_DEFAULT_LABEL, 2, args);
+}
+GnuCTreeTagDerefExpression *gnu_c_create_tree_tag_deref_expression(Pool *pool, GnuCSymStar *sym_star, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_star, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_star((GnuCAst *)sym_star));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagDerefExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_DEREF_EXPRESSION, 2, args);
+}
+GnuCTreeTagDirectMemberExpression *gnu_c_create_tree_tag_direct_member_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymDot *sym_dot, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_postfix_expression, (GnuCAst *)sym_dot, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_any_postfix_expression((GnuCAst *)any_postfix_expression));
+    assert (gnu_c_is_sym_dot((GnuCAst *)sym_dot));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagDirectMemberExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_DIRECT_MEMBER_EXPRESSION, 3, args);
+}
+GnuCTreeTagDivideAssignmentExpression *gnu_c_create_tree_tag_divide_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymSlashAssign *sym_slash_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_slash_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_slash_assign((GnuCAst *)sym_slash_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagDivideAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_DIVIDE_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagDivideExpression *gnu_c_create_tree_tag_divide_expression(Pool *pool, GnuCAnyMultiplicativeExpression *any_multiplicative_expression, GnuCSymSlash *sym_slash, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_multiplicative_expression, (GnuCAst *)sym_slash, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_any_multiplicative_expression((GnuCAst *)any_multiplicative_expression));
+    assert (gnu_c_is_sym_slash((GnuCAst *)sym_slash));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagDivideExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_DIVIDE_EXPRESSION, 3, args);
+}
+GnuCTreeTagEqExpression *gnu_c_create_tree_tag_eq_expression(Pool *pool, GnuCAnyEqualityExpression *any_equality_expression, GnuCSymEq *sym_eq, GnuCAnyRelationalExpression *any_relational_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_equality_expression, (GnuCAst *)sym_eq, (GnuCAst *)any_relational_expression};
+    assert (gnu_c_is_any_equality_expression((GnuCAst *)any_equality_expression));
+    assert (gnu_c_is_sym_eq((GnuCAst *)sym_eq));
+    assert (gnu_c_is_any_relational_expression((GnuCAst *)any_relational_expression));
+    return (GnuCTreeTagEqExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_EQ_EXPRESSION, 3, args);
+}
+GnuCTreeTagExtensionExpression *gnu_c_create_tree_tag_extension_expression(Pool *pool, GnuCKwExtension *kw_extension, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_extension, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_kw_extension((GnuCAst *)kw_extension));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagExtensionExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_EXTENSION_EXPRESSION, 2, args);
+}
+GnuCTreeTagExtensionExternalDeclaration *gnu_c_create_tree_tag_extension_external_declaration(Pool *pool, GnuCKwExtension *kw_extension, GnuCAnyExternalDeclaration *any_external_declaration)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_extension, (GnuCAst *)any_external_declaration};
+    assert (gnu_c_is_kw_extension((GnuCAst *)kw_extension));
+    assert (gnu_c_is_any_external_declaration((GnuCAst *)any_external_declaration));
+    return (GnuCTreeTagExtensionExternalDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_EXTENSION_EXTERNAL_DECLARATION, 2, args);
+}
+GnuCTreeTagExtensionNestedDeclaration *gnu_c_create_tree_tag_extension_nested_declaration(Pool *pool, GnuCKwExtension *kw_extension, GnuCAnyNestedDeclaration *any_nested_declaration)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_extension, (GnuCAst *)any_nested_declaration};
+    assert (gnu_c_is_kw_extension((GnuCAst *)kw_extension));
+    assert (gnu_c_is_any_nested_declaration((GnuCAst *)any_nested_declaration));
+    return (GnuCTreeTagExtensionNestedDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_EXTENSION_NESTED_DECLARATION, 2, args);
+}
+GnuCTreeTagExtensionStructDeclaration *gnu_c_create_tree_tag_extension_struct_declaration(Pool *pool, GnuCKwExtension *kw_extension, GnuCAnyStructDeclaration *any_struct_declaration)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_extension, (GnuCAst *)any_struct_declaration};
+    assert (gnu_c_is_kw_extension((GnuCAst *)kw_extension));
+    assert (gnu_c_is_any_struct_declaration((GnuCAst *)any_struct_declaration));
+    return (GnuCTreeTagExtensionStructDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_EXTENSION_STRUCT_DECLARATION, 2, args);
+}
+GnuCTreeTagForDeclStatement *gnu_c_create_tree_tag_for_decl_statement(Pool *pool, GnuCKwFor *kw_for, GnuCSymLparen *sym_lparen, GnuCAnyNestedDeclaration *any_nested_declaration, GnuCOptExprList *opt_expr_list1, GnuCSymSemicolon *sym_semicolon, GnuCOptExprList *opt_expr_list2, GnuCSymRparen *sym_rparen, GnuCTreeStatement *tree_statement)
+{
+    GnuCAst *args[8] = {(GnuCAst *)kw_for, (GnuCAst *)sym_lparen, (GnuCAst *)any_nested_declaration, (GnuCAst *)opt_expr_list1, (GnuCAst *)sym_semicolon, (GnuCAst *)opt_expr_list2, (GnuCAst *)sym_rparen, (GnuCAst *)tree_statement};
+    assert (gnu_c_is_kw_for((GnuCAst *)kw_for));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_nested_declaration((GnuCAst *)any_nested_declaration));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list1));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list2));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_tree_statement((GnuCAst *)tree_statement));
+    return (GnuCTreeTagForDeclStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FOR_DECL_STATEMENT, 8, args);
+}
+GnuCTreeTagForDeclStatementExceptIf *gnu_c_create_tree_tag_for_decl_statement_except_if(Pool *pool, GnuCKwFor *kw_for, GnuCSymLparen *sym_lparen, GnuCAnyNestedDeclaration *any_nested_declaration, GnuCOptExprList *opt_expr_list1, GnuCSymSemicolon *sym_semicolon, GnuCOptExprList *opt_expr_list2, GnuCSymRparen *sym_rparen, GnuCTreeStatementExceptIf *tree_statement_except_if)
+{
+    GnuCAst *args[8] = {(GnuCAst *)kw_for, (GnuCAst *)sym_lparen, (GnuCAst *)any_nested_declaration, (GnuCAst *)opt_expr_list1, (GnuCAst *)sym_semicolon, (GnuCAst *)opt_expr_list2, (GnuCAst *)sym_rparen, (GnuCAst *)tree_statement_except_if};
+    assert (gnu_c_is_kw_for((GnuCAst *)kw_for));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_nested_declaration((GnuCAst *)any_nested_declaration));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list1));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list2));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_tree_statement_except_if((GnuCAst *)tree_statement_except_if));
+    return (GnuCTreeTagForDeclStatementExceptIf *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FOR_DECL_STATEMENT_EXCEPT_IF, 8, args);
+}
+GnuCTreeTagForExprStatement *gnu_c_create_tree_tag_for_expr_statement(Pool *pool, GnuCKwFor *kw_for, GnuCSymLparen *sym_lparen, GnuCOptExprList *opt_expr_list1, GnuCSymSemicolon *sym_semicolon1, GnuCOptExprList *opt_expr_list2, GnuCSymSemicolon *sym_semicolon2, GnuCOptExprList *opt_expr_list3, GnuCSymRparen *sym_rparen, GnuCTreeStatement *tree_statement)
+{
+    GnuCAst *args[9] = {(GnuCAst *)kw_for, (GnuCAst *)sym_lparen, (GnuCAst *)opt_expr_list1, (GnuCAst *)sym_semicolon1, (GnuCAst *)opt_expr_list2, (GnuCAst *)sym_semicolon2, (GnuCAst *)opt_expr_list3, (GnuCAst *)sym_rparen, (GnuCAst *)tree_statement};
+    assert (gnu_c_is_kw_for((GnuCAst *)kw_for));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list1));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon1));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list2));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon2));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list3));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_tree_statement((GnuCAst *)tree_statement));
+    return (GnuCTreeTagForExprStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FOR_EXPR_STATEMENT, 9, args);
+}
+GnuCTreeTagForExprStatementExceptIf *gnu_c_create_tree_tag_for_expr_statement_except_if(Pool *pool, GnuCKwFor *kw_for, GnuCSymLparen *sym_lparen, GnuCOptExprList *opt_expr_list1, GnuCSymSemicolon *sym_semicolon1, GnuCOptExprList *opt_expr_list2, GnuCSymSemicolon *sym_semicolon2, GnuCOptExprList *opt_expr_list3, GnuCSymRparen *sym_rparen, GnuCTreeStatementExceptIf *tree_statement_except_if)
+{
+    GnuCAst *args[9] = {(GnuCAst *)kw_for, (GnuCAst *)sym_lparen, (GnuCAst *)opt_expr_list1, (GnuCAst *)sym_semicolon1, (GnuCAst *)opt_expr_list2, (GnuCAst *)sym_semicolon2, (GnuCAst *)opt_expr_list3, (GnuCAst *)sym_rparen, (GnuCAst *)tree_statement_except_if};
+    assert (gnu_c_is_kw_for((GnuCAst *)kw_for));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list1));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon1));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list2));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon2));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list3));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    assert (gnu_c_is_tree_statement_except_if((GnuCAst *)tree_statement_except_if));
+    return (GnuCTreeTagForExprStatementExceptIf *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FOR_EXPR_STATEMENT_EXCEPT_IF, 9, args);
+}
+GnuCTreeTagForwardEnumSpecifier *gnu_c_create_tree_tag_forward_enum_specifier(Pool *pool, GnuCKwEnum *kw_enum, GnuCOptAttributes *opt_attributes, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_enum, (GnuCAst *)opt_attributes, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_kw_enum((GnuCAst *)kw_enum));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagForwardEnumSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FORWARD_ENUM_SPECIFIER, 3, args);
+}
+GnuCTreeTagForwardParamFunDirectAbstractDeclarator *gnu_c_create_tree_tag_forward_param_fun_direct_abstract_declarator(Pool *pool, GnuCOptDirectAbstractDeclarator *opt_direct_abstract_declarator, GnuCSymLparen *sym_lparen, GnuCTreeParameterForwardDeclarations *tree_parameter_forward_declarations, GnuCOptParameterTypeList *opt_parameter_type_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[5] = {(GnuCAst *)opt_direct_abstract_declarator, (GnuCAst *)sym_lparen, (GnuCAst *)tree_parameter_forward_declarations, (GnuCAst *)opt_parameter_type_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_opt_direct_abstract_declarator((GnuCAst *)opt_direct_abstract_declarator));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_parameter_forward_declarations((GnuCAst *)tree_parameter_forward_declarations));
+    assert (gnu_c_is_opt_parameter_type_list((GnuCAst *)opt_parameter_type_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagForwardParamFunDirectAbstractDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FORWARD_PARAM_FUN_DIRECT_ABSTRACT_DECLARATOR, 5, args);
+}
+GnuCTreeTagForwardParamFunDirectDeclarator *gnu_c_create_tree_tag_forward_param_fun_direct_declarator(Pool *pool, GnuCAnyDirectDeclarator *any_direct_declarator, GnuCSymLparen *sym_lparen, GnuCTreeParameterForwardDeclarations *tree_parameter_forward_declarations, GnuCOptParameterTypeList *opt_parameter_type_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[5] = {(GnuCAst *)any_direct_declarator, (GnuCAst *)sym_lparen, (GnuCAst *)tree_parameter_forward_declarations, (GnuCAst *)opt_parameter_type_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_any_direct_declarator((GnuCAst *)any_direct_declarator));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_parameter_forward_declarations((GnuCAst *)tree_parameter_forward_declarations));
+    assert (gnu_c_is_opt_parameter_type_list((GnuCAst *)opt_parameter_type_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagForwardParamFunDirectDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FORWARD_PARAM_FUN_DIRECT_DECLARATOR, 5, args);
+}
+GnuCTreeTagForwardStructOrUnionSpecifier *gnu_c_create_tree_tag_forward_struct_or_union_specifier(Pool *pool, GnuCAnyStructOrUnion *any_struct_or_union, GnuCOptAttributes *opt_attributes, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_struct_or_union, (GnuCAst *)opt_attributes, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_any_struct_or_union((GnuCAst *)any_struct_or_union));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagForwardStructOrUnionSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FORWARD_STRUCT_OR_UNION_SPECIFIER, 3, args);
+}
+GnuCTreeTagFullEnumSpecifier *gnu_c_create_tree_tag_full_enum_specifier(Pool *pool, GnuCKwEnum *kw_enum, GnuCOptAttributes *opt_attributes, GnuCOptIdentifier *opt_identifier, GnuCSymLbrace *sym_lbrace, GnuCAnyEnumeratorList *any_enumerator_list, GnuCOptComma *opt_comma, GnuCSymRbrace *sym_rbrace)
+{
+    GnuCAst *args[7] = {(GnuCAst *)kw_enum, (GnuCAst *)opt_attributes, (GnuCAst *)opt_identifier, (GnuCAst *)sym_lbrace, (GnuCAst *)any_enumerator_list, (GnuCAst *)opt_comma, (GnuCAst *)sym_rbrace};
+    assert (gnu_c_is_kw_enum((GnuCAst *)kw_enum));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_opt_identifier((GnuCAst *)opt_identifier));
+    assert (gnu_c_is_sym_lbrace((GnuCAst *)sym_lbrace));
+    assert (gnu_c_is_any_enumerator_list((GnuCAst *)any_enumerator_list));
+    assert (gnu_c_is_opt_comma((GnuCAst *)opt_comma));
+    assert (gnu_c_is_sym_rbrace((GnuCAst *)sym_rbrace));
+    return (GnuCTreeTagFullEnumSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FULL_ENUM_SPECIFIER, 7, args);
+}
+GnuCTreeTagFullStructOrUnionSpecifier *gnu_c_create_tree_tag_full_struct_or_union_specifier(Pool *pool, GnuCAnyStructOrUnion *any_struct_or_union, GnuCOptAttributes *opt_attributes, GnuCOptIdentifier *opt_identifier, GnuCSymLbrace *sym_lbrace, GnuCOptStructDeclarationList *opt_struct_declaration_list, GnuCSymRbrace *sym_rbrace)
+{
+    GnuCAst *args[6] = {(GnuCAst *)any_struct_or_union, (GnuCAst *)opt_attributes, (GnuCAst *)opt_identifier, (GnuCAst *)sym_lbrace, (GnuCAst *)opt_struct_declaration_list, (GnuCAst *)sym_rbrace};
+    assert (gnu_c_is_any_struct_or_union((GnuCAst *)any_struct_or_union));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_opt_identifier((GnuCAst *)opt_identifier));
+    assert (gnu_c_is_sym_lbrace((GnuCAst *)sym_lbrace));
+    assert (gnu_c_is_opt_struct_declaration_list((GnuCAst *)opt_struct_declaration_list));
+    assert (gnu_c_is_sym_rbrace((GnuCAst *)sym_rbrace));
+    return (GnuCTreeTagFullStructOrUnionSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FULL_STRUCT_OR_UNION_SPECIFIER, 6, args);
+}
+GnuCTreeTagFunDirectAbstractDeclarator *gnu_c_create_tree_tag_fun_direct_abstract_declarator(Pool *pool, GnuCOptDirectAbstractDeclarator *opt_direct_abstract_declarator, GnuCSymLparen *sym_lparen, GnuCOptParameterTypeList *opt_parameter_type_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)opt_direct_abstract_declarator, (GnuCAst *)sym_lparen, (GnuCAst *)opt_parameter_type_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_opt_direct_abstract_declarator((GnuCAst *)opt_direct_abstract_declarator));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_opt_parameter_type_list((GnuCAst *)opt_parameter_type_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagFunDirectAbstractDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FUN_DIRECT_ABSTRACT_DECLARATOR, 4, args);
+}
+GnuCTreeTagFunDirectDeclarator *gnu_c_create_tree_tag_fun_direct_declarator(Pool *pool, GnuCAnyDirectDeclarator *any_direct_declarator, GnuCSymLparen *sym_lparen, GnuCAnyParameterTypeList *any_parameter_type_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)any_direct_declarator, (GnuCAst *)sym_lparen, (GnuCAst *)any_parameter_type_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_any_direct_declarator((GnuCAst *)any_direct_declarator));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_parameter_type_list((GnuCAst *)any_parameter_type_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagFunDirectDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_FUN_DIRECT_DECLARATOR, 4, args);
+}
+GnuCTreeTagGeExpression *gnu_c_create_tree_tag_ge_expression(Pool *pool, GnuCAnyRelationalExpression *any_relational_expression, GnuCSymGe *sym_ge, GnuCAnyShiftExpression *any_shift_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_relational_expression, (GnuCAst *)sym_ge, (GnuCAst *)any_shift_expression};
+    assert (gnu_c_is_any_relational_expression((GnuCAst *)any_relational_expression));
+    assert (gnu_c_is_sym_ge((GnuCAst *)sym_ge));
+    assert (gnu_c_is_any_shift_expression((GnuCAst *)any_shift_expression));
+    return (GnuCTreeTagGeExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_GE_EXPRESSION, 3, args);
+}
+GnuCTreeTagGnuDesignation *gnu_c_create_tree_tag_gnu_designation(Pool *pool, GnuCAtomIdentifier *atom_identifier, GnuCSymColon *sym_colon)
+{
+    GnuCAst *args[2] = {(GnuCAst *)atom_identifier, (GnuCAst *)sym_colon};
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    return (GnuCTreeTagGnuDesignation *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_GNU_DESIGNATION, 2, args);
+}
+GnuCTreeTagGnuStatementExpression *gnu_c_create_tree_tag_gnu_statement_expression(Pool *pool, GnuCSymLparen *sym_lparen, GnuCTreeCompoundStatement *tree_compound_statement, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[3] = {(GnuCAst *)sym_lparen, (GnuCAst *)tree_compound_statement, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_compound_statement((GnuCAst *)tree_compound_statement));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagGnuStatementExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_GNU_STATEMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagGotoStatement *gnu_c_create_tree_tag_goto_statement(Pool *pool, GnuCKwGoto *kw_goto, GnuCAtomIdentifier *atom_identifier, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_goto, (GnuCAst *)atom_identifier, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_goto((GnuCAst *)kw_goto));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagGotoStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_GOTO_STATEMENT, 3, args);
+}
+GnuCTreeTagGtExpression *gnu_c_create_tree_tag_gt_expression(Pool *pool, GnuCAnyRelationalExpression *any_relational_expression, GnuCSymGt *sym_gt, GnuCAnyShiftExpression *any_shift_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_relational_expression, (GnuCAst *)sym_gt, (GnuCAst *)any_shift_expression};
+    assert (gnu_c_is_any_relational_expression((GnuCAst *)any_relational_expression));
+    assert (gnu_c_is_sym_gt((GnuCAst *)sym_gt));
+    assert (gnu_c_is_any_shift_expression((GnuCAst *)any_shift_expression));
+    return (GnuCTreeTagGtExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_GT_EXPRESSION, 3, args);
+}
+GnuCTreeTagHeadTailDeclarationSpecifiers *gnu_c_create_tree_tag_head_tail_declaration_specifiers(Pool *pool, GnuCOptAttributes *opt_attributes, GnuCOptHeadDeclarationSpecifiers *opt_head_declaration_specifiers, GnuCTreeTailDeclarationSpecifiers *tree_tail_declaration_specifiers)
+{
+    GnuCAst *args[3] = {(GnuCAst *)opt_attributes, (GnuCAst *)opt_head_declaration_specifiers, (GnuCAst *)tree_tail_declaration_specifiers};
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_opt_head_declaration_specifiers((GnuCAst *)opt_head_declaration_specifiers));
+    assert (gnu_c_is_tree_tail_declaration_specifiers((GnuCAst *)tree_tail_declaration_specifiers));
+    return (GnuCTreeTagHeadTailDeclarationSpecifiers *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_HEAD_TAIL_DECLARATION_SPECIFIERS, 3, args);
+}
+GnuCTreeTagImagExpression *gnu_c_create_tree_tag_imag_expression(Pool *pool, GnuCKwImag *kw_imag, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_imag, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_kw_imag((GnuCAst *)kw_imag));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagImagExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_IMAG_EXPRESSION, 2, args);
+}
+GnuCTreeTagImplicitIntDeclaration *gnu_c_create_tree_tag_implicit_int_declaration(Pool *pool, GnuCAnyInitDeclaratorList *any_init_declarator_list, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[2] = {(GnuCAst *)any_init_declarator_list, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_any_init_declarator_list((GnuCAst *)any_init_declarator_list));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagImplicitIntDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_IMPLICIT_INT_DECLARATION, 2, args);
+}
+GnuCTreeTagImplicitIntFunctionDefinition *gnu_c_create_tree_tag_implicit_int_function_definition(Pool *pool, GnuCTreeDeclarator *tree_declarator, GnuCOptDeclarationList *opt_declaration_list, GnuCTreeCompoundStatement *tree_compound_statement)
+{
+    GnuCAst *args[3] = {(GnuCAst *)tree_declarator, (GnuCAst *)opt_declaration_list, (GnuCAst *)tree_compound_statement};
+    assert (gnu_c_is_tree_declarator((GnuCAst *)tree_declarator));
+    assert (gnu_c_is_opt_declaration_list((GnuCAst *)opt_declaration_list));
+    assert (gnu_c_is_tree_compound_statement((GnuCAst *)tree_compound_statement));
+    return (GnuCTreeTagImplicitIntFunctionDefinition *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_IMPLICIT_INT_FUNCTION_DEFINITION, 3, args);
+}
+GnuCTreeTagIndexExpression *gnu_c_create_tree_tag_index_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymLbracket *sym_lbracket, GnuCAnyExprList *any_expr_list, GnuCSymRbracket *sym_rbracket)
+{
+    GnuCAst *args[4] = {(GnuCAst *)any_postfix_expression, (GnuCAst *)sym_lbracket, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rbracket};
+    assert (gnu_c_is_any_postfix_expression((GnuCAst *)any_postfix_expression));
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    return (GnuCTreeTagIndexExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_INDEX_EXPRESSION, 4, args);
+}
+GnuCTreeTagIndirectMemberExpression *gnu_c_create_tree_tag_indirect_member_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymArrow *sym_arrow, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_postfix_expression, (GnuCAst *)sym_arrow, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_any_postfix_expression((GnuCAst *)any_postfix_expression));
+    assert (gnu_c_is_sym_arrow((GnuCAst *)sym_arrow));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagIndirectMemberExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_INDIRECT_MEMBER_EXPRESSION, 3, args);
+}
+GnuCTreeTagInitializedDeclarator *gnu_c_create_tree_tag_initialized_declarator(Pool *pool, GnuCTreeDeclarator *tree_declarator, GnuCOptSimpleAsmExpr *opt_simple_asm_expr, GnuCOptAttributes *opt_attributes, GnuCSymAssign *sym_assign, GnuCAnyInitializer *any_initializer)
+{
+    GnuCAst *args[5] = {(GnuCAst *)tree_declarator, (GnuCAst *)opt_simple_asm_expr, (GnuCAst *)opt_attributes, (GnuCAst *)sym_assign, (GnuCAst *)any_initializer};
+    assert (gnu_c_is_tree_declarator((GnuCAst *)tree_declarator));
+    assert (gnu_c_is_opt_simple_asm_expr((GnuCAst *)opt_simple_asm_expr));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_sym_assign((GnuCAst *)sym_assign));
+    assert (gnu_c_is_any_initializer((GnuCAst *)any_initializer));
+    return (GnuCTreeTagInitializedDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_INITIALIZED_DECLARATOR, 5, args);
+}
+GnuCTreeTagInitializedEnumerator *gnu_c_create_tree_tag_initialized_enumerator(Pool *pool, GnuCAliasEnumerationConstant *alias_enumeration_constant, GnuCSymAssign *sym_assign, GnuCAliasConstantExpression *alias_constant_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)alias_enumeration_constant, (GnuCAst *)sym_assign, (GnuCAst *)alias_constant_expression};
+    assert (gnu_c_is_alias_enumeration_constant((GnuCAst *)alias_enumeration_constant));
+    assert (gnu_c_is_sym_assign((GnuCAst *)sym_assign));
+    assert (gnu_c_is_alias_constant_expression((GnuCAst *)alias_constant_expression));
+    return (GnuCTreeTagInitializedEnumerator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_INITIALIZED_ENUMERATOR, 3, args);
+}
+GnuCTreeTagLabelAddressExpression *gnu_c_create_tree_tag_label_address_expression(Pool *pool, GnuCSymLogicalAnd *sym_logical_and, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_logical_and, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_sym_logical_and((GnuCAst *)sym_logical_and));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagLabelAddressExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LABEL_ADDRESS_EXPRESSION, 2, args);
+}
+GnuCTreeTagLeExpression *gnu_c_create_tree_tag_le_expression(Pool *pool, GnuCAnyRelationalExpression *any_relational_expression, GnuCSymLe *sym_le, GnuCAnyShiftExpression *any_shift_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_relational_expression, (GnuCAst *)sym_le, (GnuCAst *)any_shift_expression};
+    assert (gnu_c_is_any_relational_expression((GnuCAst *)any_relational_expression));
+    assert (gnu_c_is_sym_le((GnuCAst *)sym_le));
+    assert (gnu_c_is_any_shift_expression((GnuCAst *)any_shift_expression));
+    return (GnuCTreeTagLeExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LE_EXPRESSION, 3, args);
+}
+GnuCTreeTagLeftShiftAssignmentExpression *gnu_c_create_tree_tag_left_shift_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymLshiftAssign *sym_lshift_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_lshift_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_lshift_assign((GnuCAst *)sym_lshift_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagLeftShiftAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LEFT_SHIFT_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagLeftShiftExpression *gnu_c_create_tree_tag_left_shift_expression(Pool *pool, GnuCAnyShiftExpression *any_shift_expression, GnuCSymLshift *sym_lshift, GnuCAnyAdditiveExpression *any_additive_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_shift_expression, (GnuCAst *)sym_lshift, (GnuCAst *)any_additive_expression};
+    assert (gnu_c_is_any_shift_expression((GnuCAst *)any_shift_expression));
+    assert (gnu_c_is_sym_lshift((GnuCAst *)sym_lshift));
+    assert (gnu_c_is_any_additive_expression((GnuCAst *)any_additive_expression));
+    return (GnuCTreeTagLeftShiftExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LEFT_SHIFT_EXPRESSION, 3, args);
+}
+GnuCTreeTagLegacyFunDirectDeclarator *gnu_c_create_tree_tag_legacy_fun_direct_declarator(Pool *pool, GnuCAnyDirectDeclarator *any_direct_declarator, GnuCSymLparen *sym_lparen, GnuCOptIdentifierList *opt_identifier_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)any_direct_declarator, (GnuCAst *)sym_lparen, (GnuCAst *)opt_identifier_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_any_direct_declarator((GnuCAst *)any_direct_declarator));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_opt_identifier_list((GnuCAst *)opt_identifier_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagLegacyFunDirectDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LEGACY_FUN_DIRECT_DECLARATOR, 4, args);
+}
+GnuCTreeTagLogAndExpression *gnu_c_create_tree_tag_log_and_expression(Pool *pool, GnuCAnyLogicalAndExpression *any_logical_and_expression, GnuCSymLogicalAnd *sym_logical_and, GnuCAnyInclusiveOrExpression *any_inclusive_or_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_logical_and_expression, (GnuCAst *)sym_logical_and, (GnuCAst *)any_inclusive_or_expression};
+    assert (gnu_c_is_any_logical_and_expression((GnuCAst *)any_logical_and_expression));
+    assert (gnu_c_is_sym_logical_and((GnuCAst *)sym_logical_and));
+    assert (gnu_c_is_any_inclusive_or_expression((GnuCAst *)any_inclusive_or_expression));
+    return (GnuCTreeTagLogAndExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LOG_AND_EXPRESSION, 3, args);
+}
+GnuCTreeTagLogNotExpression *gnu_c_create_tree_tag_log_not_expression(Pool *pool, GnuCSymBang *sym_bang, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_bang, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_bang((GnuCAst *)sym_bang));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagLogNotExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LOG_NOT_EXPRESSION, 2, args);
+}
+GnuCTreeTagLogOrExpression *gnu_c_create_tree_tag_log_or_expression(Pool *pool, GnuCAnyLogicalOrExpression *any_logical_or_expression, GnuCSymLogicalOr *sym_logical_or, GnuCAnyLogicalAndExpression *any_logical_and_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_logical_or_expression, (GnuCAst *)sym_logical_or, (GnuCAst *)any_logical_and_expression};
+    assert (gnu_c_is_any_logical_or_expression((GnuCAst *)any_logical_or_expression));
+    assert (gnu_c_is_sym_logical_or((GnuCAst *)sym_logical_or));
+    assert (gnu_c_is_any_logical_and_expression((GnuCAst *)any_logical_and_expression));
+    return (GnuCTreeTagLogOrExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LOG_OR_EXPRESSION, 3, args);
+}
+GnuCTreeTagLtExpression *gnu_c_create_tree_tag_lt_expression(Pool *pool, GnuCAnyRelationalExpression *any_relational_expression, GnuCSymLt *sym_lt, GnuCAnyShiftExpression *any_shift_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_relational_expression, (GnuCAst *)sym_lt, (GnuCAst *)any_shift_expression};
+    assert (gnu_c_is_any_relational_expression((GnuCAst *)any_relational_expression));
+    assert (gnu_c_is_sym_lt((GnuCAst *)sym_lt));
+    assert (gnu_c_is_any_shift_expression((GnuCAst *)any_shift_expression));
+    return (GnuCTreeTagLtExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_LT_EXPRESSION, 3, args);
+}
+GnuCTreeTagMemberDeclaration *gnu_c_create_tree_tag_member_declaration(Pool *pool, GnuCAnySpecifierQualifierList *any_specifier_qualifier_list, GnuCOptStructDeclaratorList *opt_struct_declarator_list, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_specifier_qualifier_list, (GnuCAst *)opt_struct_declarator_list, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_any_specifier_qualifier_list((GnuCAst *)any_specifier_qualifier_list));
+    assert (gnu_c_is_opt_struct_declarator_list((GnuCAst *)opt_struct_declarator_list));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagMemberDeclaration *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MEMBER_DECLARATION, 3, args);
+}
+GnuCTreeTagMemberDeclarator *gnu_c_create_tree_tag_member_declarator(Pool *pool, GnuCTreeDeclarator *tree_declarator, GnuCOptAttributes *opt_attributes)
+{
+    GnuCAst *args[2] = {(GnuCAst *)tree_declarator, (GnuCAst *)opt_attributes};
+    assert (gnu_c_is_tree_declarator((GnuCAst *)tree_declarator));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    return (GnuCTreeTagMemberDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MEMBER_DECLARATOR, 2, args);
+}
+GnuCTreeTagMemberDesignator *gnu_c_create_tree_tag_member_designator(Pool *pool, GnuCSymDot *sym_dot, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_dot, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_sym_dot((GnuCAst *)sym_dot));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagMemberDesignator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MEMBER_DESIGNATOR, 2, args);
+}
+GnuCTreeTagMinusAssignmentExpression *gnu_c_create_tree_tag_minus_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymMinusAssign *sym_minus_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_minus_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_minus_assign((GnuCAst *)sym_minus_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagMinusAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MINUS_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagMinusExpression *gnu_c_create_tree_tag_minus_expression(Pool *pool, GnuCAnyAdditiveExpression *any_additive_expression, GnuCSymMinus *sym_minus, GnuCAnyMultiplicativeExpression *any_multiplicative_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_additive_expression, (GnuCAst *)sym_minus, (GnuCAst *)any_multiplicative_expression};
+    assert (gnu_c_is_any_additive_expression((GnuCAst *)any_additive_expression));
+    assert (gnu_c_is_sym_minus((GnuCAst *)sym_minus));
+    assert (gnu_c_is_any_multiplicative_expression((GnuCAst *)any_multiplicative_expression));
+    return (GnuCTreeTagMinusExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MINUS_EXPRESSION, 3, args);
+}
+GnuCTreeTagModuloAssignmentExpression *gnu_c_create_tree_tag_modulo_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymPercentAssign *sym_percent_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_percent_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_percent_assign((GnuCAst *)sym_percent_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagModuloAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MODULO_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagModuloExpression *gnu_c_create_tree_tag_modulo_expression(Pool *pool, GnuCAnyMultiplicativeExpression *any_multiplicative_expression, GnuCSymPercent *sym_percent, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_multiplicative_expression, (GnuCAst *)sym_percent, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_any_multiplicative_expression((GnuCAst *)any_multiplicative_expression));
+    assert (gnu_c_is_sym_percent((GnuCAst *)sym_percent));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagModuloExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MODULO_EXPRESSION, 3, args);
+}
+GnuCTreeTagMultiAsmClobbers *gnu_c_create_tree_tag_multi_asm_clobbers(Pool *pool, GnuCAnyAsmClobbers *any_asm_clobbers, GnuCSymComma *sym_comma, GnuCAliasAsmStringLiteral *alias_asm_string_literal)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_asm_clobbers, (GnuCAst *)sym_comma, (GnuCAst *)alias_asm_string_literal};
+    assert (gnu_c_is_any_asm_clobbers((GnuCAst *)any_asm_clobbers));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_alias_asm_string_literal((GnuCAst *)alias_asm_string_literal));
+    return (GnuCTreeTagMultiAsmClobbers *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_ASM_CLOBBERS, 3, args);
+}
+GnuCTreeTagMultiAsmGotoOperands *gnu_c_create_tree_tag_multi_asm_goto_operands(Pool *pool, GnuCAnyAsmGotoOperands *any_asm_goto_operands, GnuCSymComma *sym_comma, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_asm_goto_operands, (GnuCAst *)sym_comma, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_any_asm_goto_operands((GnuCAst *)any_asm_goto_operands));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagMultiAsmGotoOperands *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_ASM_GOTO_OPERANDS, 3, args);
+}
+GnuCTreeTagMultiAsmOperands *gnu_c_create_tree_tag_multi_asm_operands(Pool *pool, GnuCAnyAsmOperands *any_asm_operands, GnuCSymComma *sym_comma, GnuCAnyAsmOperand *any_asm_operand)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_asm_operands, (GnuCAst *)sym_comma, (GnuCAst *)any_asm_operand};
+    assert (gnu_c_is_any_asm_operands((GnuCAst *)any_asm_operands));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_asm_operand((GnuCAst *)any_asm_operand));
+    return (GnuCTreeTagMultiAsmOperands *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_ASM_OPERANDS, 3, args);
+}
+GnuCTreeTagMultiAttributeList *gnu_c_create_tree_tag_multi_attribute_list(Pool *pool, GnuCOptAttributeList *opt_attribute_list, GnuCSymComma *sym_comma, GnuCOptAttrib *opt_attrib)
+{
+    GnuCAst *args[3] = {(GnuCAst *)opt_attribute_list, (GnuCAst *)sym_comma, (GnuCAst *)opt_attrib};
+    assert (gnu_c_is_opt_attribute_list((GnuCAst *)opt_attribute_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_opt_attrib((GnuCAst *)opt_attrib));
+    return (GnuCTreeTagMultiAttributeList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_ATTRIBUTE_LIST, 3, args);
+}
+GnuCTreeTagMultiEnumeratorList *gnu_c_create_tree_tag_multi_enumerator_list(Pool *pool, GnuCAnyEnumeratorList *any_enumerator_list, GnuCSymComma *sym_comma, GnuCAnyEnumerator *any_enumerator)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_enumerator_list, (GnuCAst *)sym_comma, (GnuCAst *)any_enumerator};
+    assert (gnu_c_is_any_enumerator_list((GnuCAst *)any_enumerator_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_enumerator((GnuCAst *)any_enumerator));
+    return (GnuCTreeTagMultiEnumeratorList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_ENUMERATOR_LIST, 3, args);
+}
+GnuCTreeTagMultiExprList *gnu_c_create_tree_tag_multi_expr_list(Pool *pool, GnuCAnyExprList *any_expr_list, GnuCSymComma *sym_comma, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_expr_list, (GnuCAst *)sym_comma, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagMultiExprList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_EXPR_LIST, 3, args);
+}
+GnuCTreeTagMultiGenericAssocList *gnu_c_create_tree_tag_multi_generic_assoc_list(Pool *pool, GnuCAnyGenericAssocList *any_generic_assoc_list, GnuCSymComma *sym_comma, GnuCAnyGenericAssociation *any_generic_association)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_generic_assoc_list, (GnuCAst *)sym_comma, (GnuCAst *)any_generic_association};
+    assert (gnu_c_is_any_generic_assoc_list((GnuCAst *)any_generic_assoc_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_generic_association((GnuCAst *)any_generic_association));
+    return (GnuCTreeTagMultiGenericAssocList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_GENERIC_ASSOC_LIST, 3, args);
+}
+GnuCTreeTagMultiIdentifierList *gnu_c_create_tree_tag_multi_identifier_list(Pool *pool, GnuCAnyIdentifierList *any_identifier_list, GnuCSymComma *sym_comma, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_identifier_list, (GnuCAst *)sym_comma, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_any_identifier_list((GnuCAst *)any_identifier_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagMultiIdentifierList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_IDENTIFIER_LIST, 3, args);
+}
+GnuCTreeTagMultiInitDeclaratorList *gnu_c_create_tree_tag_multi_init_declarator_list(Pool *pool, GnuCAnyInitDeclaratorList *any_init_declarator_list, GnuCSymComma *sym_comma, GnuCAnyInitDeclarator *any_init_declarator)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_init_declarator_list, (GnuCAst *)sym_comma, (GnuCAst *)any_init_declarator};
+    assert (gnu_c_is_any_init_declarator_list((GnuCAst *)any_init_declarator_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_init_declarator((GnuCAst *)any_init_declarator));
+    return (GnuCTreeTagMultiInitDeclaratorList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_INIT_DECLARATOR_LIST, 3, args);
+}
+GnuCTreeTagMultiInitializerList *gnu_c_create_tree_tag_multi_initializer_list(Pool *pool, GnuCAnyInitializerList *any_initializer_list, GnuCSymComma *sym_comma, GnuCTreeDesignatedInitializer *tree_designated_initializer)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_initializer_list, (GnuCAst *)sym_comma, (GnuCAst *)tree_designated_initializer};
+    assert (gnu_c_is_any_initializer_list((GnuCAst *)any_initializer_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_tree_designated_initializer((GnuCAst *)tree_designated_initializer));
+    return (GnuCTreeTagMultiInitializerList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_INITIALIZER_LIST, 3, args);
+}
+GnuCTreeTagMultiParameterList *gnu_c_create_tree_tag_multi_parameter_list(Pool *pool, GnuCAnyParameterList *any_parameter_list, GnuCSymComma *sym_comma, GnuCAnyParameterDeclaration *any_parameter_declaration)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_parameter_list, (GnuCAst *)sym_comma, (GnuCAst *)any_parameter_declaration};
+    assert (gnu_c_is_any_parameter_list((GnuCAst *)any_parameter_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_any_parameter_declaration((GnuCAst *)any_parameter_declaration));
+    return (GnuCTreeTagMultiParameterList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_PARAMETER_LIST, 3, args);
+}
+GnuCTreeTagMultiStructDeclarator *gnu_c_create_tree_tag_multi_struct_declarator(Pool *pool, GnuCAnyStructDeclaratorList *any_struct_declarator_list, GnuCSymComma *sym_comma, GnuCOptAttributes *opt_attributes, GnuCAnyStructDeclarator *any_struct_declarator)
+{
+    GnuCAst *args[4] = {(GnuCAst *)any_struct_declarator_list, (GnuCAst *)sym_comma, (GnuCAst *)opt_attributes, (GnuCAst *)any_struct_declarator};
+    assert (gnu_c_is_any_struct_declarator_list((GnuCAst *)any_struct_declarator_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_any_struct_declarator((GnuCAst *)any_struct_declarator));
+    return (GnuCTreeTagMultiStructDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_MULTI_STRUCT_DECLARATOR, 4, args);
+}
+GnuCTreeTagNamedAsmOperand *gnu_c_create_tree_tag_named_asm_operand(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCAtomIdentifier *atom_identifier, GnuCSymRbracket *sym_rbracket, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[7] = {(GnuCAst *)sym_lbracket, (GnuCAst *)atom_identifier, (GnuCAst *)sym_rbracket, (GnuCAst *)alias_asm_string_literal, (GnuCAst *)sym_lparen, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    assert (gnu_c_is_alias_asm_string_literal((GnuCAst *)alias_asm_string_literal));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagNamedAsmOperand *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_NAMED_ASM_OPERAND, 7, args);
+}
+GnuCTreeTagNamedLabel *gnu_c_create_tree_tag_named_label(Pool *pool, GnuCAtomIdentifier *atom_identifier, GnuCSymColon *sym_colon, GnuCOptAttributes *opt_attributes)
+{
+    GnuCAst *args[3] = {(GnuCAst *)atom_identifier, (GnuCAst *)sym_colon, (GnuCAst *)opt_attributes};
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    return (GnuCTreeTagNamedLabel *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_NAMED_LABEL, 3, args);
+}
+GnuCTreeTagNamedMemberOffsetDesignator *gnu_c_create_tree_tag_named_member_offset_designator(Pool *pool, GnuCAnyOffsetofMemberDesignator *any_offsetof_member_designator, GnuCSymDot *sym_dot, GnuCAtomIdentifier *atom_identifier)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_offsetof_member_designator, (GnuCAst *)sym_dot, (GnuCAst *)atom_identifier};
+    assert (gnu_c_is_any_offsetof_member_designator((GnuCAst *)any_offsetof_member_designator));
+    assert (gnu_c_is_sym_dot((GnuCAst *)sym_dot));
+    assert (gnu_c_is_atom_identifier((GnuCAst *)atom_identifier));
+    return (GnuCTreeTagNamedMemberOffsetDesignator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_NAMED_MEMBER_OFFSET_DESIGNATOR, 3, args);
+}
+GnuCTreeTagNeExpression *gnu_c_create_tree_tag_ne_expression(Pool *pool, GnuCAnyEqualityExpression *any_equality_expression, GnuCSymNe *sym_ne, GnuCAnyRelationalExpression *any_relational_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_equality_expression, (GnuCAst *)sym_ne, (GnuCAst *)any_relational_expression};
+    assert (gnu_c_is_any_equality_expression((GnuCAst *)any_equality_expression));
+    assert (gnu_c_is_sym_ne((GnuCAst *)sym_ne));
+    assert (gnu_c_is_any_relational_expression((GnuCAst *)any_relational_expression));
+    return (GnuCTreeTagNeExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_NE_EXPRESSION, 3, args);
+}
+GnuCTreeTagOnlyHeadDeclarationSpecifiers *gnu_c_create_tree_tag_only_head_declaration_specifiers(Pool *pool, GnuCOptAttributes *opt_attributes, GnuCTreeHeadDeclarationSpecifiers *tree_head_declaration_specifiers)
+{
+    GnuCAst *args[2] = {(GnuCAst *)opt_attributes, (GnuCAst *)tree_head_declaration_specifiers};
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_tree_head_declaration_specifiers((GnuCAst *)tree_head_declaration_specifiers));
+    return (GnuCTreeTagOnlyHeadDeclarationSpecifiers *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_ONLY_HEAD_DECLARATION_SPECIFIERS, 2, args);
+}
+GnuCTreeTagParenDirectAbstractDeclarator *gnu_c_create_tree_tag_paren_direct_abstract_declarator(Pool *pool, GnuCSymLparen *sym_lparen, GnuCOptAttributes *opt_attributes, GnuCAnyAbstractDeclarator *any_abstract_declarator, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)sym_lparen, (GnuCAst *)opt_attributes, (GnuCAst *)any_abstract_declarator, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_any_abstract_declarator((GnuCAst *)any_abstract_declarator));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagParenDirectAbstractDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_PAREN_DIRECT_ABSTRACT_DECLARATOR, 4, args);
+}
+GnuCTreeTagParenDirectDeclarator *gnu_c_create_tree_tag_paren_direct_declarator(Pool *pool, GnuCSymLparen *sym_lparen, GnuCOptAttributes *opt_attributes, GnuCTreeDeclarator *tree_declarator, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)sym_lparen, (GnuCAst *)opt_attributes, (GnuCAst *)tree_declarator, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_tree_declarator((GnuCAst *)tree_declarator));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagParenDirectDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_PAREN_DIRECT_DECLARATOR, 4, args);
+}
+GnuCTreeTagParenExpression *gnu_c_create_tree_tag_paren_expression(Pool *pool, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[3] = {(GnuCAst *)sym_lparen, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagParenExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_PAREN_EXPRESSION, 3, args);
+}
+GnuCTreeTagPlusAssignmentExpression *gnu_c_create_tree_tag_plus_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymPlusAssign *sym_plus_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_plus_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_plus_assign((GnuCAst *)sym_plus_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagPlusAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_PLUS_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagPlusExpression *gnu_c_create_tree_tag_plus_expression(Pool *pool, GnuCAnyAdditiveExpression *any_additive_expression, GnuCSymPlus *sym_plus, GnuCAnyMultiplicativeExpression *any_multiplicative_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_additive_expression, (GnuCAst *)sym_plus, (GnuCAst *)any_multiplicative_expression};
+    assert (gnu_c_is_any_additive_expression((GnuCAst *)any_additive_expression));
+    assert (gnu_c_is_sym_plus((GnuCAst *)sym_plus));
+    assert (gnu_c_is_any_multiplicative_expression((GnuCAst *)any_multiplicative_expression));
+    return (GnuCTreeTagPlusExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_PLUS_EXPRESSION, 3, args);
+}
+GnuCTreeTagPointerAbstractDeclarator *gnu_c_create_tree_tag_pointer_abstract_declarator(Pool *pool, GnuCTreePointer *tree_pointer, GnuCOptDirectAbstractDeclarator *opt_direct_abstract_declarator)
+{
+    GnuCAst *args[2] = {(GnuCAst *)tree_pointer, (GnuCAst *)opt_direct_abstract_declarator};
+    assert (gnu_c_is_tree_pointer((GnuCAst *)tree_pointer));
+    assert (gnu_c_is_opt_direct_abstract_declarator((GnuCAst *)opt_direct_abstract_declarator));
+    return (GnuCTreeTagPointerAbstractDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_POINTER_ABSTRACT_DECLARATOR, 2, args);
+}
+GnuCTreeTagPostDecrExpression *gnu_c_create_tree_tag_post_decr_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymDecr *sym_decr)
+{
+    GnuCAst *args[2] = {(GnuCAst *)any_postfix_expression, (GnuCAst *)sym_decr};
+    assert (gnu_c_is_any_postfix_expression((GnuCAst *)any_postfix_expression));
+    assert (gnu_c_is_sym_decr((GnuCAst *)sym_decr));
+    return (GnuCTreeTagPostDecrExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_POST_DECR_EXPRESSION, 2, args);
+}
+GnuCTreeTagPostIncrExpression *gnu_c_create_tree_tag_post_incr_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymIncr *sym_incr)
+{
+    GnuCAst *args[2] = {(GnuCAst *)any_postfix_expression, (GnuCAst *)sym_incr};
+    assert (gnu_c_is_any_postfix_expression((GnuCAst *)any_postfix_expression));
+    assert (gnu_c_is_sym_incr((GnuCAst *)sym_incr));
+    return (GnuCTreeTagPostIncrExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_POST_INCR_EXPRESSION, 2, args);
+}
+GnuCTreeTagPreDecrExpression *gnu_c_create_tree_tag_pre_decr_expression(Pool *pool, GnuCSymDecr *sym_decr, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_decr, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_decr((GnuCAst *)sym_decr));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagPreDecrExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_PRE_DECR_EXPRESSION, 2, args);
+}
+GnuCTreeTagPreIncrExpression *gnu_c_create_tree_tag_pre_incr_expression(Pool *pool, GnuCSymIncr *sym_incr, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_incr, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_incr((GnuCAst *)sym_incr));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagPreIncrExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_PRE_INCR_EXPRESSION, 2, args);
+}
+GnuCTreeTagQListQualifier *gnu_c_create_tree_tag_q_list_qualifier(Pool *pool, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCAnyTypeQualifier *any_type_qualifier, GnuCOptAttributes *opt_attributes)
+{
+    GnuCAst *args[3] = {(GnuCAst *)opt_type_qualifier_list, (GnuCAst *)any_type_qualifier, (GnuCAst *)opt_attributes};
+    assert (gnu_c_is_opt_type_qualifier_list((GnuCAst *)opt_type_qualifier_list));
+    assert (gnu_c_is_any_type_qualifier((GnuCAst *)any_type_qualifier));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    return (GnuCTreeTagQListQualifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_Q_LIST_QUALIFIER, 3, args);
+}
+GnuCTreeTagRealExpression *gnu_c_create_tree_tag_real_expression(Pool *pool, GnuCKwReal *kw_real, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_real, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_kw_real((GnuCAst *)kw_real));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagRealExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_REAL_EXPRESSION, 2, args);
+}
+GnuCTreeTagReturnStatement *gnu_c_create_tree_tag_return_statement(Pool *pool, GnuCKwReturn *kw_return, GnuCOptExprList *opt_expr_list, GnuCSymSemicolon *sym_semicolon)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_return, (GnuCAst *)opt_expr_list, (GnuCAst *)sym_semicolon};
+    assert (gnu_c_is_kw_return((GnuCAst *)kw_return));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list));
+    assert (gnu_c_is_sym_semicolon((GnuCAst *)sym_semicolon));
+    return (GnuCTreeTagReturnStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_RETURN_STATEMENT, 3, args);
+}
+GnuCTreeTagReverseStaticArrayDeclarator *gnu_c_create_tree_tag_reverse_static_array_declarator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCAnyTypeQualifierList *any_type_qualifier_list, GnuCKwStatic *kw_static, GnuCAnyAssignmentExpression *any_assignment_expression, GnuCSymRbracket *sym_rbracket)
+{
+    GnuCAst *args[5] = {(GnuCAst *)sym_lbracket, (GnuCAst *)any_type_qualifier_list, (GnuCAst *)kw_static, (GnuCAst *)any_assignment_expression, (GnuCAst *)sym_rbracket};
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_any_type_qualifier_list((GnuCAst *)any_type_qualifier_list));
+    assert (gnu_c_is_kw_static((GnuCAst *)kw_static));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    return (GnuCTreeTagReverseStaticArrayDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_REVERSE_STATIC_ARRAY_DECLARATOR, 5, args);
+}
+GnuCTreeTagRightShiftAssignmentExpression *gnu_c_create_tree_tag_right_shift_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymRshiftAssign *sym_rshift_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_rshift_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_rshift_assign((GnuCAst *)sym_rshift_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagRightShiftAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_RIGHT_SHIFT_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagRightShiftExpression *gnu_c_create_tree_tag_right_shift_expression(Pool *pool, GnuCAnyShiftExpression *any_shift_expression, GnuCSymRshift *sym_rshift, GnuCAnyAdditiveExpression *any_additive_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_shift_expression, (GnuCAst *)sym_rshift, (GnuCAst *)any_additive_expression};
+    assert (gnu_c_is_any_shift_expression((GnuCAst *)any_shift_expression));
+    assert (gnu_c_is_sym_rshift((GnuCAst *)sym_rshift));
+    assert (gnu_c_is_any_additive_expression((GnuCAst *)any_additive_expression));
+    return (GnuCTreeTagRightShiftExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_RIGHT_SHIFT_EXPRESSION, 3, args);
+}
+GnuCTreeTagSimpleArrayDeclarator *gnu_c_create_tree_tag_simple_array_declarator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCOptAssignmentExpression *opt_assignment_expression, GnuCSymRbracket *sym_rbracket)
+{
+    GnuCAst *args[4] = {(GnuCAst *)sym_lbracket, (GnuCAst *)opt_type_qualifier_list, (GnuCAst *)opt_assignment_expression, (GnuCAst *)sym_rbracket};
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_opt_type_qualifier_list((GnuCAst *)opt_type_qualifier_list));
+    assert (gnu_c_is_opt_assignment_expression((GnuCAst *)opt_assignment_expression));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    return (GnuCTreeTagSimpleArrayDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_SIMPLE_ARRAY_DECLARATOR, 4, args);
+}
+GnuCTreeTagSimpleAssignmentExpression *gnu_c_create_tree_tag_simple_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymAssign *sym_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_assign((GnuCAst *)sym_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagSimpleAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_SIMPLE_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagSizeofExpressionExpression *gnu_c_create_tree_tag_sizeof_expression_expression(Pool *pool, GnuCKwSizeof *kw_sizeof, GnuCAnyNoCastExpression *any_no_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)kw_sizeof, (GnuCAst *)any_no_cast_expression};
+    assert (gnu_c_is_kw_sizeof((GnuCAst *)kw_sizeof));
+    assert (gnu_c_is_any_no_cast_expression((GnuCAst *)any_no_cast_expression));
+    return (GnuCTreeTagSizeofExpressionExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_SIZEOF_EXPRESSION_EXPRESSION, 2, args);
+}
+GnuCTreeTagSizeofTypeExpression *gnu_c_create_tree_tag_sizeof_type_expression(Pool *pool, GnuCKwSizeof *kw_sizeof, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_sizeof, (GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_sizeof((GnuCAst *)kw_sizeof));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagSizeofTypeExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_SIZEOF_TYPE_EXPRESSION, 4, args);
+}
+GnuCTreeTagSqListQualifier *gnu_c_create_tree_tag_sq_list_qualifier(Pool *pool, GnuCOptSpecifierQualifierList *opt_specifier_qualifier_list, GnuCAnyTypeQualifier *any_type_qualifier, GnuCOptAttributes *opt_attributes)
+{
+    GnuCAst *args[3] = {(GnuCAst *)opt_specifier_qualifier_list, (GnuCAst *)any_type_qualifier, (GnuCAst *)opt_attributes};
+    assert (gnu_c_is_opt_specifier_qualifier_list((GnuCAst *)opt_specifier_qualifier_list));
+    assert (gnu_c_is_any_type_qualifier((GnuCAst *)any_type_qualifier));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    return (GnuCTreeTagSqListQualifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_SQ_LIST_QUALIFIER, 3, args);
+}
+GnuCTreeTagSqListSpecifier *gnu_c_create_tree_tag_sq_list_specifier(Pool *pool, GnuCOptSpecifierQualifierList *opt_specifier_qualifier_list, GnuCAnyTypeSpecifier *any_type_specifier, GnuCOptAttributes *opt_attributes)
+{
+    GnuCAst *args[3] = {(GnuCAst *)opt_specifier_qualifier_list, (GnuCAst *)any_type_specifier, (GnuCAst *)opt_attributes};
+    assert (gnu_c_is_opt_specifier_qualifier_list((GnuCAst *)opt_specifier_qualifier_list));
+    assert (gnu_c_is_any_type_specifier((GnuCAst *)any_type_specifier));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    return (GnuCTreeTagSqListSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_SQ_LIST_SPECIFIER, 3, args);
+}
+GnuCTreeTagStarArrayDeclarator *gnu_c_create_tree_tag_star_array_declarator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCSymStar *sym_star, GnuCSymRbracket *sym_rbracket)
+{
+    GnuCAst *args[4] = {(GnuCAst *)sym_lbracket, (GnuCAst *)opt_type_qualifier_list, (GnuCAst *)sym_star, (GnuCAst *)sym_rbracket};
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_opt_type_qualifier_list((GnuCAst *)opt_type_qualifier_list));
+    assert (gnu_c_is_sym_star((GnuCAst *)sym_star));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    return (GnuCTreeTagStarArrayDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_STAR_ARRAY_DECLARATOR, 4, args);
+}
+GnuCTreeTagStaticArrayDeclarator *gnu_c_create_tree_tag_static_array_declarator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCKwStatic *kw_static, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCAnyAssignmentExpression *any_assignment_expression, GnuCSymRbracket *sym_rbracket)
+{
+    GnuCAst *args[5] = {(GnuCAst *)sym_lbracket, (GnuCAst *)kw_static, (GnuCAst *)opt_type_qualifier_list, (GnuCAst *)any_assignment_expression, (GnuCAst *)sym_rbracket};
+    assert (gnu_c_is_sym_lbracket((GnuCAst *)sym_lbracket));
+    assert (gnu_c_is_kw_static((GnuCAst *)kw_static));
+    assert (gnu_c_is_opt_type_qualifier_list((GnuCAst *)opt_type_qualifier_list));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    assert (gnu_c_is_sym_rbracket((GnuCAst *)sym_rbracket));
+    return (GnuCTreeTagStaticArrayDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_STATIC_ARRAY_DECLARATOR, 5, args);
+}
+GnuCTreeTagTernaryExpression *gnu_c_create_tree_tag_ternary_expression(Pool *pool, GnuCAnyLogicalOrExpression *any_logical_or_expression, GnuCSymQuery *sym_query, GnuCOptExprList *opt_expr_list, GnuCSymColon *sym_colon, GnuCAnyConditionalExpression *any_conditional_expression)
+{
+    GnuCAst *args[5] = {(GnuCAst *)any_logical_or_expression, (GnuCAst *)sym_query, (GnuCAst *)opt_expr_list, (GnuCAst *)sym_colon, (GnuCAst *)any_conditional_expression};
+    assert (gnu_c_is_any_logical_or_expression((GnuCAst *)any_logical_or_expression));
+    assert (gnu_c_is_sym_query((GnuCAst *)sym_query));
+    assert (gnu_c_is_opt_expr_list((GnuCAst *)opt_expr_list));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    return (GnuCTreeTagTernaryExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_TERNARY_EXPRESSION, 5, args);
+}
+GnuCTreeTagTimesAssignmentExpression *gnu_c_create_tree_tag_times_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymStarAssign *sym_star_assign, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_conditional_expression, (GnuCAst *)sym_star_assign, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_any_conditional_expression((GnuCAst *)any_conditional_expression));
+    assert (gnu_c_is_sym_star_assign((GnuCAst *)sym_star_assign));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagTimesAssignmentExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_TIMES_ASSIGNMENT_EXPRESSION, 3, args);
+}
+GnuCTreeTagTimesExpression *gnu_c_create_tree_tag_times_expression(Pool *pool, GnuCAnyMultiplicativeExpression *any_multiplicative_expression, GnuCSymStar *sym_star, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_multiplicative_expression, (GnuCAst *)sym_star, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_any_multiplicative_expression((GnuCAst *)any_multiplicative_expression));
+    assert (gnu_c_is_sym_star((GnuCAst *)sym_star));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagTimesExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_TIMES_EXPRESSION, 3, args);
+}
+GnuCTreeTagTypeGenericAssociation *gnu_c_create_tree_tag_type_generic_association(Pool *pool, GnuCTreeTypeName *tree_type_name, GnuCSymColon *sym_colon, GnuCAnyAssignmentExpression *any_assignment_expression)
+{
+    GnuCAst *args[3] = {(GnuCAst *)tree_type_name, (GnuCAst *)sym_colon, (GnuCAst *)any_assignment_expression};
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_colon((GnuCAst *)sym_colon));
+    assert (gnu_c_is_any_assignment_expression((GnuCAst *)any_assignment_expression));
+    return (GnuCTreeTagTypeGenericAssociation *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_TYPE_GENERIC_ASSOCIATION, 3, args);
+}
+GnuCTreeTagTypeofExprSpecifier *gnu_c_create_tree_tag_typeof_expr_specifier(Pool *pool, GnuCKwTypeof *kw_typeof, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_typeof, (GnuCAst *)sym_lparen, (GnuCAst *)any_expr_list, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_typeof((GnuCAst *)kw_typeof));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_any_expr_list((GnuCAst *)any_expr_list));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagTypeofExprSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_TYPEOF_EXPR_SPECIFIER, 4, args);
+}
+GnuCTreeTagTypeofTypeSpecifier *gnu_c_create_tree_tag_typeof_type_specifier(Pool *pool, GnuCKwTypeof *kw_typeof, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen)
+{
+    GnuCAst *args[4] = {(GnuCAst *)kw_typeof, (GnuCAst *)sym_lparen, (GnuCAst *)tree_type_name, (GnuCAst *)sym_rparen};
+    assert (gnu_c_is_kw_typeof((GnuCAst *)kw_typeof));
+    assert (gnu_c_is_sym_lparen((GnuCAst *)sym_lparen));
+    assert (gnu_c_is_tree_type_name((GnuCAst *)tree_type_name));
+    assert (gnu_c_is_sym_rparen((GnuCAst *)sym_rparen));
+    return (GnuCTreeTagTypeofTypeSpecifier *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_TYPEOF_TYPE_SPECIFIER, 4, args);
+}
+GnuCTreeTagUnaryMinusExpression *gnu_c_create_tree_tag_unary_minus_expression(Pool *pool, GnuCSymMinus *sym_minus, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_minus, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_minus((GnuCAst *)sym_minus));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagUnaryMinusExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_UNARY_MINUS_EXPRESSION, 2, args);
+}
+GnuCTreeTagUnaryPlusExpression *gnu_c_create_tree_tag_unary_plus_expression(Pool *pool, GnuCSymPlus *sym_plus, GnuCAnyMaybeCastExpression *any_maybe_cast_expression)
+{
+    GnuCAst *args[2] = {(GnuCAst *)sym_plus, (GnuCAst *)any_maybe_cast_expression};
+    assert (gnu_c_is_sym_plus((GnuCAst *)sym_plus));
+    assert (gnu_c_is_any_maybe_cast_expression((GnuCAst *)any_maybe_cast_expression));
+    return (GnuCTreeTagUnaryPlusExpression *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_UNARY_PLUS_EXPRESSION, 2, args);
+}
+GnuCTreeTagUninitializedDeclarator *gnu_c_create_tree_tag_uninitialized_declarator(Pool *pool, GnuCTreeDeclarator *tree_declarator, GnuCOptSimpleAsmExpr *opt_simple_asm_expr, GnuCOptAttributes *opt_attributes)
+{
+    GnuCAst *args[3] = {(GnuCAst *)tree_declarator, (GnuCAst *)opt_simple_asm_expr, (GnuCAst *)opt_attributes};
+    assert (gnu_c_is_tree_declarator((GnuCAst *)tree_declarator));
+    assert (gnu_c_is_opt_simple_asm_expr((GnuCAst *)opt_simple_asm_expr));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    return (GnuCTreeTagUninitializedDeclarator *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_UNINITIALIZED_DECLARATOR, 3, args);
+}
+GnuCTreeTagVariadicParameterList *gnu_c_create_tree_tag_variadic_parameter_list(Pool *pool, GnuCAnyParameterList *any_parameter_list, GnuCSymComma *sym_comma, GnuCSymEllipsis *sym_ellipsis)
+{
+    GnuCAst *args[3] = {(GnuCAst *)any_parameter_list, (GnuCAst *)sym_comma, (GnuCAst *)sym_ellipsis};
+    assert (gnu_c_is_any_parameter_list((GnuCAst *)any_parameter_list));
+    assert (gnu_c_is_sym_comma((GnuCAst *)sym_comma));
+    assert (gnu_c_is_sym_ellipsis((GnuCAst *)sym_ellipsis));
+    return (GnuCTreeTagVariadicParameterList *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAG_VARIADIC_PARAMETER_LIST, 3, args);
+}
+GnuCTreeTailDeclarationSpecifiers *gnu_c_create_tree_tail_declaration_specifiers(Pool *pool, GnuCOptTailDeclarationSpecifiers *opt_tail_declaration_specifiers, GnuCAnyTailDeclarationSpecifier *any_tail_declaration_specifier, GnuCOptAttributes *opt_attributes, GnuCOptHeadDeclarationSpecifiers *opt_head_declaration_specifiers)
+{
+    GnuCAst *args[4] = {(GnuCAst *)opt_tail_declaration_specifiers, (GnuCAst *)any_tail_declaration_specifier, (GnuCAst *)opt_attributes, (GnuCAst *)opt_head_declaration_specifiers};
+    assert (gnu_c_is_opt_tail_declaration_specifiers((GnuCAst *)opt_tail_declaration_specifiers));
+    assert (gnu_c_is_any_tail_declaration_specifier((GnuCAst *)any_tail_declaration_specifier));
+    assert (gnu_c_is_opt_attributes((GnuCAst *)opt_attributes));
+    assert (gnu_c_is_opt_head_declaration_specifiers((GnuCAst *)opt_head_declaration_specifiers));
+    return (GnuCTreeTailDeclarationSpecifiers *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TAIL_DECLARATION_SPECIFIERS, 4, args);
+}
+GnuCTreeTypeName *gnu_c_create_tree_type_name(Pool *pool, GnuCAnySpecifierQualifierList *any_specifier_qualifier_list, GnuCOptAbstractDeclarator *opt_abstract_declarator)
+{
+    GnuCAst *args[2] = {(GnuCAst *)any_specifier_qualifier_list, (GnuCAst *)opt_abstract_declarator};
+    assert (gnu_c_is_any_specifier_qualifier_list((GnuCAst *)any_specifier_qualifier_list));
+    assert (gnu_c_is_opt_abstract_declarator((GnuCAst *)opt_abstract_declarator));
+    return (GnuCTreeTypeName *)gnu_c_create_nonterminal(pool, GNU_C_TREE_TYPE_NAME, 2, args);
+}
+GnuCTreeWhileStatement *gnu_c_create_tree_while_statement(Pool *pool, GnuCKwWhile *kw_while, GnuCTreeCondition *tree_condition, GnuCTreeStatement *tree_statement)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_while, (GnuCAst *)tree_condition, (GnuCAst *)tree_statement};
+    assert (gnu_c_is_kw_while((GnuCAst *)kw_while));
+    assert (gnu_c_is_tree_condition((GnuCAst *)tree_condition));
+    assert (gnu_c_is_tree_statement((GnuCAst *)tree_statement));
+    return (GnuCTreeWhileStatement *)gnu_c_create_nonterminal(pool, GNU_C_TREE_WHILE_STATEMENT, 3, args);
+}
+GnuCTreeWhileStatementExceptIf *gnu_c_create_tree_while_statement_except_if(Pool *pool, GnuCKwWhile *kw_while, GnuCTreeCondition *tree_condition, GnuCTreeStatementExceptIf *tree_statement_except_if)
+{
+    GnuCAst *args[3] = {(GnuCAst *)kw_while, (GnuCAst *)tree_condition, (GnuCAst *)tree_statement_except_if};
+    assert (gnu_c_is_kw_while((GnuCAst *)kw_while));
+    assert (gnu_c_is_tree_condition((GnuCAst *)tree_condition));
+    assert (gnu_c_is_tree_statement_except_if((GnuCAst *)tree_statement_except_if));
+    return (GnuCTreeWhileStatementExceptIf *)gnu_c_create_nonterminal(pool, GNU_C_TREE_WHILE_STATEMENT_EXCEPT_IF, 3, args);
+}
+bool gnu_c_is_nothing(GnuCAst *ast)
+{
+    return ast->type == GNU_C_NOTHING;
+}
+bool gnu_c_is_alias_asm_string_literal(GnuCAst *ast)
+{
+    return gnu_c_is_atom_string_literal(ast);
+}
+bool gnu_c_is_alias_constant_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_conditional_expression(ast);
+}
+bool gnu_c_is_alias_enumeration_constant(GnuCAst *ast)
+{
+    return gnu_c_is_atom_identifier(ast);
+}
+bool gnu_c_is_alias_translation_unit(GnuCAst *ast)
+{
+    return gnu_c_is_opt_external_declarations(ast);
+}
+bool gnu_c_is_any_abstract_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_any_direct_abstract_declarator(ast) || gnu_c_is_tree_tag_pointer_abstract_declarator(ast);
+}
+bool gnu_c_is_any_additive_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_multiplicative_expression(ast) || gnu_c_is_tree_tag_plus_expression(ast) || gnu_c_is_tree_tag_minus_expression(ast);
+}
+bool gnu_c_is_any_alignment_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_alignas_type_specifier(ast) || gnu_c_is_tree_tag_alignas_expr_specifier(ast);
+}
+bool gnu_c_is_any_and_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_equality_expression(ast) || gnu_c_is_tree_tag_bit_and_expression(ast);
+}
+bool gnu_c_is_any_any_word(GnuCAst *ast)
+{
+    return gnu_c_is_atom_identifier(ast) || gnu_c_is_any_storage_class_specifier(ast) || gnu_c_is_any_type_specifier(ast) || gnu_c_is_any_type_qualifier(ast);
+}
+bool gnu_c_is_any_array_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_simple_array_declarator(ast) || gnu_c_is_tree_tag_static_array_declarator(ast) || gnu_c_is_tree_tag_reverse_static_array_declarator(ast) || gnu_c_is_tree_tag_star_array_declarator(ast);
+}
+bool gnu_c_is_any_array_designator(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_array_element_designator(ast) || gnu_c_is_tree_tag_array_range_designator(ast);
+}
+bool gnu_c_is_any_asm_argument(GnuCAst *ast)
+{
+    return gnu_c_is_alias_asm_string_literal(ast) || gnu_c_is_tree_tag_asm_argument_out(ast) || gnu_c_is_tree_tag_asm_argument_out_in(ast) || gnu_c_is_tree_tag_asm_argument_out_in_clobber(ast);
+}
+bool gnu_c_is_any_asm_clobbers(GnuCAst *ast)
+{
+    return gnu_c_is_alias_asm_string_literal(ast) || gnu_c_is_tree_tag_multi_asm_clobbers(ast);
+}
+bool gnu_c_is_any_asm_goto_operands(GnuCAst *ast)
+{
+    return gnu_c_is_atom_identifier(ast) || gnu_c_is_tree_tag_multi_asm_goto_operands(ast);
+}
+bool gnu_c_is_any_asm_operand(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_anonymous_asm_operand(ast) || gnu_c_is_tree_tag_named_asm_operand(ast);
+}
+bool gnu_c_is_any_asm_operands(GnuCAst *ast)
+{
+    return gnu_c_is_any_asm_operand(ast) || gnu_c_is_tree_tag_multi_asm_operands(ast);
+}
+bool gnu_c_is_any_asm_statement(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_asm_common_statement(ast) || gnu_c_is_tree_tag_asm_goto_statement(ast);
+}
+bool gnu_c_is_any_assignment_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_conditional_expression(ast) || gnu_c_is_tree_tag_simple_assignment_expression(ast) || gnu_c_is_tree_tag_times_assignment_expression(ast) || gnu_c_is_tree_tag_divide_assignment_expression(ast) || gnu_c_is_tree_tag_modulo_assignment_expression(ast) || gnu_c_is_tree_tag_plus_assignment_expression(ast) || gnu_c_is_tree_tag_minus_assignment_expression(ast) || gnu_c_is_tree_tag_left_shift_assignment_expression(ast) || gnu_c_is_tree_tag_right_shift_assignment_expression(ast) || gnu_c_is_tree_tag_bit_and_assignment_expression(ast) || gnu_c_is_tree_tag_bit_xor_assignment_expression(ast) || gnu_c_is_tree_tag_bit_ior_assignment_expression(ast);
+}
+bool gnu_c_is_any_attrib(GnuCAst *ast)
+{
+    return gnu_c_is_any_any_word(ast) || gnu_c_is_tree_tag_attrib_with_arg(ast);
+}
+bool gnu_c_is_any_attribute_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_attrib(ast) || gnu_c_is_tree_tag_multi_attribute_list(ast);
+}
+bool gnu_c_is_any_block_item(GnuCAst *ast)
+{
+    return gnu_c_is_any_nested_declaration(ast) || gnu_c_is_tree_statement(ast) || gnu_c_is_atom_comment(ast);
+}
+bool gnu_c_is_any_conditional_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_logical_or_expression(ast) || gnu_c_is_tree_tag_ternary_expression(ast);
+}
+bool gnu_c_is_any_constant(GnuCAst *ast)
+{
+    return gnu_c_is_any_floating_constant(ast) || gnu_c_is_any_integer_constant(ast) || gnu_c_is_atom_character_constant(ast);
+}
+bool gnu_c_is_any_declaration_specifiers(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_only_head_declaration_specifiers(ast) || gnu_c_is_tree_tag_head_tail_declaration_specifiers(ast);
+}
+bool gnu_c_is_any_designation(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_c99_designation(ast) || gnu_c_is_any_array_designator(ast) || gnu_c_is_tree_tag_gnu_designation(ast);
+}
+bool gnu_c_is_any_designator(GnuCAst *ast)
+{
+    return gnu_c_is_any_array_designator(ast) || gnu_c_is_tree_tag_member_designator(ast);
+}
+bool gnu_c_is_any_direct_abstract_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_paren_direct_abstract_declarator(ast) || gnu_c_is_tree_tag_array_direct_abstract_declarator(ast) || gnu_c_is_tree_tag_fun_direct_abstract_declarator(ast) || gnu_c_is_tree_tag_forward_param_fun_direct_abstract_declarator(ast);
+}
+bool gnu_c_is_any_direct_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_atom_identifier(ast) || gnu_c_is_tree_tag_paren_direct_declarator(ast) || gnu_c_is_tree_tag_array_direct_declarator(ast) || gnu_c_is_tree_tag_fun_direct_declarator(ast) || gnu_c_is_tree_tag_legacy_fun_direct_declarator(ast) || gnu_c_is_tree_tag_forward_param_fun_direct_declarator(ast);
+}
+bool gnu_c_is_any_enum_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_full_enum_specifier(ast) || gnu_c_is_tree_tag_forward_enum_specifier(ast);
+}
+bool gnu_c_is_any_enumerator(GnuCAst *ast)
+{
+    return gnu_c_is_alias_enumeration_constant(ast) || gnu_c_is_tree_tag_initialized_enumerator(ast);
+}
+bool gnu_c_is_any_enumerator_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_enumerator(ast) || gnu_c_is_tree_tag_multi_enumerator_list(ast);
+}
+bool gnu_c_is_any_equality_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_relational_expression(ast) || gnu_c_is_tree_tag_eq_expression(ast) || gnu_c_is_tree_tag_ne_expression(ast);
+}
+bool gnu_c_is_any_exclusive_or_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_and_expression(ast) || gnu_c_is_tree_tag_bit_xor_expression(ast);
+}
+bool gnu_c_is_any_expr_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_assignment_expression(ast) || gnu_c_is_tree_tag_multi_expr_list(ast);
+}
+bool gnu_c_is_any_external_declaration(GnuCAst *ast)
+{
+    return gnu_c_is_any_function_definition(ast) || gnu_c_is_tree_declaration(ast) || gnu_c_is_tree_static_assert_declaration(ast) || gnu_c_is_tree_asm_definition(ast) || gnu_c_is_sym_semicolon(ast) || gnu_c_is_tree_tag_extension_external_declaration(ast) || gnu_c_is_tree_tag_implicit_int_declaration(ast) || gnu_c_is_atom_comment(ast);
+}
+bool gnu_c_is_any_floating_constant(GnuCAst *ast)
+{
+    return gnu_c_is_atom_decimal_floating_constant(ast) || gnu_c_is_atom_hexadecimal_floating_constant(ast);
+}
+bool gnu_c_is_any_for_statement(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_for_expr_statement(ast) || gnu_c_is_tree_tag_for_decl_statement(ast);
+}
+bool gnu_c_is_any_for_statement_except_if(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_for_expr_statement_except_if(ast) || gnu_c_is_tree_tag_for_decl_statement_except_if(ast);
+}
+bool gnu_c_is_any_function_definition(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_implicit_int_function_definition(ast) || gnu_c_is_tree_nested_function_definition(ast);
+}
+bool gnu_c_is_any_function_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_kw_inline(ast) || gnu_c_is_kw_noreturn(ast);
+}
+bool gnu_c_is_any_generic_assoc_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_generic_association(ast) || gnu_c_is_tree_tag_multi_generic_assoc_list(ast);
+}
+bool gnu_c_is_any_generic_association(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_type_generic_association(ast) || gnu_c_is_tree_tag_default_generic_association(ast);
+}
+bool gnu_c_is_any_head_declaration_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_any_storage_class_specifier(ast) || gnu_c_is_any_function_specifier(ast) || gnu_c_is_any_alignment_specifier(ast);
+}
+bool gnu_c_is_any_identifier_list(GnuCAst *ast)
+{
+    return gnu_c_is_atom_identifier(ast) || gnu_c_is_tree_tag_multi_identifier_list(ast);
+}
+bool gnu_c_is_any_inclusive_or_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_exclusive_or_expression(ast) || gnu_c_is_tree_tag_bit_ior_expression(ast);
+}
+bool gnu_c_is_any_init_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_uninitialized_declarator(ast) || gnu_c_is_tree_tag_initialized_declarator(ast);
+}
+bool gnu_c_is_any_init_declarator_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_init_declarator(ast) || gnu_c_is_tree_tag_multi_init_declarator_list(ast);
+}
+bool gnu_c_is_any_initializer(GnuCAst *ast)
+{
+    return gnu_c_is_any_assignment_expression(ast) || gnu_c_is_tree_tag_braced_initializer(ast) || gnu_c_is_tree_tag_braced_initializer_comma(ast);
+}
+bool gnu_c_is_any_initializer_list(GnuCAst *ast)
+{
+    return gnu_c_is_tree_designated_initializer(ast) || gnu_c_is_tree_tag_multi_initializer_list(ast);
+}
+bool gnu_c_is_any_integer_constant(GnuCAst *ast)
+{
+    return gnu_c_is_atom_decimal_constant(ast) || gnu_c_is_atom_octal_constant(ast) || gnu_c_is_atom_hexadecimal_constant(ast) || gnu_c_is_atom_binary_constant(ast);
+}
+bool gnu_c_is_any_label(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_named_label(ast) || gnu_c_is_tree_tag_case_label(ast) || gnu_c_is_tree_tag_default_label(ast) || gnu_c_is_tree_tag_case_range_label(ast);
+}
+bool gnu_c_is_any_logical_and_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_inclusive_or_expression(ast) || gnu_c_is_tree_tag_log_and_expression(ast);
+}
+bool gnu_c_is_any_logical_or_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_logical_and_expression(ast) || gnu_c_is_tree_tag_log_or_expression(ast);
+}
+bool gnu_c_is_any_maybe_cast_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_no_cast_expression(ast) || gnu_c_is_tree_tag_actual_cast_expression(ast);
+}
+bool gnu_c_is_any_multiplicative_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_maybe_cast_expression(ast) || gnu_c_is_tree_tag_times_expression(ast) || gnu_c_is_tree_tag_divide_expression(ast) || gnu_c_is_tree_tag_modulo_expression(ast);
+}
+bool gnu_c_is_any_nested_declaration(GnuCAst *ast)
+{
+    return gnu_c_is_tree_declaration(ast) || gnu_c_is_tree_static_assert_declaration(ast) || gnu_c_is_tree_tag_extension_nested_declaration(ast) || gnu_c_is_tree_nested_function_definition(ast);
+}
+bool gnu_c_is_any_no_cast_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_postfix_expression(ast) || gnu_c_is_tree_tag_pre_incr_expression(ast) || gnu_c_is_tree_tag_pre_decr_expression(ast) || gnu_c_is_tree_tag_addressof_expression(ast) || gnu_c_is_tree_tag_deref_expression(ast) || gnu_c_is_tree_tag_unary_plus_expression(ast) || gnu_c_is_tree_tag_unary_minus_expression(ast) || gnu_c_is_tree_tag_bit_not_expression(ast) || gnu_c_is_tree_tag_log_not_expression(ast) || gnu_c_is_tree_tag_extension_expression(ast) || gnu_c_is_tree_tag_real_expression(ast) || gnu_c_is_tree_tag_imag_expression(ast) || gnu_c_is_tree_tag_sizeof_expression_expression(ast) || gnu_c_is_tree_tag_sizeof_type_expression(ast) || gnu_c_is_tree_tag_alignof_expression_expression(ast) || gnu_c_is_tree_tag_alignof_type_expression(ast) || gnu_c_is_tree_tag_label_address_expression(ast);
+}
+bool gnu_c_is_any_offsetof_member_designator(GnuCAst *ast)
+{
+    return gnu_c_is_atom_identifier(ast) || gnu_c_is_tree_tag_named_member_offset_designator(ast) || gnu_c_is_tree_tag_array_member_offset_designator(ast);
+}
+bool gnu_c_is_any_parameter_declaration(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_concrete_parameter_declaration(ast) || gnu_c_is_tree_tag_abstract_parameter_declaration(ast);
+}
+bool gnu_c_is_any_parameter_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_parameter_declaration(ast) || gnu_c_is_tree_tag_multi_parameter_list(ast);
+}
+bool gnu_c_is_any_parameter_type_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_parameter_list(ast) || gnu_c_is_tree_tag_variadic_parameter_list(ast);
+}
+bool gnu_c_is_any_postfix_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_primary_expression(ast) || gnu_c_is_tree_tag_index_expression(ast) || gnu_c_is_tree_tag_call_expression(ast) || gnu_c_is_tree_tag_direct_member_expression(ast) || gnu_c_is_tree_tag_indirect_member_expression(ast) || gnu_c_is_tree_tag_post_incr_expression(ast) || gnu_c_is_tree_tag_post_decr_expression(ast) || gnu_c_is_tree_tag_compound_literal(ast) || gnu_c_is_tree_tag_compound_literal_comma(ast);
+}
+bool gnu_c_is_any_primary_expression(GnuCAst *ast)
+{
+    return gnu_c_is_atom_identifier(ast) || gnu_c_is_any_constant(ast) || gnu_c_is_atom_string_literal(ast) || gnu_c_is_tree_tag_paren_expression(ast) || gnu_c_is_tree_generic_selection(ast) || gnu_c_is_kw_func(ast) || gnu_c_is_kw_function(ast) || gnu_c_is_kw_pretty_function(ast) || gnu_c_is_tree_tag_gnu_statement_expression(ast) || gnu_c_is_tree_tag_builtin_va_arg_expression(ast) || gnu_c_is_tree_tag_builtin_offsetof_expression(ast) || gnu_c_is_tree_tag_builtin_choose_expr_expression(ast) || gnu_c_is_tree_tag_builtin_types_compatible_p_expression(ast) || gnu_c_is_tree_tag_builtin_complex_expression(ast) || gnu_c_is_tree_tag_builtin_simple_shuffle_expression(ast) || gnu_c_is_tree_tag_builtin_mix_shuffle_expression(ast);
+}
+bool gnu_c_is_any_relational_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_shift_expression(ast) || gnu_c_is_tree_tag_lt_expression(ast) || gnu_c_is_tree_tag_gt_expression(ast) || gnu_c_is_tree_tag_le_expression(ast) || gnu_c_is_tree_tag_ge_expression(ast);
+}
+bool gnu_c_is_any_shift_expression(GnuCAst *ast)
+{
+    return gnu_c_is_any_additive_expression(ast) || gnu_c_is_tree_tag_left_shift_expression(ast) || gnu_c_is_tree_tag_right_shift_expression(ast);
+}
+bool gnu_c_is_any_specifier_qualifier_list(GnuCAst *ast)
+{
+    return gnu_c_is_tree_attributes(ast) || gnu_c_is_tree_tag_sq_list_specifier(ast) || gnu_c_is_tree_tag_sq_list_qualifier(ast);
+}
+bool gnu_c_is_any_storage_class_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_kw_typedef(ast) || gnu_c_is_kw_extern(ast) || gnu_c_is_kw_static(ast) || gnu_c_is_kw_auto(ast) || gnu_c_is_kw_register(ast) || gnu_c_is_kw_thread_local(ast) || gnu_c_is_kw_thread(ast);
+}
+bool gnu_c_is_any_struct_declaration(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_member_declaration(ast) || gnu_c_is_tree_static_assert_declaration(ast) || gnu_c_is_tree_tag_extension_struct_declaration(ast) || gnu_c_is_sym_semicolon(ast);
+}
+bool gnu_c_is_any_struct_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_member_declarator(ast) || gnu_c_is_tree_tag_bitfield_declarator(ast);
+}
+bool gnu_c_is_any_struct_declarator_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_struct_declarator(ast) || gnu_c_is_tree_tag_multi_struct_declarator(ast);
+}
+bool gnu_c_is_any_struct_or_union(GnuCAst *ast)
+{
+    return gnu_c_is_kw_struct(ast) || gnu_c_is_kw_union(ast);
+}
+bool gnu_c_is_any_struct_or_union_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_full_struct_or_union_specifier(ast) || gnu_c_is_tree_tag_forward_struct_or_union_specifier(ast);
+}
+bool gnu_c_is_any_tail_declaration_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_any_type_specifier(ast) || gnu_c_is_any_type_qualifier(ast);
+}
+bool gnu_c_is_any_type_qualifier(GnuCAst *ast)
+{
+    return gnu_c_is_kw_const(ast) || gnu_c_is_kw_restrict(ast) || gnu_c_is_kw_volatile(ast) || gnu_c_is_kw_atomic_as_qualifier(ast) || gnu_c_is_atom_address_space(ast);
+}
+bool gnu_c_is_any_type_qualifier_list(GnuCAst *ast)
+{
+    return gnu_c_is_tree_attributes(ast) || gnu_c_is_tree_tag_q_list_qualifier(ast);
+}
+bool gnu_c_is_any_type_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_kw_void(ast) || gnu_c_is_kw_char(ast) || gnu_c_is_kw_short(ast) || gnu_c_is_kw_int(ast) || gnu_c_is_kw_long(ast) || gnu_c_is_kw_float(ast) || gnu_c_is_kw_double(ast) || gnu_c_is_kw_signed(ast) || gnu_c_is_kw_unsigned(ast) || gnu_c_is_kw_bool(ast) || gnu_c_is_kw_complex(ast) || gnu_c_is_any_struct_or_union_specifier(ast) || gnu_c_is_any_enum_specifier(ast) || gnu_c_is_atom_typedef_name(ast) || gnu_c_is_tree_atomic_type_specifier(ast) || gnu_c_is_any_typeof_specifier(ast) || gnu_c_is_kw_auto_type(ast) || gnu_c_is_kw_decimal32(ast) || gnu_c_is_kw_decimal64(ast) || gnu_c_is_kw_decimal128(ast) || gnu_c_is_kw_fract(ast) || gnu_c_is_kw_accum(ast) || gnu_c_is_kw_sat(ast);
+}
+bool gnu_c_is_any_typeof_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tag_typeof_expr_specifier(ast) || gnu_c_is_tree_tag_typeof_type_specifier(ast);
+}
+bool gnu_c_is_any_unambiguous_statement(GnuCAst *ast)
+{
+    return gnu_c_is_tree_compound_statement(ast) || gnu_c_is_tree_expression_statement(ast) || gnu_c_is_tree_do_statement(ast) || gnu_c_is_tree_tag_goto_statement(ast) || gnu_c_is_tree_tag_continue_statement(ast) || gnu_c_is_tree_tag_break_statement(ast) || gnu_c_is_tree_tag_return_statement(ast) || gnu_c_is_tree_tag_computed_goto_statement(ast) || gnu_c_is_any_asm_statement(ast);
+}
+bool gnu_c_is_any_unlabeled_statement(GnuCAst *ast)
+{
+    return gnu_c_is_tree_if_statement(ast) || gnu_c_is_tree_if_else_statement(ast) || gnu_c_is_tree_switch_statement(ast) || gnu_c_is_tree_while_statement(ast) || gnu_c_is_any_for_statement(ast) || gnu_c_is_any_unambiguous_statement(ast);
+}
+bool gnu_c_is_any_unlabeled_statement_except_if(GnuCAst *ast)
+{
+    return gnu_c_is_tree_if_else_statement_except_if(ast) || gnu_c_is_tree_switch_statement_except_if(ast) || gnu_c_is_tree_while_statement_except_if(ast) || gnu_c_is_any_for_statement_except_if(ast) || gnu_c_is_any_unambiguous_statement(ast);
+}
+bool gnu_c_is_atom_address_space(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_ADDRESS_SPACE;
+}
+bool gnu_c_is_atom_binary_constant(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_BINARY_CONSTANT;
+}
+bool gnu_c_is_atom_character_constant(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_CHARACTER_CONSTANT;
+}
+bool gnu_c_is_atom_comment(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_COMMENT;
+}
+bool gnu_c_is_atom_decimal_constant(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_DECIMAL_CONSTANT;
+}
+bool gnu_c_is_atom_decimal_floating_constant(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_DECIMAL_FLOATING_CONSTANT;
+}
+bool gnu_c_is_atom_hexadecimal_constant(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_HEXADECIMAL_CONSTANT;
+}
+bool gnu_c_is_atom_hexadecimal_floating_constant(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_HEXADECIMAL_FLOATING_CONSTANT;
+}
+bool gnu_c_is_atom_identifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_IDENTIFIER;
+}
+bool gnu_c_is_atom_octal_constant(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_OCTAL_CONSTANT;
+}
+bool gnu_c_is_atom_string_literal(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_STRING_LITERAL;
+}
+bool gnu_c_is_atom_typedef_name(GnuCAst *ast)
+{
+    return ast->type == GNU_C_ATOM_TYPEDEF_NAME;
+}
+bool gnu_c_is_kw_accum(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ACCUM;
+}
+bool gnu_c_is_kw_alignas(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ALIGNAS;
+}
+bool gnu_c_is_kw_alignof(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ALIGNOF;
+}
+bool gnu_c_is_kw_asm(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ASM;
+}
+bool gnu_c_is_kw_atomic_as_qualifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ATOMIC_AS_QUALIFIER;
+}
+bool gnu_c_is_kw_atomic_as_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ATOMIC_AS_SPECIFIER;
+}
+bool gnu_c_is_kw_attribute(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ATTRIBUTE;
+}
+bool gnu_c_is_kw_auto(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_AUTO;
+}
+bool gnu_c_is_kw_auto_type(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_AUTO_TYPE;
+}
+bool gnu_c_is_kw_bool(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_BOOL;
+}
+bool gnu_c_is_kw_break(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_BREAK;
+}
+bool gnu_c_is_kw_builtin_choose_expr(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_BUILTIN_CHOOSE_EXPR;
+}
+bool gnu_c_is_kw_builtin_complex(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_BUILTIN_COMPLEX;
+}
+bool gnu_c_is_kw_builtin_offsetof(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_BUILTIN_OFFSETOF;
+}
+bool gnu_c_is_kw_builtin_shuffle(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_BUILTIN_SHUFFLE;
+}
+bool gnu_c_is_kw_builtin_types_compatible_p(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_BUILTIN_TYPES_COMPATIBLE_P;
+}
+bool gnu_c_is_kw_builtin_va_arg(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_BUILTIN_VA_ARG;
+}
+bool gnu_c_is_kw_case(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_CASE;
+}
+bool gnu_c_is_kw_char(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_CHAR;
+}
+bool gnu_c_is_kw_complex(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_COMPLEX;
+}
+bool gnu_c_is_kw_const(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_CONST;
+}
+bool gnu_c_is_kw_continue(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_CONTINUE;
+}
+bool gnu_c_is_kw_decimal128(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_DECIMAL128;
+}
+bool gnu_c_is_kw_decimal32(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_DECIMAL32;
+}
+bool gnu_c_is_kw_decimal64(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_DECIMAL64;
+}
+bool gnu_c_is_kw_default(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_DEFAULT;
+}
+bool gnu_c_is_kw_do(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_DO;
+}
+bool gnu_c_is_kw_double(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_DOUBLE;
+}
+bool gnu_c_is_kw_else(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ELSE;
+}
+bool gnu_c_is_kw_enum(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_ENUM;
+}
+bool gnu_c_is_kw_extension(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_EXTENSION;
+}
+bool gnu_c_is_kw_extern(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_EXTERN;
+}
+bool gnu_c_is_kw_float(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_FLOAT;
+}
+bool gnu_c_is_kw_for(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_FOR;
+}
+bool gnu_c_is_kw_fract(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_FRACT;
+}
+bool gnu_c_is_kw_func(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_FUNC;
+}
+bool gnu_c_is_kw_function(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_FUNCTION;
+}
+bool gnu_c_is_kw_generic(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_GENERIC;
+}
+bool gnu_c_is_kw_goto(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_GOTO;
+}
+bool gnu_c_is_kw_if(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_IF;
+}
+bool gnu_c_is_kw_imag(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_IMAG;
+}
+bool gnu_c_is_kw_inline(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_INLINE;
+}
+bool gnu_c_is_kw_int(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_INT;
+}
+bool gnu_c_is_kw_label(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_LABEL;
+}
+bool gnu_c_is_kw_long(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_LONG;
+}
+bool gnu_c_is_kw_noreturn(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_NORETURN;
+}
+bool gnu_c_is_kw_pretty_function(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_PRETTY_FUNCTION;
+}
+bool gnu_c_is_kw_real(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_REAL;
+}
+bool gnu_c_is_kw_register(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_REGISTER;
+}
+bool gnu_c_is_kw_restrict(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_RESTRICT;
+}
+bool gnu_c_is_kw_return(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_RETURN;
+}
+bool gnu_c_is_kw_sat(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_SAT;
+}
+bool gnu_c_is_kw_short(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_SHORT;
+}
+bool gnu_c_is_kw_signed(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_SIGNED;
+}
+bool gnu_c_is_kw_sizeof(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_SIZEOF;
+}
+bool gnu_c_is_kw_static(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_STATIC;
+}
+bool gnu_c_is_kw_static_assert(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_STATIC_ASSERT;
+}
+bool gnu_c_is_kw_struct(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_STRUCT;
+}
+bool gnu_c_is_kw_switch(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_SWITCH;
+}
+bool gnu_c_is_kw_thread(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_THREAD;
+}
+bool gnu_c_is_kw_thread_local(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_THREAD_LOCAL;
+}
+bool gnu_c_is_kw_typedef(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_TYPEDEF;
+}
+bool gnu_c_is_kw_typeof(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_TYPEOF;
+}
+bool gnu_c_is_kw_union(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_UNION;
+}
+bool gnu_c_is_kw_unsigned(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_UNSIGNED;
+}
+bool gnu_c_is_kw_void(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_VOID;
+}
+bool gnu_c_is_kw_volatile(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_VOLATILE;
+}
+bool gnu_c_is_kw_while(GnuCAst *ast)
+{
+    return ast->type == GNU_C_KW_WHILE;
+}
+bool gnu_c_is_opt_abstract_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_abstract_declarator(ast);
+}
+bool gnu_c_is_opt_asm_clobbers(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_asm_clobbers(ast);
+}
+bool gnu_c_is_opt_asm_operands(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_asm_operands(ast);
+}
+bool gnu_c_is_opt_assignment_expression(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_assignment_expression(ast);
+}
+bool gnu_c_is_opt_attrib(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_attrib(ast);
+}
+bool gnu_c_is_opt_attribute_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_attribute_list(ast);
+}
+bool gnu_c_is_opt_attributes(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_attributes(ast);
+}
+bool gnu_c_is_opt_block_item_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_block_item_list(ast);
+}
+bool gnu_c_is_opt_comma(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_sym_comma(ast);
+}
+bool gnu_c_is_opt_declaration_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_declaration_list(ast);
+}
+bool gnu_c_is_opt_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_declarator(ast);
+}
+bool gnu_c_is_opt_designation(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_designation(ast);
+}
+bool gnu_c_is_opt_designator_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_designator_list(ast);
+}
+bool gnu_c_is_opt_direct_abstract_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_direct_abstract_declarator(ast);
+}
+bool gnu_c_is_opt_expr_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_expr_list(ast);
+}
+bool gnu_c_is_opt_external_declarations(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_external_declarations(ast);
+}
+bool gnu_c_is_opt_head_declaration_specifiers(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_head_declaration_specifiers(ast);
+}
+bool gnu_c_is_opt_identifier(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_atom_identifier(ast);
+}
+bool gnu_c_is_opt_identifier_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_identifier_list(ast);
+}
+bool gnu_c_is_opt_init_declarator_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_init_declarator_list(ast);
+}
+bool gnu_c_is_opt_initializer_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_initializer_list(ast);
+}
+bool gnu_c_is_opt_label_declarations(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_label_declarations(ast);
+}
+bool gnu_c_is_opt_labels(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_labels(ast);
+}
+bool gnu_c_is_opt_parameter_forward_declarations(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_parameter_forward_declarations(ast);
+}
+bool gnu_c_is_opt_parameter_type_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_parameter_type_list(ast);
+}
+bool gnu_c_is_opt_pointer(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_pointer(ast);
+}
+bool gnu_c_is_opt_simple_asm_expr(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_simple_asm_expr(ast);
+}
+bool gnu_c_is_opt_specifier_qualifier_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_specifier_qualifier_list(ast);
+}
+bool gnu_c_is_opt_struct_declaration_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_struct_declaration_list(ast);
+}
+bool gnu_c_is_opt_struct_declarator_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_struct_declarator_list(ast);
+}
+bool gnu_c_is_opt_tail_declaration_specifiers(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_tree_tail_declaration_specifiers(ast);
+}
+bool gnu_c_is_opt_type_qualifier(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_type_qualifier(ast);
+}
+bool gnu_c_is_opt_type_qualifier_list(GnuCAst *ast)
+{
+    return gnu_c_is_nothing(ast) || gnu_c_is_any_type_qualifier_list(ast);
+}
+bool gnu_c_is_sym_ampersand(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_AMPERSAND;
+}
+bool gnu_c_is_sym_ampersand_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_AMPERSAND_ASSIGN;
+}
+bool gnu_c_is_sym_arrow(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_ARROW;
+}
+bool gnu_c_is_sym_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_ASSIGN;
+}
+bool gnu_c_is_sym_bang(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_BANG;
+}
+bool gnu_c_is_sym_caret(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_CARET;
+}
+bool gnu_c_is_sym_caret_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_CARET_ASSIGN;
+}
+bool gnu_c_is_sym_colon(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_COLON;
+}
+bool gnu_c_is_sym_comma(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_COMMA;
+}
+bool gnu_c_is_sym_decr(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_DECR;
+}
+bool gnu_c_is_sym_dot(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_DOT;
+}
+bool gnu_c_is_sym_ellipsis(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_ELLIPSIS;
+}
+bool gnu_c_is_sym_eq(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_EQ;
+}
+bool gnu_c_is_sym_ge(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_GE;
+}
+bool gnu_c_is_sym_gt(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_GT;
+}
+bool gnu_c_is_sym_incr(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_INCR;
+}
+bool gnu_c_is_sym_lbrace(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LBRACE;
+}
+bool gnu_c_is_sym_lbracket(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LBRACKET;
+}
+bool gnu_c_is_sym_le(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LE;
+}
+bool gnu_c_is_sym_logical_and(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LOGICAL_AND;
+}
+bool gnu_c_is_sym_logical_or(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LOGICAL_OR;
+}
+bool gnu_c_is_sym_lparen(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LPAREN;
+}
+bool gnu_c_is_sym_lshift(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LSHIFT;
+}
+bool gnu_c_is_sym_lshift_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LSHIFT_ASSIGN;
+}
+bool gnu_c_is_sym_lt(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_LT;
+}
+bool gnu_c_is_sym_minus(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_MINUS;
+}
+bool gnu_c_is_sym_minus_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_MINUS_ASSIGN;
+}
+bool gnu_c_is_sym_ne(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_NE;
+}
+bool gnu_c_is_sym_percent(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_PERCENT;
+}
+bool gnu_c_is_sym_percent_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_PERCENT_ASSIGN;
+}
+bool gnu_c_is_sym_pipe(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_PIPE;
+}
+bool gnu_c_is_sym_pipe_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_PIPE_ASSIGN;
+}
+bool gnu_c_is_sym_plus(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_PLUS;
+}
+bool gnu_c_is_sym_plus_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_PLUS_ASSIGN;
+}
+bool gnu_c_is_sym_query(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_QUERY;
+}
+bool gnu_c_is_sym_rbrace(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_RBRACE;
+}
+bool gnu_c_is_sym_rbracket(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_RBRACKET;
+}
+bool gnu_c_is_sym_rparen(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_RPAREN;
+}
+bool gnu_c_is_sym_rshift(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_RSHIFT;
+}
+bool gnu_c_is_sym_rshift_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_RSHIFT_ASSIGN;
+}
+bool gnu_c_is_sym_semicolon(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_SEMICOLON;
+}
+bool gnu_c_is_sym_slash(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_SLASH;
+}
+bool gnu_c_is_sym_slash_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_SLASH_ASSIGN;
+}
+bool gnu_c_is_sym_star(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_STAR;
+}
+bool gnu_c_is_sym_star_assign(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_STAR_ASSIGN;
+}
+bool gnu_c_is_sym_tilde(GnuCAst *ast)
+{
+    return ast->type == GNU_C_SYM_TILDE;
+}
+bool gnu_c_is_tree_asm_definition(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_ASM_DEFINITION;
+}
+bool gnu_c_is_tree_asm_goto_argument(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_ASM_GOTO_ARGUMENT;
+}
+bool gnu_c_is_tree_atomic_type_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_ATOMIC_TYPE_SPECIFIER;
+}
+bool gnu_c_is_tree_attribute(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_ATTRIBUTE;
+}
+bool gnu_c_is_tree_attributes(GnuCAst *ast)
+{
+    return gnu_c_is_tree_attribute(ast) || ast->type == GNU_C_TREE_ATTRIBUTES;
+}
+bool gnu_c_is_tree_block_item_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_block_item(ast) || ast->type == GNU_C_TREE_BLOCK_ITEM_LIST;
+}
+bool gnu_c_is_tree_compound_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_COMPOUND_STATEMENT;
+}
+bool gnu_c_is_tree_condition(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_CONDITION;
+}
+bool gnu_c_is_tree_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_DECLARATION;
+}
+bool gnu_c_is_tree_declaration_list(GnuCAst *ast)
+{
+    return gnu_c_is_tree_declaration(ast) || ast->type == GNU_C_TREE_DECLARATION_LIST;
+}
+bool gnu_c_is_tree_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_any_direct_declarator(ast) || ast->type == GNU_C_TREE_DECLARATOR;
+}
+bool gnu_c_is_tree_designated_initializer(GnuCAst *ast)
+{
+    return gnu_c_is_any_initializer(ast) || ast->type == GNU_C_TREE_DESIGNATED_INITIALIZER;
+}
+bool gnu_c_is_tree_designator_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_designator(ast) || ast->type == GNU_C_TREE_DESIGNATOR_LIST;
+}
+bool gnu_c_is_tree_do_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_DO_STATEMENT;
+}
+bool gnu_c_is_tree_expression_statement(GnuCAst *ast)
+{
+    return gnu_c_is_sym_semicolon(ast) || ast->type == GNU_C_TREE_EXPRESSION_STATEMENT;
+}
+bool gnu_c_is_tree_external_declarations(GnuCAst *ast)
+{
+    return gnu_c_is_any_external_declaration(ast) || ast->type == GNU_C_TREE_EXTERNAL_DECLARATIONS;
+}
+bool gnu_c_is_tree_generic_selection(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_GENERIC_SELECTION;
+}
+bool gnu_c_is_tree_head_declaration_specifiers(GnuCAst *ast)
+{
+    return gnu_c_is_any_head_declaration_specifier(ast) || ast->type == GNU_C_TREE_HEAD_DECLARATION_SPECIFIERS;
+}
+bool gnu_c_is_tree_if_else_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_IF_ELSE_STATEMENT;
+}
+bool gnu_c_is_tree_if_else_statement_except_if(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_IF_ELSE_STATEMENT_EXCEPT_IF;
+}
+bool gnu_c_is_tree_if_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_IF_STATEMENT;
+}
+bool gnu_c_is_tree_label_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_LABEL_DECLARATION;
+}
+bool gnu_c_is_tree_label_declarations(GnuCAst *ast)
+{
+    return gnu_c_is_tree_label_declaration(ast) || ast->type == GNU_C_TREE_LABEL_DECLARATIONS;
+}
+bool gnu_c_is_tree_labels(GnuCAst *ast)
+{
+    return gnu_c_is_any_label(ast) || ast->type == GNU_C_TREE_LABELS;
+}
+bool gnu_c_is_tree_nested_function_definition(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_NESTED_FUNCTION_DEFINITION;
+}
+bool gnu_c_is_tree_parameter_forward_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_PARAMETER_FORWARD_DECLARATION;
+}
+bool gnu_c_is_tree_parameter_forward_declarations(GnuCAst *ast)
+{
+    return gnu_c_is_tree_parameter_forward_declaration(ast) || ast->type == GNU_C_TREE_PARAMETER_FORWARD_DECLARATIONS;
+}
+bool gnu_c_is_tree_pointer(GnuCAst *ast)
+{
+    return gnu_c_is_sym_star(ast) || ast->type == GNU_C_TREE_POINTER;
+}
+bool gnu_c_is_tree_simple_asm_expr(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_SIMPLE_ASM_EXPR;
+}
+bool gnu_c_is_tree_statement(GnuCAst *ast)
+{
+    return gnu_c_is_any_unlabeled_statement(ast) || ast->type == GNU_C_TREE_STATEMENT;
+}
+bool gnu_c_is_tree_statement_except_if(GnuCAst *ast)
+{
+    return gnu_c_is_any_unlabeled_statement_except_if(ast) || ast->type == GNU_C_TREE_STATEMENT_EXCEPT_IF;
+}
+bool gnu_c_is_tree_static_assert_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_STATIC_ASSERT_DECLARATION;
+}
+bool gnu_c_is_tree_struct_declaration_list(GnuCAst *ast)
+{
+    return gnu_c_is_any_struct_declaration(ast) || ast->type == GNU_C_TREE_STRUCT_DECLARATION_LIST;
+}
+bool gnu_c_is_tree_switch_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_SWITCH_STATEMENT;
+}
+bool gnu_c_is_tree_switch_statement_except_if(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_SWITCH_STATEMENT_EXCEPT_IF;
+}
+bool gnu_c_is_tree_tag_abstract_parameter_declaration(GnuCAst *ast)
+{
+    return gnu_c_is_any_declaration_specifiers(ast) || ast->type == GNU_C_TREE_TAG_ABSTRACT_PARAMETER_DECLARATION;
+}
+bool gnu_c_is_tree_tag_actual_cast_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ACTUAL_CAST_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_addressof_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ADDRESSOF_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_alignas_expr_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ALIGNAS_EXPR_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_alignas_type_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ALIGNAS_TYPE_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_alignof_expression_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ALIGNOF_EXPRESSION_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_alignof_type_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ALIGNOF_TYPE_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_anonymous_asm_operand(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ANONYMOUS_ASM_OPERAND;
+}
+bool gnu_c_is_tree_tag_array_direct_abstract_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_any_array_declarator(ast) || ast->type == GNU_C_TREE_TAG_ARRAY_DIRECT_ABSTRACT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_array_direct_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ARRAY_DIRECT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_array_element_designator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ARRAY_ELEMENT_DESIGNATOR;
+}
+bool gnu_c_is_tree_tag_array_member_offset_designator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ARRAY_MEMBER_OFFSET_DESIGNATOR;
+}
+bool gnu_c_is_tree_tag_array_range_designator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ARRAY_RANGE_DESIGNATOR;
+}
+bool gnu_c_is_tree_tag_asm_argument_out(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ASM_ARGUMENT_OUT;
+}
+bool gnu_c_is_tree_tag_asm_argument_out_in(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ASM_ARGUMENT_OUT_IN;
+}
+bool gnu_c_is_tree_tag_asm_argument_out_in_clobber(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ASM_ARGUMENT_OUT_IN_CLOBBER;
+}
+bool gnu_c_is_tree_tag_asm_common_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ASM_COMMON_STATEMENT;
+}
+bool gnu_c_is_tree_tag_asm_goto_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ASM_GOTO_STATEMENT;
+}
+bool gnu_c_is_tree_tag_attrib_with_arg(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_ATTRIB_WITH_ARG;
+}
+bool gnu_c_is_tree_tag_bit_and_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BIT_AND_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_bit_and_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BIT_AND_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_bit_ior_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BIT_IOR_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_bit_ior_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BIT_IOR_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_bit_not_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BIT_NOT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_bit_xor_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BIT_XOR_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_bit_xor_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BIT_XOR_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_bitfield_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BITFIELD_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_braced_initializer(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BRACED_INITIALIZER;
+}
+bool gnu_c_is_tree_tag_braced_initializer_comma(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BRACED_INITIALIZER_COMMA;
+}
+bool gnu_c_is_tree_tag_break_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BREAK_STATEMENT;
+}
+bool gnu_c_is_tree_tag_builtin_choose_expr_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BUILTIN_CHOOSE_EXPR_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_builtin_complex_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BUILTIN_COMPLEX_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_builtin_mix_shuffle_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BUILTIN_MIX_SHUFFLE_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_builtin_offsetof_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BUILTIN_OFFSETOF_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_builtin_simple_shuffle_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BUILTIN_SIMPLE_SHUFFLE_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_builtin_types_compatible_p_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BUILTIN_TYPES_COMPATIBLE_P_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_builtin_va_arg_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_BUILTIN_VA_ARG_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_c99_designation(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_C99_DESIGNATION;
+}
+bool gnu_c_is_tree_tag_call_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_CALL_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_case_label(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_CASE_LABEL;
+}
+bool gnu_c_is_tree_tag_case_range_label(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_CASE_RANGE_LABEL;
+}
+bool gnu_c_is_tree_tag_compound_literal(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_COMPOUND_LITERAL;
+}
+bool gnu_c_is_tree_tag_compound_literal_comma(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_COMPOUND_LITERAL_COMMA;
+}
+bool gnu_c_is_tree_tag_computed_goto_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_COMPUTED_GOTO_STATEMENT;
+}
+bool gnu_c_is_tree_tag_concrete_parameter_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_CONCRETE_PARAMETER_DECLARATION;
+}
+bool gnu_c_is_tree_tag_continue_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_CONTINUE_STATEMENT;
+}
+bool gnu_c_is_tree_tag_default_generic_association(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_DEFAULT_GENERIC_ASSOCIATION;
+}
+bool gnu_c_is_tree_tag_default_label(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_DEFAULT_LABEL;
+}
+bool gnu_c_is_tree_tag_deref_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_DEREF_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_direct_member_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_DIRECT_MEMBER_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_divide_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_DIVIDE_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_divide_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_DIVIDE_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_eq_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_EQ_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_extension_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_EXTENSION_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_extension_external_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_EXTENSION_EXTERNAL_DECLARATION;
+}
+bool gnu_c_is_tree_tag_extension_nested_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_EXTENSION_NESTED_DECLARATION;
+}
+bool gnu_c_is_tree_tag_extension_struct_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_EXTENSION_STRUCT_DECLARATION;
+}
+bool gnu_c_is_tree_tag_for_decl_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FOR_DECL_STATEMENT;
+}
+bool gnu_c_is_tree_tag_for_decl_statement_except_if(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FOR_DECL_STATEMENT_EXCEPT_IF;
+}
+bool gnu_c_is_tree_tag_for_expr_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FOR_EXPR_STATEMENT;
+}
+bool gnu_c_is_tree_tag_for_expr_statement_except_if(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FOR_EXPR_STATEMENT_EXCEPT_IF;
+}
+bool gnu_c_is_tree_tag_forward_enum_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FORWARD_ENUM_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_forward_param_fun_direct_abstract_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FORWARD_PARAM_FUN_DIRECT_ABSTRACT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_forward_param_fun_direct_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FORWARD_PARAM_FUN_DIRECT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_forward_struct_or_union_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FORWARD_STRUCT_OR_UNION_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_full_enum_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FULL_ENUM_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_full_struct_or_union_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FULL_STRUCT_OR_UNION_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_fun_direct_abstract_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FUN_DIRECT_ABSTRACT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_fun_direct_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_FUN_DIRECT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_ge_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_GE_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_gnu_designation(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_GNU_DESIGNATION;
+}
+bool gnu_c_is_tree_tag_gnu_statement_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_GNU_STATEMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_goto_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_GOTO_STATEMENT;
+}
+bool gnu_c_is_tree_tag_gt_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_GT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_head_tail_declaration_specifiers(GnuCAst *ast)
+{
+    return gnu_c_is_tree_tail_declaration_specifiers(ast) || ast->type == GNU_C_TREE_TAG_HEAD_TAIL_DECLARATION_SPECIFIERS;
+}
+bool gnu_c_is_tree_tag_imag_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_IMAG_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_implicit_int_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_IMPLICIT_INT_DECLARATION;
+}
+bool gnu_c_is_tree_tag_implicit_int_function_definition(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_IMPLICIT_INT_FUNCTION_DEFINITION;
+}
+bool gnu_c_is_tree_tag_index_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_INDEX_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_indirect_member_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_INDIRECT_MEMBER_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_initialized_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_INITIALIZED_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_initialized_enumerator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_INITIALIZED_ENUMERATOR;
+}
+bool gnu_c_is_tree_tag_label_address_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LABEL_ADDRESS_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_le_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LE_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_left_shift_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LEFT_SHIFT_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_left_shift_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LEFT_SHIFT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_legacy_fun_direct_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LEGACY_FUN_DIRECT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_log_and_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LOG_AND_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_log_not_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LOG_NOT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_log_or_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LOG_OR_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_lt_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_LT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_member_declaration(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MEMBER_DECLARATION;
+}
+bool gnu_c_is_tree_tag_member_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_tree_declarator(ast) || ast->type == GNU_C_TREE_TAG_MEMBER_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_member_designator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MEMBER_DESIGNATOR;
+}
+bool gnu_c_is_tree_tag_minus_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MINUS_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_minus_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MINUS_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_modulo_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MODULO_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_modulo_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MODULO_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_multi_asm_clobbers(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_ASM_CLOBBERS;
+}
+bool gnu_c_is_tree_tag_multi_asm_goto_operands(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_ASM_GOTO_OPERANDS;
+}
+bool gnu_c_is_tree_tag_multi_asm_operands(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_ASM_OPERANDS;
+}
+bool gnu_c_is_tree_tag_multi_attribute_list(GnuCAst *ast)
+{
+    return gnu_c_is_sym_comma(ast) || ast->type == GNU_C_TREE_TAG_MULTI_ATTRIBUTE_LIST;
+}
+bool gnu_c_is_tree_tag_multi_enumerator_list(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_ENUMERATOR_LIST;
+}
+bool gnu_c_is_tree_tag_multi_expr_list(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_EXPR_LIST;
+}
+bool gnu_c_is_tree_tag_multi_generic_assoc_list(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_GENERIC_ASSOC_LIST;
+}
+bool gnu_c_is_tree_tag_multi_identifier_list(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_IDENTIFIER_LIST;
+}
+bool gnu_c_is_tree_tag_multi_init_declarator_list(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_INIT_DECLARATOR_LIST;
+}
+bool gnu_c_is_tree_tag_multi_initializer_list(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_INITIALIZER_LIST;
+}
+bool gnu_c_is_tree_tag_multi_parameter_list(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_PARAMETER_LIST;
+}
+bool gnu_c_is_tree_tag_multi_struct_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_MULTI_STRUCT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_named_asm_operand(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_NAMED_ASM_OPERAND;
+}
+bool gnu_c_is_tree_tag_named_label(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_NAMED_LABEL;
+}
+bool gnu_c_is_tree_tag_named_member_offset_designator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_NAMED_MEMBER_OFFSET_DESIGNATOR;
+}
+bool gnu_c_is_tree_tag_ne_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_NE_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_only_head_declaration_specifiers(GnuCAst *ast)
+{
+    return gnu_c_is_tree_head_declaration_specifiers(ast) || ast->type == GNU_C_TREE_TAG_ONLY_HEAD_DECLARATION_SPECIFIERS;
+}
+bool gnu_c_is_tree_tag_paren_direct_abstract_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_PAREN_DIRECT_ABSTRACT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_paren_direct_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_PAREN_DIRECT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_paren_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_PAREN_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_plus_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_PLUS_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_plus_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_PLUS_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_pointer_abstract_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_tree_pointer(ast) || ast->type == GNU_C_TREE_TAG_POINTER_ABSTRACT_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_post_decr_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_POST_DECR_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_post_incr_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_POST_INCR_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_pre_decr_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_PRE_DECR_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_pre_incr_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_PRE_INCR_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_q_list_qualifier(GnuCAst *ast)
+{
+    return gnu_c_is_any_type_qualifier(ast) || ast->type == GNU_C_TREE_TAG_Q_LIST_QUALIFIER;
+}
+bool gnu_c_is_tree_tag_real_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_REAL_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_return_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_RETURN_STATEMENT;
+}
+bool gnu_c_is_tree_tag_reverse_static_array_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_REVERSE_STATIC_ARRAY_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_right_shift_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_RIGHT_SHIFT_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_right_shift_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_RIGHT_SHIFT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_simple_array_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_SIMPLE_ARRAY_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_simple_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_SIMPLE_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_sizeof_expression_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_SIZEOF_EXPRESSION_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_sizeof_type_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_SIZEOF_TYPE_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_sq_list_qualifier(GnuCAst *ast)
+{
+    return gnu_c_is_any_type_qualifier(ast) || ast->type == GNU_C_TREE_TAG_SQ_LIST_QUALIFIER;
+}
+bool gnu_c_is_tree_tag_sq_list_specifier(GnuCAst *ast)
+{
+    return gnu_c_is_any_type_specifier(ast) || ast->type == GNU_C_TREE_TAG_SQ_LIST_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_star_array_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_STAR_ARRAY_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_static_array_declarator(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_STATIC_ARRAY_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_ternary_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_TERNARY_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_times_assignment_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_TIMES_ASSIGNMENT_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_times_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_TIMES_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_type_generic_association(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_TYPE_GENERIC_ASSOCIATION;
+}
+bool gnu_c_is_tree_tag_typeof_expr_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_TYPEOF_EXPR_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_typeof_type_specifier(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_TYPEOF_TYPE_SPECIFIER;
+}
+bool gnu_c_is_tree_tag_unary_minus_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_UNARY_MINUS_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_unary_plus_expression(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_UNARY_PLUS_EXPRESSION;
+}
+bool gnu_c_is_tree_tag_uninitialized_declarator(GnuCAst *ast)
+{
+    return gnu_c_is_tree_declarator(ast) || ast->type == GNU_C_TREE_TAG_UNINITIALIZED_DECLARATOR;
+}
+bool gnu_c_is_tree_tag_variadic_parameter_list(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_TAG_VARIADIC_PARAMETER_LIST;
+}
+bool gnu_c_is_tree_tail_declaration_specifiers(GnuCAst *ast)
+{
+    return gnu_c_is_any_tail_declaration_specifier(ast) || ast->type == GNU_C_TREE_TAIL_DECLARATION_SPECIFIERS;
+}
+bool gnu_c_is_tree_type_name(GnuCAst *ast)
+{
+    return gnu_c_is_any_specifier_qualifier_list(ast) || ast->type == GNU_C_TREE_TYPE_NAME;
+}
+bool gnu_c_is_tree_while_statement(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_WHILE_STATEMENT;
+}
+bool gnu_c_is_tree_while_statement_except_if(GnuCAst *ast)
+{
+    return ast->type == GNU_C_TREE_WHILE_STATEMENT_EXCEPT_IF;
+}
+typedef struct IndentationInfo IndentationInfo;
+struct IndentationInfo
+{
+    size_t indentation;
+    const char *prev;
+    GnuCAstType prev_parent;
+};
+static void gnu_c_emit_impl_impl(const char *next, GnuCAstType next_parent, FILE *fp, IndentationInfo *info)
+{
+    const char *const prev = info->prev;
+    GnuCAstType const prev_parent = info->prev_parent;
+    if (!*next)
+        return;
+    if (strcmp(next, "}") == 0)
+        info->indentation--;
+    if (prev)
+    {
+        bool newline = false;
+        bool no_space = false;
+        newline |= prev[0] == '/' && (prev[1] == '*' || prev[1] == '/');
+        newline |= next[0] == '/' && (next[1] == '*' || next[1] == '/');
+        newline |= prev[0] == '#';
+        newline |= next[0] == '#';
+        newline |= strcmp(prev, ";") == 0 && prev_parent != GNU_C_TREE_TAG_FOR_EXPR_STATEMENT && prev_parent != GNU_C_TREE_TAG_FOR_EXPR_STATEMENT_EXCEPT_IF && prev_parent != GNU_C_TREE_TAG_FOR_DECL_STATEMENT && prev_parent != GNU_C_TREE_TAG_FOR_DECL_STATEMENT_EXCEPT_IF;
+        newline |= strcmp(next, "{") == 0 && next_parent != GNU_C_TREE_TAG_BRACED_INITIALIZER_COMMA && next_parent != GNU_C_TREE_TAG_BRACED_INITIALIZER;
+        newline |= strcmp(prev, "{") == 0 && prev_parent != GNU_C_TREE_TAG_BRACED_INITIALIZER_COMMA && prev_parent != GNU_C_TREE_TAG_BRACED_INITIALIZER;
+        newline |= strcmp(next, "}") == 0 && next_parent != GNU_C_TREE_TAG_BRACED_INITIALIZER_COMMA && next_parent != GNU_C_TREE_TAG_BRACED_INITIALIZER;
+        newline |= strcmp(prev, "}") == 0 && prev_parent != GNU_C_TREE_TAG_BRACED_INITIALIZER_COMMA && prev_parent != GNU_C_TREE_TAG_BRACED_INITIALIZER && strcmp(next, ";") != 0;
+        no_space |= strcmp(prev, "(") == 0;
+        no_space |= strcmp(next, "(") == 0 && (next_parent == GNU_C_TREE_TAG_CALL_EXPRESSION || next_parent == GNU_C_TREE_TAG_LEGACY_FUN_DIRECT_DECLARATOR || next_parent == GNU_C_TREE_TAG_FORWARD_PARAM_FUN_DIRECT_DECLARATOR || next_parent == GNU_C_TREE_TAG_FUN_DIRECT_DECLARATOR || next_parent == GNU_C_TREE_TAG_FORWARD_PARAM_FUN_DIRECT_ABSTRACT_DECLARATOR || next_parent == GNU_C_TREE_TAG_FUN_DIRECT_ABSTRACT_DECLARATOR);
+        no_space |= strcmp(next, ")") == 0;
+        no_space |= strcmp(prev, "[") == 0;
+        no_space |= strcmp(next, "[") == 0;
+        no_space |= strcmp(next, "]") == 0;
+        no_space |= strcmp(next, ",") == 0;
+        no_space |= strcmp(next, ";") == 0;
+        no_space |= strcmp(prev, "*") == 0 && (prev_parent == GNU_C_TREE_POINTER || prev_parent == GNU_C_TREE_DECLARATOR);
+        no_space |= strcmp(next, ":") == 0 && (next_parent == GNU_C_TREE_TAG_NAMED_LABEL || next_parent == GNU_C_TREE_TAG_CASE_LABEL || next_parent == GNU_C_TREE_TAG_CASE_RANGE_LABEL || next_parent == GNU_C_TREE_TAG_DEFAULT_LABEL || next_parent == GNU_C_TREE_TAG_DEFAULT_GENERIC_ASSOCIATION || next_parent == GNU_C_TREE_TAG_TYPE_GENERIC_ASSOCIATION);
+        no_space |= strcmp(prev, ".") == 0;
+        no_space |= strcmp(next, ".") == 0;
+        no_space |= strcmp(prev, "->") == 0;
+        no_space |= strcmp(next, "->") == 0;
+        no_space |= strcmp(next, "++") == 0 && next_parent == GNU_C_TREE_TAG_POST_INCR_EXPRESSION;
+        no_space |= strcmp(next, "--") == 0 && next_parent == GNU_C_TREE_TAG_POST_DECR_EXPRESSION;
+        no_space |= strcmp(prev, "++") == 0 && prev_parent == GNU_C_TREE_TAG_PRE_INCR_EXPRESSION;
+        no_space |= strcmp(prev, "--") == 0 && prev_parent == GNU_C_TREE_TAG_PRE_DECR_EXPRESSION;
+        no_space |= strcmp(prev, "&") == 0 && next[0] != '&' && prev_parent == GNU_C_TREE_TAG_ADDRESSOF_EXPRESSION;
+        no_space |= strcmp(prev, "*") == 0 && prev_parent == GNU_C_TREE_TAG_DEREF_EXPRESSION;
+        no_space |= strcmp(prev, "+") == 0 && next[0] != '+' && prev_parent == GNU_C_TREE_TAG_UNARY_PLUS_EXPRESSION;
+        no_space |= strcmp(prev, "-") == 0 && next[0] != '-' && prev_parent == GNU_C_TREE_TAG_UNARY_MINUS_EXPRESSION;
+        no_space |= strcmp(prev, "~") == 0 && prev_parent == GNU_C_TREE_TAG_BIT_NOT_EXPRESSION;
+        no_space |= strcmp(prev, "!") == 0 && prev_parent == GNU_C_TREE_TAG_LOG_NOT_EXPRESSION;
+        no_space |= strcmp(prev, "sizeof") == 0 && strcmp(next, "(") == 0;
+        no_space |= strcmp(prev, ")") == 0 && (prev_parent == GNU_C_TREE_TAG_COMPOUND_LITERAL_COMMA || prev_parent == GNU_C_TREE_TAG_COMPOUND_LITERAL || prev_parent == GNU_C_TREE_TAG_ACTUAL_CAST_EXPRESSION);
+        if (newline)
+        {
+            size_t i;
+            fputc('\n', fp);
+            for (i = 0; i < info->indentation; ++i)
+                fputs("    ", fp);
+        }
+        else if (!no_space)
+            fputc(' ', fp);
+    }
+    if (strcmp(next, "{") == 0)
+        info->indentation++;
+    info->prev = next;
+    info->prev_parent = next_parent;
+    fputs(next, fp);
+}
+static void gnu_c_emit_impl(GnuCAst *ast, GnuCAstType parent, FILE *fp, IndentationInfo *info)
+{
+    size_t i;
+    if (ast->num_children == 0)
+    {
+         gnu_c_emit_impl_impl(ast->raw, parent, fp, info);
+    }
+    for (i = 0; i < ast->num_children; ++i)
+    {
+        gnu_c_emit_impl(ast->children[i], ast->type, fp, info);
+    }
+}
+void gnu_c_emit(GnuCAst *ast, FILE *fp)
+{
+    IndentationInfo info;
+    memset(&info, 0, sizeof(info));
+    gnu_c_emit_impl(ast, GNU_C_NOTHING, fp, &info);
+    fputc('\n', fp);
+}
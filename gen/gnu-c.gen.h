@@ -0,0 +1,2063 @@
+/* Generated file, edit cache/gram/gnu-c.gram instead. */
+#pragma once
+
+/*
+    Copyright © 2015-2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "fwd.h"
+
+
+typedef struct GnuCAst GnuCAst;
+
+typedef struct GnuCNothing GnuCNothing;
+
+/* Alias */
+typedef struct GnuCAtomStringLiteral GnuCAliasAsmStringLiteral;
+
+/* Alias */
+typedef struct GnuCAnyConditionalExpression GnuCAliasConstantExpression;
+
+/* Alias */
+typedef struct GnuCAtomIdentifier GnuCAliasEnumerationConstant;
+
+/* Alias */
+typedef struct GnuCOptExternalDeclarations GnuCAliasTranslationUnit;
+
+/* GnuCAnyDirectAbstractDeclarator | GnuCTreeTagPointerAbstractDeclarator */
+typedef struct GnuCAnyAbstractDeclarator GnuCAnyAbstractDeclarator;
+
+/* GnuCAnyMultiplicativeExpression | GnuCTreeTagPlusExpression | GnuCTreeTagMinusExpression */
+typedef struct GnuCAnyAdditiveExpression GnuCAnyAdditiveExpression;
+
+/* GnuCTreeTagAlignasTypeSpecifier | GnuCTreeTagAlignasExprSpecifier */
+typedef struct GnuCAnyAlignmentSpecifier GnuCAnyAlignmentSpecifier;
+
+/* GnuCAnyEqualityExpression | GnuCTreeTagBitAndExpression */
+typedef struct GnuCAnyAndExpression GnuCAnyAndExpression;
+
+/* GnuCAtomIdentifier | GnuCAnyStorageClassSpecifier | GnuCAnyTypeSpecifier | GnuCAnyTypeQualifier */
+typedef struct GnuCAnyAnyWord GnuCAnyAnyWord;
+
+/* GnuCTreeTagSimpleArrayDeclarator | GnuCTreeTagStaticArrayDeclarator | GnuCTreeTagReverseStaticArrayDeclarator | GnuCTreeTagStarArrayDeclarator */
+typedef struct GnuCAnyArrayDeclarator GnuCAnyArrayDeclarator;
+
+/* GnuCTreeTagArrayElementDesignator | GnuCTreeTagArrayRangeDesignator */
+typedef struct GnuCAnyArrayDesignator GnuCAnyArrayDesignator;
+
+/* GnuCAliasAsmStringLiteral | GnuCTreeTagAsmArgumentOut | GnuCTreeTagAsmArgumentOutIn | GnuCTreeTagAsmArgumentOutInClobber */
+typedef struct GnuCAnyAsmArgument GnuCAnyAsmArgument;
+
+/* GnuCAliasAsmStringLiteral | GnuCTreeTagMultiAsmClobbers */
+typedef struct GnuCAnyAsmClobbers GnuCAnyAsmClobbers;
+
+/* GnuCAtomIdentifier | GnuCTreeTagMultiAsmGotoOperands */
+typedef struct GnuCAnyAsmGotoOperands GnuCAnyAsmGotoOperands;
+
+/* GnuCTreeTagAnonymousAsmOperand | GnuCTreeTagNamedAsmOperand */
+typedef struct GnuCAnyAsmOperand GnuCAnyAsmOperand;
+
+/* GnuCAnyAsmOperand | GnuCTreeTagMultiAsmOperands */
+typedef struct GnuCAnyAsmOperands GnuCAnyAsmOperands;
+
+/* GnuCTreeTagAsmCommonStatement | GnuCTreeTagAsmGotoStatement */
+typedef struct GnuCAnyAsmStatement GnuCAnyAsmStatement;
+
+/* GnuCAnyConditionalExpression | GnuCTreeTagSimpleAssignmentExpression | GnuCTreeTagTimesAssignmentExpression | GnuCTreeTagDivideAssignmentExpression | GnuCTreeTagModuloAssignmentExpression | GnuCTreeTagPlusAssignmentExpression | GnuCTreeTagMinusAssignmentExpression | GnuCTreeTagLeftShiftAssignmentExpression | GnuCTreeTagRightShiftAssignmentExpression | GnuCTreeTagBitAndAssignmentExpression | GnuCTreeTagBitXorAssignmentExpression | GnuCTreeTagBitIorAssignmentExpression */
+typedef struct GnuCAnyAssignmentExpression GnuCAnyAssignmentExpression;
+
+/* GnuCAnyAnyWord | GnuCTreeTagAttribWithArg */
+typedef struct GnuCAnyAttrib GnuCAnyAttrib;
+
+/* GnuCAnyAttrib | GnuCTreeTagMultiAttributeList */
+typedef struct GnuCAnyAttributeList GnuCAnyAttributeList;
+
+/* GnuCAnyNestedDeclaration | GnuCTreeStatement | GnuCAtomComment */
+typedef struct GnuCAnyBlockItem GnuCAnyBlockItem;
+
+/* GnuCAnyLogicalOrExpression | GnuCTreeTagTernaryExpression */
+typedef struct GnuCAnyConditionalExpression GnuCAnyConditionalExpression;
+
+/* GnuCAnyFloatingConstant | GnuCAnyIntegerConstant | GnuCAtomCharacterConstant */
+typedef struct GnuCAnyConstant GnuCAnyConstant;
+
+/* GnuCTreeTagOnlyHeadDeclarationSpecifiers | GnuCTreeTagHeadTailDeclarationSpecifiers */
+typedef struct GnuCAnyDeclarationSpecifiers GnuCAnyDeclarationSpecifiers;
+
+/* GnuCTreeTagC99_Designation | GnuCAnyArrayDesignator | GnuCTreeTagGnuDesignation */
+typedef struct GnuCAnyDesignation GnuCAnyDesignation;
+
+/* GnuCAnyArrayDesignator | GnuCTreeTagMemberDesignator */
+typedef struct GnuCAnyDesignator GnuCAnyDesignator;
+
+/* GnuCTreeTagParenDirectAbstractDeclarator | GnuCTreeTagArrayDirectAbstractDeclarator | GnuCTreeTagFunDirectAbstractDeclarator | GnuCTreeTagForwardParamFunDirectAbstractDeclarator */
+typedef struct GnuCAnyDirectAbstractDeclarator GnuCAnyDirectAbstractDeclarator;
+
+/* GnuCAtomIdentifier | GnuCTreeTagParenDirectDeclarator | GnuCTreeTagArrayDirectDeclarator | GnuCTreeTagFunDirectDeclarator | GnuCTreeTagLegacyFunDirectDeclarator | GnuCTreeTagForwardParamFunDirectDeclarator */
+typedef struct GnuCAnyDirectDeclarator GnuCAnyDirectDeclarator;
+
+/* GnuCTreeTagFullEnumSpecifier | GnuCTreeTagForwardEnumSpecifier */
+typedef struct GnuCAnyEnumSpecifier GnuCAnyEnumSpecifier;
+
+/* GnuCAliasEnumerationConstant | GnuCTreeTagInitializedEnumerator */
+typedef struct GnuCAnyEnumerator GnuCAnyEnumerator;
+
+/* GnuCAnyEnumerator | GnuCTreeTagMultiEnumeratorList */
+typedef struct GnuCAnyEnumeratorList GnuCAnyEnumeratorList;
+
+/* GnuCAnyRelationalExpression | GnuCTreeTagEqExpression | GnuCTreeTagNeExpression */
+typedef struct GnuCAnyEqualityExpression GnuCAnyEqualityExpression;
+
+/* GnuCAnyAndExpression | GnuCTreeTagBitXorExpression */
+typedef struct GnuCAnyExclusiveOrExpression GnuCAnyExclusiveOrExpression;
+
+/* GnuCAnyAssignmentExpression | GnuCTreeTagMultiExprList */
+typedef struct GnuCAnyExprList GnuCAnyExprList;
+
+/* GnuCAnyFunctionDefinition | GnuCTreeDeclaration | GnuCTreeStaticAssertDeclaration | GnuCTreeAsmDefinition | GnuCSymSemicolon | GnuCTreeTagExtensionExternalDeclaration | GnuCTreeTagImplicitIntDeclaration | GnuCAtomComment */
+typedef struct GnuCAnyExternalDeclaration GnuCAnyExternalDeclaration;
+
+/* GnuCAtomDecimalFloatingConstant | GnuCAtomHexadecimalFloatingConstant */
+typedef struct GnuCAnyFloatingConstant GnuCAnyFloatingConstant;
+
+/* GnuCTreeTagForExprStatement | GnuCTreeTagForDeclStatement */
+typedef struct GnuCAnyForStatement GnuCAnyForStatement;
+
+/* GnuCTreeTagForExprStatementExceptIf | GnuCTreeTagForDeclStatementExceptIf */
+typedef struct GnuCAnyForStatementExceptIf GnuCAnyForStatementExceptIf;
+
+/* GnuCTreeTagImplicitIntFunctionDefinition | GnuCTreeNestedFunctionDefinition */
+typedef struct GnuCAnyFunctionDefinition GnuCAnyFunctionDefinition;
+
+/* GnuCKwInline | GnuCKwNoreturn */
+typedef struct GnuCAnyFunctionSpecifier GnuCAnyFunctionSpecifier;
+
+/* GnuCAnyGenericAssociation | GnuCTreeTagMultiGenericAssocList */
+typedef struct GnuCAnyGenericAssocList GnuCAnyGenericAssocList;
+
+/* GnuCTreeTagTypeGenericAssociation | GnuCTreeTagDefaultGenericAssociation */
+typedef struct GnuCAnyGenericAssociation GnuCAnyGenericAssociation;
+
+/* GnuCAnyStorageClassSpecifier | GnuCAnyFunctionSpecifier | GnuCAnyAlignmentSpecifier */
+typedef struct GnuCAnyHeadDeclarationSpecifier GnuCAnyHeadDeclarationSpecifier;
+
+/* GnuCAtomIdentifier | GnuCTreeTagMultiIdentifierList */
+typedef struct GnuCAnyIdentifierList GnuCAnyIdentifierList;
+
+/* GnuCAnyExclusiveOrExpression | GnuCTreeTagBitIorExpression */
+typedef struct GnuCAnyInclusiveOrExpression GnuCAnyInclusiveOrExpression;
+
+/* GnuCTreeTagUninitializedDeclarator | GnuCTreeTagInitializedDeclarator */
+typedef struct GnuCAnyInitDeclarator GnuCAnyInitDeclarator;
+
+/* GnuCAnyInitDeclarator | GnuCTreeTagMultiInitDeclaratorList */
+typedef struct GnuCAnyInitDeclaratorList GnuCAnyInitDeclaratorList;
+
+/* GnuCAnyAssignmentExpression | GnuCTreeTagBracedInitializer | GnuCTreeTagBracedInitializerComma */
+typedef struct GnuCAnyInitializer GnuCAnyInitializer;
+
+/* GnuCTreeDesignatedInitializer | GnuCTreeTagMultiInitializerList */
+typedef struct GnuCAnyInitializerList GnuCAnyInitializerList;
+
+/* GnuCAtomDecimalConstant | GnuCAtomOctalConstant | GnuCAtomHexadecimalConstant | GnuCAtomBinaryConstant */
+typedef struct GnuCAnyIntegerConstant GnuCAnyIntegerConstant;
+
+/* GnuCTreeTagNamedLabel | GnuCTreeTagCaseLabel | GnuCTreeTagDefaultLabel | GnuCTreeTagCaseRangeLabel */
+typedef struct GnuCAnyLabel GnuCAnyLabel;
+
+/* GnuCAnyInclusiveOrExpression | GnuCTreeTagLogAndExpression */
+typedef struct GnuCAnyLogicalAndExpression GnuCAnyLogicalAndExpression;
+
+/* GnuCAnyLogicalAndExpression | GnuCTreeTagLogOrExpression */
+typedef struct GnuCAnyLogicalOrExpression GnuCAnyLogicalOrExpression;
+
+/* GnuCAnyNoCastExpression | GnuCTreeTagActualCastExpression */
+typedef struct GnuCAnyMaybeCastExpression GnuCAnyMaybeCastExpression;
+
+/* GnuCAnyMaybeCastExpression | GnuCTreeTagTimesExpression | GnuCTreeTagDivideExpression | GnuCTreeTagModuloExpression */
+typedef struct GnuCAnyMultiplicativeExpression GnuCAnyMultiplicativeExpression;
+
+/* GnuCTreeDeclaration | GnuCTreeStaticAssertDeclaration | GnuCTreeTagExtensionNestedDeclaration | GnuCTreeNestedFunctionDefinition */
+typedef struct GnuCAnyNestedDeclaration GnuCAnyNestedDeclaration;
+
+/* GnuCAnyPostfixExpression | GnuCTreeTagPreIncrExpression | GnuCTreeTagPreDecrExpression | GnuCTreeTagAddressofExpression | GnuCTreeTagDerefExpression | GnuCTreeTagUnaryPlusExpression | GnuCTreeTagUnaryMinusExpression | GnuCTreeTagBitNotExpression | GnuCTreeTagLogNotExpression | GnuCTreeTagExtensionExpression | GnuCTreeTagRealExpression | GnuCTreeTagImagExpression | GnuCTreeTagSizeofExpressionExpression | GnuCTreeTagSizeofTypeExpression | GnuCTreeTagAlignofExpressionExpression | GnuCTreeTagAlignofTypeExpression | GnuCTreeTagLabelAddressExpression */
+typedef struct GnuCAnyNoCastExpression GnuCAnyNoCastExpression;
+
+/* GnuCAtomIdentifier | GnuCTreeTagNamedMemberOffsetDesignator | GnuCTreeTagArrayMemberOffsetDesignator */
+typedef struct GnuCAnyOffsetofMemberDesignator GnuCAnyOffsetofMemberDesignator;
+
+/* GnuCTreeTagConcreteParameterDeclaration | GnuCTreeTagAbstractParameterDeclaration */
+typedef struct GnuCAnyParameterDeclaration GnuCAnyParameterDeclaration;
+
+/* GnuCAnyParameterDeclaration | GnuCTreeTagMultiParameterList */
+typedef struct GnuCAnyParameterList GnuCAnyParameterList;
+
+/* GnuCAnyParameterList | GnuCTreeTagVariadicParameterList */
+typedef struct GnuCAnyParameterTypeList GnuCAnyParameterTypeList;
+
+/* GnuCAnyPrimaryExpression | GnuCTreeTagIndexExpression | GnuCTreeTagCallExpression | GnuCTreeTagDirectMemberExpression | GnuCTreeTagIndirectMemberExpression | GnuCTreeTagPostIncrExpression | GnuCTreeTagPostDecrExpression | GnuCTreeTagCompoundLiteral | GnuCTreeTagCompoundLiteralComma */
+typedef struct GnuCAnyPostfixExpression GnuCAnyPostfixExpression;
+
+/* GnuCAtomIdentifier | GnuCAnyConstant | GnuCAtomStringLiteral | GnuCTreeTagParenExpression | GnuCTreeGenericSelection | GnuCKwFunc | GnuCKwFunction | GnuCKwPrettyFunction | GnuCTreeTagGnuStatementExpression | GnuCTreeTagBuiltinVaArgExpression | GnuCTreeTagBuiltinOffsetofExpression | GnuCTreeTagBuiltinChooseExprExpression | GnuCTreeTagBuiltinTypesCompatiblePExpression | GnuCTreeTagBuiltinComplexExpression | GnuCTreeTagBuiltinSimpleShuffleExpression | GnuCTreeTagBuiltinMixShuffleExpression */
+typedef struct GnuCAnyPrimaryExpression GnuCAnyPrimaryExpression;
+
+/* GnuCAnyShiftExpression | GnuCTreeTagLtExpression | GnuCTreeTagGtExpression | GnuCTreeTagLeExpression | GnuCTreeTagGeExpression */
+typedef struct GnuCAnyRelationalExpression GnuCAnyRelationalExpression;
+
+/* GnuCAnyAdditiveExpression | GnuCTreeTagLeftShiftExpression | GnuCTreeTagRightShiftExpression */
+typedef struct GnuCAnyShiftExpression GnuCAnyShiftExpression;
+
+/* GnuCTreeAttributes | GnuCTreeTagSqListSpecifier | GnuCTreeTagSqListQualifier */
+typedef struct GnuCAnySpecifierQualifierList GnuCAnySpecifierQualifierList;
+
+/* GnuCKwTypedef | GnuCKwExtern | GnuCKwStatic | GnuCKwAuto | GnuCKwRegister | GnuCKwThreadLocal | GnuCKwThread */
+typedef struct GnuCAnyStorageClassSpecifier GnuCAnyStorageClassSpecifier;
+
+/* GnuCTreeTagMemberDeclaration | GnuCTreeStaticAssertDeclaration | GnuCTreeTagExtensionStructDeclaration | GnuCSymSemicolon */
+typedef struct GnuCAnyStructDeclaration GnuCAnyStructDeclaration;
+
+/* GnuCTreeTagMemberDeclarator | GnuCTreeTagBitfieldDeclarator */
+typedef struct GnuCAnyStructDeclarator GnuCAnyStructDeclarator;
+
+/* GnuCAnyStructDeclarator | GnuCTreeTagMultiStructDeclarator */
+typedef struct GnuCAnyStructDeclaratorList GnuCAnyStructDeclaratorList;
+
+/* GnuCKwStruct | GnuCKwUnion */
+typedef struct GnuCAnyStructOrUnion GnuCAnyStructOrUnion;
+
+/* GnuCTreeTagFullStructOrUnionSpecifier | GnuCTreeTagForwardStructOrUnionSpecifier */
+typedef struct GnuCAnyStructOrUnionSpecifier GnuCAnyStructOrUnionSpecifier;
+
+/* GnuCAnyTypeSpecifier | GnuCAnyTypeQualifier */
+typedef struct GnuCAnyTailDeclarationSpecifier GnuCAnyTailDeclarationSpecifier;
+
+/* GnuCKwConst | GnuCKwRestrict | GnuCKwVolatile | GnuCKwAtomicAsQualifier | GnuCAtomAddressSpace */
+typedef struct GnuCAnyTypeQualifier GnuCAnyTypeQualifier;
+
+/* GnuCTreeAttributes | GnuCTreeTagQListQualifier */
+typedef struct GnuCAnyTypeQualifierList GnuCAnyTypeQualifierList;
+
+/* GnuCKwVoid | GnuCKwChar | GnuCKwShort | GnuCKwInt | GnuCKwLong | GnuCKwFloat | GnuCKwDouble | GnuCKwSigned | GnuCKwUnsigned | GnuCKwBool | GnuCKwComplex | GnuCAnyStructOrUnionSpecifier | GnuCAnyEnumSpecifier | GnuCAtomTypedefName | GnuCTreeAtomicTypeSpecifier | GnuCAnyTypeofSpecifier | GnuCKwAutoType | GnuCKwDecimal32 | GnuCKwDecimal64 | GnuCKwDecimal128 | GnuCKwFract | GnuCKwAccum | GnuCKwSat */
+typedef struct GnuCAnyTypeSpecifier GnuCAnyTypeSpecifier;
+
+/* GnuCTreeTagTypeofExprSpecifier | GnuCTreeTagTypeofTypeSpecifier */
+typedef struct GnuCAnyTypeofSpecifier GnuCAnyTypeofSpecifier;
+
+/* GnuCTreeCompoundStatement | GnuCTreeExpressionStatement | GnuCTreeDoStatement | GnuCTreeTagGotoStatement | GnuCTreeTagContinueStatement | GnuCTreeTagBreakStatement | GnuCTreeTagReturnStatement | GnuCTreeTagComputedGotoStatement | GnuCAnyAsmStatement */
+typedef struct GnuCAnyUnambiguousStatement GnuCAnyUnambiguousStatement;
+
+/* GnuCTreeIfStatement | GnuCTreeIfElseStatement | GnuCTreeSwitchStatement | GnuCTreeWhileStatement | GnuCAnyForStatement | GnuCAnyUnambiguousStatement */
+typedef struct GnuCAnyUnlabeledStatement GnuCAnyUnlabeledStatement;
+
+/* GnuCTreeIfElseStatementExceptIf | GnuCTreeSwitchStatementExceptIf | GnuCTreeWhileStatementExceptIf | GnuCAnyForStatementExceptIf | GnuCAnyUnambiguousStatement */
+typedef struct GnuCAnyUnlabeledStatementExceptIf GnuCAnyUnlabeledStatementExceptIf;
+
+/* Term */
+typedef struct GnuCAtomAddressSpace GnuCAtomAddressSpace;
+
+/* Term */
+typedef struct GnuCAtomBinaryConstant GnuCAtomBinaryConstant;
+
+/* Term */
+typedef struct GnuCAtomCharacterConstant GnuCAtomCharacterConstant;
+
+/* Term */
+typedef struct GnuCAtomComment GnuCAtomComment;
+
+/* Term */
+typedef struct GnuCAtomDecimalConstant GnuCAtomDecimalConstant;
+
+/* Term */
+typedef struct GnuCAtomDecimalFloatingConstant GnuCAtomDecimalFloatingConstant;
+
+/* Term */
+typedef struct GnuCAtomHexadecimalConstant GnuCAtomHexadecimalConstant;
+
+/* Term */
+typedef struct GnuCAtomHexadecimalFloatingConstant GnuCAtomHexadecimalFloatingConstant;
+
+/* Term */
+typedef struct GnuCAtomIdentifier GnuCAtomIdentifier;
+
+/* Term */
+typedef struct GnuCAtomOctalConstant GnuCAtomOctalConstant;
+
+/* Term */
+typedef struct GnuCAtomStringLiteral GnuCAtomStringLiteral;
+
+/* Term */
+typedef struct GnuCAtomTypedefName GnuCAtomTypedefName;
+
+/* Term */
+typedef struct GnuCKwAccum GnuCKwAccum;
+
+/* Term */
+typedef struct GnuCKwAlignas GnuCKwAlignas;
+
+/* Term */
+typedef struct GnuCKwAlignof GnuCKwAlignof;
+
+/* Term */
+typedef struct GnuCKwAsm GnuCKwAsm;
+
+/* Term */
+typedef struct GnuCKwAtomicAsQualifier GnuCKwAtomicAsQualifier;
+
+/* Term */
+typedef struct GnuCKwAtomicAsSpecifier GnuCKwAtomicAsSpecifier;
+
+/* Term */
+typedef struct GnuCKwAttribute GnuCKwAttribute;
+
+/* Term */
+typedef struct GnuCKwAuto GnuCKwAuto;
+
+/* Term */
+typedef struct GnuCKwAutoType GnuCKwAutoType;
+
+/* Term */
+typedef struct GnuCKwBool GnuCKwBool;
+
+/* Term */
+typedef struct GnuCKwBreak GnuCKwBreak;
+
+/* Term */
+typedef struct GnuCKwBuiltinChooseExpr GnuCKwBuiltinChooseExpr;
+
+/* Term */
+typedef struct GnuCKwBuiltinComplex GnuCKwBuiltinComplex;
+
+/* Term */
+typedef struct GnuCKwBuiltinOffsetof GnuCKwBuiltinOffsetof;
+
+/* Term */
+typedef struct GnuCKwBuiltinShuffle GnuCKwBuiltinShuffle;
+
+/* Term */
+typedef struct GnuCKwBuiltinTypesCompatibleP GnuCKwBuiltinTypesCompatibleP;
+
+/* Term */
+typedef struct GnuCKwBuiltinVaArg GnuCKwBuiltinVaArg;
+
+/* Term */
+typedef struct GnuCKwCase GnuCKwCase;
+
+/* Term */
+typedef struct GnuCKwChar GnuCKwChar;
+
+/* Term */
+typedef struct GnuCKwComplex GnuCKwComplex;
+
+/* Term */
+typedef struct GnuCKwConst GnuCKwConst;
+
+/* Term */
+typedef struct GnuCKwContinue GnuCKwContinue;
+
+/* Term */
+typedef struct GnuCKwDecimal128 GnuCKwDecimal128;
+
+/* Term */
+typedef struct GnuCKwDecimal32 GnuCKwDecimal32;
+
+/* Term */
+typedef struct GnuCKwDecimal64 GnuCKwDecimal64;
+
+/* Term */
+typedef struct GnuCKwDefault GnuCKwDefault;
+
+/* Term */
+typedef struct GnuCKwDo GnuCKwDo;
+
+/* Term */
+typedef struct GnuCKwDouble GnuCKwDouble;
+
+/* Term */
+typedef struct GnuCKwElse GnuCKwElse;
+
+/* Term */
+typedef struct GnuCKwEnum GnuCKwEnum;
+
+/* Term */
+typedef struct GnuCKwExtension GnuCKwExtension;
+
+/* Term */
+typedef struct GnuCKwExtern GnuCKwExtern;
+
+/* Term */
+typedef struct GnuCKwFloat GnuCKwFloat;
+
+/* Term */
+typedef struct GnuCKwFor GnuCKwFor;
+
+/* Term */
+typedef struct GnuCKwFract GnuCKwFract;
+
+/* Term */
+typedef struct GnuCKwFunc GnuCKwFunc;
+
+/* Term */
+typedef struct GnuCKwFunction GnuCKwFunction;
+
+/* Term */
+typedef struct GnuCKwGeneric GnuCKwGeneric;
+
+/* Term */
+typedef struct GnuCKwGoto GnuCKwGoto;
+
+/* Term */
+typedef struct GnuCKwIf GnuCKwIf;
+
+/* Term */
+typedef struct GnuCKwImag GnuCKwImag;
+
+/* Term */
+typedef struct GnuCKwInline GnuCKwInline;
+
+/* Term */
+typedef struct GnuCKwInt GnuCKwInt;
+
+/* Term */
+typedef struct GnuCKwLabel GnuCKwLabel;
+
+/* Term */
+typedef struct GnuCKwLong GnuCKwLong;
+
+/* Term */
+typedef struct GnuCKwNoreturn GnuCKwNoreturn;
+
+/* Term */
+typedef struct GnuCKwPrettyFunction GnuCKwPrettyFunction;
+
+/* Term */
+typedef struct GnuCKwReal GnuCKwReal;
+
+/* Term */
+typedef struct GnuCKwRegister GnuCKwRegister;
+
+/* Term */
+typedef struct GnuCKwRestrict GnuCKwRestrict;
+
+/* Term */
+typedef struct GnuCKwReturn GnuCKwReturn;
+
+/* Term */
+typedef struct GnuCKwSat GnuCKwSat;
+
+/* Term */
+typedef struct GnuCKwShort GnuCKwShort;
+
+/* Term */
+typedef struct GnuCKwSigned GnuCKwSigned;
+
+/* Term */
+typedef struct GnuCKwSizeof GnuCKwSizeof;
+
+/* Term */
+typedef struct GnuCKwStatic GnuCKwStatic;
+
+/* Term */
+typedef struct GnuCKwStaticAssert GnuCKwStaticAssert;
+
+/* Term */
+typedef struct GnuCKwStruct GnuCKwStruct;
+
+/* Term */
+typedef struct GnuCKwSwitch GnuCKwSwitch;
+
+/* Term */
+typedef struct GnuCKwThread GnuCKwThread;
+
+/* Term */
+typedef struct GnuCKwThreadLocal GnuCKwThreadLocal;
+
+/* Term */
+typedef struct GnuCKwTypedef GnuCKwTypedef;
+
+/* Term */
+typedef struct GnuCKwTypeof GnuCKwTypeof;
+
+/* Term */
+typedef struct GnuCKwUnion GnuCKwUnion;
+
+/* Term */
+typedef struct GnuCKwUnsigned GnuCKwUnsigned;
+
+/* Term */
+typedef struct GnuCKwVoid GnuCKwVoid;
+
+/* Term */
+typedef struct GnuCKwVolatile GnuCKwVolatile;
+
+/* Term */
+typedef struct GnuCKwWhile GnuCKwWhile;
+
+/* GnuCAnyAbstractDeclarator | GnuCNothing */
+typedef struct GnuCOptAbstractDeclarator GnuCOptAbstractDeclarator;
+
+/* GnuCAnyAsmClobbers | GnuCNothing */
+typedef struct GnuCOptAsmClobbers GnuCOptAsmClobbers;
+
+/* GnuCAnyAsmOperands | GnuCNothing */
+typedef struct GnuCOptAsmOperands GnuCOptAsmOperands;
+
+/* GnuCAnyAssignmentExpression | GnuCNothing */
+typedef struct GnuCOptAssignmentExpression GnuCOptAssignmentExpression;
+
+/* GnuCAnyAttrib | GnuCNothing */
+typedef struct GnuCOptAttrib GnuCOptAttrib;
+
+/* GnuCAnyAttributeList | GnuCNothing */
+typedef struct GnuCOptAttributeList GnuCOptAttributeList;
+
+/* GnuCTreeAttributes | GnuCNothing */
+typedef struct GnuCOptAttributes GnuCOptAttributes;
+
+/* GnuCTreeBlockItemList | GnuCNothing */
+typedef struct GnuCOptBlockItemList GnuCOptBlockItemList;
+
+/* GnuCSymComma | GnuCNothing */
+typedef struct GnuCOptComma GnuCOptComma;
+
+/* GnuCTreeDeclarationList | GnuCNothing */
+typedef struct GnuCOptDeclarationList GnuCOptDeclarationList;
+
+/* GnuCTreeDeclarator | GnuCNothing */
+typedef struct GnuCOptDeclarator GnuCOptDeclarator;
+
+/* GnuCAnyDesignation | GnuCNothing */
+typedef struct GnuCOptDesignation GnuCOptDesignation;
+
+/* GnuCTreeDesignatorList | GnuCNothing */
+typedef struct GnuCOptDesignatorList GnuCOptDesignatorList;
+
+/* GnuCAnyDirectAbstractDeclarator | GnuCNothing */
+typedef struct GnuCOptDirectAbstractDeclarator GnuCOptDirectAbstractDeclarator;
+
+/* GnuCAnyExprList | GnuCNothing */
+typedef struct GnuCOptExprList GnuCOptExprList;
+
+/* GnuCTreeExternalDeclarations | GnuCNothing */
+typedef struct GnuCOptExternalDeclarations GnuCOptExternalDeclarations;
+
+/* GnuCTreeHeadDeclarationSpecifiers | GnuCNothing */
+typedef struct GnuCOptHeadDeclarationSpecifiers GnuCOptHeadDeclarationSpecifiers;
+
+/* GnuCAtomIdentifier | GnuCNothing */
+typedef struct GnuCOptIdentifier GnuCOptIdentifier;
+
+/* GnuCAnyIdentifierList | GnuCNothing */
+typedef struct GnuCOptIdentifierList GnuCOptIdentifierList;
+
+/* GnuCAnyInitDeclaratorList | GnuCNothing */
+typedef struct GnuCOptInitDeclaratorList GnuCOptInitDeclaratorList;
+
+/* GnuCAnyInitializerList | GnuCNothing */
+typedef struct GnuCOptInitializerList GnuCOptInitializerList;
+
+/* GnuCTreeLabelDeclarations | GnuCNothing */
+typedef struct GnuCOptLabelDeclarations GnuCOptLabelDeclarations;
+
+/* GnuCTreeLabels | GnuCNothing */
+typedef struct GnuCOptLabels GnuCOptLabels;
+
+/* GnuCTreeParameterForwardDeclarations | GnuCNothing */
+typedef struct GnuCOptParameterForwardDeclarations GnuCOptParameterForwardDeclarations;
+
+/* GnuCAnyParameterTypeList | GnuCNothing */
+typedef struct GnuCOptParameterTypeList GnuCOptParameterTypeList;
+
+/* GnuCTreePointer | GnuCNothing */
+typedef struct GnuCOptPointer GnuCOptPointer;
+
+/* GnuCTreeSimpleAsmExpr | GnuCNothing */
+typedef struct GnuCOptSimpleAsmExpr GnuCOptSimpleAsmExpr;
+
+/* GnuCAnySpecifierQualifierList | GnuCNothing */
+typedef struct GnuCOptSpecifierQualifierList GnuCOptSpecifierQualifierList;
+
+/* GnuCTreeStructDeclarationList | GnuCNothing */
+typedef struct GnuCOptStructDeclarationList GnuCOptStructDeclarationList;
+
+/* GnuCAnyStructDeclaratorList | GnuCNothing */
+typedef struct GnuCOptStructDeclaratorList GnuCOptStructDeclaratorList;
+
+/* GnuCTreeTailDeclarationSpecifiers | GnuCNothing */
+typedef struct GnuCOptTailDeclarationSpecifiers GnuCOptTailDeclarationSpecifiers;
+
+/* GnuCAnyTypeQualifier | GnuCNothing */
+typedef struct GnuCOptTypeQualifier GnuCOptTypeQualifier;
+
+/* GnuCAnyTypeQualifierList | GnuCNothing */
+typedef struct GnuCOptTypeQualifierList GnuCOptTypeQualifierList;
+
+/* Term */
+typedef struct GnuCSymAmpersand GnuCSymAmpersand;
+
+/* Term */
+typedef struct GnuCSymAmpersandAssign GnuCSymAmpersandAssign;
+
+/* Term */
+typedef struct GnuCSymArrow GnuCSymArrow;
+
+/* Term */
+typedef struct GnuCSymAssign GnuCSymAssign;
+
+/* Term */
+typedef struct GnuCSymBang GnuCSymBang;
+
+/* Term */
+typedef struct GnuCSymCaret GnuCSymCaret;
+
+/* Term */
+typedef struct GnuCSymCaretAssign GnuCSymCaretAssign;
+
+/* Term */
+typedef struct GnuCSymColon GnuCSymColon;
+
+/* Term */
+typedef struct GnuCSymComma GnuCSymComma;
+
+/* Term */
+typedef struct GnuCSymDecr GnuCSymDecr;
+
+/* Term */
+typedef struct GnuCSymDot GnuCSymDot;
+
+/* Term */
+typedef struct GnuCSymEllipsis GnuCSymEllipsis;
+
+/* Term */
+typedef struct GnuCSymEq GnuCSymEq;
+
+/* Term */
+typedef struct GnuCSymGe GnuCSymGe;
+
+/* Term */
+typedef struct GnuCSymGt GnuCSymGt;
+
+/* Term */
+typedef struct GnuCSymIncr GnuCSymIncr;
+
+/* Term */
+typedef struct GnuCSymLbrace GnuCSymLbrace;
+
+/* Term */
+typedef struct GnuCSymLbracket GnuCSymLbracket;
+
+/* Term */
+typedef struct GnuCSymLe GnuCSymLe;
+
+/* Term */
+typedef struct GnuCSymLogicalAnd GnuCSymLogicalAnd;
+
+/* Term */
+typedef struct GnuCSymLogicalOr GnuCSymLogicalOr;
+
+/* Term */
+typedef struct GnuCSymLparen GnuCSymLparen;
+
+/* Term */
+typedef struct GnuCSymLshift GnuCSymLshift;
+
+/* Term */
+typedef struct GnuCSymLshiftAssign GnuCSymLshiftAssign;
+
+/* Term */
+typedef struct GnuCSymLt GnuCSymLt;
+
+/* Term */
+typedef struct GnuCSymMinus GnuCSymMinus;
+
+/* Term */
+typedef struct GnuCSymMinusAssign GnuCSymMinusAssign;
+
+/* Term */
+typedef struct GnuCSymNe GnuCSymNe;
+
+/* Term */
+typedef struct GnuCSymPercent GnuCSymPercent;
+
+/* Term */
+typedef struct GnuCSymPercentAssign GnuCSymPercentAssign;
+
+/* Term */
+typedef struct GnuCSymPipe GnuCSymPipe;
+
+/* Term */
+typedef struct GnuCSymPipeAssign GnuCSymPipeAssign;
+
+/* Term */
+typedef struct GnuCSymPlus GnuCSymPlus;
+
+/* Term */
+typedef struct GnuCSymPlusAssign GnuCSymPlusAssign;
+
+/* Term */
+typedef struct GnuCSymQuery GnuCSymQuery;
+
+/* Term */
+typedef struct GnuCSymRbrace GnuCSymRbrace;
+
+/* Term */
+typedef struct GnuCSymRbracket GnuCSymRbracket;
+
+/* Term */
+typedef struct GnuCSymRparen GnuCSymRparen;
+
+/* Term */
+typedef struct GnuCSymRshift GnuCSymRshift;
+
+/* Term */
+typedef struct GnuCSymRshiftAssign GnuCSymRshiftAssign;
+
+/* Term */
+typedef struct GnuCSymSemicolon GnuCSymSemicolon;
+
+/* Term */
+typedef struct GnuCSymSlash GnuCSymSlash;
+
+/* Term */
+typedef struct GnuCSymSlashAssign GnuCSymSlashAssign;
+
+/* Term */
+typedef struct GnuCSymStar GnuCSymStar;
+
+/* Term */
+typedef struct GnuCSymStarAssign GnuCSymStarAssign;
+
+/* Term */
+typedef struct GnuCSymTilde GnuCSymTilde;
+
+/* GnuCTreeSimpleAsmExpr GnuCSymSemicolon */
+typedef struct GnuCTreeAsmDefinition GnuCTreeAsmDefinition;
+
+/* GnuCAliasAsmStringLiteral GnuCSymColon GnuCSymColon GnuCOptAsmOperands GnuCSymColon GnuCOptAsmClobbers GnuCSymColon GnuCAnyAsmGotoOperands */
+typedef struct GnuCTreeAsmGotoArgument GnuCTreeAsmGotoArgument;
+
+/* GnuCKwAtomicAsSpecifier GnuCSymLparen GnuCTreeTypeName GnuCSymRparen */
+typedef struct GnuCTreeAtomicTypeSpecifier GnuCTreeAtomicTypeSpecifier;
+
+/* GnuCKwAttribute GnuCSymLparen GnuCSymLparen GnuCOptAttributeList GnuCSymRparen GnuCSymRparen */
+typedef struct GnuCTreeAttribute GnuCTreeAttribute;
+
+/* GnuCOptAttributes GnuCTreeAttribute */
+typedef struct GnuCTreeAttributes GnuCTreeAttributes;
+
+/* GnuCOptBlockItemList GnuCAnyBlockItem */
+typedef struct GnuCTreeBlockItemList GnuCTreeBlockItemList;
+
+/* GnuCSymLbrace GnuCOptLabelDeclarations GnuCOptBlockItemList GnuCSymRbrace */
+typedef struct GnuCTreeCompoundStatement GnuCTreeCompoundStatement;
+
+/* GnuCSymLparen GnuCAnyExprList GnuCSymRparen */
+typedef struct GnuCTreeCondition GnuCTreeCondition;
+
+/* GnuCAnyDeclarationSpecifiers GnuCOptInitDeclaratorList GnuCSymSemicolon */
+typedef struct GnuCTreeDeclaration GnuCTreeDeclaration;
+
+/* GnuCOptDeclarationList GnuCTreeDeclaration */
+typedef struct GnuCTreeDeclarationList GnuCTreeDeclarationList;
+
+/* GnuCOptPointer GnuCAnyDirectDeclarator */
+typedef struct GnuCTreeDeclarator GnuCTreeDeclarator;
+
+/* GnuCOptDesignation GnuCAnyInitializer */
+typedef struct GnuCTreeDesignatedInitializer GnuCTreeDesignatedInitializer;
+
+/* GnuCOptDesignatorList GnuCAnyDesignator */
+typedef struct GnuCTreeDesignatorList GnuCTreeDesignatorList;
+
+/* GnuCKwDo GnuCTreeStatement GnuCKwWhile GnuCTreeCondition GnuCSymSemicolon */
+typedef struct GnuCTreeDoStatement GnuCTreeDoStatement;
+
+/* GnuCOptExprList GnuCSymSemicolon */
+typedef struct GnuCTreeExpressionStatement GnuCTreeExpressionStatement;
+
+/* GnuCOptExternalDeclarations GnuCAnyExternalDeclaration */
+typedef struct GnuCTreeExternalDeclarations GnuCTreeExternalDeclarations;
+
+/* GnuCKwGeneric GnuCSymLparen GnuCAnyAssignmentExpression GnuCSymComma GnuCAnyGenericAssocList GnuCSymRparen */
+typedef struct GnuCTreeGenericSelection GnuCTreeGenericSelection;
+
+/* GnuCOptHeadDeclarationSpecifiers GnuCAnyHeadDeclarationSpecifier GnuCOptAttributes */
+typedef struct GnuCTreeHeadDeclarationSpecifiers GnuCTreeHeadDeclarationSpecifiers;
+
+/* GnuCKwIf GnuCTreeCondition GnuCTreeStatementExceptIf GnuCKwElse GnuCTreeStatement */
+typedef struct GnuCTreeIfElseStatement GnuCTreeIfElseStatement;
+
+/* GnuCKwIf GnuCTreeCondition GnuCTreeStatementExceptIf GnuCKwElse GnuCTreeStatementExceptIf */
+typedef struct GnuCTreeIfElseStatementExceptIf GnuCTreeIfElseStatementExceptIf;
+
+/* GnuCKwIf GnuCTreeCondition GnuCTreeStatement */
+typedef struct GnuCTreeIfStatement GnuCTreeIfStatement;
+
+/* GnuCKwLabel GnuCAnyIdentifierList GnuCSymSemicolon */
+typedef struct GnuCTreeLabelDeclaration GnuCTreeLabelDeclaration;
+
+/* GnuCOptLabelDeclarations GnuCTreeLabelDeclaration */
+typedef struct GnuCTreeLabelDeclarations GnuCTreeLabelDeclarations;
+
+/* GnuCOptLabels GnuCAnyLabel */
+typedef struct GnuCTreeLabels GnuCTreeLabels;
+
+/* GnuCAnyDeclarationSpecifiers GnuCTreeDeclarator GnuCOptDeclarationList GnuCTreeCompoundStatement */
+typedef struct GnuCTreeNestedFunctionDefinition GnuCTreeNestedFunctionDefinition;
+
+/* GnuCAnyParameterList GnuCSymSemicolon */
+typedef struct GnuCTreeParameterForwardDeclaration GnuCTreeParameterForwardDeclaration;
+
+/* GnuCOptParameterForwardDeclarations GnuCTreeParameterForwardDeclaration */
+typedef struct GnuCTreeParameterForwardDeclarations GnuCTreeParameterForwardDeclarations;
+
+/* GnuCSymStar GnuCOptTypeQualifierList GnuCOptPointer */
+typedef struct GnuCTreePointer GnuCTreePointer;
+
+/* GnuCKwAsm GnuCSymLparen GnuCAliasAsmStringLiteral GnuCSymRparen */
+typedef struct GnuCTreeSimpleAsmExpr GnuCTreeSimpleAsmExpr;
+
+/* GnuCOptLabels GnuCAnyUnlabeledStatement */
+typedef struct GnuCTreeStatement GnuCTreeStatement;
+
+/* GnuCOptLabels GnuCAnyUnlabeledStatementExceptIf */
+typedef struct GnuCTreeStatementExceptIf GnuCTreeStatementExceptIf;
+
+/* GnuCKwStaticAssert GnuCSymLparen GnuCAliasConstantExpression GnuCSymComma GnuCAtomStringLiteral GnuCSymRparen GnuCSymSemicolon */
+typedef struct GnuCTreeStaticAssertDeclaration GnuCTreeStaticAssertDeclaration;
+
+/* GnuCOptStructDeclarationList GnuCAnyStructDeclaration */
+typedef struct GnuCTreeStructDeclarationList GnuCTreeStructDeclarationList;
+
+/* GnuCKwSwitch GnuCSymLparen GnuCAnyExprList GnuCSymRparen GnuCTreeStatement */
+typedef struct GnuCTreeSwitchStatement GnuCTreeSwitchStatement;
+
+/* GnuCKwSwitch GnuCSymLparen GnuCAnyExprList GnuCSymRparen GnuCTreeStatementExceptIf */
+typedef struct GnuCTreeSwitchStatementExceptIf GnuCTreeSwitchStatementExceptIf;
+
+/* GnuCAnyDeclarationSpecifiers GnuCOptAbstractDeclarator */
+typedef struct GnuCTreeTagAbstractParameterDeclaration GnuCTreeTagAbstractParameterDeclaration;
+
+/* GnuCSymLparen GnuCTreeTypeName GnuCSymRparen GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagActualCastExpression GnuCTreeTagActualCastExpression;
+
+/* GnuCSymAmpersand GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagAddressofExpression GnuCTreeTagAddressofExpression;
+
+/* GnuCKwAlignas GnuCSymLparen GnuCAliasConstantExpression GnuCSymRparen */
+typedef struct GnuCTreeTagAlignasExprSpecifier GnuCTreeTagAlignasExprSpecifier;
+
+/* GnuCKwAlignas GnuCSymLparen GnuCTreeTypeName GnuCSymRparen */
+typedef struct GnuCTreeTagAlignasTypeSpecifier GnuCTreeTagAlignasTypeSpecifier;
+
+/* GnuCKwAlignof GnuCAnyNoCastExpression */
+typedef struct GnuCTreeTagAlignofExpressionExpression GnuCTreeTagAlignofExpressionExpression;
+
+/* GnuCKwAlignof GnuCSymLparen GnuCTreeTypeName GnuCSymRparen */
+typedef struct GnuCTreeTagAlignofTypeExpression GnuCTreeTagAlignofTypeExpression;
+
+/* GnuCAliasAsmStringLiteral GnuCSymLparen GnuCAnyExprList GnuCSymRparen */
+typedef struct GnuCTreeTagAnonymousAsmOperand GnuCTreeTagAnonymousAsmOperand;
+
+/* GnuCOptDirectAbstractDeclarator GnuCAnyArrayDeclarator */
+typedef struct GnuCTreeTagArrayDirectAbstractDeclarator GnuCTreeTagArrayDirectAbstractDeclarator;
+
+/* GnuCAnyDirectDeclarator GnuCAnyArrayDeclarator */
+typedef struct GnuCTreeTagArrayDirectDeclarator GnuCTreeTagArrayDirectDeclarator;
+
+/* GnuCSymLbracket GnuCAliasConstantExpression GnuCSymRbracket */
+typedef struct GnuCTreeTagArrayElementDesignator GnuCTreeTagArrayElementDesignator;
+
+/* GnuCAnyOffsetofMemberDesignator GnuCSymLbracket GnuCAnyExprList GnuCSymRbracket */
+typedef struct GnuCTreeTagArrayMemberOffsetDesignator GnuCTreeTagArrayMemberOffsetDesignator;
+
+/* GnuCSymLbracket GnuCAliasConstantExpression GnuCSymEllipsis GnuCAliasConstantExpression GnuCSymRbracket */
+typedef struct GnuCTreeTagArrayRangeDesignator GnuCTreeTagArrayRangeDesignator;
+
+/* GnuCAliasAsmStringLiteral GnuCSymColon GnuCOptAsmOperands */
+typedef struct GnuCTreeTagAsmArgumentOut GnuCTreeTagAsmArgumentOut;
+
+/* GnuCAliasAsmStringLiteral GnuCSymColon GnuCOptAsmOperands GnuCSymColon GnuCOptAsmOperands */
+typedef struct GnuCTreeTagAsmArgumentOutIn GnuCTreeTagAsmArgumentOutIn;
+
+/* GnuCAliasAsmStringLiteral GnuCSymColon GnuCOptAsmOperands GnuCSymColon GnuCOptAsmOperands GnuCSymColon GnuCOptAsmClobbers */
+typedef struct GnuCTreeTagAsmArgumentOutInClobber GnuCTreeTagAsmArgumentOutInClobber;
+
+/* GnuCKwAsm GnuCOptTypeQualifier GnuCSymLparen GnuCAnyAsmArgument GnuCSymRparen GnuCSymSemicolon */
+typedef struct GnuCTreeTagAsmCommonStatement GnuCTreeTagAsmCommonStatement;
+
+/* GnuCKwAsm GnuCOptTypeQualifier GnuCKwGoto GnuCSymLparen GnuCTreeAsmGotoArgument GnuCSymRparen GnuCSymSemicolon */
+typedef struct GnuCTreeTagAsmGotoStatement GnuCTreeTagAsmGotoStatement;
+
+/* GnuCAnyAnyWord GnuCSymLparen GnuCAnyExprList GnuCSymRparen */
+typedef struct GnuCTreeTagAttribWithArg GnuCTreeTagAttribWithArg;
+
+/* GnuCAnyConditionalExpression GnuCSymAmpersandAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagBitAndAssignmentExpression GnuCTreeTagBitAndAssignmentExpression;
+
+/* GnuCAnyAndExpression GnuCSymAmpersand GnuCAnyEqualityExpression */
+typedef struct GnuCTreeTagBitAndExpression GnuCTreeTagBitAndExpression;
+
+/* GnuCAnyConditionalExpression GnuCSymPipeAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagBitIorAssignmentExpression GnuCTreeTagBitIorAssignmentExpression;
+
+/* GnuCAnyInclusiveOrExpression GnuCSymPipe GnuCAnyExclusiveOrExpression */
+typedef struct GnuCTreeTagBitIorExpression GnuCTreeTagBitIorExpression;
+
+/* GnuCSymTilde GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagBitNotExpression GnuCTreeTagBitNotExpression;
+
+/* GnuCAnyConditionalExpression GnuCSymCaretAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagBitXorAssignmentExpression GnuCTreeTagBitXorAssignmentExpression;
+
+/* GnuCAnyExclusiveOrExpression GnuCSymCaret GnuCAnyAndExpression */
+typedef struct GnuCTreeTagBitXorExpression GnuCTreeTagBitXorExpression;
+
+/* GnuCOptDeclarator GnuCSymColon GnuCAliasConstantExpression GnuCOptAttributes */
+typedef struct GnuCTreeTagBitfieldDeclarator GnuCTreeTagBitfieldDeclarator;
+
+/* GnuCSymLbrace GnuCOptInitializerList GnuCSymRbrace */
+typedef struct GnuCTreeTagBracedInitializer GnuCTreeTagBracedInitializer;
+
+/* GnuCSymLbrace GnuCAnyInitializerList GnuCSymComma GnuCSymRbrace */
+typedef struct GnuCTreeTagBracedInitializerComma GnuCTreeTagBracedInitializerComma;
+
+/* GnuCKwBreak GnuCSymSemicolon */
+typedef struct GnuCTreeTagBreakStatement GnuCTreeTagBreakStatement;
+
+/* GnuCKwBuiltinChooseExpr GnuCSymLparen GnuCAnyAssignmentExpression GnuCSymComma GnuCAnyAssignmentExpression GnuCSymComma GnuCAnyAssignmentExpression GnuCSymRparen */
+typedef struct GnuCTreeTagBuiltinChooseExprExpression GnuCTreeTagBuiltinChooseExprExpression;
+
+/* GnuCKwBuiltinComplex GnuCSymLparen GnuCAnyAssignmentExpression GnuCSymComma GnuCAnyAssignmentExpression GnuCSymRparen */
+typedef struct GnuCTreeTagBuiltinComplexExpression GnuCTreeTagBuiltinComplexExpression;
+
+/* GnuCKwBuiltinShuffle GnuCSymLparen GnuCAnyAssignmentExpression GnuCSymComma GnuCAnyAssignmentExpression GnuCSymComma GnuCAnyAssignmentExpression GnuCSymRparen */
+typedef struct GnuCTreeTagBuiltinMixShuffleExpression GnuCTreeTagBuiltinMixShuffleExpression;
+
+/* GnuCKwBuiltinOffsetof GnuCSymLparen GnuCTreeTypeName GnuCSymComma GnuCAnyOffsetofMemberDesignator GnuCSymRparen */
+typedef struct GnuCTreeTagBuiltinOffsetofExpression GnuCTreeTagBuiltinOffsetofExpression;
+
+/* GnuCKwBuiltinShuffle GnuCSymLparen GnuCAnyAssignmentExpression GnuCSymComma GnuCAnyAssignmentExpression GnuCSymRparen */
+typedef struct GnuCTreeTagBuiltinSimpleShuffleExpression GnuCTreeTagBuiltinSimpleShuffleExpression;
+
+/* GnuCKwBuiltinTypesCompatibleP GnuCSymLparen GnuCTreeTypeName GnuCSymComma GnuCTreeTypeName GnuCSymRparen */
+typedef struct GnuCTreeTagBuiltinTypesCompatiblePExpression GnuCTreeTagBuiltinTypesCompatiblePExpression;
+
+/* GnuCKwBuiltinVaArg GnuCSymLparen GnuCAnyAssignmentExpression GnuCSymComma GnuCTreeTypeName GnuCSymRparen */
+typedef struct GnuCTreeTagBuiltinVaArgExpression GnuCTreeTagBuiltinVaArgExpression;
+
+/* GnuCTreeDesignatorList GnuCSymAssign */
+typedef struct GnuCTreeTagC99_Designation GnuCTreeTagC99_Designation;
+
+/* GnuCAnyPostfixExpression GnuCSymLparen GnuCOptExprList GnuCSymRparen */
+typedef struct GnuCTreeTagCallExpression GnuCTreeTagCallExpression;
+
+/* GnuCKwCase GnuCAliasConstantExpression GnuCSymColon */
+typedef struct GnuCTreeTagCaseLabel GnuCTreeTagCaseLabel;
+
+/* GnuCKwCase GnuCAliasConstantExpression GnuCSymEllipsis GnuCAliasConstantExpression GnuCSymColon */
+typedef struct GnuCTreeTagCaseRangeLabel GnuCTreeTagCaseRangeLabel;
+
+/* GnuCSymLparen GnuCTreeTypeName GnuCSymRparen GnuCSymLbrace GnuCOptInitializerList GnuCSymRbrace */
+typedef struct GnuCTreeTagCompoundLiteral GnuCTreeTagCompoundLiteral;
+
+/* GnuCSymLparen GnuCTreeTypeName GnuCSymRparen GnuCSymLbrace GnuCAnyInitializerList GnuCSymComma GnuCSymRbrace */
+typedef struct GnuCTreeTagCompoundLiteralComma GnuCTreeTagCompoundLiteralComma;
+
+/* GnuCKwGoto GnuCSymStar GnuCAnyExprList GnuCSymSemicolon */
+typedef struct GnuCTreeTagComputedGotoStatement GnuCTreeTagComputedGotoStatement;
+
+/* GnuCAnyDeclarationSpecifiers GnuCTreeDeclarator */
+typedef struct GnuCTreeTagConcreteParameterDeclaration GnuCTreeTagConcreteParameterDeclaration;
+
+/* GnuCKwContinue GnuCSymSemicolon */
+typedef struct GnuCTreeTagContinueStatement GnuCTreeTagContinueStatement;
+
+/* GnuCKwDefault GnuCSymColon GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagDefaultGenericAssociation GnuCTreeTagDefaultGenericAssociation;
+
+/* GnuCKwDefault GnuCSymColon */
+typedef struct GnuCTreeTagDefaultLabel GnuCTreeTagDefaultLabel;
+
+/* GnuCSymStar GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagDerefExpression GnuCTreeTagDerefExpression;
+
+/* GnuCAnyPostfixExpression GnuCSymDot GnuCAtomIdentifier */
+typedef struct GnuCTreeTagDirectMemberExpression GnuCTreeTagDirectMemberExpression;
+
+/* GnuCAnyConditionalExpression GnuCSymSlashAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagDivideAssignmentExpression GnuCTreeTagDivideAssignmentExpression;
+
+/* GnuCAnyMultiplicativeExpression GnuCSymSlash GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagDivideExpression GnuCTreeTagDivideExpression;
+
+/* GnuCAnyEqualityExpression GnuCSymEq GnuCAnyRelationalExpression */
+typedef struct GnuCTreeTagEqExpression GnuCTreeTagEqExpression;
+
+/* GnuCKwExtension GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagExtensionExpression GnuCTreeTagExtensionExpression;
+
+/* GnuCKwExtension GnuCAnyExternalDeclaration */
+typedef struct GnuCTreeTagExtensionExternalDeclaration GnuCTreeTagExtensionExternalDeclaration;
+
+/* GnuCKwExtension GnuCAnyNestedDeclaration */
+typedef struct GnuCTreeTagExtensionNestedDeclaration GnuCTreeTagExtensionNestedDeclaration;
+
+/* GnuCKwExtension GnuCAnyStructDeclaration */
+typedef struct GnuCTreeTagExtensionStructDeclaration GnuCTreeTagExtensionStructDeclaration;
+
+/* GnuCKwFor GnuCSymLparen GnuCAnyNestedDeclaration GnuCOptExprList GnuCSymSemicolon GnuCOptExprList GnuCSymRparen GnuCTreeStatement */
+typedef struct GnuCTreeTagForDeclStatement GnuCTreeTagForDeclStatement;
+
+/* GnuCKwFor GnuCSymLparen GnuCAnyNestedDeclaration GnuCOptExprList GnuCSymSemicolon GnuCOptExprList GnuCSymRparen GnuCTreeStatementExceptIf */
+typedef struct GnuCTreeTagForDeclStatementExceptIf GnuCTreeTagForDeclStatementExceptIf;
+
+/* GnuCKwFor GnuCSymLparen GnuCOptExprList GnuCSymSemicolon GnuCOptExprList GnuCSymSemicolon GnuCOptExprList GnuCSymRparen GnuCTreeStatement */
+typedef struct GnuCTreeTagForExprStatement GnuCTreeTagForExprStatement;
+
+/* GnuCKwFor GnuCSymLparen GnuCOptExprList GnuCSymSemicolon GnuCOptExprList GnuCSymSemicolon GnuCOptExprList GnuCSymRparen GnuCTreeStatementExceptIf */
+typedef struct GnuCTreeTagForExprStatementExceptIf GnuCTreeTagForExprStatementExceptIf;
+
+/* GnuCKwEnum GnuCOptAttributes GnuCAtomIdentifier */
+typedef struct GnuCTreeTagForwardEnumSpecifier GnuCTreeTagForwardEnumSpecifier;
+
+/* GnuCOptDirectAbstractDeclarator GnuCSymLparen GnuCTreeParameterForwardDeclarations GnuCOptParameterTypeList GnuCSymRparen */
+typedef struct GnuCTreeTagForwardParamFunDirectAbstractDeclarator GnuCTreeTagForwardParamFunDirectAbstractDeclarator;
+
+/* GnuCAnyDirectDeclarator GnuCSymLparen GnuCTreeParameterForwardDeclarations GnuCOptParameterTypeList GnuCSymRparen */
+typedef struct GnuCTreeTagForwardParamFunDirectDeclarator GnuCTreeTagForwardParamFunDirectDeclarator;
+
+/* GnuCAnyStructOrUnion GnuCOptAttributes GnuCAtomIdentifier */
+typedef struct GnuCTreeTagForwardStructOrUnionSpecifier GnuCTreeTagForwardStructOrUnionSpecifier;
+
+/* GnuCKwEnum GnuCOptAttributes GnuCOptIdentifier GnuCSymLbrace GnuCAnyEnumeratorList GnuCOptComma GnuCSymRbrace */
+typedef struct GnuCTreeTagFullEnumSpecifier GnuCTreeTagFullEnumSpecifier;
+
+/* GnuCAnyStructOrUnion GnuCOptAttributes GnuCOptIdentifier GnuCSymLbrace GnuCOptStructDeclarationList GnuCSymRbrace */
+typedef struct GnuCTreeTagFullStructOrUnionSpecifier GnuCTreeTagFullStructOrUnionSpecifier;
+
+/* GnuCOptDirectAbstractDeclarator GnuCSymLparen GnuCOptParameterTypeList GnuCSymRparen */
+typedef struct GnuCTreeTagFunDirectAbstractDeclarator GnuCTreeTagFunDirectAbstractDeclarator;
+
+/* GnuCAnyDirectDeclarator GnuCSymLparen GnuCAnyParameterTypeList GnuCSymRparen */
+typedef struct GnuCTreeTagFunDirectDeclarator GnuCTreeTagFunDirectDeclarator;
+
+/* GnuCAnyRelationalExpression GnuCSymGe GnuCAnyShiftExpression */
+typedef struct GnuCTreeTagGeExpression GnuCTreeTagGeExpression;
+
+/* GnuCAtomIdentifier GnuCSymColon */
+typedef struct GnuCTreeTagGnuDesignation GnuCTreeTagGnuDesignation;
+
+/* GnuCSymLparen GnuCTreeCompoundStatement GnuCSymRparen */
+typedef struct GnuCTreeTagGnuStatementExpression GnuCTreeTagGnuStatementExpression;
+
+/* GnuCKwGoto GnuCAtomIdentifier GnuCSymSemicolon */
+typedef struct GnuCTreeTagGotoStatement GnuCTreeTagGotoStatement;
+
+/* GnuCAnyRelationalExpression GnuCSymGt GnuCAnyShiftExpression */
+typedef struct GnuCTreeTagGtExpression GnuCTreeTagGtExpression;
+
+/* GnuCOptAttributes GnuCOptHeadDeclarationSpecifiers GnuCTreeTailDeclarationSpecifiers */
+typedef struct GnuCTreeTagHeadTailDeclarationSpecifiers GnuCTreeTagHeadTailDeclarationSpecifiers;
+
+/* GnuCKwImag GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagImagExpression GnuCTreeTagImagExpression;
+
+/* GnuCAnyInitDeclaratorList GnuCSymSemicolon */
+typedef struct GnuCTreeTagImplicitIntDeclaration GnuCTreeTagImplicitIntDeclaration;
+
+/* GnuCTreeDeclarator GnuCOptDeclarationList GnuCTreeCompoundStatement */
+typedef struct GnuCTreeTagImplicitIntFunctionDefinition GnuCTreeTagImplicitIntFunctionDefinition;
+
+/* GnuCAnyPostfixExpression GnuCSymLbracket GnuCAnyExprList GnuCSymRbracket */
+typedef struct GnuCTreeTagIndexExpression GnuCTreeTagIndexExpression;
+
+/* GnuCAnyPostfixExpression GnuCSymArrow GnuCAtomIdentifier */
+typedef struct GnuCTreeTagIndirectMemberExpression GnuCTreeTagIndirectMemberExpression;
+
+/* GnuCTreeDeclarator GnuCOptSimpleAsmExpr GnuCOptAttributes GnuCSymAssign GnuCAnyInitializer */
+typedef struct GnuCTreeTagInitializedDeclarator GnuCTreeTagInitializedDeclarator;
+
+/* GnuCAliasEnumerationConstant GnuCSymAssign GnuCAliasConstantExpression */
+typedef struct GnuCTreeTagInitializedEnumerator GnuCTreeTagInitializedEnumerator;
+
+/* GnuCSymLogicalAnd GnuCAtomIdentifier */
+typedef struct GnuCTreeTagLabelAddressExpression GnuCTreeTagLabelAddressExpression;
+
+/* GnuCAnyRelationalExpression GnuCSymLe GnuCAnyShiftExpression */
+typedef struct GnuCTreeTagLeExpression GnuCTreeTagLeExpression;
+
+/* GnuCAnyConditionalExpression GnuCSymLshiftAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagLeftShiftAssignmentExpression GnuCTreeTagLeftShiftAssignmentExpression;
+
+/* GnuCAnyShiftExpression GnuCSymLshift GnuCAnyAdditiveExpression */
+typedef struct GnuCTreeTagLeftShiftExpression GnuCTreeTagLeftShiftExpression;
+
+/* GnuCAnyDirectDeclarator GnuCSymLparen GnuCOptIdentifierList GnuCSymRparen */
+typedef struct GnuCTreeTagLegacyFunDirectDeclarator GnuCTreeTagLegacyFunDirectDeclarator;
+
+/* GnuCAnyLogicalAndExpression GnuCSymLogicalAnd GnuCAnyInclusiveOrExpression */
+typedef struct GnuCTreeTagLogAndExpression GnuCTreeTagLogAndExpression;
+
+/* GnuCSymBang GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagLogNotExpression GnuCTreeTagLogNotExpression;
+
+/* GnuCAnyLogicalOrExpression GnuCSymLogicalOr GnuCAnyLogicalAndExpression */
+typedef struct GnuCTreeTagLogOrExpression GnuCTreeTagLogOrExpression;
+
+/* GnuCAnyRelationalExpression GnuCSymLt GnuCAnyShiftExpression */
+typedef struct GnuCTreeTagLtExpression GnuCTreeTagLtExpression;
+
+/* GnuCAnySpecifierQualifierList GnuCOptStructDeclaratorList GnuCSymSemicolon */
+typedef struct GnuCTreeTagMemberDeclaration GnuCTreeTagMemberDeclaration;
+
+/* GnuCTreeDeclarator GnuCOptAttributes */
+typedef struct GnuCTreeTagMemberDeclarator GnuCTreeTagMemberDeclarator;
+
+/* GnuCSymDot GnuCAtomIdentifier */
+typedef struct GnuCTreeTagMemberDesignator GnuCTreeTagMemberDesignator;
+
+/* GnuCAnyConditionalExpression GnuCSymMinusAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagMinusAssignmentExpression GnuCTreeTagMinusAssignmentExpression;
+
+/* GnuCAnyAdditiveExpression GnuCSymMinus GnuCAnyMultiplicativeExpression */
+typedef struct GnuCTreeTagMinusExpression GnuCTreeTagMinusExpression;
+
+/* GnuCAnyConditionalExpression GnuCSymPercentAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagModuloAssignmentExpression GnuCTreeTagModuloAssignmentExpression;
+
+/* GnuCAnyMultiplicativeExpression GnuCSymPercent GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagModuloExpression GnuCTreeTagModuloExpression;
+
+/* GnuCAnyAsmClobbers GnuCSymComma GnuCAliasAsmStringLiteral */
+typedef struct GnuCTreeTagMultiAsmClobbers GnuCTreeTagMultiAsmClobbers;
+
+/* GnuCAnyAsmGotoOperands GnuCSymComma GnuCAtomIdentifier */
+typedef struct GnuCTreeTagMultiAsmGotoOperands GnuCTreeTagMultiAsmGotoOperands;
+
+/* GnuCAnyAsmOperands GnuCSymComma GnuCAnyAsmOperand */
+typedef struct GnuCTreeTagMultiAsmOperands GnuCTreeTagMultiAsmOperands;
+
+/* GnuCOptAttributeList GnuCSymComma GnuCOptAttrib */
+typedef struct GnuCTreeTagMultiAttributeList GnuCTreeTagMultiAttributeList;
+
+/* GnuCAnyEnumeratorList GnuCSymComma GnuCAnyEnumerator */
+typedef struct GnuCTreeTagMultiEnumeratorList GnuCTreeTagMultiEnumeratorList;
+
+/* GnuCAnyExprList GnuCSymComma GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagMultiExprList GnuCTreeTagMultiExprList;
+
+/* GnuCAnyGenericAssocList GnuCSymComma GnuCAnyGenericAssociation */
+typedef struct GnuCTreeTagMultiGenericAssocList GnuCTreeTagMultiGenericAssocList;
+
+/* GnuCAnyIdentifierList GnuCSymComma GnuCAtomIdentifier */
+typedef struct GnuCTreeTagMultiIdentifierList GnuCTreeTagMultiIdentifierList;
+
+/* GnuCAnyInitDeclaratorList GnuCSymComma GnuCAnyInitDeclarator */
+typedef struct GnuCTreeTagMultiInitDeclaratorList GnuCTreeTagMultiInitDeclaratorList;
+
+/* GnuCAnyInitializerList GnuCSymComma GnuCTreeDesignatedInitializer */
+typedef struct GnuCTreeTagMultiInitializerList GnuCTreeTagMultiInitializerList;
+
+/* GnuCAnyParameterList GnuCSymComma GnuCAnyParameterDeclaration */
+typedef struct GnuCTreeTagMultiParameterList GnuCTreeTagMultiParameterList;
+
+/* GnuCAnyStructDeclaratorList GnuCSymComma GnuCOptAttributes GnuCAnyStructDeclarator */
+typedef struct GnuCTreeTagMultiStructDeclarator GnuCTreeTagMultiStructDeclarator;
+
+/* GnuCSymLbracket GnuCAtomIdentifier GnuCSymRbracket GnuCAliasAsmStringLiteral GnuCSymLparen GnuCAnyExprList GnuCSymRparen */
+typedef struct GnuCTreeTagNamedAsmOperand GnuCTreeTagNamedAsmOperand;
+
+/* GnuCAtomIdentifier GnuCSymColon GnuCOptAttributes */
+typedef struct GnuCTreeTagNamedLabel GnuCTreeTagNamedLabel;
+
+/* GnuCAnyOffsetofMemberDesignator GnuCSymDot GnuCAtomIdentifier */
+typedef struct GnuCTreeTagNamedMemberOffsetDesignator GnuCTreeTagNamedMemberOffsetDesignator;
+
+/* GnuCAnyEqualityExpression GnuCSymNe GnuCAnyRelationalExpression */
+typedef struct GnuCTreeTagNeExpression GnuCTreeTagNeExpression;
+
+/* GnuCOptAttributes GnuCTreeHeadDeclarationSpecifiers */
+typedef struct GnuCTreeTagOnlyHeadDeclarationSpecifiers GnuCTreeTagOnlyHeadDeclarationSpecifiers;
+
+/* GnuCSymLparen GnuCOptAttributes GnuCAnyAbstractDeclarator GnuCSymRparen */
+typedef struct GnuCTreeTagParenDirectAbstractDeclarator GnuCTreeTagParenDirectAbstractDeclarator;
+
+/* GnuCSymLparen GnuCOptAttributes GnuCTreeDeclarator GnuCSymRparen */
+typedef struct GnuCTreeTagParenDirectDeclarator GnuCTreeTagParenDirectDeclarator;
+
+/* GnuCSymLparen GnuCAnyExprList GnuCSymRparen */
+typedef struct GnuCTreeTagParenExpression GnuCTreeTagParenExpression;
+
+/* GnuCAnyConditionalExpression GnuCSymPlusAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagPlusAssignmentExpression GnuCTreeTagPlusAssignmentExpression;
+
+/* GnuCAnyAdditiveExpression GnuCSymPlus GnuCAnyMultiplicativeExpression */
+typedef struct GnuCTreeTagPlusExpression GnuCTreeTagPlusExpression;
+
+/* GnuCTreePointer GnuCOptDirectAbstractDeclarator */
+typedef struct GnuCTreeTagPointerAbstractDeclarator GnuCTreeTagPointerAbstractDeclarator;
+
+/* GnuCAnyPostfixExpression GnuCSymDecr */
+typedef struct GnuCTreeTagPostDecrExpression GnuCTreeTagPostDecrExpression;
+
+/* GnuCAnyPostfixExpression GnuCSymIncr */
+typedef struct GnuCTreeTagPostIncrExpression GnuCTreeTagPostIncrExpression;
+
+/* GnuCSymDecr GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagPreDecrExpression GnuCTreeTagPreDecrExpression;
+
+/* GnuCSymIncr GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagPreIncrExpression GnuCTreeTagPreIncrExpression;
+
+/* GnuCOptTypeQualifierList GnuCAnyTypeQualifier GnuCOptAttributes */
+typedef struct GnuCTreeTagQListQualifier GnuCTreeTagQListQualifier;
+
+/* GnuCKwReal GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagRealExpression GnuCTreeTagRealExpression;
+
+/* GnuCKwReturn GnuCOptExprList GnuCSymSemicolon */
+typedef struct GnuCTreeTagReturnStatement GnuCTreeTagReturnStatement;
+
+/* GnuCSymLbracket GnuCAnyTypeQualifierList GnuCKwStatic GnuCAnyAssignmentExpression GnuCSymRbracket */
+typedef struct GnuCTreeTagReverseStaticArrayDeclarator GnuCTreeTagReverseStaticArrayDeclarator;
+
+/* GnuCAnyConditionalExpression GnuCSymRshiftAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagRightShiftAssignmentExpression GnuCTreeTagRightShiftAssignmentExpression;
+
+/* GnuCAnyShiftExpression GnuCSymRshift GnuCAnyAdditiveExpression */
+typedef struct GnuCTreeTagRightShiftExpression GnuCTreeTagRightShiftExpression;
+
+/* GnuCSymLbracket GnuCOptTypeQualifierList GnuCOptAssignmentExpression GnuCSymRbracket */
+typedef struct GnuCTreeTagSimpleArrayDeclarator GnuCTreeTagSimpleArrayDeclarator;
+
+/* GnuCAnyConditionalExpression GnuCSymAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagSimpleAssignmentExpression GnuCTreeTagSimpleAssignmentExpression;
+
+/* GnuCKwSizeof GnuCAnyNoCastExpression */
+typedef struct GnuCTreeTagSizeofExpressionExpression GnuCTreeTagSizeofExpressionExpression;
+
+/* GnuCKwSizeof GnuCSymLparen GnuCTreeTypeName GnuCSymRparen */
+typedef struct GnuCTreeTagSizeofTypeExpression GnuCTreeTagSizeofTypeExpression;
+
+/* GnuCOptSpecifierQualifierList GnuCAnyTypeQualifier GnuCOptAttributes */
+typedef struct GnuCTreeTagSqListQualifier GnuCTreeTagSqListQualifier;
+
+/* GnuCOptSpecifierQualifierList GnuCAnyTypeSpecifier GnuCOptAttributes */
+typedef struct GnuCTreeTagSqListSpecifier GnuCTreeTagSqListSpecifier;
+
+/* GnuCSymLbracket GnuCOptTypeQualifierList GnuCSymStar GnuCSymRbracket */
+typedef struct GnuCTreeTagStarArrayDeclarator GnuCTreeTagStarArrayDeclarator;
+
+/* GnuCSymLbracket GnuCKwStatic GnuCOptTypeQualifierList GnuCAnyAssignmentExpression GnuCSymRbracket */
+typedef struct GnuCTreeTagStaticArrayDeclarator GnuCTreeTagStaticArrayDeclarator;
+
+/* GnuCAnyLogicalOrExpression GnuCSymQuery GnuCOptExprList GnuCSymColon GnuCAnyConditionalExpression */
+typedef struct GnuCTreeTagTernaryExpression GnuCTreeTagTernaryExpression;
+
+/* GnuCAnyConditionalExpression GnuCSymStarAssign GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagTimesAssignmentExpression GnuCTreeTagTimesAssignmentExpression;
+
+/* GnuCAnyMultiplicativeExpression GnuCSymStar GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagTimesExpression GnuCTreeTagTimesExpression;
+
+/* GnuCTreeTypeName GnuCSymColon GnuCAnyAssignmentExpression */
+typedef struct GnuCTreeTagTypeGenericAssociation GnuCTreeTagTypeGenericAssociation;
+
+/* GnuCKwTypeof GnuCSymLparen GnuCAnyExprList GnuCSymRparen */
+typedef struct GnuCTreeTagTypeofExprSpecifier GnuCTreeTagTypeofExprSpecifier;
+
+/* GnuCKwTypeof GnuCSymLparen GnuCTreeTypeName GnuCSymRparen */
+typedef struct GnuCTreeTagTypeofTypeSpecifier GnuCTreeTagTypeofTypeSpecifier;
+
+/* GnuCSymMinus GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagUnaryMinusExpression GnuCTreeTagUnaryMinusExpression;
+
+/* GnuCSymPlus GnuCAnyMaybeCastExpression */
+typedef struct GnuCTreeTagUnaryPlusExpression GnuCTreeTagUnaryPlusExpression;
+
+/* GnuCTreeDeclarator GnuCOptSimpleAsmExpr GnuCOptAttributes */
+typedef struct GnuCTreeTagUninitializedDeclarator GnuCTreeTagUninitializedDeclarator;
+
+/* GnuCAnyParameterList GnuCSymComma GnuCSymEllipsis */
+typedef struct GnuCTreeTagVariadicParameterList GnuCTreeTagVariadicParameterList;
+
+/* GnuCOptTailDeclarationSpecifiers GnuCAnyTailDeclarationSpecifier GnuCOptAttributes GnuCOptHeadDeclarationSpecifiers */
+typedef struct GnuCTreeTailDeclarationSpecifiers GnuCTreeTailDeclarationSpecifiers;
+
+/* GnuCAnySpecifierQualifierList GnuCOptAbstractDeclarator */
+typedef struct GnuCTreeTypeName GnuCTreeTypeName;
+
+/* GnuCKwWhile GnuCTreeCondition GnuCTreeStatement */
+typedef struct GnuCTreeWhileStatement GnuCTreeWhileStatement;
+
+/* GnuCKwWhile GnuCTreeCondition GnuCTreeStatementExceptIf */
+typedef struct GnuCTreeWhileStatementExceptIf GnuCTreeWhileStatementExceptIf;
+
+/* Construction. */
+GnuCNothing *gnu_c_create_nothing(Pool *pool);
+GnuCAtomAddressSpace *gnu_c_create_atom_address_space(Pool *pool, const char *raw);
+GnuCAtomBinaryConstant *gnu_c_create_atom_binary_constant(Pool *pool, const char *raw);
+GnuCAtomCharacterConstant *gnu_c_create_atom_character_constant(Pool *pool, const char *raw);
+GnuCAtomComment *gnu_c_create_atom_comment(Pool *pool, const char *raw);
+GnuCAtomDecimalConstant *gnu_c_create_atom_decimal_constant(Pool *pool, const char *raw);
+GnuCAtomDecimalFloatingConstant *gnu_c_create_atom_decimal_floating_constant(Pool *pool, const char *raw);
+GnuCAtomHexadecimalConstant *gnu_c_create_atom_hexadecimal_constant(Pool *pool, const char *raw);
+GnuCAtomHexadecimalFloatingConstant *gnu_c_create_atom_hexadecimal_floating_constant(Pool *pool, const char *raw);
+GnuCAtomIdentifier *gnu_c_create_atom_identifier(Pool *pool, const char *raw);
+GnuCAtomOctalConstant *gnu_c_create_atom_octal_constant(Pool *pool, const char *raw);
+GnuCAtomStringLiteral *gnu_c_create_atom_string_literal(Pool *pool, const char *raw);
+GnuCAtomTypedefName *gnu_c_create_atom_typedef_name(Pool *pool, const char *raw);
+GnuCKwAccum *gnu_c_create_kw_accum(Pool *pool);
+GnuCKwAlignas *gnu_c_create_kw_alignas(Pool *pool);
+GnuCKwAlignof *gnu_c_create_kw_alignof(Pool *pool);
+GnuCKwAsm *gnu_c_create_kw_asm(Pool *pool);
+GnuCKwAtomicAsQualifier *gnu_c_create_kw_atomic_as_qualifier(Pool *pool);
+GnuCKwAtomicAsSpecifier *gnu_c_create_kw_atomic_as_specifier(Pool *pool);
+GnuCKwAttribute *gnu_c_create_kw_attribute(Pool *pool);
+GnuCKwAuto *gnu_c_create_kw_auto(Pool *pool);
+GnuCKwAutoType *gnu_c_create_kw_auto_type(Pool *pool);
+GnuCKwBool *gnu_c_create_kw_bool(Pool *pool);
+GnuCKwBreak *gnu_c_create_kw_break(Pool *pool);
+GnuCKwBuiltinChooseExpr *gnu_c_create_kw_builtin_choose_expr(Pool *pool);
+GnuCKwBuiltinComplex *gnu_c_create_kw_builtin_complex(Pool *pool);
+GnuCKwBuiltinOffsetof *gnu_c_create_kw_builtin_offsetof(Pool *pool);
+GnuCKwBuiltinShuffle *gnu_c_create_kw_builtin_shuffle(Pool *pool);
+GnuCKwBuiltinTypesCompatibleP *gnu_c_create_kw_builtin_types_compatible_p(Pool *pool);
+GnuCKwBuiltinVaArg *gnu_c_create_kw_builtin_va_arg(Pool *pool);
+GnuCKwCase *gnu_c_create_kw_case(Pool *pool);
+GnuCKwChar *gnu_c_create_kw_char(Pool *pool);
+GnuCKwComplex *gnu_c_create_kw_complex(Pool *pool);
+GnuCKwConst *gnu_c_create_kw_const(Pool *pool);
+GnuCKwContinue *gnu_c_create_kw_continue(Pool *pool);
+GnuCKwDecimal128 *gnu_c_create_kw_decimal128(Pool *pool);
+GnuCKwDecimal32 *gnu_c_create_kw_decimal32(Pool *pool);
+GnuCKwDecimal64 *gnu_c_create_kw_decimal64(Pool *pool);
+GnuCKwDefault *gnu_c_create_kw_default(Pool *pool);
+GnuCKwDo *gnu_c_create_kw_do(Pool *pool);
+GnuCKwDouble *gnu_c_create_kw_double(Pool *pool);
+GnuCKwElse *gnu_c_create_kw_else(Pool *pool);
+GnuCKwEnum *gnu_c_create_kw_enum(Pool *pool);
+GnuCKwExtension *gnu_c_create_kw_extension(Pool *pool);
+GnuCKwExtern *gnu_c_create_kw_extern(Pool *pool);
+GnuCKwFloat *gnu_c_create_kw_float(Pool *pool);
+GnuCKwFor *gnu_c_create_kw_for(Pool *pool);
+GnuCKwFract *gnu_c_create_kw_fract(Pool *pool);
+GnuCKwFunc *gnu_c_create_kw_func(Pool *pool);
+GnuCKwFunction *gnu_c_create_kw_function(Pool *pool);
+GnuCKwGeneric *gnu_c_create_kw_generic(Pool *pool);
+GnuCKwGoto *gnu_c_create_kw_goto(Pool *pool);
+GnuCKwIf *gnu_c_create_kw_if(Pool *pool);
+GnuCKwImag *gnu_c_create_kw_imag(Pool *pool);
+GnuCKwInline *gnu_c_create_kw_inline(Pool *pool);
+GnuCKwInt *gnu_c_create_kw_int(Pool *pool);
+GnuCKwLabel *gnu_c_create_kw_label(Pool *pool);
+GnuCKwLong *gnu_c_create_kw_long(Pool *pool);
+GnuCKwNoreturn *gnu_c_create_kw_noreturn(Pool *pool);
+GnuCKwPrettyFunction *gnu_c_create_kw_pretty_function(Pool *pool);
+GnuCKwReal *gnu_c_create_kw_real(Pool *pool);
+GnuCKwRegister *gnu_c_create_kw_register(Pool *pool);
+GnuCKwRestrict *gnu_c_create_kw_restrict(Pool *pool);
+GnuCKwReturn *gnu_c_create_kw_return(Pool *pool);
+GnuCKwSat *gnu_c_create_kw_sat(Pool *pool);
+GnuCKwShort *gnu_c_create_kw_short(Pool *pool);
+GnuCKwSigned *gnu_c_create_kw_signed(Pool *pool);
+GnuCKwSizeof *gnu_c_create_kw_sizeof(Pool *pool);
+GnuCKwStatic *gnu_c_create_kw_static(Pool *pool);
+GnuCKwStaticAssert *gnu_c_create_kw_static_assert(Pool *pool);
+GnuCKwStruct *gnu_c_create_kw_struct(Pool *pool);
+GnuCKwSwitch *gnu_c_create_kw_switch(Pool *pool);
+GnuCKwThread *gnu_c_create_kw_thread(Pool *pool);
+GnuCKwThreadLocal *gnu_c_create_kw_thread_local(Pool *pool);
+GnuCKwTypedef *gnu_c_create_kw_typedef(Pool *pool);
+GnuCKwTypeof *gnu_c_create_kw_typeof(Pool *pool);
+GnuCKwUnion *gnu_c_create_kw_union(Pool *pool);
+GnuCKwUnsigned *gnu_c_create_kw_unsigned(Pool *pool);
+GnuCKwVoid *gnu_c_create_kw_void(Pool *pool);
+GnuCKwVolatile *gnu_c_create_kw_volatile(Pool *pool);
+GnuCKwWhile *gnu_c_create_kw_while(Pool *pool);
+GnuCSymAmpersand *gnu_c_create_sym_ampersand(Pool *pool);
+GnuCSymAmpersandAssign *gnu_c_create_sym_ampersand_assign(Pool *pool);
+GnuCSymArrow *gnu_c_create_sym_arrow(Pool *pool);
+GnuCSymAssign *gnu_c_create_sym_assign(Pool *pool);
+GnuCSymBang *gnu_c_create_sym_bang(Pool *pool);
+GnuCSymCaret *gnu_c_create_sym_caret(Pool *pool);
+GnuCSymCaretAssign *gnu_c_create_sym_caret_assign(Pool *pool);
+GnuCSymColon *gnu_c_create_sym_colon(Pool *pool);
+GnuCSymComma *gnu_c_create_sym_comma(Pool *pool);
+GnuCSymDecr *gnu_c_create_sym_decr(Pool *pool);
+GnuCSymDot *gnu_c_create_sym_dot(Pool *pool);
+GnuCSymEllipsis *gnu_c_create_sym_ellipsis(Pool *pool);
+GnuCSymEq *gnu_c_create_sym_eq(Pool *pool);
+GnuCSymGe *gnu_c_create_sym_ge(Pool *pool);
+GnuCSymGt *gnu_c_create_sym_gt(Pool *pool);
+GnuCSymIncr *gnu_c_create_sym_incr(Pool *pool);
+GnuCSymLbrace *gnu_c_create_sym_lbrace(Pool *pool);
+GnuCSymLbracket *gnu_c_create_sym_lbracket(Pool *pool);
+GnuCSymLe *gnu_c_create_sym_le(Pool *pool);
+GnuCSymLogicalAnd *gnu_c_create_sym_logical_and(Pool *pool);
+GnuCSymLogicalOr *gnu_c_create_sym_logical_or(Pool *pool);
+GnuCSymLparen *gnu_c_create_sym_lparen(Pool *pool);
+GnuCSymLshift *gnu_c_create_sym_lshift(Pool *pool);
+GnuCSymLshiftAssign *gnu_c_create_sym_lshift_assign(Pool *pool);
+GnuCSymLt *gnu_c_create_sym_lt(Pool *pool);
+GnuCSymMinus *gnu_c_create_sym_minus(Pool *pool);
+GnuCSymMinusAssign *gnu_c_create_sym_minus_assign(Pool *pool);
+GnuCSymNe *gnu_c_create_sym_ne(Pool *pool);
+GnuCSymPercent *gnu_c_create_sym_percent(Pool *pool);
+GnuCSymPercentAssign *gnu_c_create_sym_percent_assign(Pool *pool);
+GnuCSymPipe *gnu_c_create_sym_pipe(Pool *pool);
+GnuCSymPipeAssign *gnu_c_create_sym_pipe_assign(Pool *pool);
+GnuCSymPlus *gnu_c_create_sym_plus(Pool *pool);
+GnuCSymPlusAssign *gnu_c_create_sym_plus_assign(Pool *pool);
+GnuCSymQuery *gnu_c_create_sym_query(Pool *pool);
+GnuCSymRbrace *gnu_c_create_sym_rbrace(Pool *pool);
+GnuCSymRbracket *gnu_c_create_sym_rbracket(Pool *pool);
+GnuCSymRparen *gnu_c_create_sym_rparen(Pool *pool);
+GnuCSymRshift *gnu_c_create_sym_rshift(Pool *pool);
+GnuCSymRshiftAssign *gnu_c_create_sym_rshift_assign(Pool *pool);
+GnuCSymSemicolon *gnu_c_create_sym_semicolon(Pool *pool);
+GnuCSymSlash *gnu_c_create_sym_slash(Pool *pool);
+GnuCSymSlashAssign *gnu_c_create_sym_slash_assign(Pool *pool);
+GnuCSymStar *gnu_c_create_sym_star(Pool *pool);
+GnuCSymStarAssign *gnu_c_create_sym_star_assign(Pool *pool);
+GnuCSymTilde *gnu_c_create_sym_tilde(Pool *pool);
+GnuCTreeAsmDefinition *gnu_c_create_tree_asm_definition(Pool *pool, GnuCTreeSimpleAsmExpr *tree_simple_asm_expr, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeAsmGotoArgument *gnu_c_create_tree_asm_goto_argument(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymColon *sym_colon1, GnuCSymColon *sym_colon2, GnuCOptAsmOperands *opt_asm_operands, GnuCSymColon *sym_colon3, GnuCOptAsmClobbers *opt_asm_clobbers, GnuCSymColon *sym_colon4, GnuCAnyAsmGotoOperands *any_asm_goto_operands);
+GnuCTreeAtomicTypeSpecifier *gnu_c_create_tree_atomic_type_specifier(Pool *pool, GnuCKwAtomicAsSpecifier *kw_atomic_as_specifier, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen);
+GnuCTreeAttribute *gnu_c_create_tree_attribute(Pool *pool, GnuCKwAttribute *kw_attribute, GnuCSymLparen *sym_lparen1, GnuCSymLparen *sym_lparen2, GnuCOptAttributeList *opt_attribute_list, GnuCSymRparen *sym_rparen1, GnuCSymRparen *sym_rparen2);
+GnuCTreeAttributes *gnu_c_create_tree_attributes(Pool *pool, GnuCOptAttributes *opt_attributes, GnuCTreeAttribute *tree_attribute);
+GnuCTreeBlockItemList *gnu_c_create_tree_block_item_list(Pool *pool, GnuCOptBlockItemList *opt_block_item_list, GnuCAnyBlockItem *any_block_item);
+GnuCTreeCompoundStatement *gnu_c_create_tree_compound_statement(Pool *pool, GnuCSymLbrace *sym_lbrace, GnuCOptLabelDeclarations *opt_label_declarations, GnuCOptBlockItemList *opt_block_item_list, GnuCSymRbrace *sym_rbrace);
+GnuCTreeCondition *gnu_c_create_tree_condition(Pool *pool, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen);
+GnuCTreeDeclaration *gnu_c_create_tree_declaration(Pool *pool, GnuCAnyDeclarationSpecifiers *any_declaration_specifiers, GnuCOptInitDeclaratorList *opt_init_declarator_list, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeDeclarationList *gnu_c_create_tree_declaration_list(Pool *pool, GnuCOptDeclarationList *opt_declaration_list, GnuCTreeDeclaration *tree_declaration);
+GnuCTreeDeclarator *gnu_c_create_tree_declarator(Pool *pool, GnuCOptPointer *opt_pointer, GnuCAnyDirectDeclarator *any_direct_declarator);
+GnuCTreeDesignatedInitializer *gnu_c_create_tree_designated_initializer(Pool *pool, GnuCOptDesignation *opt_designation, GnuCAnyInitializer *any_initializer);
+GnuCTreeDesignatorList *gnu_c_create_tree_designator_list(Pool *pool, GnuCOptDesignatorList *opt_designator_list, GnuCAnyDesignator *any_designator);
+GnuCTreeDoStatement *gnu_c_create_tree_do_statement(Pool *pool, GnuCKwDo *kw_do, GnuCTreeStatement *tree_statement, GnuCKwWhile *kw_while, GnuCTreeCondition *tree_condition, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeExpressionStatement *gnu_c_create_tree_expression_statement(Pool *pool, GnuCOptExprList *opt_expr_list, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeExternalDeclarations *gnu_c_create_tree_external_declarations(Pool *pool, GnuCOptExternalDeclarations *opt_external_declarations, GnuCAnyExternalDeclaration *any_external_declaration);
+GnuCTreeGenericSelection *gnu_c_create_tree_generic_selection(Pool *pool, GnuCKwGeneric *kw_generic, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression, GnuCSymComma *sym_comma, GnuCAnyGenericAssocList *any_generic_assoc_list, GnuCSymRparen *sym_rparen);
+GnuCTreeHeadDeclarationSpecifiers *gnu_c_create_tree_head_declaration_specifiers(Pool *pool, GnuCOptHeadDeclarationSpecifiers *opt_head_declaration_specifiers, GnuCAnyHeadDeclarationSpecifier *any_head_declaration_specifier, GnuCOptAttributes *opt_attributes);
+GnuCTreeIfElseStatement *gnu_c_create_tree_if_else_statement(Pool *pool, GnuCKwIf *kw_if, GnuCTreeCondition *tree_condition, GnuCTreeStatementExceptIf *tree_statement_except_if, GnuCKwElse *kw_else, GnuCTreeStatement *tree_statement);
+GnuCTreeIfElseStatementExceptIf *gnu_c_create_tree_if_else_statement_except_if(Pool *pool, GnuCKwIf *kw_if, GnuCTreeCondition *tree_condition, GnuCTreeStatementExceptIf *tree_statement_except_if1, GnuCKwElse *kw_else, GnuCTreeStatementExceptIf *tree_statement_except_if2);
+GnuCTreeIfStatement *gnu_c_create_tree_if_statement(Pool *pool, GnuCKwIf *kw_if, GnuCTreeCondition *tree_condition, GnuCTreeStatement *tree_statement);
+GnuCTreeLabelDeclaration *gnu_c_create_tree_label_declaration(Pool *pool, GnuCKwLabel *kw_label, GnuCAnyIdentifierList *any_identifier_list, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeLabelDeclarations *gnu_c_create_tree_label_declarations(Pool *pool, GnuCOptLabelDeclarations *opt_label_declarations, GnuCTreeLabelDeclaration *tree_label_declaration);
+GnuCTreeLabels *gnu_c_create_tree_labels(Pool *pool, GnuCOptLabels *opt_labels, GnuCAnyLabel *any_label);
+GnuCTreeNestedFunctionDefinition *gnu_c_create_tree_nested_function_definition(Pool *pool, GnuCAnyDeclarationSpecifiers *any_declaration_specifiers, GnuCTreeDeclarator *tree_declarator, GnuCOptDeclarationList *opt_declaration_list, GnuCTreeCompoundStatement *tree_compound_statement);
+GnuCTreeParameterForwardDeclaration *gnu_c_create_tree_parameter_forward_declaration(Pool *pool, GnuCAnyParameterList *any_parameter_list, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeParameterForwardDeclarations *gnu_c_create_tree_parameter_forward_declarations(Pool *pool, GnuCOptParameterForwardDeclarations *opt_parameter_forward_declarations, GnuCTreeParameterForwardDeclaration *tree_parameter_forward_declaration);
+GnuCTreePointer *gnu_c_create_tree_pointer(Pool *pool, GnuCSymStar *sym_star, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCOptPointer *opt_pointer);
+GnuCTreeSimpleAsmExpr *gnu_c_create_tree_simple_asm_expr(Pool *pool, GnuCKwAsm *kw_asm, GnuCSymLparen *sym_lparen, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymRparen *sym_rparen);
+GnuCTreeStatement *gnu_c_create_tree_statement(Pool *pool, GnuCOptLabels *opt_labels, GnuCAnyUnlabeledStatement *any_unlabeled_statement);
+GnuCTreeStatementExceptIf *gnu_c_create_tree_statement_except_if(Pool *pool, GnuCOptLabels *opt_labels, GnuCAnyUnlabeledStatementExceptIf *any_unlabeled_statement_except_if);
+GnuCTreeStaticAssertDeclaration *gnu_c_create_tree_static_assert_declaration(Pool *pool, GnuCKwStaticAssert *kw_static_assert, GnuCSymLparen *sym_lparen, GnuCAliasConstantExpression *alias_constant_expression, GnuCSymComma *sym_comma, GnuCAtomStringLiteral *atom_string_literal, GnuCSymRparen *sym_rparen, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeStructDeclarationList *gnu_c_create_tree_struct_declaration_list(Pool *pool, GnuCOptStructDeclarationList *opt_struct_declaration_list, GnuCAnyStructDeclaration *any_struct_declaration);
+GnuCTreeSwitchStatement *gnu_c_create_tree_switch_statement(Pool *pool, GnuCKwSwitch *kw_switch, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen, GnuCTreeStatement *tree_statement);
+GnuCTreeSwitchStatementExceptIf *gnu_c_create_tree_switch_statement_except_if(Pool *pool, GnuCKwSwitch *kw_switch, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen, GnuCTreeStatementExceptIf *tree_statement_except_if);
+GnuCTreeTagAbstractParameterDeclaration *gnu_c_create_tree_tag_abstract_parameter_declaration(Pool *pool, GnuCAnyDeclarationSpecifiers *any_declaration_specifiers, GnuCOptAbstractDeclarator *opt_abstract_declarator);
+GnuCTreeTagActualCastExpression *gnu_c_create_tree_tag_actual_cast_expression(Pool *pool, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagAddressofExpression *gnu_c_create_tree_tag_addressof_expression(Pool *pool, GnuCSymAmpersand *sym_ampersand, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagAlignasExprSpecifier *gnu_c_create_tree_tag_alignas_expr_specifier(Pool *pool, GnuCKwAlignas *kw_alignas, GnuCSymLparen *sym_lparen, GnuCAliasConstantExpression *alias_constant_expression, GnuCSymRparen *sym_rparen);
+GnuCTreeTagAlignasTypeSpecifier *gnu_c_create_tree_tag_alignas_type_specifier(Pool *pool, GnuCKwAlignas *kw_alignas, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen);
+GnuCTreeTagAlignofExpressionExpression *gnu_c_create_tree_tag_alignof_expression_expression(Pool *pool, GnuCKwAlignof *kw_alignof, GnuCAnyNoCastExpression *any_no_cast_expression);
+GnuCTreeTagAlignofTypeExpression *gnu_c_create_tree_tag_alignof_type_expression(Pool *pool, GnuCKwAlignof *kw_alignof, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen);
+GnuCTreeTagAnonymousAsmOperand *gnu_c_create_tree_tag_anonymous_asm_operand(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagArrayDirectAbstractDeclarator *gnu_c_create_tree_tag_array_direct_abstract_declarator(Pool *pool, GnuCOptDirectAbstractDeclarator *opt_direct_abstract_declarator, GnuCAnyArrayDeclarator *any_array_declarator);
+GnuCTreeTagArrayDirectDeclarator *gnu_c_create_tree_tag_array_direct_declarator(Pool *pool, GnuCAnyDirectDeclarator *any_direct_declarator, GnuCAnyArrayDeclarator *any_array_declarator);
+GnuCTreeTagArrayElementDesignator *gnu_c_create_tree_tag_array_element_designator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCAliasConstantExpression *alias_constant_expression, GnuCSymRbracket *sym_rbracket);
+GnuCTreeTagArrayMemberOffsetDesignator *gnu_c_create_tree_tag_array_member_offset_designator(Pool *pool, GnuCAnyOffsetofMemberDesignator *any_offsetof_member_designator, GnuCSymLbracket *sym_lbracket, GnuCAnyExprList *any_expr_list, GnuCSymRbracket *sym_rbracket);
+GnuCTreeTagArrayRangeDesignator *gnu_c_create_tree_tag_array_range_designator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCAliasConstantExpression *alias_constant_expression1, GnuCSymEllipsis *sym_ellipsis, GnuCAliasConstantExpression *alias_constant_expression2, GnuCSymRbracket *sym_rbracket);
+GnuCTreeTagAsmArgumentOut *gnu_c_create_tree_tag_asm_argument_out(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymColon *sym_colon, GnuCOptAsmOperands *opt_asm_operands);
+GnuCTreeTagAsmArgumentOutIn *gnu_c_create_tree_tag_asm_argument_out_in(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymColon *sym_colon1, GnuCOptAsmOperands *opt_asm_operands1, GnuCSymColon *sym_colon2, GnuCOptAsmOperands *opt_asm_operands2);
+GnuCTreeTagAsmArgumentOutInClobber *gnu_c_create_tree_tag_asm_argument_out_in_clobber(Pool *pool, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymColon *sym_colon1, GnuCOptAsmOperands *opt_asm_operands1, GnuCSymColon *sym_colon2, GnuCOptAsmOperands *opt_asm_operands2, GnuCSymColon *sym_colon3, GnuCOptAsmClobbers *opt_asm_clobbers);
+GnuCTreeTagAsmCommonStatement *gnu_c_create_tree_tag_asm_common_statement(Pool *pool, GnuCKwAsm *kw_asm, GnuCOptTypeQualifier *opt_type_qualifier, GnuCSymLparen *sym_lparen, GnuCAnyAsmArgument *any_asm_argument, GnuCSymRparen *sym_rparen, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagAsmGotoStatement *gnu_c_create_tree_tag_asm_goto_statement(Pool *pool, GnuCKwAsm *kw_asm, GnuCOptTypeQualifier *opt_type_qualifier, GnuCKwGoto *kw_goto, GnuCSymLparen *sym_lparen, GnuCTreeAsmGotoArgument *tree_asm_goto_argument, GnuCSymRparen *sym_rparen, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagAttribWithArg *gnu_c_create_tree_tag_attrib_with_arg(Pool *pool, GnuCAnyAnyWord *any_any_word, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagBitAndAssignmentExpression *gnu_c_create_tree_tag_bit_and_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymAmpersandAssign *sym_ampersand_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagBitAndExpression *gnu_c_create_tree_tag_bit_and_expression(Pool *pool, GnuCAnyAndExpression *any_and_expression, GnuCSymAmpersand *sym_ampersand, GnuCAnyEqualityExpression *any_equality_expression);
+GnuCTreeTagBitIorAssignmentExpression *gnu_c_create_tree_tag_bit_ior_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymPipeAssign *sym_pipe_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagBitIorExpression *gnu_c_create_tree_tag_bit_ior_expression(Pool *pool, GnuCAnyInclusiveOrExpression *any_inclusive_or_expression, GnuCSymPipe *sym_pipe, GnuCAnyExclusiveOrExpression *any_exclusive_or_expression);
+GnuCTreeTagBitNotExpression *gnu_c_create_tree_tag_bit_not_expression(Pool *pool, GnuCSymTilde *sym_tilde, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagBitXorAssignmentExpression *gnu_c_create_tree_tag_bit_xor_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymCaretAssign *sym_caret_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagBitXorExpression *gnu_c_create_tree_tag_bit_xor_expression(Pool *pool, GnuCAnyExclusiveOrExpression *any_exclusive_or_expression, GnuCSymCaret *sym_caret, GnuCAnyAndExpression *any_and_expression);
+GnuCTreeTagBitfieldDeclarator *gnu_c_create_tree_tag_bitfield_declarator(Pool *pool, GnuCOptDeclarator *opt_declarator, GnuCSymColon *sym_colon, GnuCAliasConstantExpression *alias_constant_expression, GnuCOptAttributes *opt_attributes);
+GnuCTreeTagBracedInitializer *gnu_c_create_tree_tag_braced_initializer(Pool *pool, GnuCSymLbrace *sym_lbrace, GnuCOptInitializerList *opt_initializer_list, GnuCSymRbrace *sym_rbrace);
+GnuCTreeTagBracedInitializerComma *gnu_c_create_tree_tag_braced_initializer_comma(Pool *pool, GnuCSymLbrace *sym_lbrace, GnuCAnyInitializerList *any_initializer_list, GnuCSymComma *sym_comma, GnuCSymRbrace *sym_rbrace);
+GnuCTreeTagBreakStatement *gnu_c_create_tree_tag_break_statement(Pool *pool, GnuCKwBreak *kw_break, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagBuiltinChooseExprExpression *gnu_c_create_tree_tag_builtin_choose_expr_expression(Pool *pool, GnuCKwBuiltinChooseExpr *kw_builtin_choose_expr, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression1, GnuCSymComma *sym_comma1, GnuCAnyAssignmentExpression *any_assignment_expression2, GnuCSymComma *sym_comma2, GnuCAnyAssignmentExpression *any_assignment_expression3, GnuCSymRparen *sym_rparen);
+GnuCTreeTagBuiltinComplexExpression *gnu_c_create_tree_tag_builtin_complex_expression(Pool *pool, GnuCKwBuiltinComplex *kw_builtin_complex, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression1, GnuCSymComma *sym_comma, GnuCAnyAssignmentExpression *any_assignment_expression2, GnuCSymRparen *sym_rparen);
+GnuCTreeTagBuiltinMixShuffleExpression *gnu_c_create_tree_tag_builtin_mix_shuffle_expression(Pool *pool, GnuCKwBuiltinShuffle *kw_builtin_shuffle, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression1, GnuCSymComma *sym_comma1, GnuCAnyAssignmentExpression *any_assignment_expression2, GnuCSymComma *sym_comma2, GnuCAnyAssignmentExpression *any_assignment_expression3, GnuCSymRparen *sym_rparen);
+GnuCTreeTagBuiltinOffsetofExpression *gnu_c_create_tree_tag_builtin_offsetof_expression(Pool *pool, GnuCKwBuiltinOffsetof *kw_builtin_offsetof, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymComma *sym_comma, GnuCAnyOffsetofMemberDesignator *any_offsetof_member_designator, GnuCSymRparen *sym_rparen);
+GnuCTreeTagBuiltinSimpleShuffleExpression *gnu_c_create_tree_tag_builtin_simple_shuffle_expression(Pool *pool, GnuCKwBuiltinShuffle *kw_builtin_shuffle, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression1, GnuCSymComma *sym_comma, GnuCAnyAssignmentExpression *any_assignment_expression2, GnuCSymRparen *sym_rparen);
+GnuCTreeTagBuiltinTypesCompatiblePExpression *gnu_c_create_tree_tag_builtin_types_compatible_p_expression(Pool *pool, GnuCKwBuiltinTypesCompatibleP *kw_builtin_types_compatible_p, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name1, GnuCSymComma *sym_comma, GnuCTreeTypeName *tree_type_name2, GnuCSymRparen *sym_rparen);
+GnuCTreeTagBuiltinVaArgExpression *gnu_c_create_tree_tag_builtin_va_arg_expression(Pool *pool, GnuCKwBuiltinVaArg *kw_builtin_va_arg, GnuCSymLparen *sym_lparen, GnuCAnyAssignmentExpression *any_assignment_expression, GnuCSymComma *sym_comma, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen);
+GnuCTreeTagC99_Designation *gnu_c_create_tree_tag_c99_designation(Pool *pool, GnuCTreeDesignatorList *tree_designator_list, GnuCSymAssign *sym_assign);
+GnuCTreeTagCallExpression *gnu_c_create_tree_tag_call_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymLparen *sym_lparen, GnuCOptExprList *opt_expr_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagCaseLabel *gnu_c_create_tree_tag_case_label(Pool *pool, GnuCKwCase *kw_case, GnuCAliasConstantExpression *alias_constant_expression, GnuCSymColon *sym_colon);
+GnuCTreeTagCaseRangeLabel *gnu_c_create_tree_tag_case_range_label(Pool *pool, GnuCKwCase *kw_case, GnuCAliasConstantExpression *alias_constant_expression1, GnuCSymEllipsis *sym_ellipsis, GnuCAliasConstantExpression *alias_constant_expression2, GnuCSymColon *sym_colon);
+GnuCTreeTagCompoundLiteral *gnu_c_create_tree_tag_compound_literal(Pool *pool, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen, GnuCSymLbrace *sym_lbrace, GnuCOptInitializerList *opt_initializer_list, GnuCSymRbrace *sym_rbrace);
+GnuCTreeTagCompoundLiteralComma *gnu_c_create_tree_tag_compound_literal_comma(Pool *pool, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen, GnuCSymLbrace *sym_lbrace, GnuCAnyInitializerList *any_initializer_list, GnuCSymComma *sym_comma, GnuCSymRbrace *sym_rbrace);
+GnuCTreeTagComputedGotoStatement *gnu_c_create_tree_tag_computed_goto_statement(Pool *pool, GnuCKwGoto *kw_goto, GnuCSymStar *sym_star, GnuCAnyExprList *any_expr_list, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagConcreteParameterDeclaration *gnu_c_create_tree_tag_concrete_parameter_declaration(Pool *pool, GnuCAnyDeclarationSpecifiers *any_declaration_specifiers, GnuCTreeDeclarator *tree_declarator);
+GnuCTreeTagContinueStatement *gnu_c_create_tree_tag_continue_statement(Pool *pool, GnuCKwContinue *kw_continue, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagDefaultGenericAssociation *gnu_c_create_tree_tag_default_generic_association(Pool *pool, GnuCKwDefault *kw_default, GnuCSymColon *sym_colon, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagDefaultLabel *gnu_c_create_tree_tag_default_label(Pool *pool, GnuCKwDefault *kw_default, GnuCSymColon *sym_colon);
+GnuCTreeTagDerefExpression *gnu_c_create_tree_tag_deref_expression(Pool *pool, GnuCSymStar *sym_star, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagDirectMemberExpression *gnu_c_create_tree_tag_direct_member_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymDot *sym_dot, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagDivideAssignmentExpression *gnu_c_create_tree_tag_divide_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymSlashAssign *sym_slash_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagDivideExpression *gnu_c_create_tree_tag_divide_expression(Pool *pool, GnuCAnyMultiplicativeExpression *any_multiplicative_expression, GnuCSymSlash *sym_slash, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagEqExpression *gnu_c_create_tree_tag_eq_expression(Pool *pool, GnuCAnyEqualityExpression *any_equality_expression, GnuCSymEq *sym_eq, GnuCAnyRelationalExpression *any_relational_expression);
+GnuCTreeTagExtensionExpression *gnu_c_create_tree_tag_extension_expression(Pool *pool, GnuCKwExtension *kw_extension, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagExtensionExternalDeclaration *gnu_c_create_tree_tag_extension_external_declaration(Pool *pool, GnuCKwExtension *kw_extension, GnuCAnyExternalDeclaration *any_external_declaration);
+GnuCTreeTagExtensionNestedDeclaration *gnu_c_create_tree_tag_extension_nested_declaration(Pool *pool, GnuCKwExtension *kw_extension, GnuCAnyNestedDeclaration *any_nested_declaration);
+GnuCTreeTagExtensionStructDeclaration *gnu_c_create_tree_tag_extension_struct_declaration(Pool *pool, GnuCKwExtension *kw_extension, GnuCAnyStructDeclaration *any_struct_declaration);
+GnuCTreeTagForDeclStatement *gnu_c_create_tree_tag_for_decl_statement(Pool *pool, GnuCKwFor *kw_for, GnuCSymLparen *sym_lparen, GnuCAnyNestedDeclaration *any_nested_declaration, GnuCOptExprList *opt_expr_list1, GnuCSymSemicolon *sym_semicolon, GnuCOptExprList *opt_expr_list2, GnuCSymRparen *sym_rparen, GnuCTreeStatement *tree_statement);
+GnuCTreeTagForDeclStatementExceptIf *gnu_c_create_tree_tag_for_decl_statement_except_if(Pool *pool, GnuCKwFor *kw_for, GnuCSymLparen *sym_lparen, GnuCAnyNestedDeclaration *any_nested_declaration, GnuCOptExprList *opt_expr_list1, GnuCSymSemicolon *sym_semicolon, GnuCOptExprList *opt_expr_list2, GnuCSymRparen *sym_rparen, GnuCTreeStatementExceptIf *tree_statement_except_if);
+GnuCTreeTagForExprStatement *gnu_c_create_tree_tag_for_expr_statement(Pool *pool, GnuCKwFor *kw_for, GnuCSymLparen *sym_lparen, GnuCOptExprList *opt_expr_list1, GnuCSymSemicolon *sym_semicolon1, GnuCOptExprList *opt_expr_list2, GnuCSymSemicolon *sym_semicolon2, GnuCOptExprList *opt_expr_list3, GnuCSymRparen *sym_rparen, GnuCTreeStatement *tree_statement);
+GnuCTreeTagForExprStatementExceptIf *gnu_c_create_tree_tag_for_expr_statement_except_if(Pool *pool, GnuCKwFor *kw_for, GnuCSymLparen *sym_lparen, GnuCOptExprList *opt_expr_list1, GnuCSymSemicolon *sym_semicolon1, GnuCOptExprList *opt_expr_list2, GnuCSymSemicolon *sym_semicolon2, GnuCOptExprList *opt_expr_list3, GnuCSymRparen *sym_rparen, GnuCTreeStatementExceptIf *tree_statement_except_if);
+GnuCTreeTagForwardEnumSpecifier *gnu_c_create_tree_tag_forward_enum_specifier(Pool *pool, GnuCKwEnum *kw_enum, GnuCOptAttributes *opt_attributes, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagForwardParamFunDirectAbstractDeclarator *gnu_c_create_tree_tag_forward_param_fun_direct_abstract_declarator(Pool *pool, GnuCOptDirectAbstractDeclarator *opt_direct_abstract_declarator, GnuCSymLparen *sym_lparen, GnuCTreeParameterForwardDeclarations *tree_parameter_forward_declarations, GnuCOptParameterTypeList *opt_parameter_type_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagForwardParamFunDirectDeclarator *gnu_c_create_tree_tag_forward_param_fun_direct_declarator(Pool *pool, GnuCAnyDirectDeclarator *any_direct_declarator, GnuCSymLparen *sym_lparen, GnuCTreeParameterForwardDeclarations *tree_parameter_forward_declarations, GnuCOptParameterTypeList *opt_parameter_type_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagForwardStructOrUnionSpecifier *gnu_c_create_tree_tag_forward_struct_or_union_specifier(Pool *pool, GnuCAnyStructOrUnion *any_struct_or_union, GnuCOptAttributes *opt_attributes, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagFullEnumSpecifier *gnu_c_create_tree_tag_full_enum_specifier(Pool *pool, GnuCKwEnum *kw_enum, GnuCOptAttributes *opt_attributes, GnuCOptIdentifier *opt_identifier, GnuCSymLbrace *sym_lbrace, GnuCAnyEnumeratorList *any_enumerator_list, GnuCOptComma *opt_comma, GnuCSymRbrace *sym_rbrace);
+GnuCTreeTagFullStructOrUnionSpecifier *gnu_c_create_tree_tag_full_struct_or_union_specifier(Pool *pool, GnuCAnyStructOrUnion *any_struct_or_union, GnuCOptAttributes *opt_attributes, GnuCOptIdentifier *opt_identifier, GnuCSymLbrace *sym_lbrace, GnuCOptStructDeclarationList *opt_struct_declaration_list, GnuCSymRbrace *sym_rbrace);
+GnuCTreeTagFunDirectAbstractDeclarator *gnu_c_create_tree_tag_fun_direct_abstract_declarator(Pool *pool, GnuCOptDirectAbstractDeclarator *opt_direct_abstract_declarator, GnuCSymLparen *sym_lparen, GnuCOptParameterTypeList *opt_parameter_type_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagFunDirectDeclarator *gnu_c_create_tree_tag_fun_direct_declarator(Pool *pool, GnuCAnyDirectDeclarator *any_direct_declarator, GnuCSymLparen *sym_lparen, GnuCAnyParameterTypeList *any_parameter_type_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagGeExpression *gnu_c_create_tree_tag_ge_expression(Pool *pool, GnuCAnyRelationalExpression *any_relational_expression, GnuCSymGe *sym_ge, GnuCAnyShiftExpression *any_shift_expression);
+GnuCTreeTagGnuDesignation *gnu_c_create_tree_tag_gnu_designation(Pool *pool, GnuCAtomIdentifier *atom_identifier, GnuCSymColon *sym_colon);
+GnuCTreeTagGnuStatementExpression *gnu_c_create_tree_tag_gnu_statement_expression(Pool *pool, GnuCSymLparen *sym_lparen, GnuCTreeCompoundStatement *tree_compound_statement, GnuCSymRparen *sym_rparen);
+GnuCTreeTagGotoStatement *gnu_c_create_tree_tag_goto_statement(Pool *pool, GnuCKwGoto *kw_goto, GnuCAtomIdentifier *atom_identifier, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagGtExpression *gnu_c_create_tree_tag_gt_expression(Pool *pool, GnuCAnyRelationalExpression *any_relational_expression, GnuCSymGt *sym_gt, GnuCAnyShiftExpression *any_shift_expression);
+GnuCTreeTagHeadTailDeclarationSpecifiers *gnu_c_create_tree_tag_head_tail_declaration_specifiers(Pool *pool, GnuCOptAttributes *opt_attributes, GnuCOptHeadDeclarationSpecifiers *opt_head_declaration_specifiers, GnuCTreeTailDeclarationSpecifiers *tree_tail_declaration_specifiers);
+GnuCTreeTagImagExpression *gnu_c_create_tree_tag_imag_expression(Pool *pool, GnuCKwImag *kw_imag, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagImplicitIntDeclaration *gnu_c_create_tree_tag_implicit_int_declaration(Pool *pool, GnuCAnyInitDeclaratorList *any_init_declarator_list, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagImplicitIntFunctionDefinition *gnu_c_create_tree_tag_implicit_int_function_definition(Pool *pool, GnuCTreeDeclarator *tree_declarator, GnuCOptDeclarationList *opt_declaration_list, GnuCTreeCompoundStatement *tree_compound_statement);
+GnuCTreeTagIndexExpression *gnu_c_create_tree_tag_index_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymLbracket *sym_lbracket, GnuCAnyExprList *any_expr_list, GnuCSymRbracket *sym_rbracket);
+GnuCTreeTagIndirectMemberExpression *gnu_c_create_tree_tag_indirect_member_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymArrow *sym_arrow, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagInitializedDeclarator *gnu_c_create_tree_tag_initialized_declarator(Pool *pool, GnuCTreeDeclarator *tree_declarator, GnuCOptSimpleAsmExpr *opt_simple_asm_expr, GnuCOptAttributes *opt_attributes, GnuCSymAssign *sym_assign, GnuCAnyInitializer *any_initializer);
+GnuCTreeTagInitializedEnumerator *gnu_c_create_tree_tag_initialized_enumerator(Pool *pool, GnuCAliasEnumerationConstant *alias_enumeration_constant, GnuCSymAssign *sym_assign, GnuCAliasConstantExpression *alias_constant_expression);
+GnuCTreeTagLabelAddressExpression *gnu_c_create_tree_tag_label_address_expression(Pool *pool, GnuCSymLogicalAnd *sym_logical_and, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagLeExpression *gnu_c_create_tree_tag_le_expression(Pool *pool, GnuCAnyRelationalExpression *any_relational_expression, GnuCSymLe *sym_le, GnuCAnyShiftExpression *any_shift_expression);
+GnuCTreeTagLeftShiftAssignmentExpression *gnu_c_create_tree_tag_left_shift_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymLshiftAssign *sym_lshift_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagLeftShiftExpression *gnu_c_create_tree_tag_left_shift_expression(Pool *pool, GnuCAnyShiftExpression *any_shift_expression, GnuCSymLshift *sym_lshift, GnuCAnyAdditiveExpression *any_additive_expression);
+GnuCTreeTagLegacyFunDirectDeclarator *gnu_c_create_tree_tag_legacy_fun_direct_declarator(Pool *pool, GnuCAnyDirectDeclarator *any_direct_declarator, GnuCSymLparen *sym_lparen, GnuCOptIdentifierList *opt_identifier_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagLogAndExpression *gnu_c_create_tree_tag_log_and_expression(Pool *pool, GnuCAnyLogicalAndExpression *any_logical_and_expression, GnuCSymLogicalAnd *sym_logical_and, GnuCAnyInclusiveOrExpression *any_inclusive_or_expression);
+GnuCTreeTagLogNotExpression *gnu_c_create_tree_tag_log_not_expression(Pool *pool, GnuCSymBang *sym_bang, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagLogOrExpression *gnu_c_create_tree_tag_log_or_expression(Pool *pool, GnuCAnyLogicalOrExpression *any_logical_or_expression, GnuCSymLogicalOr *sym_logical_or, GnuCAnyLogicalAndExpression *any_logical_and_expression);
+GnuCTreeTagLtExpression *gnu_c_create_tree_tag_lt_expression(Pool *pool, GnuCAnyRelationalExpression *any_relational_expression, GnuCSymLt *sym_lt, GnuCAnyShiftExpression *any_shift_expression);
+GnuCTreeTagMemberDeclaration *gnu_c_create_tree_tag_member_declaration(Pool *pool, GnuCAnySpecifierQualifierList *any_specifier_qualifier_list, GnuCOptStructDeclaratorList *opt_struct_declarator_list, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagMemberDeclarator *gnu_c_create_tree_tag_member_declarator(Pool *pool, GnuCTreeDeclarator *tree_declarator, GnuCOptAttributes *opt_attributes);
+GnuCTreeTagMemberDesignator *gnu_c_create_tree_tag_member_designator(Pool *pool, GnuCSymDot *sym_dot, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagMinusAssignmentExpression *gnu_c_create_tree_tag_minus_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymMinusAssign *sym_minus_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagMinusExpression *gnu_c_create_tree_tag_minus_expression(Pool *pool, GnuCAnyAdditiveExpression *any_additive_expression, GnuCSymMinus *sym_minus, GnuCAnyMultiplicativeExpression *any_multiplicative_expression);
+GnuCTreeTagModuloAssignmentExpression *gnu_c_create_tree_tag_modulo_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymPercentAssign *sym_percent_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagModuloExpression *gnu_c_create_tree_tag_modulo_expression(Pool *pool, GnuCAnyMultiplicativeExpression *any_multiplicative_expression, GnuCSymPercent *sym_percent, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagMultiAsmClobbers *gnu_c_create_tree_tag_multi_asm_clobbers(Pool *pool, GnuCAnyAsmClobbers *any_asm_clobbers, GnuCSymComma *sym_comma, GnuCAliasAsmStringLiteral *alias_asm_string_literal);
+GnuCTreeTagMultiAsmGotoOperands *gnu_c_create_tree_tag_multi_asm_goto_operands(Pool *pool, GnuCAnyAsmGotoOperands *any_asm_goto_operands, GnuCSymComma *sym_comma, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagMultiAsmOperands *gnu_c_create_tree_tag_multi_asm_operands(Pool *pool, GnuCAnyAsmOperands *any_asm_operands, GnuCSymComma *sym_comma, GnuCAnyAsmOperand *any_asm_operand);
+GnuCTreeTagMultiAttributeList *gnu_c_create_tree_tag_multi_attribute_list(Pool *pool, GnuCOptAttributeList *opt_attribute_list, GnuCSymComma *sym_comma, GnuCOptAttrib *opt_attrib);
+GnuCTreeTagMultiEnumeratorList *gnu_c_create_tree_tag_multi_enumerator_list(Pool *pool, GnuCAnyEnumeratorList *any_enumerator_list, GnuCSymComma *sym_comma, GnuCAnyEnumerator *any_enumerator);
+GnuCTreeTagMultiExprList *gnu_c_create_tree_tag_multi_expr_list(Pool *pool, GnuCAnyExprList *any_expr_list, GnuCSymComma *sym_comma, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagMultiGenericAssocList *gnu_c_create_tree_tag_multi_generic_assoc_list(Pool *pool, GnuCAnyGenericAssocList *any_generic_assoc_list, GnuCSymComma *sym_comma, GnuCAnyGenericAssociation *any_generic_association);
+GnuCTreeTagMultiIdentifierList *gnu_c_create_tree_tag_multi_identifier_list(Pool *pool, GnuCAnyIdentifierList *any_identifier_list, GnuCSymComma *sym_comma, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagMultiInitDeclaratorList *gnu_c_create_tree_tag_multi_init_declarator_list(Pool *pool, GnuCAnyInitDeclaratorList *any_init_declarator_list, GnuCSymComma *sym_comma, GnuCAnyInitDeclarator *any_init_declarator);
+GnuCTreeTagMultiInitializerList *gnu_c_create_tree_tag_multi_initializer_list(Pool *pool, GnuCAnyInitializerList *any_initializer_list, GnuCSymComma *sym_comma, GnuCTreeDesignatedInitializer *tree_designated_initializer);
+GnuCTreeTagMultiParameterList *gnu_c_create_tree_tag_multi_parameter_list(Pool *pool, GnuCAnyParameterList *any_parameter_list, GnuCSymComma *sym_comma, GnuCAnyParameterDeclaration *any_parameter_declaration);
+GnuCTreeTagMultiStructDeclarator *gnu_c_create_tree_tag_multi_struct_declarator(Pool *pool, GnuCAnyStructDeclaratorList *any_struct_declarator_list, GnuCSymComma *sym_comma, GnuCOptAttributes *opt_attributes, GnuCAnyStructDeclarator *any_struct_declarator);
+GnuCTreeTagNamedAsmOperand *gnu_c_create_tree_tag_named_asm_operand(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCAtomIdentifier *atom_identifier, GnuCSymRbracket *sym_rbracket, GnuCAliasAsmStringLiteral *alias_asm_string_literal, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagNamedLabel *gnu_c_create_tree_tag_named_label(Pool *pool, GnuCAtomIdentifier *atom_identifier, GnuCSymColon *sym_colon, GnuCOptAttributes *opt_attributes);
+GnuCTreeTagNamedMemberOffsetDesignator *gnu_c_create_tree_tag_named_member_offset_designator(Pool *pool, GnuCAnyOffsetofMemberDesignator *any_offsetof_member_designator, GnuCSymDot *sym_dot, GnuCAtomIdentifier *atom_identifier);
+GnuCTreeTagNeExpression *gnu_c_create_tree_tag_ne_expression(Pool *pool, GnuCAnyEqualityExpression *any_equality_expression, GnuCSymNe *sym_ne, GnuCAnyRelationalExpression *any_relational_expression);
+GnuCTreeTagOnlyHeadDeclarationSpecifiers *gnu_c_create_tree_tag_only_head_declaration_specifiers(Pool *pool, GnuCOptAttributes *opt_attributes, GnuCTreeHeadDeclarationSpecifiers *tree_head_declaration_specifiers);
+GnuCTreeTagParenDirectAbstractDeclarator *gnu_c_create_tree_tag_paren_direct_abstract_declarator(Pool *pool, GnuCSymLparen *sym_lparen, GnuCOptAttributes *opt_attributes, GnuCAnyAbstractDeclarator *any_abstract_declarator, GnuCSymRparen *sym_rparen);
+GnuCTreeTagParenDirectDeclarator *gnu_c_create_tree_tag_paren_direct_declarator(Pool *pool, GnuCSymLparen *sym_lparen, GnuCOptAttributes *opt_attributes, GnuCTreeDeclarator *tree_declarator, GnuCSymRparen *sym_rparen);
+GnuCTreeTagParenExpression *gnu_c_create_tree_tag_paren_expression(Pool *pool, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagPlusAssignmentExpression *gnu_c_create_tree_tag_plus_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymPlusAssign *sym_plus_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagPlusExpression *gnu_c_create_tree_tag_plus_expression(Pool *pool, GnuCAnyAdditiveExpression *any_additive_expression, GnuCSymPlus *sym_plus, GnuCAnyMultiplicativeExpression *any_multiplicative_expression);
+GnuCTreeTagPointerAbstractDeclarator *gnu_c_create_tree_tag_pointer_abstract_declarator(Pool *pool, GnuCTreePointer *tree_pointer, GnuCOptDirectAbstractDeclarator *opt_direct_abstract_declarator);
+GnuCTreeTagPostDecrExpression *gnu_c_create_tree_tag_post_decr_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymDecr *sym_decr);
+GnuCTreeTagPostIncrExpression *gnu_c_create_tree_tag_post_incr_expression(Pool *pool, GnuCAnyPostfixExpression *any_postfix_expression, GnuCSymIncr *sym_incr);
+GnuCTreeTagPreDecrExpression *gnu_c_create_tree_tag_pre_decr_expression(Pool *pool, GnuCSymDecr *sym_decr, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagPreIncrExpression *gnu_c_create_tree_tag_pre_incr_expression(Pool *pool, GnuCSymIncr *sym_incr, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagQListQualifier *gnu_c_create_tree_tag_q_list_qualifier(Pool *pool, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCAnyTypeQualifier *any_type_qualifier, GnuCOptAttributes *opt_attributes);
+GnuCTreeTagRealExpression *gnu_c_create_tree_tag_real_expression(Pool *pool, GnuCKwReal *kw_real, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagReturnStatement *gnu_c_create_tree_tag_return_statement(Pool *pool, GnuCKwReturn *kw_return, GnuCOptExprList *opt_expr_list, GnuCSymSemicolon *sym_semicolon);
+GnuCTreeTagReverseStaticArrayDeclarator *gnu_c_create_tree_tag_reverse_static_array_declarator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCAnyTypeQualifierList *any_type_qualifier_list, GnuCKwStatic *kw_static, GnuCAnyAssignmentExpression *any_assignment_expression, GnuCSymRbracket *sym_rbracket);
+GnuCTreeTagRightShiftAssignmentExpression *gnu_c_create_tree_tag_right_shift_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymRshiftAssign *sym_rshift_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagRightShiftExpression *gnu_c_create_tree_tag_right_shift_expression(Pool *pool, GnuCAnyShiftExpression *any_shift_expression, GnuCSymRshift *sym_rshift, GnuCAnyAdditiveExpression *any_additive_expression);
+GnuCTreeTagSimpleArrayDeclarator *gnu_c_create_tree_tag_simple_array_declarator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCOptAssignmentExpression *opt_assignment_expression, GnuCSymRbracket *sym_rbracket);
+GnuCTreeTagSimpleAssignmentExpression *gnu_c_create_tree_tag_simple_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymAssign *sym_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagSizeofExpressionExpression *gnu_c_create_tree_tag_sizeof_expression_expression(Pool *pool, GnuCKwSizeof *kw_sizeof, GnuCAnyNoCastExpression *any_no_cast_expression);
+GnuCTreeTagSizeofTypeExpression *gnu_c_create_tree_tag_sizeof_type_expression(Pool *pool, GnuCKwSizeof *kw_sizeof, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen);
+GnuCTreeTagSqListQualifier *gnu_c_create_tree_tag_sq_list_qualifier(Pool *pool, GnuCOptSpecifierQualifierList *opt_specifier_qualifier_list, GnuCAnyTypeQualifier *any_type_qualifier, GnuCOptAttributes *opt_attributes);
+GnuCTreeTagSqListSpecifier *gnu_c_create_tree_tag_sq_list_specifier(Pool *pool, GnuCOptSpecifierQualifierList *opt_specifier_qualifier_list, GnuCAnyTypeSpecifier *any_type_specifier, GnuCOptAttributes *opt_attributes);
+GnuCTreeTagStarArrayDeclarator *gnu_c_create_tree_tag_star_array_declarator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCSymStar *sym_star, GnuCSymRbracket *sym_rbracket);
+GnuCTreeTagStaticArrayDeclarator *gnu_c_create_tree_tag_static_array_declarator(Pool *pool, GnuCSymLbracket *sym_lbracket, GnuCKwStatic *kw_static, GnuCOptTypeQualifierList *opt_type_qualifier_list, GnuCAnyAssignmentExpression *any_assignment_expression, GnuCSymRbracket *sym_rbracket);
+GnuCTreeTagTernaryExpression *gnu_c_create_tree_tag_ternary_expression(Pool *pool, GnuCAnyLogicalOrExpression *any_logical_or_expression, GnuCSymQuery *sym_query, GnuCOptExprList *opt_expr_list, GnuCSymColon *sym_colon, GnuCAnyConditionalExpression *any_conditional_expression);
+GnuCTreeTagTimesAssignmentExpression *gnu_c_create_tree_tag_times_assignment_expression(Pool *pool, GnuCAnyConditionalExpression *any_conditional_expression, GnuCSymStarAssign *sym_star_assign, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagTimesExpression *gnu_c_create_tree_tag_times_expression(Pool *pool, GnuCAnyMultiplicativeExpression *any_multiplicative_expression, GnuCSymStar *sym_star, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagTypeGenericAssociation *gnu_c_create_tree_tag_type_generic_association(Pool *pool, GnuCTreeTypeName *tree_type_name, GnuCSymColon *sym_colon, GnuCAnyAssignmentExpression *any_assignment_expression);
+GnuCTreeTagTypeofExprSpecifier *gnu_c_create_tree_tag_typeof_expr_specifier(Pool *pool, GnuCKwTypeof *kw_typeof, GnuCSymLparen *sym_lparen, GnuCAnyExprList *any_expr_list, GnuCSymRparen *sym_rparen);
+GnuCTreeTagTypeofTypeSpecifier *gnu_c_create_tree_tag_typeof_type_specifier(Pool *pool, GnuCKwTypeof *kw_typeof, GnuCSymLparen *sym_lparen, GnuCTreeTypeName *tree_type_name, GnuCSymRparen *sym_rparen);
+GnuCTreeTagUnaryMinusExpression *gnu_c_create_tree_tag_unary_minus_expression(Pool *pool, GnuCSymMinus *sym_minus, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagUnaryPlusExpression *gnu_c_create_tree_tag_unary_plus_expression(Pool *pool, GnuCSymPlus *sym_plus, GnuCAnyMaybeCastExpression *any_maybe_cast_expression);
+GnuCTreeTagUninitializedDeclarator *gnu_c_create_tree_tag_uninitialized_declarator(Pool *pool, GnuCTreeDeclarator *tree_declarator, GnuCOptSimpleAsmExpr *opt_simple_asm_expr, GnuCOptAttributes *opt_attributes);
+GnuCTreeTagVariadicParameterList *gnu_c_create_tree_tag_variadic_parameter_list(Pool *pool, GnuCAnyParameterList *any_parameter_list, GnuCSymComma *sym_comma, GnuCSymEllipsis *sym_ellipsis);
+GnuCTreeTailDeclarationSpecifiers *gnu_c_create_tree_tail_declaration_specifiers(Pool *pool, GnuCOptTailDeclarationSpecifiers *opt_tail_declaration_specifiers, GnuCAnyTailDeclarationSpecifier *any_tail_declaration_specifier, GnuCOptAttributes *opt_attributes, GnuCOptHeadDeclarationSpecifiers *opt_head_declaration_specifiers);
+GnuCTreeTypeName *gnu_c_create_tree_type_name(Pool *pool, GnuCAnySpecifierQualifierList *any_specifier_qualifier_list, GnuCOptAbstractDeclarator *opt_abstract_declarator);
+GnuCTreeWhileStatement *gnu_c_create_tree_while_statement(Pool *pool, GnuCKwWhile *kw_while, GnuCTreeCondition *tree_condition, GnuCTreeStatement *tree_statement);
+GnuCTreeWhileStatementExceptIf *gnu_c_create_tree_while_statement_except_if(Pool *pool, GnuCKwWhile *kw_while, GnuCTreeCondition *tree_condition, GnuCTreeStatementExceptIf *tree_statement_except_if);
+
+/* Type checking. */
+bool gnu_c_is_nothing(GnuCAst *ast);
+bool gnu_c_is_alias_asm_string_literal(GnuCAst *ast);
+bool gnu_c_is_alias_constant_expression(GnuCAst *ast);
+bool gnu_c_is_alias_enumeration_constant(GnuCAst *ast);
+bool gnu_c_is_alias_translation_unit(GnuCAst *ast);
+bool gnu_c_is_any_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_any_additive_expression(GnuCAst *ast);
+bool gnu_c_is_any_alignment_specifier(GnuCAst *ast);
+bool gnu_c_is_any_and_expression(GnuCAst *ast);
+bool gnu_c_is_any_any_word(GnuCAst *ast);
+bool gnu_c_is_any_array_declarator(GnuCAst *ast);
+bool gnu_c_is_any_array_designator(GnuCAst *ast);
+bool gnu_c_is_any_asm_argument(GnuCAst *ast);
+bool gnu_c_is_any_asm_clobbers(GnuCAst *ast);
+bool gnu_c_is_any_asm_goto_operands(GnuCAst *ast);
+bool gnu_c_is_any_asm_operand(GnuCAst *ast);
+bool gnu_c_is_any_asm_operands(GnuCAst *ast);
+bool gnu_c_is_any_asm_statement(GnuCAst *ast);
+bool gnu_c_is_any_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_any_attrib(GnuCAst *ast);
+bool gnu_c_is_any_attribute_list(GnuCAst *ast);
+bool gnu_c_is_any_block_item(GnuCAst *ast);
+bool gnu_c_is_any_conditional_expression(GnuCAst *ast);
+bool gnu_c_is_any_constant(GnuCAst *ast);
+bool gnu_c_is_any_declaration_specifiers(GnuCAst *ast);
+bool gnu_c_is_any_designation(GnuCAst *ast);
+bool gnu_c_is_any_designator(GnuCAst *ast);
+bool gnu_c_is_any_direct_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_any_direct_declarator(GnuCAst *ast);
+bool gnu_c_is_any_enum_specifier(GnuCAst *ast);
+bool gnu_c_is_any_enumerator(GnuCAst *ast);
+bool gnu_c_is_any_enumerator_list(GnuCAst *ast);
+bool gnu_c_is_any_equality_expression(GnuCAst *ast);
+bool gnu_c_is_any_exclusive_or_expression(GnuCAst *ast);
+bool gnu_c_is_any_expr_list(GnuCAst *ast);
+bool gnu_c_is_any_external_declaration(GnuCAst *ast);
+bool gnu_c_is_any_floating_constant(GnuCAst *ast);
+bool gnu_c_is_any_for_statement(GnuCAst *ast);
+bool gnu_c_is_any_for_statement_except_if(GnuCAst *ast);
+bool gnu_c_is_any_function_definition(GnuCAst *ast);
+bool gnu_c_is_any_function_specifier(GnuCAst *ast);
+bool gnu_c_is_any_generic_assoc_list(GnuCAst *ast);
+bool gnu_c_is_any_generic_association(GnuCAst *ast);
+bool gnu_c_is_any_head_declaration_specifier(GnuCAst *ast);
+bool gnu_c_is_any_identifier_list(GnuCAst *ast);
+bool gnu_c_is_any_inclusive_or_expression(GnuCAst *ast);
+bool gnu_c_is_any_init_declarator(GnuCAst *ast);
+bool gnu_c_is_any_init_declarator_list(GnuCAst *ast);
+bool gnu_c_is_any_initializer(GnuCAst *ast);
+bool gnu_c_is_any_initializer_list(GnuCAst *ast);
+bool gnu_c_is_any_integer_constant(GnuCAst *ast);
+bool gnu_c_is_any_label(GnuCAst *ast);
+bool gnu_c_is_any_logical_and_expression(GnuCAst *ast);
+bool gnu_c_is_any_logical_or_expression(GnuCAst *ast);
+bool gnu_c_is_any_maybe_cast_expression(GnuCAst *ast);
+bool gnu_c_is_any_multiplicative_expression(GnuCAst *ast);
+bool gnu_c_is_any_nested_declaration(GnuCAst *ast);
+bool gnu_c_is_any_no_cast_expression(GnuCAst *ast);
+bool gnu_c_is_any_offsetof_member_designator(GnuCAst *ast);
+bool gnu_c_is_any_parameter_declaration(GnuCAst *ast);
+bool gnu_c_is_any_parameter_list(GnuCAst *ast);
+bool gnu_c_is_any_parameter_type_list(GnuCAst *ast);
+bool gnu_c_is_any_postfix_expression(GnuCAst *ast);
+bool gnu_c_is_any_primary_expression(GnuCAst *ast);
+bool gnu_c_is_any_relational_expression(GnuCAst *ast);
+bool gnu_c_is_any_shift_expression(GnuCAst *ast);
+bool gnu_c_is_any_specifier_qualifier_list(GnuCAst *ast);
+bool gnu_c_is_any_storage_class_specifier(GnuCAst *ast);
+bool gnu_c_is_any_struct_declaration(GnuCAst *ast);
+bool gnu_c_is_any_struct_declarator(GnuCAst *ast);
+bool gnu_c_is_any_struct_declarator_list(GnuCAst *ast);
+bool gnu_c_is_any_struct_or_union(GnuCAst *ast);
+bool gnu_c_is_any_struct_or_union_specifier(GnuCAst *ast);
+bool gnu_c_is_any_tail_declaration_specifier(GnuCAst *ast);
+bool gnu_c_is_any_type_qualifier(GnuCAst *ast);
+bool gnu_c_is_any_type_qualifier_list(GnuCAst *ast);
+bool gnu_c_is_any_type_specifier(GnuCAst *ast);
+bool gnu_c_is_any_typeof_specifier(GnuCAst *ast);
+bool gnu_c_is_any_unambiguous_statement(GnuCAst *ast);
+bool gnu_c_is_any_unlabeled_statement(GnuCAst *ast);
+bool gnu_c_is_any_unlabeled_statement_except_if(GnuCAst *ast);
+bool gnu_c_is_atom_address_space(GnuCAst *ast);
+bool gnu_c_is_atom_binary_constant(GnuCAst *ast);
+bool gnu_c_is_atom_character_constant(GnuCAst *ast);
+bool gnu_c_is_atom_comment(GnuCAst *ast);
+bool gnu_c_is_atom_decimal_constant(GnuCAst *ast);
+bool gnu_c_is_atom_decimal_floating_constant(GnuCAst *ast);
+bool gnu_c_is_atom_hexadecimal_constant(GnuCAst *ast);
+bool gnu_c_is_atom_hexadecimal_floating_constant(GnuCAst *ast);
+bool gnu_c_is_atom_identifier(GnuCAst *ast);
+bool gnu_c_is_atom_octal_constant(GnuCAst *ast);
+bool gnu_c_is_atom_string_literal(GnuCAst *ast);
+bool gnu_c_is_atom_typedef_name(GnuCAst *ast);
+bool gnu_c_is_kw_accum(GnuCAst *ast);
+bool gnu_c_is_kw_alignas(GnuCAst *ast);
+bool gnu_c_is_kw_alignof(GnuCAst *ast);
+bool gnu_c_is_kw_asm(GnuCAst *ast);
+bool gnu_c_is_kw_atomic_as_qualifier(GnuCAst *ast);
+bool gnu_c_is_kw_atomic_as_specifier(GnuCAst *ast);
+bool gnu_c_is_kw_attribute(GnuCAst *ast);
+bool gnu_c_is_kw_auto(GnuCAst *ast);
+bool gnu_c_is_kw_auto_type(GnuCAst *ast);
+bool gnu_c_is_kw_bool(GnuCAst *ast);
+bool gnu_c_is_kw_break(GnuCAst *ast);
+bool gnu_c_is_kw_builtin_choose_expr(GnuCAst *ast);
+bool gnu_c_is_kw_builtin_complex(GnuCAst *ast);
+bool gnu_c_is_kw_builtin_offsetof(GnuCAst *ast);
+bool gnu_c_is_kw_builtin_shuffle(GnuCAst *ast);
+bool gnu_c_is_kw_builtin_types_compatible_p(GnuCAst *ast);
+bool gnu_c_is_kw_builtin_va_arg(GnuCAst *ast);
+bool gnu_c_is_kw_case(GnuCAst *ast);
+bool gnu_c_is_kw_char(GnuCAst *ast);
+bool gnu_c_is_kw_complex(GnuCAst *ast);
+bool gnu_c_is_kw_const(GnuCAst *ast);
+bool gnu_c_is_kw_continue(GnuCAst *ast);
+bool gnu_c_is_kw_decimal128(GnuCAst *ast);
+bool gnu_c_is_kw_decimal32(GnuCAst *ast);
+bool gnu_c_is_kw_decimal64(GnuCAst *ast);
+bool gnu_c_is_kw_default(GnuCAst *ast);
+bool gnu_c_is_kw_do(GnuCAst *ast);
+bool gnu_c_is_kw_double(GnuCAst *ast);
+bool gnu_c_is_kw_else(GnuCAst *ast);
+bool gnu_c_is_kw_enum(GnuCAst *ast);
+bool gnu_c_is_kw_extension(GnuCAst *ast);
+bool gnu_c_is_kw_extern(GnuCAst *ast);
+bool gnu_c_is_kw_float(GnuCAst *ast);
+bool gnu_c_is_kw_for(GnuCAst *ast);
+bool gnu_c_is_kw_fract(GnuCAst *ast);
+bool gnu_c_is_kw_func(GnuCAst *ast);
+bool gnu_c_is_kw_function(GnuCAst *ast);
+bool gnu_c_is_kw_generic(GnuCAst *ast);
+bool gnu_c_is_kw_goto(GnuCAst *ast);
+bool gnu_c_is_kw_if(GnuCAst *ast);
+bool gnu_c_is_kw_imag(GnuCAst *ast);
+bool gnu_c_is_kw_inline(GnuCAst *ast);
+bool gnu_c_is_kw_int(GnuCAst *ast);
+bool gnu_c_is_kw_label(GnuCAst *ast);
+bool gnu_c_is_kw_long(GnuCAst *ast);
+bool gnu_c_is_kw_noreturn(GnuCAst *ast);
+bool gnu_c_is_kw_pretty_function(GnuCAst *ast);
+bool gnu_c_is_kw_real(GnuCAst *ast);
+bool gnu_c_is_kw_register(GnuCAst *ast);
+bool gnu_c_is_kw_restrict(GnuCAst *ast);
+bool gnu_c_is_kw_return(GnuCAst *ast);
+bool gnu_c_is_kw_sat(GnuCAst *ast);
+bool gnu_c_is_kw_short(GnuCAst *ast);
+bool gnu_c_is_kw_signed(GnuCAst *ast);
+bool gnu_c_is_kw_sizeof(GnuCAst *ast);
+bool gnu_c_is_kw_static(GnuCAst *ast);
+bool gnu_c_is_kw_static_assert(GnuCAst *ast);
+bool gnu_c_is_kw_struct(GnuCAst *ast);
+bool gnu_c_is_kw_switch(GnuCAst *ast);
+bool gnu_c_is_kw_thread(GnuCAst *ast);
+bool gnu_c_is_kw_thread_local(GnuCAst *ast);
+bool gnu_c_is_kw_typedef(GnuCAst *ast);
+bool gnu_c_is_kw_typeof(GnuCAst *ast);
+bool gnu_c_is_kw_union(GnuCAst *ast);
+bool gnu_c_is_kw_unsigned(GnuCAst *ast);
+bool gnu_c_is_kw_void(GnuCAst *ast);
+bool gnu_c_is_kw_volatile(GnuCAst *ast);
+bool gnu_c_is_kw_while(GnuCAst *ast);
+bool gnu_c_is_opt_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_opt_asm_clobbers(GnuCAst *ast);
+bool gnu_c_is_opt_asm_operands(GnuCAst *ast);
+bool gnu_c_is_opt_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_opt_attrib(GnuCAst *ast);
+bool gnu_c_is_opt_attribute_list(GnuCAst *ast);
+bool gnu_c_is_opt_attributes(GnuCAst *ast);
+bool gnu_c_is_opt_block_item_list(GnuCAst *ast);
+bool gnu_c_is_opt_comma(GnuCAst *ast);
+bool gnu_c_is_opt_declaration_list(GnuCAst *ast);
+bool gnu_c_is_opt_declarator(GnuCAst *ast);
+bool gnu_c_is_opt_designation(GnuCAst *ast);
+bool gnu_c_is_opt_designator_list(GnuCAst *ast);
+bool gnu_c_is_opt_direct_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_opt_expr_list(GnuCAst *ast);
+bool gnu_c_is_opt_external_declarations(GnuCAst *ast);
+bool gnu_c_is_opt_head_declaration_specifiers(GnuCAst *ast);
+bool gnu_c_is_opt_identifier(GnuCAst *ast);
+bool gnu_c_is_opt_identifier_list(GnuCAst *ast);
+bool gnu_c_is_opt_init_declarator_list(GnuCAst *ast);
+bool gnu_c_is_opt_initializer_list(GnuCAst *ast);
+bool gnu_c_is_opt_label_declarations(GnuCAst *ast);
+bool gnu_c_is_opt_labels(GnuCAst *ast);
+bool gnu_c_is_opt_parameter_forward_declarations(GnuCAst *ast);
+bool gnu_c_is_opt_parameter_type_list(GnuCAst *ast);
+bool gnu_c_is_opt_pointer(GnuCAst *ast);
+bool gnu_c_is_opt_simple_asm_expr(GnuCAst *ast);
+bool gnu_c_is_opt_specifier_qualifier_list(GnuCAst *ast);
+bool gnu_c_is_opt_struct_declaration_list(GnuCAst *ast);
+bool gnu_c_is_opt_struct_declarator_list(GnuCAst *ast);
+bool gnu_c_is_opt_tail_declaration_specifiers(GnuCAst *ast);
+bool gnu_c_is_opt_type_qualifier(GnuCAst *ast);
+bool gnu_c_is_opt_type_qualifier_list(GnuCAst *ast);
+bool gnu_c_is_sym_ampersand(GnuCAst *ast);
+bool gnu_c_is_sym_ampersand_assign(GnuCAst *ast);
+bool gnu_c_is_sym_arrow(GnuCAst *ast);
+bool gnu_c_is_sym_assign(GnuCAst *ast);
+bool gnu_c_is_sym_bang(GnuCAst *ast);
+bool gnu_c_is_sym_caret(GnuCAst *ast);
+bool gnu_c_is_sym_caret_assign(GnuCAst *ast);
+bool gnu_c_is_sym_colon(GnuCAst *ast);
+bool gnu_c_is_sym_comma(GnuCAst *ast);
+bool gnu_c_is_sym_decr(GnuCAst *ast);
+bool gnu_c_is_sym_dot(GnuCAst *ast);
+bool gnu_c_is_sym_ellipsis(GnuCAst *ast);
+bool gnu_c_is_sym_eq(GnuCAst *ast);
+bool gnu_c_is_sym_ge(GnuCAst *ast);
+bool gnu_c_is_sym_gt(GnuCAst *ast);
+bool gnu_c_is_sym_incr(GnuCAst *ast);
+bool gnu_c_is_sym_lbrace(GnuCAst *ast);
+bool gnu_c_is_sym_lbracket(GnuCAst *ast);
+bool gnu_c_is_sym_le(GnuCAst *ast);
+bool gnu_c_is_sym_logical_and(GnuCAst *ast);
+bool gnu_c_is_sym_logical_or(GnuCAst *ast);
+bool gnu_c_is_sym_lparen(GnuCAst *ast);
+bool gnu_c_is_sym_lshift(GnuCAst *ast);
+bool gnu_c_is_sym_lshift_assign(GnuCAst *ast);
+bool gnu_c_is_sym_lt(GnuCAst *ast);
+bool gnu_c_is_sym_minus(GnuCAst *ast);
+bool gnu_c_is_sym_minus_assign(GnuCAst *ast);
+bool gnu_c_is_sym_ne(GnuCAst *ast);
+bool gnu_c_is_sym_percent(GnuCAst *ast);
+bool gnu_c_is_sym_percent_assign(GnuCAst *ast);
+bool gnu_c_is_sym_pipe(GnuCAst *ast);
+bool gnu_c_is_sym_pipe_assign(GnuCAst *ast);
+bool gnu_c_is_sym_plus(GnuCAst *ast);
+bool gnu_c_is_sym_plus_assign(GnuCAst *ast);
+bool gnu_c_is_sym_query(GnuCAst *ast);
+bool gnu_c_is_sym_rbrace(GnuCAst *ast);
+bool gnu_c_is_sym_rbracket(GnuCAst *ast);
+bool gnu_c_is_sym_rparen(GnuCAst *ast);
+bool gnu_c_is_sym_rshift(GnuCAst *ast);
+bool gnu_c_is_sym_rshift_assign(GnuCAst *ast);
+bool gnu_c_is_sym_semicolon(GnuCAst *ast);
+bool gnu_c_is_sym_slash(GnuCAst *ast);
+bool gnu_c_is_sym_slash_assign(GnuCAst *ast);
+bool gnu_c_is_sym_star(GnuCAst *ast);
+bool gnu_c_is_sym_star_assign(GnuCAst *ast);
+bool gnu_c_is_sym_tilde(GnuCAst *ast);
+bool gnu_c_is_tree_asm_definition(GnuCAst *ast);
+bool gnu_c_is_tree_asm_goto_argument(GnuCAst *ast);
+bool gnu_c_is_tree_atomic_type_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_attribute(GnuCAst *ast);
+bool gnu_c_is_tree_attributes(GnuCAst *ast);
+bool gnu_c_is_tree_block_item_list(GnuCAst *ast);
+bool gnu_c_is_tree_compound_statement(GnuCAst *ast);
+bool gnu_c_is_tree_condition(GnuCAst *ast);
+bool gnu_c_is_tree_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_declaration_list(GnuCAst *ast);
+bool gnu_c_is_tree_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_designated_initializer(GnuCAst *ast);
+bool gnu_c_is_tree_designator_list(GnuCAst *ast);
+bool gnu_c_is_tree_do_statement(GnuCAst *ast);
+bool gnu_c_is_tree_expression_statement(GnuCAst *ast);
+bool gnu_c_is_tree_external_declarations(GnuCAst *ast);
+bool gnu_c_is_tree_generic_selection(GnuCAst *ast);
+bool gnu_c_is_tree_head_declaration_specifiers(GnuCAst *ast);
+bool gnu_c_is_tree_if_else_statement(GnuCAst *ast);
+bool gnu_c_is_tree_if_else_statement_except_if(GnuCAst *ast);
+bool gnu_c_is_tree_if_statement(GnuCAst *ast);
+bool gnu_c_is_tree_label_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_label_declarations(GnuCAst *ast);
+bool gnu_c_is_tree_labels(GnuCAst *ast);
+bool gnu_c_is_tree_nested_function_definition(GnuCAst *ast);
+bool gnu_c_is_tree_parameter_forward_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_parameter_forward_declarations(GnuCAst *ast);
+bool gnu_c_is_tree_pointer(GnuCAst *ast);
+bool gnu_c_is_tree_simple_asm_expr(GnuCAst *ast);
+bool gnu_c_is_tree_statement(GnuCAst *ast);
+bool gnu_c_is_tree_statement_except_if(GnuCAst *ast);
+bool gnu_c_is_tree_static_assert_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_struct_declaration_list(GnuCAst *ast);
+bool gnu_c_is_tree_switch_statement(GnuCAst *ast);
+bool gnu_c_is_tree_switch_statement_except_if(GnuCAst *ast);
+bool gnu_c_is_tree_tag_abstract_parameter_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_tag_actual_cast_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_addressof_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_alignas_expr_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_alignas_type_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_alignof_expression_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_alignof_type_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_anonymous_asm_operand(GnuCAst *ast);
+bool gnu_c_is_tree_tag_array_direct_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_array_direct_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_array_element_designator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_array_member_offset_designator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_array_range_designator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_asm_argument_out(GnuCAst *ast);
+bool gnu_c_is_tree_tag_asm_argument_out_in(GnuCAst *ast);
+bool gnu_c_is_tree_tag_asm_argument_out_in_clobber(GnuCAst *ast);
+bool gnu_c_is_tree_tag_asm_common_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_asm_goto_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_attrib_with_arg(GnuCAst *ast);
+bool gnu_c_is_tree_tag_bit_and_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_bit_and_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_bit_ior_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_bit_ior_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_bit_not_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_bit_xor_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_bit_xor_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_bitfield_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_braced_initializer(GnuCAst *ast);
+bool gnu_c_is_tree_tag_braced_initializer_comma(GnuCAst *ast);
+bool gnu_c_is_tree_tag_break_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_builtin_choose_expr_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_builtin_complex_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_builtin_mix_shuffle_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_builtin_offsetof_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_builtin_simple_shuffle_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_builtin_types_compatible_p_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_builtin_va_arg_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_c99_designation(GnuCAst *ast);
+bool gnu_c_is_tree_tag_call_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_case_label(GnuCAst *ast);
+bool gnu_c_is_tree_tag_case_range_label(GnuCAst *ast);
+bool gnu_c_is_tree_tag_compound_literal(GnuCAst *ast);
+bool gnu_c_is_tree_tag_compound_literal_comma(GnuCAst *ast);
+bool gnu_c_is_tree_tag_computed_goto_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_concrete_parameter_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_tag_continue_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_default_generic_association(GnuCAst *ast);
+bool gnu_c_is_tree_tag_default_label(GnuCAst *ast);
+bool gnu_c_is_tree_tag_deref_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_direct_member_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_divide_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_divide_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_eq_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_extension_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_extension_external_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_tag_extension_nested_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_tag_extension_struct_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_tag_for_decl_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_for_decl_statement_except_if(GnuCAst *ast);
+bool gnu_c_is_tree_tag_for_expr_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_for_expr_statement_except_if(GnuCAst *ast);
+bool gnu_c_is_tree_tag_forward_enum_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_forward_param_fun_direct_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_forward_param_fun_direct_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_forward_struct_or_union_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_full_enum_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_full_struct_or_union_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_fun_direct_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_fun_direct_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_ge_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_gnu_designation(GnuCAst *ast);
+bool gnu_c_is_tree_tag_gnu_statement_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_goto_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_gt_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_head_tail_declaration_specifiers(GnuCAst *ast);
+bool gnu_c_is_tree_tag_imag_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_implicit_int_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_tag_implicit_int_function_definition(GnuCAst *ast);
+bool gnu_c_is_tree_tag_index_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_indirect_member_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_initialized_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_initialized_enumerator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_label_address_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_le_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_left_shift_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_left_shift_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_legacy_fun_direct_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_log_and_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_log_not_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_log_or_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_lt_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_member_declaration(GnuCAst *ast);
+bool gnu_c_is_tree_tag_member_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_member_designator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_minus_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_minus_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_modulo_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_modulo_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_asm_clobbers(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_asm_goto_operands(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_asm_operands(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_attribute_list(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_enumerator_list(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_expr_list(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_generic_assoc_list(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_identifier_list(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_init_declarator_list(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_initializer_list(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_parameter_list(GnuCAst *ast);
+bool gnu_c_is_tree_tag_multi_struct_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_named_asm_operand(GnuCAst *ast);
+bool gnu_c_is_tree_tag_named_label(GnuCAst *ast);
+bool gnu_c_is_tree_tag_named_member_offset_designator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_ne_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_only_head_declaration_specifiers(GnuCAst *ast);
+bool gnu_c_is_tree_tag_paren_direct_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_paren_direct_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_paren_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_plus_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_plus_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_pointer_abstract_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_post_decr_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_post_incr_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_pre_decr_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_pre_incr_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_q_list_qualifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_real_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_return_statement(GnuCAst *ast);
+bool gnu_c_is_tree_tag_reverse_static_array_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_right_shift_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_right_shift_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_simple_array_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_simple_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_sizeof_expression_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_sizeof_type_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_sq_list_qualifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_sq_list_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_star_array_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_static_array_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_ternary_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_times_assignment_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_times_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_type_generic_association(GnuCAst *ast);
+bool gnu_c_is_tree_tag_typeof_expr_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_typeof_type_specifier(GnuCAst *ast);
+bool gnu_c_is_tree_tag_unary_minus_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_unary_plus_expression(GnuCAst *ast);
+bool gnu_c_is_tree_tag_uninitialized_declarator(GnuCAst *ast);
+bool gnu_c_is_tree_tag_variadic_parameter_list(GnuCAst *ast);
+bool gnu_c_is_tree_tail_declaration_specifiers(GnuCAst *ast);
+bool gnu_c_is_tree_type_name(GnuCAst *ast);
+bool gnu_c_is_tree_while_statement(GnuCAst *ast);
+bool gnu_c_is_tree_while_statement_except_if(GnuCAst *ast);
+
+/* Output. */
+void gnu_c_emit(GnuCAst *ast, FILE *fp);
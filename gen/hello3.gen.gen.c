@@ -0,0 +1,9 @@
+/* This program writes "Hello, World!" */
+extern signed int printf(char const *format, ...);
+signed int main(signed int argc, char *(*argv))
+{
+    (void)argc;
+    (void)argv;
+    printf("Hello, World!\n");
+    return 0;
+}
@@ -0,0 +1,939 @@
+/* Generated file, edit cache/gram/nicate-glass.gram instead. */
+#pragma once
+
+/*
+    Copyright © 2015-2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "fwd.h"
+
+
+typedef struct NicateGlassAst NicateGlassAst;
+
+typedef struct NicateGlassNothing NicateGlassNothing;
+
+/* Alias */
+typedef struct NicateGlassAnyLogicalOrExpr NicateGlassAliasExpr;
+
+/* NicateGlassAnyMulExpr | NicateGlassTreeTagPlusExpr | NicateGlassTreeTagMinusExpr */
+typedef struct NicateGlassAnyAddExpr NicateGlassAnyAddExpr;
+
+/* NicateGlassTreeTagSimpleAssign | NicateGlassTreeTagTimesAssign | NicateGlassTreeTagDivideAssign | NicateGlassTreeTagModuloAssign | NicateGlassTreeTagPlusAssign | NicateGlassTreeTagMinusAssign | NicateGlassTreeTagLeftShiftAssign | NicateGlassTreeTagRightShiftAssign | NicateGlassTreeTagBitAndAssign | NicateGlassTreeTagBitXorAssign | NicateGlassTreeTagBitOrAssign | NicateGlassAliasExpr */
+typedef struct NicateGlassAnyAssign NicateGlassAnyAssign;
+
+/* NicateGlassTreeTagAnnotatedStmt | NicateGlassTreeTagUnionStmt | NicateGlassTreeTagStructStmt | NicateGlassTreeTagEnumStmt | NicateGlassTreeTagFunStmt | NicateGlassTreeTagDeclaration | NicateGlassTreeTagInitializedDeclaration | NicateGlassSymSemicolon */
+typedef struct NicateGlassAnyAttrStmt NicateGlassAnyAttrStmt;
+
+/* NicateGlassAnyCmpExpr | NicateGlassTreeTagBitAndExpr */
+typedef struct NicateGlassAnyBitwiseAndExpr NicateGlassAnyBitwiseAndExpr;
+
+/* NicateGlassAnyBitwiseXorExpr | NicateGlassTreeTagBitIorExpr */
+typedef struct NicateGlassAnyBitwiseIorExpr NicateGlassAnyBitwiseIorExpr;
+
+/* NicateGlassAnyBitwiseAndExpr | NicateGlassTreeTagBitXorExpr */
+typedef struct NicateGlassAnyBitwiseXorExpr NicateGlassAnyBitwiseXorExpr;
+
+/* NicateGlassAnyShiftExpr | NicateGlassTreeTagLtExpr | NicateGlassTreeTagGtExpr | NicateGlassTreeTagLeExpr | NicateGlassTreeTagGeExpr | NicateGlassTreeTagEqExpr | NicateGlassTreeTagNeExpr */
+typedef struct NicateGlassAnyCmpExpr NicateGlassAnyCmpExpr;
+
+/* NicateGlassTreeTagFixedFunSig | NicateGlassTreeTagVariadicFunSig */
+typedef struct NicateGlassAnyFunSig NicateGlassAnyFunSig;
+
+/* NicateGlassTreeCompoundStmt | NicateGlassTreeTagIfStmt | NicateGlassTreeTagIfElseStmt */
+typedef struct NicateGlassAnyIfOrCompoundStmt NicateGlassAnyIfOrCompoundStmt;
+
+/* NicateGlassAtomDecimalFloatingLiteral | NicateGlassAtomHexadecimalFloatingLiteral | NicateGlassAtomDecimalLiteral | NicateGlassAtomOctalLiteral | NicateGlassAtomHexadecimalLiteral | NicateGlassAtomBinaryLiteral | NicateGlassAtomCharacterLiteral | NicateGlassAtomStringLiteral */
+typedef struct NicateGlassAnyLiteral NicateGlassAnyLiteral;
+
+/* NicateGlassAnyBitwiseIorExpr | NicateGlassTreeTagLogAndExpr */
+typedef struct NicateGlassAnyLogicalAndExpr NicateGlassAnyLogicalAndExpr;
+
+/* NicateGlassAnyLogicalAndExpr | NicateGlassTreeTagLogOrExpr */
+typedef struct NicateGlassAnyLogicalOrExpr NicateGlassAnyLogicalOrExpr;
+
+/* NicateGlassSymSemicolon | NicateGlassTreeCompoundStmt */
+typedef struct NicateGlassAnyMaybeCompoundStmt NicateGlassAnyMaybeCompoundStmt;
+
+/* NicateGlassSymSemicolon | NicateGlassTreeTagEnumBody */
+typedef struct NicateGlassAnyMaybeEnumBody NicateGlassAnyMaybeEnumBody;
+
+/* NicateGlassSymSemicolon | NicateGlassTreeTagStructBody */
+typedef struct NicateGlassAnyMaybeStructBody NicateGlassAnyMaybeStructBody;
+
+/* NicateGlassTreeTypedId | NicateGlassTreeTagUntypedId */
+typedef struct NicateGlassAnyMaybeTypedId NicateGlassAnyMaybeTypedId;
+
+/* NicateGlassAnyUnaryExpr | NicateGlassTreeTagTimesExpr | NicateGlassTreeTagDivideExpr | NicateGlassTreeTagModuloExpr */
+typedef struct NicateGlassAnyMulExpr NicateGlassAnyMulExpr;
+
+/* NicateGlassAtomComment | NicateGlassTreeTagExprStmt | NicateGlassTreeTagLabeledStmt | NicateGlassTreeTagDefaultStmt | NicateGlassTreeTagCaseStmt | NicateGlassTreeTagWhileStmt | NicateGlassTreeTagDoStmt | NicateGlassTreeTagGotoStmt | NicateGlassTreeTagBreakStmt | NicateGlassTreeTagContinueStmt | NicateGlassTreeTagReturnStmt | NicateGlassTreeTagSwitchStmt | NicateGlassAnyIfOrCompoundStmt */
+typedef struct NicateGlassAnyNoattrStmt NicateGlassAnyNoattrStmt;
+
+/* NicateGlassAnyPrimaryExpr | NicateGlassTreeTagIndexExpr | NicateGlassTreeTagCallExpr | NicateGlassTreeTagMemberExpr | NicateGlassTreeTagPostIncrExpr | NicateGlassTreeTagPostDecrExpr */
+typedef struct NicateGlassAnyPostfixExpr NicateGlassAnyPostfixExpr;
+
+/* NicateGlassAtomId | NicateGlassAnyLiteral | NicateGlassTreeTagParenExpr | NicateGlassTreeTagArrayLiteral */
+typedef struct NicateGlassAnyPrimaryExpr NicateGlassAnyPrimaryExpr;
+
+/* NicateGlassAnyPostfixExpr | NicateGlassTreeTagAttrExpr */
+typedef struct NicateGlassAnyQuasipostfixExpr NicateGlassAnyQuasipostfixExpr;
+
+/* NicateGlassAnyAddExpr | NicateGlassTreeTagLeftShiftExpr | NicateGlassTreeTagRightShiftExpr */
+typedef struct NicateGlassAnyShiftExpr NicateGlassAnyShiftExpr;
+
+/* NicateGlassAnyAttrStmt | NicateGlassAnyNoattrStmt */
+typedef struct NicateGlassAnyStmt NicateGlassAnyStmt;
+
+/* NicateGlassAnyQuasipostfixExpr | NicateGlassTreeTagPreIncrExpr | NicateGlassTreeTagPreDecrExpr | NicateGlassTreeTagAddressofExpr | NicateGlassTreeTagUnaryPlusExpr | NicateGlassTreeTagUnaryMinusExpr | NicateGlassTreeTagBitNotExpr | NicateGlassTreeTagLogNotExpr */
+typedef struct NicateGlassAnyUnaryExpr NicateGlassAnyUnaryExpr;
+
+/* Term */
+typedef struct NicateGlassAtomBinaryLiteral NicateGlassAtomBinaryLiteral;
+
+/* Term */
+typedef struct NicateGlassAtomCharacterLiteral NicateGlassAtomCharacterLiteral;
+
+/* Term */
+typedef struct NicateGlassAtomComment NicateGlassAtomComment;
+
+/* Term */
+typedef struct NicateGlassAtomDecimalFloatingLiteral NicateGlassAtomDecimalFloatingLiteral;
+
+/* Term */
+typedef struct NicateGlassAtomDecimalLiteral NicateGlassAtomDecimalLiteral;
+
+/* Term */
+typedef struct NicateGlassAtomHexadecimalFloatingLiteral NicateGlassAtomHexadecimalFloatingLiteral;
+
+/* Term */
+typedef struct NicateGlassAtomHexadecimalLiteral NicateGlassAtomHexadecimalLiteral;
+
+/* Term */
+typedef struct NicateGlassAtomId NicateGlassAtomId;
+
+/* Term */
+typedef struct NicateGlassAtomOctalLiteral NicateGlassAtomOctalLiteral;
+
+/* Term */
+typedef struct NicateGlassAtomStringLiteral NicateGlassAtomStringLiteral;
+
+/* Term */
+typedef struct NicateGlassKwBreak NicateGlassKwBreak;
+
+/* Term */
+typedef struct NicateGlassKwCase NicateGlassKwCase;
+
+/* Term */
+typedef struct NicateGlassKwContinue NicateGlassKwContinue;
+
+/* Term */
+typedef struct NicateGlassKwDefault NicateGlassKwDefault;
+
+/* Term */
+typedef struct NicateGlassKwDo NicateGlassKwDo;
+
+/* Term */
+typedef struct NicateGlassKwElse NicateGlassKwElse;
+
+/* Term */
+typedef struct NicateGlassKwEnum NicateGlassKwEnum;
+
+/* Term */
+typedef struct NicateGlassKwFun NicateGlassKwFun;
+
+/* Term */
+typedef struct NicateGlassKwGoto NicateGlassKwGoto;
+
+/* Term */
+typedef struct NicateGlassKwIf NicateGlassKwIf;
+
+/* Term */
+typedef struct NicateGlassKwLet NicateGlassKwLet;
+
+/* Term */
+typedef struct NicateGlassKwReturn NicateGlassKwReturn;
+
+/* Term */
+typedef struct NicateGlassKwStruct NicateGlassKwStruct;
+
+/* Term */
+typedef struct NicateGlassKwSwitch NicateGlassKwSwitch;
+
+/* Term */
+typedef struct NicateGlassKwUnion NicateGlassKwUnion;
+
+/* Term */
+typedef struct NicateGlassKwWhile NicateGlassKwWhile;
+
+/* NicateGlassSymBe | NicateGlassNothing */
+typedef struct NicateGlassOptBe NicateGlassOptBe;
+
+/* NicateGlassTreeEnumList | NicateGlassNothing */
+typedef struct NicateGlassOptEnumList NicateGlassOptEnumList;
+
+/* NicateGlassAliasExpr | NicateGlassNothing */
+typedef struct NicateGlassOptLogicalOrExpr NicateGlassOptExpr;
+
+/* NicateGlassTreeExprList | NicateGlassNothing */
+typedef struct NicateGlassOptExprList NicateGlassOptExprList;
+
+/* NicateGlassSymLparen | NicateGlassNothing */
+typedef struct NicateGlassOptLparen NicateGlassOptLparen;
+
+/* NicateGlassTreeStmtList | NicateGlassNothing */
+typedef struct NicateGlassOptStmtList NicateGlassOptStmtList;
+
+/* NicateGlassTreeTu | NicateGlassNothing */
+typedef struct NicateGlassOptTu NicateGlassOptTu;
+
+/* NicateGlassTreeTypedIdList | NicateGlassNothing */
+typedef struct NicateGlassOptTypedIdList NicateGlassOptTypedIdList;
+
+/* NicateGlassSymComma | NicateGlassNothing */
+typedef struct NicateGlassSlaveComma NicateGlassSlaveComma;
+
+/* NicateGlassAliasExpr | NicateGlassNothing */
+typedef struct NicateGlassSlaveLogicalOrExpr NicateGlassSlaveExpr;
+
+/* NicateGlassTreeExprList | NicateGlassNothing */
+typedef struct NicateGlassSlaveExprList NicateGlassSlaveExprList;
+
+/* NicateGlassSymRparen | NicateGlassNothing */
+typedef struct NicateGlassSlaveRparen NicateGlassSlaveRparen;
+
+/* Term */
+typedef struct NicateGlassSymAmpersand NicateGlassSymAmpersand;
+
+/* Term */
+typedef struct NicateGlassSymAmpersandBe NicateGlassSymAmpersandBe;
+
+/* Term */
+typedef struct NicateGlassSymArrow NicateGlassSymArrow;
+
+/* Term */
+typedef struct NicateGlassSymAt NicateGlassSymAt;
+
+/* Term */
+typedef struct NicateGlassSymBang NicateGlassSymBang;
+
+/* Term */
+typedef struct NicateGlassSymBe NicateGlassSymBe;
+
+/* Term */
+typedef struct NicateGlassSymCaret NicateGlassSymCaret;
+
+/* Term */
+typedef struct NicateGlassSymCaretBe NicateGlassSymCaretBe;
+
+/* Term */
+typedef struct NicateGlassSymColon NicateGlassSymColon;
+
+/* Term */
+typedef struct NicateGlassSymComma NicateGlassSymComma;
+
+/* Term */
+typedef struct NicateGlassSymDecr NicateGlassSymDecr;
+
+/* Term */
+typedef struct NicateGlassSymDot NicateGlassSymDot;
+
+/* Term */
+typedef struct NicateGlassSymEllipsis NicateGlassSymEllipsis;
+
+/* Term */
+typedef struct NicateGlassSymEq NicateGlassSymEq;
+
+/* Term */
+typedef struct NicateGlassSymGe NicateGlassSymGe;
+
+/* Term */
+typedef struct NicateGlassSymGt NicateGlassSymGt;
+
+/* Term */
+typedef struct NicateGlassSymIncr NicateGlassSymIncr;
+
+/* Term */
+typedef struct NicateGlassSymLbrace NicateGlassSymLbrace;
+
+/* Term */
+typedef struct NicateGlassSymLbracket NicateGlassSymLbracket;
+
+/* Term */
+typedef struct NicateGlassSymLe NicateGlassSymLe;
+
+/* Term */
+typedef struct NicateGlassSymLogicalAnd NicateGlassSymLogicalAnd;
+
+/* Term */
+typedef struct NicateGlassSymLogicalOr NicateGlassSymLogicalOr;
+
+/* Term */
+typedef struct NicateGlassSymLparen NicateGlassSymLparen;
+
+/* Term */
+typedef struct NicateGlassSymLshift NicateGlassSymLshift;
+
+/* Term */
+typedef struct NicateGlassSymLshiftBe NicateGlassSymLshiftBe;
+
+/* Term */
+typedef struct NicateGlassSymLt NicateGlassSymLt;
+
+/* Term */
+typedef struct NicateGlassSymMinus NicateGlassSymMinus;
+
+/* Term */
+typedef struct NicateGlassSymMinusBe NicateGlassSymMinusBe;
+
+/* Term */
+typedef struct NicateGlassSymNe NicateGlassSymNe;
+
+/* Term */
+typedef struct NicateGlassSymPercent NicateGlassSymPercent;
+
+/* Term */
+typedef struct NicateGlassSymPercentBe NicateGlassSymPercentBe;
+
+/* Term */
+typedef struct NicateGlassSymPipe NicateGlassSymPipe;
+
+/* Term */
+typedef struct NicateGlassSymPipeBe NicateGlassSymPipeBe;
+
+/* Term */
+typedef struct NicateGlassSymPlus NicateGlassSymPlus;
+
+/* Term */
+typedef struct NicateGlassSymPlusBe NicateGlassSymPlusBe;
+
+/* Term */
+typedef struct NicateGlassSymRbrace NicateGlassSymRbrace;
+
+/* Term */
+typedef struct NicateGlassSymRbracket NicateGlassSymRbracket;
+
+/* Term */
+typedef struct NicateGlassSymRparen NicateGlassSymRparen;
+
+/* Term */
+typedef struct NicateGlassSymRshift NicateGlassSymRshift;
+
+/* Term */
+typedef struct NicateGlassSymRshiftBe NicateGlassSymRshiftBe;
+
+/* Term */
+typedef struct NicateGlassSymSemicolon NicateGlassSymSemicolon;
+
+/* Term */
+typedef struct NicateGlassSymSlash NicateGlassSymSlash;
+
+/* Term */
+typedef struct NicateGlassSymSlashBe NicateGlassSymSlashBe;
+
+/* Term */
+typedef struct NicateGlassSymStar NicateGlassSymStar;
+
+/* Term */
+typedef struct NicateGlassSymStarBe NicateGlassSymStarBe;
+
+/* Term */
+typedef struct NicateGlassSymTilde NicateGlassSymTilde;
+
+/* NicateGlassSymAt NicateGlassAtomId NicateGlassOptLparen NicateGlassSlaveExprList NicateGlassSlaveRparen */
+typedef struct NicateGlassTreeAttr NicateGlassTreeAttr;
+
+/* NicateGlassSymLbrace NicateGlassOptStmtList NicateGlassSymRbrace */
+typedef struct NicateGlassTreeCompoundStmt NicateGlassTreeCompoundStmt;
+
+/* NicateGlassOptEnumList NicateGlassSlaveComma NicateGlassTreeEnumerator */
+typedef struct NicateGlassTreeEnumList NicateGlassTreeEnumList;
+
+/* NicateGlassAtomId NicateGlassOptBe NicateGlassSlaveExpr */
+typedef struct NicateGlassTreeEnumerator NicateGlassTreeEnumerator;
+
+/* NicateGlassOptExprList NicateGlassSlaveComma NicateGlassAliasExpr */
+typedef struct NicateGlassTreeExprList NicateGlassTreeExprList;
+
+/* NicateGlassOptStmtList NicateGlassAnyStmt */
+typedef struct NicateGlassTreeStmtList NicateGlassTreeStmtList;
+
+/* NicateGlassSymAmpersand NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagAddressofExpr NicateGlassTreeTagAddressofExpr;
+
+/* NicateGlassTreeAttr NicateGlassAnyAttrStmt */
+typedef struct NicateGlassTreeTagAnnotatedStmt NicateGlassTreeTagAnnotatedStmt;
+
+/* NicateGlassSymLbracket NicateGlassOptExprList NicateGlassSymRbracket */
+typedef struct NicateGlassTreeTagArrayLiteral NicateGlassTreeTagArrayLiteral;
+
+/* NicateGlassAnyQuasipostfixExpr NicateGlassTreeAttr */
+typedef struct NicateGlassTreeTagAttrExpr NicateGlassTreeTagAttrExpr;
+
+/* NicateGlassAliasExpr NicateGlassSymAmpersandBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagBitAndAssign NicateGlassTreeTagBitAndAssign;
+
+/* NicateGlassAnyBitwiseAndExpr NicateGlassSymAmpersand NicateGlassAnyCmpExpr */
+typedef struct NicateGlassTreeTagBitAndExpr NicateGlassTreeTagBitAndExpr;
+
+/* NicateGlassAnyBitwiseIorExpr NicateGlassSymPipe NicateGlassAnyBitwiseXorExpr */
+typedef struct NicateGlassTreeTagBitIorExpr NicateGlassTreeTagBitIorExpr;
+
+/* NicateGlassSymTilde NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagBitNotExpr NicateGlassTreeTagBitNotExpr;
+
+/* NicateGlassAliasExpr NicateGlassSymPipeBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagBitOrAssign NicateGlassTreeTagBitOrAssign;
+
+/* NicateGlassAliasExpr NicateGlassSymCaretBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagBitXorAssign NicateGlassTreeTagBitXorAssign;
+
+/* NicateGlassAnyBitwiseXorExpr NicateGlassSymCaret NicateGlassAnyBitwiseAndExpr */
+typedef struct NicateGlassTreeTagBitXorExpr NicateGlassTreeTagBitXorExpr;
+
+/* NicateGlassKwBreak NicateGlassSymSemicolon */
+typedef struct NicateGlassTreeTagBreakStmt NicateGlassTreeTagBreakStmt;
+
+/* NicateGlassAnyPostfixExpr NicateGlassSymLparen NicateGlassOptExprList NicateGlassSymRparen */
+typedef struct NicateGlassTreeTagCallExpr NicateGlassTreeTagCallExpr;
+
+/* NicateGlassKwCase NicateGlassAliasExpr NicateGlassSymColon NicateGlassAnyStmt */
+typedef struct NicateGlassTreeTagCaseStmt NicateGlassTreeTagCaseStmt;
+
+/* NicateGlassKwContinue NicateGlassSymSemicolon */
+typedef struct NicateGlassTreeTagContinueStmt NicateGlassTreeTagContinueStmt;
+
+/* NicateGlassKwLet NicateGlassTreeTypedId NicateGlassSymSemicolon */
+typedef struct NicateGlassTreeTagDeclaration NicateGlassTreeTagDeclaration;
+
+/* NicateGlassKwDefault NicateGlassSymColon NicateGlassAnyStmt */
+typedef struct NicateGlassTreeTagDefaultStmt NicateGlassTreeTagDefaultStmt;
+
+/* NicateGlassAliasExpr NicateGlassSymSlashBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagDivideAssign NicateGlassTreeTagDivideAssign;
+
+/* NicateGlassAnyMulExpr NicateGlassSymSlash NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagDivideExpr NicateGlassTreeTagDivideExpr;
+
+/* NicateGlassKwDo NicateGlassTreeCompoundStmt NicateGlassKwWhile NicateGlassSymLparen NicateGlassAliasExpr NicateGlassSymRparen NicateGlassSymSemicolon */
+typedef struct NicateGlassTreeTagDoStmt NicateGlassTreeTagDoStmt;
+
+/* NicateGlassSymLbrace NicateGlassOptEnumList NicateGlassSymRbrace */
+typedef struct NicateGlassTreeTagEnumBody NicateGlassTreeTagEnumBody;
+
+/* NicateGlassKwEnum NicateGlassAtomId NicateGlassAnyMaybeEnumBody */
+typedef struct NicateGlassTreeTagEnumStmt NicateGlassTreeTagEnumStmt;
+
+/* NicateGlassAnyShiftExpr NicateGlassSymEq NicateGlassAnyShiftExpr */
+typedef struct NicateGlassTreeTagEqExpr NicateGlassTreeTagEqExpr;
+
+/* NicateGlassAnyAssign NicateGlassSymSemicolon */
+typedef struct NicateGlassTreeTagExprStmt NicateGlassTreeTagExprStmt;
+
+/* NicateGlassSymLparen NicateGlassOptTypedIdList NicateGlassSymRparen NicateGlassSymArrow NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagFixedFunSig NicateGlassTreeTagFixedFunSig;
+
+/* NicateGlassKwFun NicateGlassAtomId NicateGlassAnyFunSig NicateGlassAnyMaybeCompoundStmt */
+typedef struct NicateGlassTreeTagFunStmt NicateGlassTreeTagFunStmt;
+
+/* NicateGlassAnyShiftExpr NicateGlassSymGe NicateGlassAnyShiftExpr */
+typedef struct NicateGlassTreeTagGeExpr NicateGlassTreeTagGeExpr;
+
+/* NicateGlassKwGoto NicateGlassAtomId NicateGlassSymSemicolon */
+typedef struct NicateGlassTreeTagGotoStmt NicateGlassTreeTagGotoStmt;
+
+/* NicateGlassAnyShiftExpr NicateGlassSymGt NicateGlassAnyShiftExpr */
+typedef struct NicateGlassTreeTagGtExpr NicateGlassTreeTagGtExpr;
+
+/* NicateGlassKwIf NicateGlassSymLparen NicateGlassAliasExpr NicateGlassSymRparen NicateGlassTreeCompoundStmt NicateGlassKwElse NicateGlassAnyIfOrCompoundStmt */
+typedef struct NicateGlassTreeTagIfElseStmt NicateGlassTreeTagIfElseStmt;
+
+/* NicateGlassKwIf NicateGlassSymLparen NicateGlassAliasExpr NicateGlassSymRparen NicateGlassTreeCompoundStmt */
+typedef struct NicateGlassTreeTagIfStmt NicateGlassTreeTagIfStmt;
+
+/* NicateGlassAnyPostfixExpr NicateGlassSymLbracket NicateGlassOptExprList NicateGlassSymRbracket */
+typedef struct NicateGlassTreeTagIndexExpr NicateGlassTreeTagIndexExpr;
+
+/* NicateGlassKwLet NicateGlassAnyMaybeTypedId NicateGlassSymBe NicateGlassAliasExpr NicateGlassSymSemicolon */
+typedef struct NicateGlassTreeTagInitializedDeclaration NicateGlassTreeTagInitializedDeclaration;
+
+/* NicateGlassAtomId NicateGlassSymColon NicateGlassAnyStmt */
+typedef struct NicateGlassTreeTagLabeledStmt NicateGlassTreeTagLabeledStmt;
+
+/* NicateGlassAnyShiftExpr NicateGlassSymLe NicateGlassAnyShiftExpr */
+typedef struct NicateGlassTreeTagLeExpr NicateGlassTreeTagLeExpr;
+
+/* NicateGlassAliasExpr NicateGlassSymLshiftBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagLeftShiftAssign NicateGlassTreeTagLeftShiftAssign;
+
+/* NicateGlassAnyShiftExpr NicateGlassSymLshift NicateGlassAnyAddExpr */
+typedef struct NicateGlassTreeTagLeftShiftExpr NicateGlassTreeTagLeftShiftExpr;
+
+/* NicateGlassAnyLogicalAndExpr NicateGlassSymLogicalAnd NicateGlassAnyBitwiseIorExpr */
+typedef struct NicateGlassTreeTagLogAndExpr NicateGlassTreeTagLogAndExpr;
+
+/* NicateGlassSymBang NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagLogNotExpr NicateGlassTreeTagLogNotExpr;
+
+/* NicateGlassAnyLogicalOrExpr NicateGlassSymLogicalOr NicateGlassAnyLogicalAndExpr */
+typedef struct NicateGlassTreeTagLogOrExpr NicateGlassTreeTagLogOrExpr;
+
+/* NicateGlassAnyShiftExpr NicateGlassSymLt NicateGlassAnyShiftExpr */
+typedef struct NicateGlassTreeTagLtExpr NicateGlassTreeTagLtExpr;
+
+/* NicateGlassAnyPostfixExpr NicateGlassSymDot NicateGlassAtomId */
+typedef struct NicateGlassTreeTagMemberExpr NicateGlassTreeTagMemberExpr;
+
+/* NicateGlassAliasExpr NicateGlassSymMinusBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagMinusAssign NicateGlassTreeTagMinusAssign;
+
+/* NicateGlassAnyAddExpr NicateGlassSymMinus NicateGlassAnyMulExpr */
+typedef struct NicateGlassTreeTagMinusExpr NicateGlassTreeTagMinusExpr;
+
+/* NicateGlassAliasExpr NicateGlassSymPercentBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagModuloAssign NicateGlassTreeTagModuloAssign;
+
+/* NicateGlassAnyMulExpr NicateGlassSymPercent NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagModuloExpr NicateGlassTreeTagModuloExpr;
+
+/* NicateGlassAnyShiftExpr NicateGlassSymNe NicateGlassAnyShiftExpr */
+typedef struct NicateGlassTreeTagNeExpr NicateGlassTreeTagNeExpr;
+
+/* NicateGlassSymLparen NicateGlassAnyAssign NicateGlassSymRparen */
+typedef struct NicateGlassTreeTagParenExpr NicateGlassTreeTagParenExpr;
+
+/* NicateGlassAliasExpr NicateGlassSymPlusBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagPlusAssign NicateGlassTreeTagPlusAssign;
+
+/* NicateGlassAnyAddExpr NicateGlassSymPlus NicateGlassAnyMulExpr */
+typedef struct NicateGlassTreeTagPlusExpr NicateGlassTreeTagPlusExpr;
+
+/* NicateGlassAnyPostfixExpr NicateGlassSymDecr */
+typedef struct NicateGlassTreeTagPostDecrExpr NicateGlassTreeTagPostDecrExpr;
+
+/* NicateGlassAnyPostfixExpr NicateGlassSymIncr */
+typedef struct NicateGlassTreeTagPostIncrExpr NicateGlassTreeTagPostIncrExpr;
+
+/* NicateGlassSymDecr NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagPreDecrExpr NicateGlassTreeTagPreDecrExpr;
+
+/* NicateGlassSymIncr NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagPreIncrExpr NicateGlassTreeTagPreIncrExpr;
+
+/* NicateGlassKwReturn NicateGlassOptExpr NicateGlassSymSemicolon */
+typedef struct NicateGlassTreeTagReturnStmt NicateGlassTreeTagReturnStmt;
+
+/* NicateGlassAliasExpr NicateGlassSymRshiftBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagRightShiftAssign NicateGlassTreeTagRightShiftAssign;
+
+/* NicateGlassAnyShiftExpr NicateGlassSymRshift NicateGlassAnyAddExpr */
+typedef struct NicateGlassTreeTagRightShiftExpr NicateGlassTreeTagRightShiftExpr;
+
+/* NicateGlassAliasExpr NicateGlassSymBe NicateGlassAnyAssign */
+typedef struct NicateGlassTreeTagSimpleAssign NicateGlassTreeTagSimpleAssign;
+
+/* NicateGlassSymLbrace NicateGlassOptTypedIdList NicateGlassSymRbrace */
+typedef struct NicateGlassTreeTagStructBody NicateGlassTreeTagStructBody;
+
+/* NicateGlassKwStruct NicateGlassAtomId NicateGlassAnyMaybeStructBody */
+typedef struct NicateGlassTreeTagStructStmt NicateGlassTreeTagStructStmt;
+
+/* NicateGlassKwSwitch NicateGlassSymLparen NicateGlassAliasExpr NicateGlassSymRparen NicateGlassTreeCompoundStmt */
+typedef struct NicateGlassTreeTagSwitchStmt NicateGlassTreeTagSwitchStmt;
+
+/* NicateGlassAliasExpr NicateGlassSymStarBe NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagTimesAssign NicateGlassTreeTagTimesAssign;
+
+/* NicateGlassAnyMulExpr NicateGlassSymStar NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagTimesExpr NicateGlassTreeTagTimesExpr;
+
+/* NicateGlassSymMinus NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagUnaryMinusExpr NicateGlassTreeTagUnaryMinusExpr;
+
+/* NicateGlassSymPlus NicateGlassAnyUnaryExpr */
+typedef struct NicateGlassTreeTagUnaryPlusExpr NicateGlassTreeTagUnaryPlusExpr;
+
+/* NicateGlassKwUnion NicateGlassAtomId NicateGlassAnyMaybeStructBody */
+typedef struct NicateGlassTreeTagUnionStmt NicateGlassTreeTagUnionStmt;
+
+/* NicateGlassAtomId NicateGlassSymColon */
+typedef struct NicateGlassTreeTagUntypedId NicateGlassTreeTagUntypedId;
+
+/* NicateGlassSymLparen NicateGlassTreeTypedIdList NicateGlassSymComma NicateGlassSymEllipsis NicateGlassSymRparen NicateGlassSymArrow NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTagVariadicFunSig NicateGlassTreeTagVariadicFunSig;
+
+/* NicateGlassKwWhile NicateGlassSymLparen NicateGlassAliasExpr NicateGlassSymRparen NicateGlassTreeCompoundStmt */
+typedef struct NicateGlassTreeTagWhileStmt NicateGlassTreeTagWhileStmt;
+
+/* NicateGlassOptTu NicateGlassAnyStmt */
+typedef struct NicateGlassTreeTu NicateGlassTreeTu;
+
+/* NicateGlassAtomId NicateGlassSymColon NicateGlassAliasExpr */
+typedef struct NicateGlassTreeTypedId NicateGlassTreeTypedId;
+
+/* NicateGlassOptTypedIdList NicateGlassSlaveComma NicateGlassTreeTypedId */
+typedef struct NicateGlassTreeTypedIdList NicateGlassTreeTypedIdList;
+
+/* Construction. */
+NicateGlassNothing *nicate_glass_create_nothing(Pool *pool);
+NicateGlassAtomBinaryLiteral *nicate_glass_create_atom_binary_literal(Pool *pool, const char *raw);
+NicateGlassAtomCharacterLiteral *nicate_glass_create_atom_character_literal(Pool *pool, const char *raw);
+NicateGlassAtomComment *nicate_glass_create_atom_comment(Pool *pool, const char *raw);
+NicateGlassAtomDecimalFloatingLiteral *nicate_glass_create_atom_decimal_floating_literal(Pool *pool, const char *raw);
+NicateGlassAtomDecimalLiteral *nicate_glass_create_atom_decimal_literal(Pool *pool, const char *raw);
+NicateGlassAtomHexadecimalFloatingLiteral *nicate_glass_create_atom_hexadecimal_floating_literal(Pool *pool, const char *raw);
+NicateGlassAtomHexadecimalLiteral *nicate_glass_create_atom_hexadecimal_literal(Pool *pool, const char *raw);
+NicateGlassAtomId *nicate_glass_create_atom_id(Pool *pool, const char *raw);
+NicateGlassAtomOctalLiteral *nicate_glass_create_atom_octal_literal(Pool *pool, const char *raw);
+NicateGlassAtomStringLiteral *nicate_glass_create_atom_string_literal(Pool *pool, const char *raw);
+NicateGlassKwBreak *nicate_glass_create_kw_break(Pool *pool);
+NicateGlassKwCase *nicate_glass_create_kw_case(Pool *pool);
+NicateGlassKwContinue *nicate_glass_create_kw_continue(Pool *pool);
+NicateGlassKwDefault *nicate_glass_create_kw_default(Pool *pool);
+NicateGlassKwDo *nicate_glass_create_kw_do(Pool *pool);
+NicateGlassKwElse *nicate_glass_create_kw_else(Pool *pool);
+NicateGlassKwEnum *nicate_glass_create_kw_enum(Pool *pool);
+NicateGlassKwFun *nicate_glass_create_kw_fun(Pool *pool);
+NicateGlassKwGoto *nicate_glass_create_kw_goto(Pool *pool);
+NicateGlassKwIf *nicate_glass_create_kw_if(Pool *pool);
+NicateGlassKwLet *nicate_glass_create_kw_let(Pool *pool);
+NicateGlassKwReturn *nicate_glass_create_kw_return(Pool *pool);
+NicateGlassKwStruct *nicate_glass_create_kw_struct(Pool *pool);
+NicateGlassKwSwitch *nicate_glass_create_kw_switch(Pool *pool);
+NicateGlassKwUnion *nicate_glass_create_kw_union(Pool *pool);
+NicateGlassKwWhile *nicate_glass_create_kw_while(Pool *pool);
+NicateGlassSymAmpersand *nicate_glass_create_sym_ampersand(Pool *pool);
+NicateGlassSymAmpersandBe *nicate_glass_create_sym_ampersand_be(Pool *pool);
+NicateGlassSymArrow *nicate_glass_create_sym_arrow(Pool *pool);
+NicateGlassSymAt *nicate_glass_create_sym_at(Pool *pool);
+NicateGlassSymBang *nicate_glass_create_sym_bang(Pool *pool);
+NicateGlassSymBe *nicate_glass_create_sym_be(Pool *pool);
+NicateGlassSymCaret *nicate_glass_create_sym_caret(Pool *pool);
+NicateGlassSymCaretBe *nicate_glass_create_sym_caret_be(Pool *pool);
+NicateGlassSymColon *nicate_glass_create_sym_colon(Pool *pool);
+NicateGlassSymComma *nicate_glass_create_sym_comma(Pool *pool);
+NicateGlassSymDecr *nicate_glass_create_sym_decr(Pool *pool);
+NicateGlassSymDot *nicate_glass_create_sym_dot(Pool *pool);
+NicateGlassSymEllipsis *nicate_glass_create_sym_ellipsis(Pool *pool);
+NicateGlassSymEq *nicate_glass_create_sym_eq(Pool *pool);
+NicateGlassSymGe *nicate_glass_create_sym_ge(Pool *pool);
+NicateGlassSymGt *nicate_glass_create_sym_gt(Pool *pool);
+NicateGlassSymIncr *nicate_glass_create_sym_incr(Pool *pool);
+NicateGlassSymLbrace *nicate_glass_create_sym_lbrace(Pool *pool);
+NicateGlassSymLbracket *nicate_glass_create_sym_lbracket(Pool *pool);
+NicateGlassSymLe *nicate_glass_create_sym_le(Pool *pool);
+NicateGlassSymLogicalAnd *nicate_glass_create_sym_logical_and(Pool *pool);
+NicateGlassSymLogicalOr *nicate_glass_create_sym_logical_or(Pool *pool);
+NicateGlassSymLparen *nicate_glass_create_sym_lparen(Pool *pool);
+NicateGlassSymLshift *nicate_glass_create_sym_lshift(Pool *pool);
+NicateGlassSymLshiftBe *nicate_glass_create_sym_lshift_be(Pool *pool);
+NicateGlassSymLt *nicate_glass_create_sym_lt(Pool *pool);
+NicateGlassSymMinus *nicate_glass_create_sym_minus(Pool *pool);
+NicateGlassSymMinusBe *nicate_glass_create_sym_minus_be(Pool *pool);
+NicateGlassSymNe *nicate_glass_create_sym_ne(Pool *pool);
+NicateGlassSymPercent *nicate_glass_create_sym_percent(Pool *pool);
+NicateGlassSymPercentBe *nicate_glass_create_sym_percent_be(Pool *pool);
+NicateGlassSymPipe *nicate_glass_create_sym_pipe(Pool *pool);
+NicateGlassSymPipeBe *nicate_glass_create_sym_pipe_be(Pool *pool);
+NicateGlassSymPlus *nicate_glass_create_sym_plus(Pool *pool);
+NicateGlassSymPlusBe *nicate_glass_create_sym_plus_be(Pool *pool);
+NicateGlassSymRbrace *nicate_glass_create_sym_rbrace(Pool *pool);
+NicateGlassSymRbracket *nicate_glass_create_sym_rbracket(Pool *pool);
+NicateGlassSymRparen *nicate_glass_create_sym_rparen(Pool *pool);
+NicateGlassSymRshift *nicate_glass_create_sym_rshift(Pool *pool);
+NicateGlassSymRshiftBe *nicate_glass_create_sym_rshift_be(Pool *pool);
+NicateGlassSymSemicolon *nicate_glass_create_sym_semicolon(Pool *pool);
+NicateGlassSymSlash *nicate_glass_create_sym_slash(Pool *pool);
+NicateGlassSymSlashBe *nicate_glass_create_sym_slash_be(Pool *pool);
+NicateGlassSymStar *nicate_glass_create_sym_star(Pool *pool);
+NicateGlassSymStarBe *nicate_glass_create_sym_star_be(Pool *pool);
+NicateGlassSymTilde *nicate_glass_create_sym_tilde(Pool *pool);
+NicateGlassTreeAttr *nicate_glass_create_tree_attr(Pool *pool, NicateGlassSymAt *sym_at, NicateGlassAtomId *atom_id, NicateGlassOptLparen *opt_lparen, NicateGlassSlaveExprList *slave_expr_list, NicateGlassSlaveRparen *slave_rparen);
+NicateGlassTreeCompoundStmt *nicate_glass_create_tree_compound_stmt(Pool *pool, NicateGlassSymLbrace *sym_lbrace, NicateGlassOptStmtList *opt_stmt_list, NicateGlassSymRbrace *sym_rbrace);
+NicateGlassTreeEnumList *nicate_glass_create_tree_enum_list(Pool *pool, NicateGlassOptEnumList *opt_enum_list, NicateGlassSlaveComma *slave_comma, NicateGlassTreeEnumerator *tree_enumerator);
+NicateGlassTreeEnumerator *nicate_glass_create_tree_enumerator(Pool *pool, NicateGlassAtomId *atom_id, NicateGlassOptBe *opt_be, NicateGlassSlaveExpr *slave_expr);
+NicateGlassTreeExprList *nicate_glass_create_tree_expr_list(Pool *pool, NicateGlassOptExprList *opt_expr_list, NicateGlassSlaveComma *slave_comma, NicateGlassAliasExpr *alias_expr);
+NicateGlassTreeStmtList *nicate_glass_create_tree_stmt_list(Pool *pool, NicateGlassOptStmtList *opt_stmt_list, NicateGlassAnyStmt *any_stmt);
+NicateGlassTreeTagAddressofExpr *nicate_glass_create_tree_tag_addressof_expr(Pool *pool, NicateGlassSymAmpersand *sym_ampersand, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagAnnotatedStmt *nicate_glass_create_tree_tag_annotated_stmt(Pool *pool, NicateGlassTreeAttr *tree_attr, NicateGlassAnyAttrStmt *any_attr_stmt);
+NicateGlassTreeTagArrayLiteral *nicate_glass_create_tree_tag_array_literal(Pool *pool, NicateGlassSymLbracket *sym_lbracket, NicateGlassOptExprList *opt_expr_list, NicateGlassSymRbracket *sym_rbracket);
+NicateGlassTreeTagAttrExpr *nicate_glass_create_tree_tag_attr_expr(Pool *pool, NicateGlassAnyQuasipostfixExpr *any_quasipostfix_expr, NicateGlassTreeAttr *tree_attr);
+NicateGlassTreeTagBitAndAssign *nicate_glass_create_tree_tag_bit_and_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymAmpersandBe *sym_ampersand_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagBitAndExpr *nicate_glass_create_tree_tag_bit_and_expr(Pool *pool, NicateGlassAnyBitwiseAndExpr *any_bitwise_and_expr, NicateGlassSymAmpersand *sym_ampersand, NicateGlassAnyCmpExpr *any_cmp_expr);
+NicateGlassTreeTagBitIorExpr *nicate_glass_create_tree_tag_bit_ior_expr(Pool *pool, NicateGlassAnyBitwiseIorExpr *any_bitwise_ior_expr, NicateGlassSymPipe *sym_pipe, NicateGlassAnyBitwiseXorExpr *any_bitwise_xor_expr);
+NicateGlassTreeTagBitNotExpr *nicate_glass_create_tree_tag_bit_not_expr(Pool *pool, NicateGlassSymTilde *sym_tilde, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagBitOrAssign *nicate_glass_create_tree_tag_bit_or_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymPipeBe *sym_pipe_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagBitXorAssign *nicate_glass_create_tree_tag_bit_xor_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymCaretBe *sym_caret_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagBitXorExpr *nicate_glass_create_tree_tag_bit_xor_expr(Pool *pool, NicateGlassAnyBitwiseXorExpr *any_bitwise_xor_expr, NicateGlassSymCaret *sym_caret, NicateGlassAnyBitwiseAndExpr *any_bitwise_and_expr);
+NicateGlassTreeTagBreakStmt *nicate_glass_create_tree_tag_break_stmt(Pool *pool, NicateGlassKwBreak *kw_break, NicateGlassSymSemicolon *sym_semicolon);
+NicateGlassTreeTagCallExpr *nicate_glass_create_tree_tag_call_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymLparen *sym_lparen, NicateGlassOptExprList *opt_expr_list, NicateGlassSymRparen *sym_rparen);
+NicateGlassTreeTagCaseStmt *nicate_glass_create_tree_tag_case_stmt(Pool *pool, NicateGlassKwCase *kw_case, NicateGlassAliasExpr *alias_expr, NicateGlassSymColon *sym_colon, NicateGlassAnyStmt *any_stmt);
+NicateGlassTreeTagContinueStmt *nicate_glass_create_tree_tag_continue_stmt(Pool *pool, NicateGlassKwContinue *kw_continue, NicateGlassSymSemicolon *sym_semicolon);
+NicateGlassTreeTagDeclaration *nicate_glass_create_tree_tag_declaration(Pool *pool, NicateGlassKwLet *kw_let, NicateGlassTreeTypedId *tree_typed_id, NicateGlassSymSemicolon *sym_semicolon);
+NicateGlassTreeTagDefaultStmt *nicate_glass_create_tree_tag_default_stmt(Pool *pool, NicateGlassKwDefault *kw_default, NicateGlassSymColon *sym_colon, NicateGlassAnyStmt *any_stmt);
+NicateGlassTreeTagDivideAssign *nicate_glass_create_tree_tag_divide_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymSlashBe *sym_slash_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagDivideExpr *nicate_glass_create_tree_tag_divide_expr(Pool *pool, NicateGlassAnyMulExpr *any_mul_expr, NicateGlassSymSlash *sym_slash, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagDoStmt *nicate_glass_create_tree_tag_do_stmt(Pool *pool, NicateGlassKwDo *kw_do, NicateGlassTreeCompoundStmt *tree_compound_stmt, NicateGlassKwWhile *kw_while, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassSymSemicolon *sym_semicolon);
+NicateGlassTreeTagEnumBody *nicate_glass_create_tree_tag_enum_body(Pool *pool, NicateGlassSymLbrace *sym_lbrace, NicateGlassOptEnumList *opt_enum_list, NicateGlassSymRbrace *sym_rbrace);
+NicateGlassTreeTagEnumStmt *nicate_glass_create_tree_tag_enum_stmt(Pool *pool, NicateGlassKwEnum *kw_enum, NicateGlassAtomId *atom_id, NicateGlassAnyMaybeEnumBody *any_maybe_enum_body);
+NicateGlassTreeTagEqExpr *nicate_glass_create_tree_tag_eq_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymEq *sym_eq, NicateGlassAnyShiftExpr *any_shift_expr2);
+NicateGlassTreeTagExprStmt *nicate_glass_create_tree_tag_expr_stmt(Pool *pool, NicateGlassAnyAssign *any_assign, NicateGlassSymSemicolon *sym_semicolon);
+NicateGlassTreeTagFixedFunSig *nicate_glass_create_tree_tag_fixed_fun_sig(Pool *pool, NicateGlassSymLparen *sym_lparen, NicateGlassOptTypedIdList *opt_typed_id_list, NicateGlassSymRparen *sym_rparen, NicateGlassSymArrow *sym_arrow, NicateGlassAliasExpr *alias_expr);
+NicateGlassTreeTagFunStmt *nicate_glass_create_tree_tag_fun_stmt(Pool *pool, NicateGlassKwFun *kw_fun, NicateGlassAtomId *atom_id, NicateGlassAnyFunSig *any_fun_sig, NicateGlassAnyMaybeCompoundStmt *any_maybe_compound_stmt);
+NicateGlassTreeTagGeExpr *nicate_glass_create_tree_tag_ge_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymGe *sym_ge, NicateGlassAnyShiftExpr *any_shift_expr2);
+NicateGlassTreeTagGotoStmt *nicate_glass_create_tree_tag_goto_stmt(Pool *pool, NicateGlassKwGoto *kw_goto, NicateGlassAtomId *atom_id, NicateGlassSymSemicolon *sym_semicolon);
+NicateGlassTreeTagGtExpr *nicate_glass_create_tree_tag_gt_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymGt *sym_gt, NicateGlassAnyShiftExpr *any_shift_expr2);
+NicateGlassTreeTagIfElseStmt *nicate_glass_create_tree_tag_if_else_stmt(Pool *pool, NicateGlassKwIf *kw_if, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassTreeCompoundStmt *tree_compound_stmt, NicateGlassKwElse *kw_else, NicateGlassAnyIfOrCompoundStmt *any_if_or_compound_stmt);
+NicateGlassTreeTagIfStmt *nicate_glass_create_tree_tag_if_stmt(Pool *pool, NicateGlassKwIf *kw_if, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassTreeCompoundStmt *tree_compound_stmt);
+NicateGlassTreeTagIndexExpr *nicate_glass_create_tree_tag_index_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymLbracket *sym_lbracket, NicateGlassOptExprList *opt_expr_list, NicateGlassSymRbracket *sym_rbracket);
+NicateGlassTreeTagInitializedDeclaration *nicate_glass_create_tree_tag_initialized_declaration(Pool *pool, NicateGlassKwLet *kw_let, NicateGlassAnyMaybeTypedId *any_maybe_typed_id, NicateGlassSymBe *sym_be, NicateGlassAliasExpr *alias_expr, NicateGlassSymSemicolon *sym_semicolon);
+NicateGlassTreeTagLabeledStmt *nicate_glass_create_tree_tag_labeled_stmt(Pool *pool, NicateGlassAtomId *atom_id, NicateGlassSymColon *sym_colon, NicateGlassAnyStmt *any_stmt);
+NicateGlassTreeTagLeExpr *nicate_glass_create_tree_tag_le_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymLe *sym_le, NicateGlassAnyShiftExpr *any_shift_expr2);
+NicateGlassTreeTagLeftShiftAssign *nicate_glass_create_tree_tag_left_shift_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymLshiftBe *sym_lshift_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagLeftShiftExpr *nicate_glass_create_tree_tag_left_shift_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr, NicateGlassSymLshift *sym_lshift, NicateGlassAnyAddExpr *any_add_expr);
+NicateGlassTreeTagLogAndExpr *nicate_glass_create_tree_tag_log_and_expr(Pool *pool, NicateGlassAnyLogicalAndExpr *any_logical_and_expr, NicateGlassSymLogicalAnd *sym_logical_and, NicateGlassAnyBitwiseIorExpr *any_bitwise_ior_expr);
+NicateGlassTreeTagLogNotExpr *nicate_glass_create_tree_tag_log_not_expr(Pool *pool, NicateGlassSymBang *sym_bang, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagLogOrExpr *nicate_glass_create_tree_tag_log_or_expr(Pool *pool, NicateGlassAnyLogicalOrExpr *any_logical_or_expr, NicateGlassSymLogicalOr *sym_logical_or, NicateGlassAnyLogicalAndExpr *any_logical_and_expr);
+NicateGlassTreeTagLtExpr *nicate_glass_create_tree_tag_lt_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymLt *sym_lt, NicateGlassAnyShiftExpr *any_shift_expr2);
+NicateGlassTreeTagMemberExpr *nicate_glass_create_tree_tag_member_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymDot *sym_dot, NicateGlassAtomId *atom_id);
+NicateGlassTreeTagMinusAssign *nicate_glass_create_tree_tag_minus_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymMinusBe *sym_minus_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagMinusExpr *nicate_glass_create_tree_tag_minus_expr(Pool *pool, NicateGlassAnyAddExpr *any_add_expr, NicateGlassSymMinus *sym_minus, NicateGlassAnyMulExpr *any_mul_expr);
+NicateGlassTreeTagModuloAssign *nicate_glass_create_tree_tag_modulo_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymPercentBe *sym_percent_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagModuloExpr *nicate_glass_create_tree_tag_modulo_expr(Pool *pool, NicateGlassAnyMulExpr *any_mul_expr, NicateGlassSymPercent *sym_percent, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagNeExpr *nicate_glass_create_tree_tag_ne_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr1, NicateGlassSymNe *sym_ne, NicateGlassAnyShiftExpr *any_shift_expr2);
+NicateGlassTreeTagParenExpr *nicate_glass_create_tree_tag_paren_expr(Pool *pool, NicateGlassSymLparen *sym_lparen, NicateGlassAnyAssign *any_assign, NicateGlassSymRparen *sym_rparen);
+NicateGlassTreeTagPlusAssign *nicate_glass_create_tree_tag_plus_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymPlusBe *sym_plus_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagPlusExpr *nicate_glass_create_tree_tag_plus_expr(Pool *pool, NicateGlassAnyAddExpr *any_add_expr, NicateGlassSymPlus *sym_plus, NicateGlassAnyMulExpr *any_mul_expr);
+NicateGlassTreeTagPostDecrExpr *nicate_glass_create_tree_tag_post_decr_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymDecr *sym_decr);
+NicateGlassTreeTagPostIncrExpr *nicate_glass_create_tree_tag_post_incr_expr(Pool *pool, NicateGlassAnyPostfixExpr *any_postfix_expr, NicateGlassSymIncr *sym_incr);
+NicateGlassTreeTagPreDecrExpr *nicate_glass_create_tree_tag_pre_decr_expr(Pool *pool, NicateGlassSymDecr *sym_decr, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagPreIncrExpr *nicate_glass_create_tree_tag_pre_incr_expr(Pool *pool, NicateGlassSymIncr *sym_incr, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagReturnStmt *nicate_glass_create_tree_tag_return_stmt(Pool *pool, NicateGlassKwReturn *kw_return, NicateGlassOptExpr *opt_expr, NicateGlassSymSemicolon *sym_semicolon);
+NicateGlassTreeTagRightShiftAssign *nicate_glass_create_tree_tag_right_shift_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymRshiftBe *sym_rshift_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagRightShiftExpr *nicate_glass_create_tree_tag_right_shift_expr(Pool *pool, NicateGlassAnyShiftExpr *any_shift_expr, NicateGlassSymRshift *sym_rshift, NicateGlassAnyAddExpr *any_add_expr);
+NicateGlassTreeTagSimpleAssign *nicate_glass_create_tree_tag_simple_assign(Pool *pool, NicateGlassAliasExpr *alias_expr, NicateGlassSymBe *sym_be, NicateGlassAnyAssign *any_assign);
+NicateGlassTreeTagStructBody *nicate_glass_create_tree_tag_struct_body(Pool *pool, NicateGlassSymLbrace *sym_lbrace, NicateGlassOptTypedIdList *opt_typed_id_list, NicateGlassSymRbrace *sym_rbrace);
+NicateGlassTreeTagStructStmt *nicate_glass_create_tree_tag_struct_stmt(Pool *pool, NicateGlassKwStruct *kw_struct, NicateGlassAtomId *atom_id, NicateGlassAnyMaybeStructBody *any_maybe_struct_body);
+NicateGlassTreeTagSwitchStmt *nicate_glass_create_tree_tag_switch_stmt(Pool *pool, NicateGlassKwSwitch *kw_switch, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassTreeCompoundStmt *tree_compound_stmt);
+NicateGlassTreeTagTimesAssign *nicate_glass_create_tree_tag_times_assign(Pool *pool, NicateGlassAliasExpr *alias_expr1, NicateGlassSymStarBe *sym_star_be, NicateGlassAliasExpr *alias_expr2);
+NicateGlassTreeTagTimesExpr *nicate_glass_create_tree_tag_times_expr(Pool *pool, NicateGlassAnyMulExpr *any_mul_expr, NicateGlassSymStar *sym_star, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagUnaryMinusExpr *nicate_glass_create_tree_tag_unary_minus_expr(Pool *pool, NicateGlassSymMinus *sym_minus, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagUnaryPlusExpr *nicate_glass_create_tree_tag_unary_plus_expr(Pool *pool, NicateGlassSymPlus *sym_plus, NicateGlassAnyUnaryExpr *any_unary_expr);
+NicateGlassTreeTagUnionStmt *nicate_glass_create_tree_tag_union_stmt(Pool *pool, NicateGlassKwUnion *kw_union, NicateGlassAtomId *atom_id, NicateGlassAnyMaybeStructBody *any_maybe_struct_body);
+NicateGlassTreeTagUntypedId *nicate_glass_create_tree_tag_untyped_id(Pool *pool, NicateGlassAtomId *atom_id, NicateGlassSymColon *sym_colon);
+NicateGlassTreeTagVariadicFunSig *nicate_glass_create_tree_tag_variadic_fun_sig(Pool *pool, NicateGlassSymLparen *sym_lparen, NicateGlassTreeTypedIdList *tree_typed_id_list, NicateGlassSymComma *sym_comma, NicateGlassSymEllipsis *sym_ellipsis, NicateGlassSymRparen *sym_rparen, NicateGlassSymArrow *sym_arrow, NicateGlassAliasExpr *alias_expr);
+NicateGlassTreeTagWhileStmt *nicate_glass_create_tree_tag_while_stmt(Pool *pool, NicateGlassKwWhile *kw_while, NicateGlassSymLparen *sym_lparen, NicateGlassAliasExpr *alias_expr, NicateGlassSymRparen *sym_rparen, NicateGlassTreeCompoundStmt *tree_compound_stmt);
+NicateGlassTreeTu *nicate_glass_create_tree_tu(Pool *pool, NicateGlassOptTu *opt_tu, NicateGlassAnyStmt *any_stmt);
+NicateGlassTreeTypedId *nicate_glass_create_tree_typed_id(Pool *pool, NicateGlassAtomId *atom_id, NicateGlassSymColon *sym_colon, NicateGlassAliasExpr *alias_expr);
+NicateGlassTreeTypedIdList *nicate_glass_create_tree_typed_id_list(Pool *pool, NicateGlassOptTypedIdList *opt_typed_id_list, NicateGlassSlaveComma *slave_comma, NicateGlassTreeTypedId *tree_typed_id);
+
+/* Type checking. */
+bool nicate_glass_is_nothing(NicateGlassAst *ast);
+bool nicate_glass_is_alias_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_add_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_assign(NicateGlassAst *ast);
+bool nicate_glass_is_any_attr_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_any_bitwise_and_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_bitwise_ior_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_bitwise_xor_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_cmp_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_fun_sig(NicateGlassAst *ast);
+bool nicate_glass_is_any_if_or_compound_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_any_literal(NicateGlassAst *ast);
+bool nicate_glass_is_any_logical_and_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_logical_or_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_maybe_compound_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_any_maybe_enum_body(NicateGlassAst *ast);
+bool nicate_glass_is_any_maybe_struct_body(NicateGlassAst *ast);
+bool nicate_glass_is_any_maybe_typed_id(NicateGlassAst *ast);
+bool nicate_glass_is_any_mul_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_noattr_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_any_postfix_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_primary_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_quasipostfix_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_shift_expr(NicateGlassAst *ast);
+bool nicate_glass_is_any_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_any_unary_expr(NicateGlassAst *ast);
+bool nicate_glass_is_atom_binary_literal(NicateGlassAst *ast);
+bool nicate_glass_is_atom_character_literal(NicateGlassAst *ast);
+bool nicate_glass_is_atom_comment(NicateGlassAst *ast);
+bool nicate_glass_is_atom_decimal_floating_literal(NicateGlassAst *ast);
+bool nicate_glass_is_atom_decimal_literal(NicateGlassAst *ast);
+bool nicate_glass_is_atom_hexadecimal_floating_literal(NicateGlassAst *ast);
+bool nicate_glass_is_atom_hexadecimal_literal(NicateGlassAst *ast);
+bool nicate_glass_is_atom_id(NicateGlassAst *ast);
+bool nicate_glass_is_atom_octal_literal(NicateGlassAst *ast);
+bool nicate_glass_is_atom_string_literal(NicateGlassAst *ast);
+bool nicate_glass_is_kw_break(NicateGlassAst *ast);
+bool nicate_glass_is_kw_case(NicateGlassAst *ast);
+bool nicate_glass_is_kw_continue(NicateGlassAst *ast);
+bool nicate_glass_is_kw_default(NicateGlassAst *ast);
+bool nicate_glass_is_kw_do(NicateGlassAst *ast);
+bool nicate_glass_is_kw_else(NicateGlassAst *ast);
+bool nicate_glass_is_kw_enum(NicateGlassAst *ast);
+bool nicate_glass_is_kw_fun(NicateGlassAst *ast);
+bool nicate_glass_is_kw_goto(NicateGlassAst *ast);
+bool nicate_glass_is_kw_if(NicateGlassAst *ast);
+bool nicate_glass_is_kw_let(NicateGlassAst *ast);
+bool nicate_glass_is_kw_return(NicateGlassAst *ast);
+bool nicate_glass_is_kw_struct(NicateGlassAst *ast);
+bool nicate_glass_is_kw_switch(NicateGlassAst *ast);
+bool nicate_glass_is_kw_union(NicateGlassAst *ast);
+bool nicate_glass_is_kw_while(NicateGlassAst *ast);
+bool nicate_glass_is_opt_be(NicateGlassAst *ast);
+bool nicate_glass_is_opt_enum_list(NicateGlassAst *ast);
+bool nicate_glass_is_opt_expr(NicateGlassAst *ast);
+bool nicate_glass_is_opt_expr_list(NicateGlassAst *ast);
+bool nicate_glass_is_opt_lparen(NicateGlassAst *ast);
+bool nicate_glass_is_opt_stmt_list(NicateGlassAst *ast);
+bool nicate_glass_is_opt_tu(NicateGlassAst *ast);
+bool nicate_glass_is_opt_typed_id_list(NicateGlassAst *ast);
+bool nicate_glass_is_slave_comma(NicateGlassAst *ast);
+bool nicate_glass_is_slave_expr(NicateGlassAst *ast);
+bool nicate_glass_is_slave_expr_list(NicateGlassAst *ast);
+bool nicate_glass_is_slave_rparen(NicateGlassAst *ast);
+bool nicate_glass_is_sym_ampersand(NicateGlassAst *ast);
+bool nicate_glass_is_sym_ampersand_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_arrow(NicateGlassAst *ast);
+bool nicate_glass_is_sym_at(NicateGlassAst *ast);
+bool nicate_glass_is_sym_bang(NicateGlassAst *ast);
+bool nicate_glass_is_sym_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_caret(NicateGlassAst *ast);
+bool nicate_glass_is_sym_caret_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_colon(NicateGlassAst *ast);
+bool nicate_glass_is_sym_comma(NicateGlassAst *ast);
+bool nicate_glass_is_sym_decr(NicateGlassAst *ast);
+bool nicate_glass_is_sym_dot(NicateGlassAst *ast);
+bool nicate_glass_is_sym_ellipsis(NicateGlassAst *ast);
+bool nicate_glass_is_sym_eq(NicateGlassAst *ast);
+bool nicate_glass_is_sym_ge(NicateGlassAst *ast);
+bool nicate_glass_is_sym_gt(NicateGlassAst *ast);
+bool nicate_glass_is_sym_incr(NicateGlassAst *ast);
+bool nicate_glass_is_sym_lbrace(NicateGlassAst *ast);
+bool nicate_glass_is_sym_lbracket(NicateGlassAst *ast);
+bool nicate_glass_is_sym_le(NicateGlassAst *ast);
+bool nicate_glass_is_sym_logical_and(NicateGlassAst *ast);
+bool nicate_glass_is_sym_logical_or(NicateGlassAst *ast);
+bool nicate_glass_is_sym_lparen(NicateGlassAst *ast);
+bool nicate_glass_is_sym_lshift(NicateGlassAst *ast);
+bool nicate_glass_is_sym_lshift_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_lt(NicateGlassAst *ast);
+bool nicate_glass_is_sym_minus(NicateGlassAst *ast);
+bool nicate_glass_is_sym_minus_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_ne(NicateGlassAst *ast);
+bool nicate_glass_is_sym_percent(NicateGlassAst *ast);
+bool nicate_glass_is_sym_percent_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_pipe(NicateGlassAst *ast);
+bool nicate_glass_is_sym_pipe_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_plus(NicateGlassAst *ast);
+bool nicate_glass_is_sym_plus_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_rbrace(NicateGlassAst *ast);
+bool nicate_glass_is_sym_rbracket(NicateGlassAst *ast);
+bool nicate_glass_is_sym_rparen(NicateGlassAst *ast);
+bool nicate_glass_is_sym_rshift(NicateGlassAst *ast);
+bool nicate_glass_is_sym_rshift_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_semicolon(NicateGlassAst *ast);
+bool nicate_glass_is_sym_slash(NicateGlassAst *ast);
+bool nicate_glass_is_sym_slash_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_star(NicateGlassAst *ast);
+bool nicate_glass_is_sym_star_be(NicateGlassAst *ast);
+bool nicate_glass_is_sym_tilde(NicateGlassAst *ast);
+bool nicate_glass_is_tree_attr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_compound_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_enum_list(NicateGlassAst *ast);
+bool nicate_glass_is_tree_enumerator(NicateGlassAst *ast);
+bool nicate_glass_is_tree_expr_list(NicateGlassAst *ast);
+bool nicate_glass_is_tree_stmt_list(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_addressof_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_annotated_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_array_literal(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_attr_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_bit_and_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_bit_and_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_bit_ior_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_bit_not_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_bit_or_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_bit_xor_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_bit_xor_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_break_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_call_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_case_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_continue_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_declaration(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_default_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_divide_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_divide_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_do_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_enum_body(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_enum_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_eq_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_expr_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_fixed_fun_sig(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_fun_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_ge_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_goto_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_gt_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_if_else_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_if_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_index_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_initialized_declaration(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_labeled_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_le_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_left_shift_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_left_shift_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_log_and_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_log_not_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_log_or_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_lt_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_member_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_minus_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_minus_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_modulo_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_modulo_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_ne_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_paren_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_plus_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_plus_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_post_decr_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_post_incr_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_pre_decr_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_pre_incr_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_return_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_right_shift_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_right_shift_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_simple_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_struct_body(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_struct_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_switch_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_times_assign(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_times_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_unary_minus_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_unary_plus_expr(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_union_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_untyped_id(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_variadic_fun_sig(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tag_while_stmt(NicateGlassAst *ast);
+bool nicate_glass_is_tree_tu(NicateGlassAst *ast);
+bool nicate_glass_is_tree_typed_id(NicateGlassAst *ast);
+bool nicate_glass_is_tree_typed_id_list(NicateGlassAst *ast);
+
+/* Output. */
+void nicate_glass_emit(NicateGlassAst *ast, FILE *fp);
@@ -16,7 +16,8 @@
 #   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 import cffi
-from collections import namedtuple
+import os
+from collections import deque, namedtuple
 
 from . import grammar
 from .util import u2b, b2u, eprint as print
@@ -32,9 +33,11 @@ def load():
     for fn in [
             'src/fwd.h',
             'src/builder.h',
+            'src/mre.h',
             'src/lexer.h',
             'src/automaton.h',
             'src/automaton-internal.h',
+            'src/typenames.h',
     ]:
         with open(fn) as f:
             x = [l.replace(' __extension__ ', ' ') for l in f if not l.startswith('#')]
@@ -201,20 +204,37 @@ def new_string(u):
     return nicate_ffi.new('char[]', b)
 
 Symbol = namedtuple('Symbol', ('name', 'regex'))
+# As MRE_MAX_GROUPS, since cffi does not see #defines.
+MAX_GROUPS = 16
 
 class Lexicon:
     __slots__ = ('_c_lexicon', '_names', '_regexes')
 
-    def __init__(self, symbols):
+    def __init__(self, symbols, skip=(), **options):
+        ''' Tokens named in `skip` are consumed without being returned.
+
+            Other keyword arguments set fields of MreOptions, e.g.
+            `engine=nicate_library.MRE_ENGINE_LAZY_DFA`.
+
+            Raises ValueError if the rules are invalid or over budget.
+        '''
         syms = [(new_string(s.name), new_string(s.regex)) for s in symbols]
-        self._c_lexicon = nicate_library.lexicon_create(len(syms), nicate_ffi.new('Symbol[]', syms))
+        skip_ids = [i + 1 for (i, s) in enumerate(symbols) if s.name in skip]
+        c_options = nicate_ffi.new('MreOptions *')
+        nicate_library.mre_options_init(c_options)
+        for k, v in options.items():
+            setattr(c_options, k, v)
+        self._c_lexicon = nicate_library.lexicon_create_with_skip(len(syms), nicate_ffi.new('Symbol[]', syms), c_options, len(skip_ids), skip_ids)
+        if not self._c_lexicon:
+            raise ValueError('invalid or over-budget lexicon')
         self._names = ['error'] + [s.name for s in symbols]
         self._regexes = ['(.)'] + [s.regex for s in symbols]
         for i in range(len(symbols)):
             assert self.__name(i) == self.name(i)
 
     def __del__(self):
-        nicate_library.lexicon_destroy(self._c_lexicon)
+        if self._c_lexicon:
+            nicate_library.lexicon_destroy(self._c_lexicon)
 
     def __name(self, idx):
         c = nicate_library.lexicon_name(self._c_lexicon, idx)
@@ -224,33 +244,170 @@ class Lexicon:
     def name(self, idx):
         return self._names[idx]
 
+class Search:
+    __slots__ = ('_c_search', '_names')
+
+    def __init__(self, symbols, **options):
+        ''' Finds the symbols anywhere in a text, as grep would.
+
+            Options are as for Lexicon, and so is the ValueError.
+        '''
+        syms = [(new_string(s.name), new_string(s.regex)) for s in symbols]
+        c_options = nicate_ffi.new('MreOptions *')
+        nicate_library.mre_options_init(c_options)
+        for k, v in options.items():
+            setattr(c_options, k, v)
+        self._c_search = nicate_library.lexicon_search_create(len(syms), nicate_ffi.new('Symbol[]', syms), c_options)
+        if not self._c_search:
+            raise ValueError('invalid or over-budget lexicon')
+        self._names = ['error'] + [s.name for s in symbols]
+
+    def __del__(self):
+        if self._c_search:
+            nicate_library.mre_search_destroy(self._c_search)
+
+    def find_all(self, u, groups=False):
+        ''' Yield (name, offset, text) for each match that does not
+            overlap an earlier one, leftmost first and then longest.
+            Offsets are in bytes, as for Tokenizer.
+
+            With groups, also yield a dict of the text of each $( ) group
+            that took part in the match, by number, as Tokenizer.get_groups.
+        '''
+        b = u2b(u)
+        buf = nicate_ffi.new('char[]', b)
+        start = nicate_ffi.new('size_t *')
+        size = nicate_ffi.new('size_t *')
+        pos = 0
+        while True:
+            sym = nicate_library.mre_search(self._c_search, buf, len(b), pos, start, size)
+            if not sym:
+                return
+            match_start = start[0]
+            pos = match_start + size[0]
+            if not groups:
+                yield (self._names[sym], match_start, b2u(b[match_start:pos]))
+                continue
+            found = {}
+            for g in range(1, MAX_GROUPS + 1):
+                if nicate_library.mre_search_group(self._c_search, g, start, size):
+                    found[g] = b2u(b[start[0]:start[0] + size[0]])
+            yield (self._names[sym], match_start, b2u(b[match_start:pos]), found)
+
 class Tokenizer:
-    __slots__ = ('_c_tokenizer', '_py_lexicon')
+    __slots__ = ('_c_tokenizer', '_py_lexicon', '_borrowed', '_text', '_text_base', '_queue', '_batch', '_whole', '_mark', '_last')
+
+    BATCH = 256
 
     def __init__(self, lexicon):
         self._c_tokenizer = nicate_library.tokenizer_create(lexicon._c_lexicon)
         self._py_lexicon = lexicon
+        self._batch = [nicate_ffi.new('uint32_t[]', self.BATCH) for _ in range(3)]
+        self._clear()
 
     def __del__(self):
         nicate_library.tokenizer_destroy(self._c_tokenizer)
 
+    def _clear(self):
+        # The input not yet popped, from offset `_text_base` on, so that
+        # a whole batch of tokens can be sliced out of it.
+        self._borrowed = None
+        self._text = bytearray()
+        self._text_base = 0
+        self._queue = deque()
+        # Whether the C tokenizer can locate any offset by itself.
+        self._whole = False
+        # The (offset, line, col) of the current batch's first token,
+        # and the offset of the token last returned by get.
+        self._mark = (0, 1, 1)
+        self._last = 0
+
     def clone(self):
         rv = object.__new__(Tokenizer)
         rv._c_tokenizer = nicate_library.tokenizer_clone(self._c_tokenizer)
         rv._py_lexicon = self._py_lexicon
+        rv._batch = [nicate_ffi.new('uint32_t[]', self.BATCH) for _ in range(3)]
+        rv._clear()
         return rv
 
     def reset(self):
         nicate_library.tokenizer_reset(self._c_tokenizer)
+        self._clear()
+
+    def finish(self):
+        nicate_library.tokenizer_finish(self._c_tokenizer)
+
+    def steps(self):
+        return nicate_library.tokenizer_steps(self._c_tokenizer)
 
     def feed(self, u):
         b = u2b(u)
+        self._text += b
         nicate_library.tokenizer_feed_slice(self._c_tokenizer, b, len(b))
 
+    def feed_chunk(self, u):
+        ''' Like feed, but only copies what spans chunks.
+        '''
+        b = u2b(u)
+        self._text += b
+        # The previous chunk is no longer needed once this returns.
+        borrowed = nicate_ffi.new('char[]', b)
+        nicate_library.tokenizer_feed_chunk(self._c_tokenizer, borrowed, len(b))
+        self._borrowed = borrowed
+
+    def feed_all(self, u):
+        ''' Tokenize the whole input without buffering it again.
+        '''
+        b = u2b(u)
+        self._clear()
+        self._borrowed = nicate_ffi.new('char[]', b)
+        self._text = nicate_ffi.buffer(self._borrowed, len(b))
+        self._whole = True
+        nicate_library.tokenizer_borrow(self._c_tokenizer, self._borrowed, len(b))
+
+    def map_file(self, path):
+        t = self._c_tokenizer
+        self._clear()
+        if not nicate_library.tokenizer_map_file(t, u2b(path)):
+            err = nicate_ffi.errno
+            raise OSError(err, os.strerror(err), path)
+        self._text = nicate_ffi.buffer(nicate_library.tokenizer_text_start(t), os.path.getsize(path))
+        self._whole = True
+
+    def _set_mark(self):
+        t = self._c_tokenizer
+        start = nicate_library.tokenizer_offset(t)
+        self._mark = (start, nicate_library.tokenizer_line(t), nicate_library.tokenizer_col(t))
+        # Everything before the mark has been returned already.
+        done = start - self._text_base
+        if isinstance(self._text, bytearray) and done * 2 > len(self._text):
+            del self._text[:done]
+            self._text_base = start
+
+    def _next_batch(self):
+        syms, offsets, lens = self._batch
+        self._set_mark()
+        n = nicate_library.tokenizer_next_batch(self._c_tokenizer, self.BATCH, syms, offsets, lens)
+        names = self._py_lexicon._names
+        text = self._text
+        base = self._text_base
+        queue = self._queue
+        for i in range(n):
+            o = offsets[i] - base
+            queue.append((names[syms[i]], b2u(text[o:o + lens[i]]), offsets[i]))
+
     def get(self, at_eof):
+        if not self._queue:
+            self._next_batch()
+        if self._queue:
+            name, s, self._last = self._queue.popleft()
+            return (name, s)
         t = self._c_tokenizer
+        # A ready token can only be left out if its offset is too big.
         if not at_eof and not nicate_library.tokenizer_ready(t):
             return None
+        self._set_mark()
+        self._last = self._mark[0]
         i = nicate_library.tokenizer_sym(t)
         b = nicate_library.tokenizer_text_start(t)
         l = nicate_library.tokenizer_text_len(t)
@@ -258,6 +415,94 @@ class Tokenizer:
         nicate_library.tokenizer_pop(t)
         return (self._py_lexicon.name(i), s)
 
+    def get_groups(self, at_eof):
+        ''' As get, but return (name, text, groups), where groups is a
+            dict of the text of each $( ) group that took part in the
+            token, by number. Only the DFA engine reports any groups.
+
+            Tokens are taken one at a time, so there must be none left
+            over from get.
+        '''
+        assert not self._queue
+        t = self._c_tokenizer
+        if not at_eof and not nicate_library.tokenizer_ready(t):
+            return None
+        self._set_mark()
+        self._last = self._mark[0]
+        i = nicate_library.tokenizer_sym(t)
+        b = nicate_library.tokenizer_text_start(t)
+        l = nicate_library.tokenizer_text_len(t)
+        text = nicate_ffi.buffer(b, l)[:]
+        start = nicate_ffi.new('size_t *')
+        size = nicate_ffi.new('size_t *')
+        found = {}
+        for g in range(1, MAX_GROUPS + 1):
+            if nicate_library.tokenizer_group(t, g, start, size):
+                found[g] = b2u(text[start[0]:start[0] + size[0]])
+        nicate_library.tokenizer_pop(t)
+        return (self._py_lexicon.name(i), b2u(text), found)
+
+    def location(self):
+        ''' The (line, col) of the token last returned by get.
+        '''
+        if self._whole:
+            line = nicate_ffi.new('size_t *')
+            col = nicate_ffi.new('size_t *')
+            nicate_library.tokenizer_locate(self._c_tokenizer, self._last, line, col)
+            return (line[0], col[0])
+        start, line, col = self._mark
+        text = self._text
+        a = start - self._text_base
+        b = self._last - self._text_base
+        n = text.count(b'\n', a, b)
+        if n:
+            return (line + n, b - text.rindex(b'\n', a, b))
+        return (line, col + b - a)
+
+class TokenStream:
+    ''' All tokens of a text, kept up to date as it is edited.
+
+        Offsets are in bytes of the UTF-8 text.
+    '''
+    __slots__ = ('_c_stream', '_py_lexicon')
+
+    def __init__(self, lexicon, text=''):
+        self._c_stream = nicate_library.token_stream_create(lexicon._c_lexicon)
+        self._py_lexicon = lexicon
+        self.edit(0, 0, text)
+
+    def __del__(self):
+        nicate_library.token_stream_destroy(self._c_stream)
+
+    def set(self, text, threads=1):
+        ''' Replace the whole text, lexing chunks of it on many threads.
+        '''
+        b = u2b(text)
+        nicate_library.token_stream_set_parallel(self._c_stream, b, len(b), threads)
+
+    def edit(self, offset, delete, insert):
+        ''' Returns (first, removed, added), as token indices and counts.
+        '''
+        b = u2b(insert)
+        out = nicate_ffi.new('size_t[3]')
+        nicate_library.token_stream_edit(self._c_stream, offset, delete, b, len(b), out, out + 1, out + 2)
+        return (out[0], out[1], out[2])
+
+    def steps(self):
+        return nicate_library.token_stream_steps(self._c_stream)
+
+    def __len__(self):
+        return nicate_library.token_stream_size(self._c_stream)
+
+    def __getitem__(self, i):
+        c = self._c_stream
+        if not 0 <= i < len(self):
+            raise IndexError(i)
+        o = nicate_library.token_stream_offset(c, i)
+        l = nicate_library.token_stream_len(c, i)
+        s = nicate_ffi.buffer(nicate_library.token_stream_text(c) + o, l)[:]
+        return (self._py_lexicon.name(nicate_library.token_stream_sym(c, i)), b2u(s))
+
 class Grammar:
     __slots__ = ('_names', '_indices', '_num_terminals', '_num_nonterminals', '_c_grammar', '_derivs')
 
@@ -296,11 +541,34 @@ class Grammar:
     def __del__(self):
         nicate_library.grammar_destroy(self._c_grammar)
 
+# The symbols of gnu-c.gram that TypeNames needs, once lowered.
+C_TYPE_NAME_SYMS = dict(
+    identifier='atom-identifier',
+    typedef_name='atom-typedef-name',
+    typedef_keyword='kw-typedef',
+    open_brace='sym-lbrace',
+    close_brace='sym-rbrace',
+    semicolon='sym-semicolon',
+    open_paren='sym-lparen',
+    close_paren='sym-rparen',
+    comma='sym-comma',
+    declaration='tree-declaration',
+    parameter_declaration='any-parameter-declaration',
+    enumerator='any-enumerator',
+    declaration_specifiers='any-declaration-specifiers',
+    type_specifier='any-type-specifier',
+    initializer='any-initializer',
+    declarators=['tree-declarator', 'any-direct-declarator'],
+)
+# GCC predefines these.
+C_BUILTIN_TYPE_NAMES = ['__builtin_va_list']
+
 class Automaton:
-    __slots__ = ('_py_grammar', '_c_automaton')
+    __slots__ = ('_py_grammar', '_c_automaton', '_c_type_names')
 
     def __init__(self, grammar, states=None):
         self._py_grammar = grammar
+        self._c_type_names = None
         if states is None:
             self._c_automaton = nicate_library.automaton_create_auto(grammar._c_grammar)
             return
@@ -321,21 +589,54 @@ class Automaton:
 
     def __del__(self):
         nicate_library.automaton_destroy(self._c_automaton)
+        if self._c_type_names is not None:
+            nicate_library.type_names_destroy(self._c_type_names)
+
+    def track_type_names(self, syms=C_TYPE_NAME_SYMS, builtins=C_BUILTIN_TYPE_NAMES):
+        ''' Feed identifiers that name typedefs in scope as typedef-names.
+
+            `syms` maps the fields of TypeNameSyms to symbol names.
+        '''
+        indices = self._py_grammar._indices
+        c_syms = nicate_ffi.new('TypeNameSyms *')
+        for k, v in syms.items():
+            if k != 'declarators':
+                setattr(c_syms, k, indices[v])
+        declarators = nicate_ffi.new('size_t[]', [indices[v] for v in syms['declarators']])
+        c_syms.num_declarators = len(declarators)
+        c_syms.declarators = declarators
+        tn = nicate_library.type_names_create(c_syms)
+        for b in builtins:
+            b = u2b(b)
+            nicate_library.type_names_builtin(tn, b, len(b))
+        self._attach(tn)
+
+    def _attach(self, tn):
+        self._c_type_names = tn
+        nicate_library.type_names_attach(tn, self._c_automaton)
 
     def clone(self):
         rv = object.__new__(Automaton)
         rv._py_grammar = self._py_grammar
         rv._c_automaton = nicate_library.automaton_clone(self._c_automaton)
+        rv._c_type_names = None
+        if self._c_type_names is not None:
+            rv._attach(nicate_library.type_names_clone(self._c_type_names))
         return rv
 
     def reset(self):
         nicate_library.automaton_reset(self._c_automaton)
+        if self._c_type_names is not None:
+            nicate_library.type_names_reset(self._c_type_names)
 
     def feed(self, sym, data):
         a = self._c_automaton
         sym = self._py_grammar._indices[sym]
         data = u2b(data)
-        rv = nicate_library.automaton_feed_term(a, sym, data, len(data))
+        if self._c_type_names is not None:
+            rv = nicate_library.type_names_feed(self._c_type_names, a, sym, data, len(data))
+        else:
+            rv = nicate_library.automaton_feed_term(a, sym, data, len(data))
         return bool(rv)
 
     def _get_count(self):
@@ -467,7 +768,7 @@ def lower_grammar(gram):
 
 def lower_lexicon(gram):
     symbols = [Symbol(term.tag.dash, term.regex) for term in gram.patterns]
-    return Lexicon(symbols)
+    return Lexicon(symbols, skip=['whitespace'])
 
 class Error(Exception):
     pass
@@ -486,6 +787,8 @@ class Parser:
         self._py_tokenizer = Tokenizer(lower_lexicon(grammar))
         print('%s: creating automaton ...' % grammar.language.dash)
         self._py_automaton = Automaton(lower_grammar(grammar))
+        if 'atom-typedef-name' in self._py_automaton._py_grammar._indices:
+            self._py_automaton.track_type_names()
         self._loc = LocationTracker('<unknown-file>')
 
         self._classes = self._build_classes(grammar)
@@ -553,7 +856,9 @@ class Parser:
         automaton = self._py_automaton
         grammar = automaton._py_grammar
 
-        tokenizer.feed(text)
+        tokenizer.feed_chunk(text)
+        if at_eof:
+            tokenizer.finish()
         while True:
             sym = tokenizer.get(at_eof)
             if sym is None:
@@ -564,14 +869,14 @@ class Parser:
                     sym_type = '$end'
                     assert sym_data == ''
                 else:
+                    self._loc.line, self._loc.col = tokenizer.location()
                     raise LexerError(self._loc.error('Unexpected character: %s' % sym_data))
-            if sym_type != 'whitespace':
-                if not automaton.feed(sym_type, sym_data):
-                    if sym_type == '$end':
-                        if automaton._get_count() == 0:
-                            break
-                    raise ParserError(self._loc.error('Unexpected %s: %s' % (sym_type, sym_data)))
-            self._loc.track(sym_type, sym_data)
+            if not automaton.feed(sym_type, sym_data):
+                if sym_type == '$end':
+                    if automaton._get_count() == 0:
+                        break
+                self._loc.line, self._loc.col = tokenizer.location()
+                raise ParserError(self._loc.error('Unexpected %s: %s' % (sym_type, sym_data)))
             if sym_data == '':
                 break
 
@@ -20,20 +20,14 @@ class LocationTracker:
     __slots__ = ('file', 'line', 'col')
 
     def __init__(self, file):
+        self.file = file
         self.reset()
 
     def reset(self):
+        # Set from the tokenizer's position when a message is needed.
         self.line = 1
         self.col = 1
 
-    def track(self, t, s):
-        for c in s:
-            if c == '\n':
-                self.line += 1
-                self.col = 1
-            else:
-                self.col += 1
-
     def msg(self, lvl, msg):
         return '%s:%d:%d: %s: %s' % (self.file, self.line, self.col, lvl, msg)
 
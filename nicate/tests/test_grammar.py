@@ -16,6 +16,7 @@
 #   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 import glob
+import io
 import pytest
 
 from nicate import grammar
@@ -29,3 +30,26 @@ def gram(request):
 def test_grammar_is_lr1(gram):
     gram = nicate.lower_grammar(gram)
     automaton = nicate.Automaton(gram)
+
+def test_typedef_names():
+    with open('gram/gnu-c.gram') as f:
+        parser = nicate.Parser(grammar.Grammar('gram/gnu-c.gram', f))
+    good = [
+            'typedef int T; T x;',
+            '__builtin_va_list ap;',
+            'typedef int T; int f(T T) { return T; } T y;',
+            'typedef int T; void g(void) { int T; T = 1; } T z;',
+            'typedef int T; void h(void) { enum { T }; int x = T; } T w;',
+            'typedef int A, *B; void f(void) { A c; { typedef B A; A d; } A e; }',
+            'typedef int T; int k(void) { return sizeof(T) + (T)1; }',
+            'typedef int T; int m(int a, T b); int a, T;',
+    ]
+    for src in good:
+        parser.parse_file(io.StringIO(src))
+    bad = [
+            'int T; T x;',
+            'void f(void) { typedef int T; } T x;',
+    ]
+    for src in bad:
+        with pytest.raises(nicate.ParserError):
+            parser.parse_file(io.StringIO(src))
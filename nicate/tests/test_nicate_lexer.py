@@ -243,3 +243,484 @@ def test_regex_seq():
     t.feed('aaa')
     assert t.get(False) == ('AA', 'aa')
     assert t.get(True) == ('A', 'a')
+
+def tokenize_all(l, txt, chunk=1, borrow=False):
+    t = nicate.Tokenizer(l)
+    feed = t.feed_chunk if borrow else t.feed
+    rv = []
+    for i in range(0, len(txt), chunk):
+        feed(txt[i:i + chunk])
+        while True:
+            m = t.get(False)
+            if m is None:
+                break
+            rv.append(m)
+    while True:
+        m = t.get(True)
+        if m[1] == '':
+            break
+        rv.append(m)
+    return rv
+
+engine_syms = [
+    nicate.Symbol('whitespace', '[ \\n]+'),
+    nicate.Symbol('IF', 'if'),
+    nicate.Symbol('ID', '[a-z][a-z0-9]*'),
+    # The full DFA for this needs 2**7 states.
+    nicate.Symbol('TAIL', '[AB]*A[AB]{6}X'),
+    nicate.Symbol('NUM', '[0-9]+'),
+]
+engine_txt = 'if iff x1 42 ABABABAABX BBBBBBBAX ab\nBABBBBBBX 0 i'
+
+def test_lazy_engine():
+    expected = tokenize_all(nicate.Lexicon(engine_syms), engine_txt)
+    assert ('TAIL', 'ABABABAABX') in expected
+    assert ('TAIL', 'BABBBBBBX') in expected
+    assert ('error', 'X') in expected
+    for cache_states in [0, 4, 5, 16, 1024]:
+        l = nicate.Lexicon(engine_syms,
+                engine=nicate.nicate_library.MRE_ENGINE_LAZY_DFA,
+                cache_states=cache_states)
+        assert tokenize_all(l, engine_txt) == expected
+
+def test_bit_engine():
+    expected = tokenize_all(nicate.Lexicon(engine_syms), engine_txt)
+    bits = nicate.nicate_library.MRE_ENGINE_BIT_NFA
+    auto = nicate.nicate_library.MRE_ENGINE_AUTO
+    for options in [dict(engine=bits), dict(engine=auto, max_states=8), dict(engine=auto)]:
+        l = nicate.Lexicon(engine_syms, **options)
+        assert tokenize_all(l, engine_txt) == expected
+        assert tokenize_all(l, engine_txt, len(engine_txt), borrow=True) == expected
+    # Past 64 states, so sets take more than one word.
+    syms = [nicate.Symbol('W', '[a-z]{1,80}'), nicate.Symbol('S', "' '")]
+    txt = ' '.join('abcdefghij'[:i % 10 + 1] * (i % 9 + 1) for i in range(40))
+    expected = tokenize_all(nicate.Lexicon(syms), txt)
+    assert tokenize_all(nicate.Lexicon(syms, engine=bits), txt) == expected
+    # Literals that run across words, with many of them active at once.
+    pre = 'abcdefghijklmnopqrstuvwxyz' * 3
+    words = [pre + 'x' * i + 'y' for i in range(30)]
+    syms = [nicate.Symbol('K%d' % i, "'%s'" % w) for i, w in enumerate(words)]
+    syms += [nicate.Symbol('S', "' '"), nicate.Symbol('P', "'%s'" % pre)]
+    txt = ' '.join(words[i * 7 % 30] for i in range(30)) + ' ' + pre + 'xx ' + pre[:40]
+    expected = tokenize_all(nicate.Lexicon(syms), txt)
+    assert ('P', pre) in expected
+    assert tokenize_all(nicate.Lexicon(syms, engine=bits), txt) == expected
+
+def test_budget():
+    lib = nicate.nicate_library
+    # The DFA needs 2**13 states to remember the last 13 characters.
+    syms = [nicate.Symbol('T', '[ab]*a[ab]{12}'), nicate.Symbol('S', "' '")]
+    txt = 'ab' * 10 + ' ' + 'b' * 20 + 'a' + 'b' * 12
+    expected = tokenize_all(nicate.Lexicon(syms, engine=lib.MRE_ENGINE_BIT_NFA), txt)
+    # No budget unless one is asked for.
+    assert tokenize_all(nicate.Lexicon(syms), txt) == expected
+    for options in [dict(max_states=1000), dict(max_bytes=100000)]:
+        try:
+            nicate.Lexicon(syms, **options)
+        except ValueError:
+            pass
+        else:
+            assert False
+        l = nicate.Lexicon(syms, engine=lib.MRE_ENGINE_AUTO, **options)
+        assert tokenize_all(l, txt) == expected
+    # Too big even for the bit engine, so lazy.
+    l = nicate.Lexicon(syms, engine=lib.MRE_ENGINE_AUTO, max_bytes=16)
+    assert tokenize_all(l, txt) == expected
+
+    calls = []
+    @nicate.nicate_ffi.callback('bool(void *, size_t, size_t, size_t)')
+    def progress(data, done, found, size):
+        calls.append((done, found, size))
+        return found < limit[0]
+    limit = [100]
+    try:
+        nicate.Lexicon(syms, progress=progress)
+    except ValueError:
+        pass
+    else:
+        assert False
+    assert calls[-1][1] >= 100
+    assert all(d <= f for (d, f, _) in calls)
+    calls[:] = []
+    limit[0] = 1 << 20
+    nicate.Lexicon(engine_syms, progress=progress)
+    assert calls[-1][0] == calls[-1][1]
+
+    for engine in [lib.MRE_ENGINE_DFA, lib.MRE_ENGINE_LAZY_DFA, lib.MRE_ENGINE_BIT_NFA, lib.MRE_ENGINE_AUTO]:
+        try:
+            nicate.Lexicon([], engine=engine)
+        except ValueError:
+            pass
+        else:
+            assert False
+
+def search_slowly(syms, txt):
+    l = nicate.Lexicon(syms)
+    rv = []
+    p = 0
+    while p < len(txt):
+        name, text = tokenize_all(l, txt[p:])[0]
+        if name == 'error':
+            p += 1
+            continue
+        rv.append((name, p, text))
+        p += len(text)
+    return rv
+
+def test_search():
+    lib = nicate.nicate_library
+    syms = [s for s in engine_syms if s.name != 'whitespace']
+    txt = '-- ' + engine_txt + ' ABBBBBAX.if'
+    expected = search_slowly(syms, txt)
+    assert ('TAIL', 16, 'ABABABAABX') in expected
+    assert expected[-1] == ('IF', len(txt) - 2, 'if')
+    for options in [{}, dict(engine=lib.MRE_ENGINE_LAZY_DFA), dict(engine=lib.MRE_ENGINE_BIT_NFA), dict(engine=lib.MRE_ENGINE_AUTO, max_states=4)]:
+        assert list(nicate.Search(syms, **options).find_all(txt)) == expected
+    # One starting byte, for memchr, and many failed starts.
+    syms = [nicate.Symbol('AB', "'a'+'b'")]
+    txt = 'xa' + 'a' * 50 + 'c' + 'aab' * 3 + 'ba'
+    expected = search_slowly(syms, txt)
+    assert len(expected) == 3
+    assert list(nicate.Search(syms).find_all(txt)) == expected
+    assert list(nicate.Search(syms).find_all('')) == []
+    # Too many starting bytes for SIMD ranges.
+    syms = [nicate.Symbol('P', "[aceg]'-'")]
+    txt = 'a b-c-d-e -g-'
+    assert list(nicate.Search(syms).find_all(txt)) == search_slowly(syms, txt)
+    # Text that every match has, at the start or within a bounded distance.
+    engines = [lib.MRE_ENGINE_DFA, lib.MRE_ENGINE_LAZY_DFA, lib.MRE_ENGINE_BIT_NFA]
+    for regexes, txt in [
+            (["'foo'[0-9]+", "'fob'"], 'fo foo fob1 foo12 fofoo3'),
+            (["[a-z]{1,3}'@'[a-z]{2}"], 'abcd@ef @gh x@y a@bc xy@@zw'),
+            (["[a-z]{1,3}'@'"], 'xxabc@ x@ @'),
+            (["[a-z]+'ing'"], 'sing singing ing ringin'),
+            (["[a-z]{1,3}'@'[a-z]{2}"], 'no at sign here')]:
+        syms = [nicate.Symbol('R%d' % i, r) for i, r in enumerate(regexes)]
+        expected = search_slowly(syms, txt)
+        for engine in engines:
+            assert list(nicate.Search(syms, engine=engine).find_all(txt)) == expected
+
+def groups_all(l, txt):
+    t = nicate.Tokenizer(l)
+    t.feed(txt)
+    t.finish()
+    rv = []
+    while True:
+        m = t.get_groups(True)
+        if m[1] == '':
+            break
+        rv.append(m)
+    return rv
+
+def test_groups():
+    lib = nicate.nicate_library
+    syms = [
+        nicate.Symbol('NUM', '$([0-9]+)$([uUlL]*)'),
+        nicate.Symbol('STR', '\'"\'$(([^"\\\\]|\\\\.)*)\'"\''),
+        nicate.Symbol('ID', "[a-z]+$('='$([0-9]+))?"),
+        nicate.Symbol('LIST', "'<'($([a-z])',')*'>'"),
+        nicate.Symbol('whitespace', "' '+"),
+    ]
+    txt = '12 34ul "a\\"b" x y=5 <a,b,c,> <>'
+    expected = [
+        ('NUM', '12', {1: '12', 2: ''}),
+        ('NUM', '34ul', {1: '34', 2: 'ul'}),
+        ('STR', '"a\\"b"', {1: 'a\\"b'}),
+        # An optional group that took no part is left out.
+        ('ID', 'x', {}),
+        ('ID', 'y=5', {1: '=5', 2: '5'}),
+        # A repeated group is its last time round.
+        ('LIST', '<a,b,c,>', {1: 'c'}),
+        ('LIST', '<>', {}),
+    ]
+    for engine in [lib.MRE_ENGINE_DFA, lib.MRE_ENGINE_AUTO]:
+        l = nicate.Lexicon(syms, skip=['whitespace'], engine=engine)
+        assert groups_all(l, txt) == expected
+        assert tokenize_all(l, txt) == [m[:2] for m in expected]
+    # Only the DFA engine tracks groups.
+    for engine in [lib.MRE_ENGINE_LAZY_DFA, lib.MRE_ENGINE_BIT_NFA]:
+        l = nicate.Lexicon(syms, skip=['whitespace'], engine=engine)
+        assert groups_all(l, txt) == [m[:2] + ({},) for m in expected]
+    # Long runs, in groups or not, are scanned in bulk.
+    body = 'x' * 1000 + '\\"' + 'y' * 1000
+    l = nicate.Lexicon(syms, skip=['whitespace'])
+    assert groups_all(l, '"' + body + '" ' + 'q' * 1000) == [
+        ('STR', '"' + body + '"', {1: body}),
+        ('ID', 'q' * 1000, {}),
+    ]
+    s = nicate.Search(syms[:1])
+    assert list(s.find_all('ab 12u cd 7', groups=True)) == [
+        ('NUM', 3, '12u', {1: '12', 2: 'u'}),
+        ('NUM', 10, '7', {1: '7', 2: ''}),
+    ]
+
+def test_threaded_build():
+    expected = tokenize_all(nicate.Lexicon(engine_syms), engine_txt)
+    for num_threads in [0, 2, 7]:
+        l = nicate.Lexicon(engine_syms, num_threads=num_threads)
+        assert tokenize_all(l, engine_txt) == expected
+
+def check_long_runs(l):
+    for n in [1, 15, 16, 17, 31, 32, 33, 100, 1000]:
+        ident = ('a_Z9' * n)[:n]
+        comment = '/*' + ('x' * n) + '**' + (' ' * n) + '*/'
+        txt = ident + ' ' * n + comment + '*' + ident
+        for chunk in [1, 7, len(txt)]:
+            assert tokenize_all(l, txt, chunk) == [
+                ('ID', ident),
+                ('whitespace', ' ' * n),
+                ('whitespace', comment),
+                ('STAR', '*'),
+                ('ID', ident),
+            ]
+
+def test_long_runs():
+    syms = [
+        nicate.Symbol('whitespace', '[ \\n]+|"/*"([^*]|"*"+[^*/])*"*"+"/"'),
+        nicate.Symbol('ID', '[A-Za-z_][A-Za-z_0-9]*'),
+        nicate.Symbol('STAR', '\\*'),
+    ]
+    # Runs are skipped in bulk with the linear memo too.
+    for l in [nicate.Lexicon(syms), nicate.Lexicon(syms, linear=True)]:
+        check_long_runs(l)
+
+def test_linear():
+    syms = [
+        nicate.Symbol('A', 'a'),
+        nicate.Symbol('AB', 'a*b'),
+    ]
+    n = 2000
+    txt = 'a' * n
+    for engine in [nicate.nicate_library.MRE_ENGINE_DFA, nicate.nicate_library.MRE_ENGINE_LAZY_DFA]:
+        for linear in [False, True]:
+            l = nicate.Lexicon(syms, engine=engine, linear=linear, cache_states=4)
+            t = nicate.Tokenizer(l)
+            t.feed(txt)
+            t.finish()
+            for i in range(n):
+                assert t.get(False) == ('A', 'a')
+            assert t.get(True) == ('error', '')
+            if linear:
+                assert t.steps() <= 3 * n
+            else:
+                assert t.steps() >= n * n // 2
+
+def drain(t):
+    rv = []
+    while True:
+        m = t.get(True)
+        if m[1] == '':
+            break
+        rv.append(m)
+    return rv
+
+def test_borrow(tmp_path):
+    l = nicate.Lexicon(engine_syms)
+    expected = tokenize_all(l, engine_txt)
+    t = nicate.Tokenizer(l)
+    t.feed_all(engine_txt)
+    assert drain(t) == expected
+    t.feed_all('')
+    assert drain(t) == []
+
+    path = tmp_path / 'input.txt'
+    path.write_text(engine_txt)
+    t.map_file(str(path))
+    assert drain(t) == expected
+    path.write_text('')
+    t.map_file(str(path))
+    assert drain(t) == []
+    t.reset()
+    t.feed('if')
+    assert t.get(True) == ('IF', 'if')
+    try:
+        t.map_file(str(tmp_path / 'missing.txt'))
+    except FileNotFoundError:
+        pass
+    else:
+        assert False
+
+def test_feed_chunk():
+    for syms, txt in [
+            (engine_syms, engine_txt),
+            (engine_syms, 'ABABABABABABABABAB' * 3),
+            ([nicate.Symbol('A', 'a'), nicate.Symbol('AB', 'a*b')], 'aaaaaaaaab aaaaaa'),
+    ]:
+        l = nicate.Lexicon(syms)
+        expected = tokenize_all(l, txt, len(txt))
+        for chunk in [1, 2, 3, 5, 8, 13, len(txt)]:
+            assert tokenize_all(l, txt, chunk, borrow=True) == expected
+
+def test_next_batch():
+    l = nicate.Lexicon(engine_syms)
+    t = nicate.Tokenizer(l)
+    b = nicate.u2b(engine_txt)
+    t.feed(engine_txt)
+    t.finish()
+    syms, offsets, lens = [nicate.nicate_ffi.new('uint32_t[]', 4) for _ in range(3)]
+    rv = []
+    while True:
+        n = nicate.nicate_library.tokenizer_next_batch(t._c_tokenizer, 4, syms, offsets, lens)
+        assert n
+        rv += [(l.name(syms[i]), nicate.b2u(b[offsets[i]:offsets[i] + lens[i]])) for i in range(n)]
+        if not lens[n - 1]:
+            break
+    assert rv[:-1] == tokenize_all(l, engine_txt)
+    assert rv[-1] == ('error', '')
+
+def test_next_batch_offsets():
+    import mmap
+    # Reading a private anonymous mapping only ever touches the zero page.
+    size = (1 << 32) + 1
+    mem = mmap.mmap(-1, size, flags=mmap.MAP_PRIVATE | mmap.MAP_ANONYMOUS)
+    mem[size - 4:] = b'abbc'
+    l = nicate.Lexicon([
+        nicate.Symbol('A', 'a'),
+        nicate.Symbol('B', "'bb'"),
+        nicate.Symbol('C', 'c'),
+        nicate.Symbol('zeros', '\\0+'),
+    ], skip=['zeros'])
+    t = nicate.Tokenizer(l)
+    t._text = mem
+    t._whole = True
+    buf = nicate.nicate_ffi.from_buffer(mem)
+    nicate.nicate_library.tokenizer_borrow(t._c_tokenizer, buf, size)
+    syms, offsets, lens = [nicate.nicate_ffi.new('uint32_t[]', 4) for _ in range(3)]
+    # `B` would end past 32 bits, so the batch stops before it.
+    assert nicate.nicate_library.tokenizer_next_batch(t._c_tokenizer, 4, syms, offsets, lens) == 1
+    assert (l.name(syms[0]), offsets[0], lens[0]) == ('A', size - 4, 1)
+    assert nicate.nicate_library.tokenizer_next_batch(t._c_tokenizer, 4, syms, offsets, lens) == 0
+    # Python falls back to one token at a time.
+    assert [t.get(False), t.get(False), t.get(True)] == [('B', 'bb'), ('C', 'c'), ('error', '')]
+    del t, buf
+    mem.close()
+
+def test_skip():
+    l = nicate.Lexicon(engine_syms)
+    s = nicate.Lexicon(engine_syms, skip=['whitespace'])
+    expected = [m for m in tokenize_all(l, engine_txt) if m[0] != 'whitespace']
+    for chunk in [1, 4, len(engine_txt)]:
+        assert tokenize_all(s, engine_txt, chunk) == expected
+        assert tokenize_all(s, engine_txt, chunk, borrow=True) == expected
+    t = nicate.Tokenizer(s)
+    t.feed_all(engine_txt)
+    assert drain(t) == expected
+
+def test_keywords():
+    # Literals matched by a general rule are looked up by text instead.
+    words = ['kw%d' % i for i in range(100)]
+    syms = [nicate.Symbol(w.upper(), w) for w in words] + [
+            nicate.Symbol('IF', 'if'),
+            nicate.Symbol('ID', '[a-z][a-z0-9]*'),
+            nicate.Symbol('IFFY', 'iffy'),
+            nicate.Symbol('IF2', "'if'"),
+            nicate.Symbol('PLUS', '\\+'),
+            nicate.Symbol('NUM', '[0-9]+'),
+            nicate.Symbol('whitespace', "' '+"),
+    ]
+    l = nicate.Lexicon(syms, skip=['whitespace'])
+    txt = 'if iffy ifx i + 12 ' + ' '.join(words) + ' kw100 kw'
+    expected = [('IF', 'if'), ('ID', 'iffy'), ('ID', 'ifx'), ('ID', 'i'), ('PLUS', '+'), ('NUM', '12')]
+    expected += [(w.upper(), w) for w in words] + [('ID', 'kw100'), ('ID', 'kw')]
+    assert tokenize_all(l, txt) == expected
+    assert list(nicate.TokenStream(l, txt)) == [m for m in tokenize_all(nicate.Lexicon(syms), txt)]
+
+def test_location():
+    txt = 'if x\n\n  42' + '\n' * 40 + ' ' * 40 + 'ab\n \nAAAAAAAX\n'
+    l = nicate.Lexicon(engine_syms, skip=['whitespace'])
+    expected = []
+    pos = 0
+    for name, s in tokenize_all(l, txt, len(txt)):
+        if name == 'whitespace':
+            continue
+        pos = txt.index(s, pos)
+        line = txt.count('\n', 0, pos) + 1
+        expected.append((s, line, pos - txt.rfind('\n', 0, pos)))
+        pos += len(s)
+    for how in ['feed', 'feed_chunk', 'feed_all']:
+        for chunk in [1, 7, len(txt)]:
+            t = nicate.Tokenizer(l)
+            rv = []
+            for i in range(0, len(txt), chunk):
+                getattr(t, how)(txt[i:i + chunk] if how != 'feed_all' else txt)
+                if how == 'feed_all':
+                    break
+                while True:
+                    m = t.get(False)
+                    if m is None:
+                        break
+                    rv.append((m[1],) + t.location())
+            t.finish()
+            while True:
+                m = t.get(True)
+                if m[1] == '':
+                    break
+                rv.append((m[1],) + t.location())
+            assert rv == expected
+            assert t.location() == (txt.count('\n') + 1, 1)
+
+def test_threads():
+    import threading
+    for options in [{}, {'engine': nicate.nicate_library.MRE_ENGINE_LAZY_DFA}]:
+        l = nicate.Lexicon(engine_syms, **options)
+        expected = tokenize_all(l, engine_txt, len(engine_txt))
+        results = []
+        def work():
+            for i in range(50):
+                ts = [nicate.Tokenizer(l) for j in range(4)]
+                t = ts[i % 4]
+                t.feed_all(engine_txt)
+                rv = drain(t)
+                del ts, t
+                if rv != expected:
+                    results.append(rv)
+                    return
+            results.append(True)
+        threads = [threading.Thread(target=work) for i in range(8)]
+        for th in threads:
+            th.start()
+        for th in threads:
+            th.join()
+        assert results == [True] * 8
+
+def test_token_stream():
+    import random
+    rng = random.Random(17)
+    l = nicate.Lexicon(engine_syms, skip=['whitespace'])
+    full = nicate.Lexicon(engine_syms)
+    txt = engine_txt
+    ts = nicate.TokenStream(l, txt)
+    for i in range(300):
+        offset = rng.randrange(len(txt) + 1)
+        delete = rng.randrange(min(4, len(txt) - offset) + 1)
+        insert = ''.join(rng.choice('ABXif0 \n!') for j in range(rng.randrange(4)))
+        first, removed, added = ts.edit(offset, delete, insert)
+        txt = txt[:offset] + insert + txt[offset + delete:]
+        expected = nicate.TokenStream(full, txt)
+        assert list(ts) == list(expected)
+        assert ''.join(s for (n, s) in ts) == txt
+
+    # An edit in the middle of a long text only lexes a few tokens again.
+    ts = nicate.TokenStream(l, 'x1 ' * 10000)
+    steps = ts.steps()
+    first, removed, added = ts.edit(15001, 1, '7 y')
+    assert (first, removed, added) == (10000, 1, 3)
+    assert ts.steps() - steps < 20
+    assert [ts[i] for i in range(first, first + 4)] == [('ID', 'x7'), ('whitespace', ' '), ('ID', 'y'), ('whitespace', ' ')]
+
+def test_token_stream_parallel():
+    import random
+    rng = random.Random(20)
+    l = nicate.Lexicon(engine_syms + [nicate.Symbol('STR', '\\"[^"]*\\"')])
+    # Chunks that start inside a string or a long token lex wrongly at first.
+    parts = [engine_txt, ' "x y ' + 'x y ' * 500 + '" ', 'A' * 5000 + 'X ']
+    txt = ''.join(rng.choice(parts) for i in range(24))
+    mid = len(txt) // 2
+    expected = nicate.TokenStream(l, txt)
+    for threads in [1, 2, 3, 8]:
+        ts = nicate.TokenStream(l)
+        ts.set(txt, threads)
+        assert list(ts) == list(expected)
+        assert ts.edit(mid, 3, '"') == expected.edit(mid, 3, '"')
+        assert list(ts) == list(expected)
+        expected.edit(mid, 1, txt[mid:mid + 3])
@@ -49,6 +49,11 @@ struct State
     size_t first_term;
     size_t last_term;
     ssize_t *acts;
+    /*
+        If the only action other than ERROR is one REDUCE, that; else 0.
+        Then the reduction need not wait for the lookahead.
+    */
+    ssize_t only_reduce;
     /*
         Can only be DEFAULT or GOTO(state).
         DEFAULT is ERROR but should be unreachable from table construction.
@@ -73,6 +78,10 @@ struct Automaton
     size_t *state_refcount;
     State *states;
     Grammar *grammar;
+
+    /* optional, not cloned */
+    ReduceHook reduce_hook;
+    void *reduce_data;
 };
 
 
@@ -213,6 +222,19 @@ State *state_create(Grammar *g, Action def, Action *term_acts, Action *nonterm_a
             rv.acts[i - rv.first_term] = encode(term_acts[i], false);
         }
     }
+    rv.only_reduce = rv.def;
+    for (i = rv.first_term; rv.acts && i <= rv.last_term; ++i)
+    {
+        ssize_t act = rv.acts[i - rv.first_term];
+        if (act && act != rv.only_reduce)
+        {
+            rv.only_reduce = rv.only_reduce ? 1 : act;
+        }
+    }
+    if (rv.only_reduce > 0)
+    {
+        rv.only_reduce = 0;
+    }
     rv.first_nonterm = skip_forward(&error, sizeof(error), nonterm_acts, g->num_nonterminals);
     if (rv.first_nonterm == g->num_nonterminals)
     {
@@ -256,6 +278,8 @@ Automaton *automaton_create(Grammar *g, size_t num_states, State **states)
         free(states[i]);
     }
     rv.grammar = g;
+    rv.reduce_hook = NULL;
+    rv.reduce_data = NULL;
     return (Automaton *)memdup(&rv, sizeof(rv));
 }
 
@@ -269,10 +293,12 @@ Automaton *automaton_clone(Automaton *a)
     rv.tree_stack = (Tree *)malloc(rv.stacks_cap * sizeof(*rv.tree_stack));
     rv.alloc_states = a->alloc_states;
     rv.state_refcount = a->state_refcount;
-    ++*rv.state_refcount;
+    __sync_fetch_and_add(rv.state_refcount, 1);
     rv.states = a->states;
     /* Grammar is only borrowed. */
     rv.grammar = a->grammar;
+    rv.reduce_hook = NULL;
+    rv.reduce_data = NULL;
     return (Automaton *)memdup(&rv, sizeof(rv));
 }
 
@@ -307,7 +333,7 @@ void automaton_destroy(Automaton *a)
 {
     size_t i;
     (void)a->grammar;
-    if (!(*a->state_refcount)--)
+    if (!__sync_fetch_and_sub(a->state_refcount, 1))
     {
         free(a->state_refcount);
         for (i = a->alloc_states; i--; )
@@ -362,6 +388,34 @@ static Tree make_tree(size_t sym, Tree *trees, size_t num_trees, size_t rule)
     return rv;
 }
 
+void automaton_set_reduce_hook(Automaton *a, ReduceHook hook, void *data)
+{
+    a->reduce_hook = hook;
+    a->reduce_data = data;
+}
+
+static void reduce(Automaton *a, size_t rule_no)
+{
+    /* Note: this code is wrong if you have empty rules. */
+    Rule *rule = &a->grammar->rules[rule_no];
+    size_t lhs = rule->lhs;
+    size_t count = rule->num_rhses;
+    size_t new_size = a->stacks_size - count;
+    Tree *trees = a->tree_stack + new_size;
+    Tree new_tree = make_tree(lhs, trees, count, rule_no);
+    size_t old_new_top = a->state_stack[new_size];
+    size_t new_new_top = get_goto(&a->states[old_new_top], lhs);
+    assert (new_new_top != 0);
+    *trees = new_tree;
+    /* a->state_stack[new_size] = old_new_top */
+    a->state_stack_top = new_new_top;
+    a->stacks_size = new_size + 1;
+    if (a->reduce_hook)
+    {
+        a->reduce_hook(a->reduce_data, trees);
+    }
+}
+
 bool automaton_feed_term(Automaton *a, size_t sym, const char *str, size_t len)
 {
     Tree term;
@@ -388,21 +442,7 @@ bool automaton_feed_term(Automaton *a, size_t sym, const char *str, size_t len)
         }
         if (act < 0)
         {
-            /* Note: this code is wrong if you have empty rules. */
-            size_t rule_no = -(size_t)act;
-            Rule *rule = &a->grammar->rules[rule_no];
-            size_t lhs = rule->lhs;
-            size_t count = rule->num_rhses;
-            size_t new_size = a->stacks_size - count;
-            Tree *trees = a->tree_stack + new_size;
-            Tree new_tree = make_tree(lhs, trees, count, rule_no);
-            size_t old_new_top = a->state_stack[new_size];
-            size_t new_new_top = get_goto(&a->states[old_new_top], lhs);
-            assert (new_new_top != 0);
-            *trees = new_tree;
-            /* a->state_stack[new_size] = old_new_top */
-            a->state_stack_top = new_new_top;
-            a->stacks_size = new_size + 1;
+            reduce(a, -(size_t)act);
             continue;
         }
         else
@@ -419,8 +459,49 @@ bool automaton_feed_term(Automaton *a, size_t sym, const char *str, size_t len)
             a->state_stack[idx] = state; /* old top */
             a->state_stack_top = state_no;
             a->tree_stack[idx] = term;
+            if (a->reduce_hook)
+            {
+                /*
+                    Reductions that do not depend on the lookahead can be
+                    done now, so that the hook sees them before the caller
+                    decides what the next terminal is.
+                */
+                ssize_t act;
+                while ((act = a->states[a->state_stack_top].only_reduce))
+                {
+                    reduce(a, -(size_t)act);
+                }
+            }
+            return true;
+        }
+    }
+}
+
+bool automaton_accepts(Automaton *a, size_t sym)
+{
+    /*
+        Reducing pops at least one state and pushes one, and the states
+        below the top are left as they were, so the real stack can be
+        used as long as only its length and top are simulated.
+    */
+    size_t len = a->stacks_size;
+    size_t state = a->state_stack_top;
+    while (true)
+    {
+        ssize_t act = get_act(&a->states[state], sym);
+        Rule *rule;
+        if (!act)
+        {
+            return false;
+        }
+        if (act > 0)
+        {
             return true;
         }
+        rule = &a->grammar->rules[-(size_t)act];
+        len -= rule->num_rhses;
+        state = get_goto(&a->states[a->state_stack[len]], rule->lhs);
+        len++;
     }
 }
 
@@ -53,5 +53,14 @@ void automaton_destroy(Automaton *a);
 void automaton_reset(Automaton *a);
 Automaton *automaton_clone(Automaton *a);
 
+/*
+    The hook is called with each tree as soon as it is reduced. With a
+    hook, reductions that do not depend on the lookahead are done right
+    after a shift, instead of when the next terminal is fed.
+*/
+typedef void (*ReduceHook)(void *data, Tree *tree);
+void automaton_set_reduce_hook(Automaton *a, ReduceHook hook, void *data);
 bool automaton_feed_term(Automaton *a, size_t sym, const char *str, size_t len);
+/* Whether `automaton_feed_term` would succeed, without changing anything. */
+bool automaton_accepts(Automaton *a, size_t sym);
 Tree *automaton_result(Automaton *a);
@@ -130,6 +130,34 @@ bool bitset_test(BitSet *b, size_t i)
     return (*w & mask) != 0;
 }
 
+size_t bitset_find_next(BitSet *b, size_t i)
+{
+    size_t bits = bitset_bits(b);
+    size_t index = bitset_index(i);
+    size_t w = bitset_words(b);
+    size_t word;
+    if (i >= bits)
+    {
+        return bits;
+    }
+    word = b[index].word & ~(bitset_mask(i) - 1);
+    while (!word)
+    {
+        if (++index == w)
+        {
+            return bits;
+        }
+        word = b[index].word;
+    }
+    i = index * SIZE_BITS;
+    while (!(word & 1))
+    {
+        word >>= 1;
+        ++i;
+    }
+    return i;
+}
+
 void bitset_invert(BitSet *b)
 {
     size_t w = bitset_words(b);
@@ -41,6 +41,8 @@ BitSet *bitset_unique(BitSet *b);
 void bitset_set(BitSet *b, size_t i);
 void bitset_unset(BitSet *b, size_t i);
 bool bitset_test(BitSet *b, size_t i);
+/* Returns `bitset_bits(b)` if there are no more bits set. */
+size_t bitset_find_next(BitSet *b, size_t i);
 
 void bitset_invert(BitSet *b);
 void bitset_erase(BitSet *b);
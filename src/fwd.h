@@ -47,6 +47,8 @@ typedef struct BuildTypePairAbstractStructDeclarator BuildTypePairAbstractStruct
 typedef struct Nfa Nfa;
 typedef struct MultiNfa MultiNfa;
 typedef struct MreRuntime MreRuntime;
+typedef struct MreOptions MreOptions;
+typedef struct MreSearch MreSearch;
 
 typedef struct BitSet BitSet;
 typedef struct CharBitSet CharBitSet;
@@ -54,6 +56,7 @@ typedef struct CharBitSet CharBitSet;
 typedef struct Symbol Symbol;
 typedef struct Lexicon Lexicon;
 typedef struct Tokenizer Tokenizer;
+typedef struct TokenStream TokenStream;
 
 typedef struct Tree Tree;
 /* typedef enum ActionType ActionType; */
@@ -62,3 +65,6 @@ typedef struct Rule Rule;
 typedef struct Grammar Grammar;
 typedef struct State State;
 typedef struct Automaton Automaton;
+
+typedef struct TypeNameSyms TypeNameSyms;
+typedef struct TypeNames TypeNames;
@@ -20,6 +20,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "fwd.h"
 
@@ -30,10 +31,35 @@ struct Symbol
     const char *regex;
 };
 
+/*
+    The options are as for `mre_runtime_create`; `options` may be NULL
+    for the defaults. These return NULL if the rules are invalid or
+    over budget; by default there is no budget.
+*/
 Lexicon *lexicon_create(size_t num_symbols, Symbol *symbols);
+Lexicon *lexicon_create_with_options(size_t num_symbols, Symbol *symbols, const MreOptions *options);
+/*
+    `skip` lists `num_skip` symbol ids (as returned by `tokenizer_sym`,
+    so not 0) that `tokenizer_ready` never reports. Their tokens are
+    consumed silently, though they still count towards the offsets of
+    later tokens. `options` is as for `lexicon_create_with_options`.
+*/
+Lexicon *lexicon_create_with_skip(size_t num_symbols, Symbol *symbols, const MreOptions *options, size_t num_skip, const size_t *skip);
 void lexicon_destroy(Lexicon *lex);
 const char *lexicon_name(Lexicon *lex, size_t idx);
+/*
+    Finds the symbols anywhere in a text, rather than token after token;
+    see `mre_search`, which returns the symbol ids. Returns NULL as
+    `lexicon_create_with_options` does.
+*/
+MreSearch *lexicon_search_create(size_t num_symbols, Symbol *symbols, const MreOptions *options);
 
+/*
+    Threads: a Lexicon is never modified after it is created, so any
+    number of threads may create Tokenizers from it at once. Each
+    Tokenizer may only be used by one thread at a time, but they may be
+    destroyed in any order, before or after the Lexicon.
+*/
 Tokenizer *tokenizer_create(Lexicon *lex);
 void tokenizer_destroy(Tokenizer *tok);
 Tokenizer *tokenizer_clone(Tokenizer *tok);
@@ -41,9 +67,93 @@ Tokenizer *tokenizer_clone(Tokenizer *tok);
 void tokenizer_feed(Tokenizer *tok, const char *str);
 void tokenizer_feed_slice(Tokenizer *tok, const char *str, size_t len);
 void tokenizer_feed_char(Tokenizer *tok, char c);
+/*
+    Like `tokenizer_feed_slice`, but the chunk is only copied from if a
+    token spans chunks, so memory is bounded by the longest token. The
+    chunk must stay alive until the next feed or reset; until then, the
+    text of tokens may point into it. Do not mix with the other feeds.
+*/
+void tokenizer_feed_chunk(Tokenizer *tok, const char *str, size_t len);
+/*
+    Instead of feeding, tokenize the whole input in place. The text of
+    each token points into it, so it must outlive the next reset.
+*/
+void tokenizer_borrow(Tokenizer *tok, const char *str, size_t len);
+/* The same, for a whole file. On failure, returns false with `errno` set. */
+bool tokenizer_map_file(Tokenizer *tok, const char *path);
 bool tokenizer_ready(Tokenizer *tok);
 size_t tokenizer_sym(Tokenizer *tok);
 const char *tokenizer_text_start(Tokenizer *tok);
 size_t tokenizer_text_len(Tokenizer *tok);
+/*
+    The groups of the ready token, as offsets from its start; see
+    `mre_runtime_match_group`. A token that was taken as a keyword has
+    none.
+*/
+bool tokenizer_group(Tokenizer *tok, size_t group, size_t *start, size_t *len);
 void tokenizer_pop(Tokenizer *tok);
+/*
+    Pop up to `max` ready tokens at once, returning how many were stored.
+    Offsets count from the last `tokenizer_reset`. A token that does not
+    end within 32 bits of that ends the batch before it, and is left for
+    the functions above.
+
+    A token of length 0 (an error, or the end of the input) ends the
+    batch. It consumes nothing, so the next call will return it again.
+*/
+size_t tokenizer_next_batch(Tokenizer *tok, size_t max, uint32_t *syms, uint32_t *offsets, uint32_t *lens);
+/* No more input will be fed until the next `tokenizer_reset`. */
+void tokenizer_finish(Tokenizer *tok);
 void tokenizer_reset(Tokenizer *tok);
+/* The number of characters the DFA has consumed, including rescans. */
+size_t tokenizer_steps(Tokenizer *tok);
+/*
+    The position of the current token: its offset from the start of the
+    input, and its line and column, counting from 1. Columns count bytes.
+*/
+size_t tokenizer_offset(Tokenizer *tok);
+size_t tokenizer_line(Tokenizer *tok);
+size_t tokenizer_col(Tokenizer *tok);
+/*
+    The line and column of any offset, for error messages. Only for
+    input that is borrowed or mapped, which must still be alive.
+*/
+void tokenizer_locate(Tokenizer *tok, size_t offset, size_t *line, size_t *col);
+
+
+/*
+    A token stream that is kept up to date as its text is edited.
+
+    Unlike a Tokenizer, it keeps every token, including those that the
+    lexicon skips. Where nothing matches, it records a token of symbol 0
+    and length 1, and carries on after it.
+
+    `token_stream_edit` replaces `del_len` bytes at `offset` with the
+    `ins_len` bytes at `ins`. Only tokens that could have been affected
+    are lexed again, starting from the first one whose lookahead reached
+    the edit, until a token starts where an old one did (after the
+    edit). Tokens `*first` up to `*first + *num_removed` were replaced by
+    `*num_added` new ones; offsets of the tokens after them move along.
+*/
+TokenStream *token_stream_create(Lexicon *lex);
+void token_stream_destroy(TokenStream *ts);
+void token_stream_set(TokenStream *ts, const char *text, size_t len);
+/*
+    The same, but for a large text, up to `num_threads` threads (including
+    the caller) each lex a chunk of it at once, as if a token started
+    where the chunk does. Then the chunks are joined in order: tokens are
+    lexed again from where the previous chunk really left off, until one
+    starts where a token of the chunk does, after which the chunk is
+    right. Usually that happens within a few tokens.
+*/
+void token_stream_set_parallel(TokenStream *ts, const char *text, size_t len, size_t num_threads);
+void token_stream_edit(TokenStream *ts, size_t offset, size_t del_len, const char *ins, size_t ins_len,
+        size_t *first, size_t *num_removed, size_t *num_added);
+const char *token_stream_text(TokenStream *ts);
+size_t token_stream_text_len(TokenStream *ts);
+size_t token_stream_size(TokenStream *ts);
+size_t token_stream_sym(TokenStream *ts, size_t idx);
+size_t token_stream_offset(TokenStream *ts, size_t idx);
+size_t token_stream_len(TokenStream *ts, size_t idx);
+/* As for `tokenizer_steps`, to see how much was lexed again. */
+size_t token_stream_steps(TokenStream *ts);
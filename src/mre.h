@@ -39,11 +39,26 @@ Nfa *nfa_cat(Pool *pool, Nfa *left, Nfa *right);
 Nfa *nfa_opt(Pool *pool, Nfa *inner);
 Nfa *nfa_star(Pool *pool, Nfa *inner);
 Nfa *nfa_plus(Pool *pool, Nfa *inner);
+/*
+    Group `group` of the rule is whatever `inner` matched, as reported by
+    `mre_runtime_match_group`. Groups are numbered from 1, up to
+    MRE_MAX_GROUPS per rule.
+*/
+#define MRE_MAX_GROUPS 16
+Nfa *nfa_capture(Pool *pool, Nfa *inner, size_t group);
 
 Nfa *nfa_parse_regex(Pool *pool, const char *re);
 Nfa *nfa_parse_regex_slice(Pool *pool, const char *re, size_t re_len);
 /* There is no public delete function; the pool takes care of that. */
 
+/*
+    If the NFA matches exactly one string, and it is not empty, return
+    its length, and copy it to `buf` unless that is NULL. Else return 0.
+    Only NFAs built from text, single characters and concatenation are
+    recognized.
+*/
+size_t nfa_literal(Nfa *nfa, char *buf);
+
 
 /*
     Usage:
@@ -56,16 +71,101 @@ Nfa *nfa_parse_regex_slice(Pool *pool, const char *re, size_t re_len);
 
     Remember the return value of `multi_nfa_add` so you know which regex
     is matching. The return value will be a unique small integer but not 0.
+
+    `multi_nfa_add_all` is the same as calling `multi_nfa_add` for each
+    NFA in order, and returns the id of the first one.
+
+    `multi_nfa_create_glushkov` is the same, except that each NFA is
+    added as a position automaton, with a state for each character or
+    class in it and no epsilon edges (but for the accept states). This
+    has fewer states, and no closures to compute, so building a DFA from
+    it is quicker; the result is the same.
 */
 MultiNfa *multi_nfa_create(void);
+MultiNfa *multi_nfa_create_glushkov(void);
 void multi_nfa_destroy(MultiNfa *m);
 size_t multi_nfa_add(MultiNfa *m, Nfa *nfa);
+size_t multi_nfa_add_all(MultiNfa *m, size_t num_nfas, Nfa **nfas);
+
+enum MreEngine
+{
+    /*
+        Build the whole (minimized) DFA up front, unless that would take
+        more than `max_states` states or about `max_bytes` bytes.
+    */
+    MRE_ENGINE_DFA,
+    /*
+        Build DFA states only when a step first reaches them, keeping at
+        most `cache_states` of them per runtime. Construction is quick and
+        memory bounded no matter how large the full DFA would be, but
+        stepping is slower until the cache warms up.
+    */
+    MRE_ENGINE_LAZY_DFA,
+    /*
+        Never build DFA states; step through the NFA a word of states at
+        a time. Memory is at worst quadratic in the size of the NFA.
+        States along a literal advance together by a shift, but every
+        other active state costs time in proportion to the size of the
+        NFA, so stepping slows as more of them are active at once.
+    */
+    MRE_ENGINE_BIT_NFA,
+    /*
+        As MRE_ENGINE_DFA, unless that would go over budget, in which case
+        as MRE_ENGINE_BIT_NFA, unless that would take more than `max_bytes`
+        too, in which case as MRE_ENGINE_LAZY_DFA. If neither `max_states`
+        nor `max_bytes` is set, the budget is MRE_AUTO_MAX_STATES states
+        and MRE_AUTO_MAX_BYTES bytes.
+    */
+    MRE_ENGINE_AUTO
+};
+typedef enum MreEngine MreEngine;
+
+#define MRE_MAX_THREADS 64
+#define MRE_AUTO_MAX_STATES ((size_t)1 << 16)
+#define MRE_AUTO_MAX_BYTES ((size_t)1 << 28)
+
+/*
+    Call `mre_options_init` first, for the sake of future fields.
+
+    For MRE_ENGINE_DFA, `num_threads` threads (including the caller) are
+    used to build the DFA; the result is the same regardless.
+
+    With `linear`, the runtime remembers which (state, offset) pairs
+    failed to lead to a match, so that finding every token of an input
+    takes time linear in its length, however much backtracking the rules
+    need. The caller must use `mre_runtime_reset_at` and
+    `mre_runtime_finish` to tell it where it is. It is ignored by
+    MRE_ENGINE_BIT_NFA, which has no states to remember.
+
+    `max_states` and `max_bytes` bound the DFA as it is built; 0, the
+    default, means no bound. The bytes are an estimate of the memory
+    the finished DFA will need, counted before it is minimized.
+
+    If `progress` is not NULL, it is called as the DFA is built, with the
+    number of states done so far, the number found so far (an estimate
+    of the final count, which only grows), and the estimated bytes.
+    Returning false stops the build as if it were over budget.
+*/
+struct MreOptions
+{
+    MreEngine engine;
+    size_t cache_states;
+    size_t num_threads;
+    bool linear;
+    size_t max_states;
+    size_t max_bytes;
+    bool (*progress)(void *progress_data, size_t done, size_t found, size_t bytes);
+    void *progress_data;
+};
 
 /*
     Usage:
 
-    First call `mre_runtime_create`. After this, the `MultiNfa` object
-    may be destroyed.
+    First call `mre_runtime_create`, with options or NULL for the
+    defaults. After this, the `MultiNfa` object may be destroyed.
+    It returns NULL, rather than a runtime, if there are no rules, if
+    a rule matches the empty string, if the engine builds a DFA and no
+    rule can match at all, or if the engine goes over budget.
 
     Then repeatedly call `mre_runtime_step` with each character of input,
     until `mre_runtime_hopeful` returns false or you run out of input.
@@ -74,15 +174,78 @@ size_t multi_nfa_add(MultiNfa *m, Nfa *nfa);
     accepted, and `mre_runtime_match_id` to determine which rule matched.
     Both functions will return 0 if (and only if) nothing matched.
 
+    If the matching rule has groups (see `nfa_capture`),
+    `mre_runtime_match_group` sets the offset of one from the start of
+    the token, and its length, or returns false if it took no part in
+    the match. Only the DFA engine tracks groups; with the others (and
+    with the automatic one, if it does not build a DFA) no group is ever
+    reported. `mre_runtime_scan` takes bytes one at a time only where
+    a group may start or end.
+
     Finally, call `mre_runtime_reset` to prepare the state machine for the
-    next token.
+    next token. Or, to keep what was learned about the same input, call
+    `mre_runtime_reset_at` with the offset of the next token, counting
+    from the last `mre_runtime_reset`. Call `mre_runtime_finish` when
+    there is no more input, so that a match can be decided.
+
+    `mre_runtime_steps` counts the characters consumed since creation.
+
+    `mre_runtime_scan` does the same as calling `mre_runtime_step` for
+    each character of a buffer, for as long as `mre_runtime_hopeful`
+    would return true, and returns the number of characters consumed.
+
+    Clones share the compiled rules, but with the lazy engine each one
+    has its own cache.
+
+    Threads: a runtime may only be used by one thread at a time, but the
+    rules are never modified after `mre_runtime_create`, so a runtime
+    that is no longer stepped may be cloned and destroyed by any number
+    of threads at once, and so may its clones.
 */
-MreRuntime *mre_runtime_create(MultiNfa *m, void *future_extension_for_now_just_pass_null);
+void mre_options_init(MreOptions *options);
+MreRuntime *mre_runtime_create(MultiNfa *m, const MreOptions *options);
 MreRuntime *mre_runtime_clone(MreRuntime *old);
 void mre_runtime_reset(MreRuntime *run);
+void mre_runtime_reset_at(MreRuntime *run, size_t offset);
+void mre_runtime_finish(MreRuntime *run);
 void mre_runtime_destroy(MreRuntime *run);
 
 void mre_runtime_step(MreRuntime *run, char c);
+size_t mre_runtime_scan(MreRuntime *run, const char *buf, size_t len);
 bool mre_runtime_hopeful(MreRuntime *run);
 size_t mre_runtime_match_id(MreRuntime *run);
 size_t mre_runtime_match_len(MreRuntime *run);
+bool mre_runtime_match_group(MreRuntime *run, size_t group, size_t *start, size_t *len);
+size_t mre_runtime_steps(MreRuntime *run);
+
+
+/*
+    Usage:
+
+    Call `mre_search_create`, which takes the same options and returns
+    NULL in the same cases as `mre_runtime_create`. After this, the
+    `MultiNfa` object may be destroyed.
+
+    Then `mre_search` finds the match that starts first at or after
+    offset `start` of the buffer, and is longest of those that start
+    there, and of the earliest rule of those. It returns the rule and
+    sets `*match_start` and `*match_len`, or returns 0 if there is no
+    match. Call it again from the end of a match to find the next one
+    that does not overlap. `mre_search_group` then reports the groups
+    of that match as `mre_runtime_match_group` does, but as offsets in
+    the buffer.
+
+    Skipping the text between matches takes a search DFA, where a match
+    may start anywhere, and a scan for the bytes a match can start with.
+    The search DFA is only built for MRE_ENGINE_DFA and MRE_ENGINE_AUTO,
+    with the budget of the latter if none is set. Without it, only the
+    scan is used, which is much slower when candidate starts fail to
+    match. Either way, if every match has some text in common, starts
+    are only tried where that text is near enough to be part of them.
+
+    Threads: as for a runtime.
+*/
+MreSearch *mre_search_create(MultiNfa *m, const MreOptions *options);
+void mre_search_destroy(MreSearch *s);
+size_t mre_search(MreSearch *s, const char *buf, size_t len, size_t start, size_t *match_start, size_t *match_len);
+bool mre_search_group(MreSearch *s, size_t group, size_t *start, size_t *len);
@@ -0,0 +1,191 @@
+#include "mre_internal.h"
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+
+#include "bitset.h"
+
+
+#define LAZY_UNKNOWN ((size_t)-1)
+
+struct MreLazyCache
+{
+    NfaGraph *graph;
+    size_t num_classes;
+    size_t max_states;
+    size_t num_flushes;
+    StateMap *map;
+    /* Row `s` holds the gotos of state `s`, or LAZY_UNKNOWN. */
+    size_t *gotos;
+    size_t *accept;
+    bool *hopeful;
+    BitSet *current;
+    BitSet *next;
+    BitSet *empty;
+};
+
+
+static size_t lazy_cache_add(MreLazyCache *c, BitSet *bs)
+{
+    NfaGraph *g = c->graph;
+    size_t old_size = statemap_size(c->map);
+    size_t rv = statemap_intern(c->map, bs);
+    size_t ci, si;
+    if (rv != old_size)
+    {
+        return rv;
+    }
+    for (ci = 0; ci < c->num_classes; ++ci)
+    {
+        c->gotos[rv * c->num_classes + ci] = LAZY_UNKNOWN;
+    }
+    c->accept[rv] = nfa_graph_accept(g, bs);
+    /*
+        Closures only contain states with character edges, or accepts.
+        This may be true of a state whose every goto turns out to be fail,
+        but then the caller just finds that out one step later.
+    */
+    c->hopeful[rv] = false;
+    for (si = bitset_find_next(bs, 0); si < g->num_states; si = bitset_find_next(bs, si + 1))
+    {
+        if (g->char_start[si] != g->char_start[si + 1])
+        {
+            c->hopeful[rv] = true;
+            break;
+        }
+    }
+    return rv;
+}
+
+static void lazy_cache_flush(MreLazyCache *c)
+{
+    size_t ci;
+    if (c->map)
+    {
+        statemap_destroy(c->map);
+        c->num_flushes++;
+    }
+    c->map = statemap_create();
+    /* fail = 0 */
+    (void)lazy_cache_add(c, c->empty);
+    for (ci = 0; ci < c->num_classes; ++ci)
+    {
+        c->gotos[ci] = 0;
+    }
+    /* start = 1 */
+    if (lazy_cache_add(c, nfa_graph_closure(c->graph, 0)) != 1)
+        abort();
+}
+
+MreLazyCache *lazy_cache_create(NfaGraph *g, size_t max_states)
+{
+    MreLazyCache *rv = (MreLazyCache *)calloc(1, sizeof(*rv));
+    /* Room for fail, start, and one step from any other state. */
+    if (max_states < 4)
+    {
+        max_states = 4;
+    }
+    rv->graph = g;
+    rv->num_classes = g->num_classes;
+    rv->max_states = max_states;
+    rv->gotos = (size_t *)calloc(max_states * rv->num_classes, sizeof(*rv->gotos));
+    rv->accept = (size_t *)calloc(max_states, sizeof(*rv->accept));
+    rv->hopeful = (bool *)calloc(max_states, sizeof(*rv->hopeful));
+    rv->current = bitset_create(g->num_states);
+    rv->next = bitset_create(g->num_states);
+    rv->empty = bitset_create(g->num_states);
+    lazy_cache_flush(rv);
+    return rv;
+}
+
+void lazy_cache_destroy(MreLazyCache *c)
+{
+    bitset_destroy(c->empty);
+    bitset_destroy(c->next);
+    bitset_destroy(c->current);
+    free(c->hopeful);
+    free(c->accept);
+    free(c->gotos);
+    statemap_destroy(c->map);
+    free(c);
+}
+
+MreLazyCache *lazy_cache_clone(MreLazyCache *c, size_t *state)
+{
+    MreLazyCache *rv = lazy_cache_create(c->graph, c->max_states);
+    statemap_index(c->map, *state, rv->current);
+    *state = lazy_cache_add(rv, rv->current);
+    return rv;
+}
+
+size_t lazy_cache_goto(MreLazyCache *c, size_t state, size_t ci)
+{
+    NfaGraph *g = c->graph;
+    size_t rv = c->gotos[state * c->num_classes + ci];
+    size_t si;
+    if (rv != LAZY_UNKNOWN)
+    {
+        return rv;
+    }
+
+    statemap_index(c->map, state, c->current);
+    bitset_erase(c->next);
+    for (si = bitset_find_next(c->current, 0); si < g->num_states; si = bitset_find_next(c->current, si + 1))
+    {
+        size_t e;
+        /* Edges are sorted by class. */
+        for (e = g->char_start[si]; e != g->char_start[si + 1] && g->char_class[e] <= ci; ++e)
+        {
+            if (g->char_class[e] == ci)
+            {
+                bitset_or_eq(c->next, nfa_graph_closure(g, g->char_to[e]));
+            }
+        }
+    }
+
+    rv = statemap_find(c->map, c->next);
+    if (rv == (size_t)-1)
+    {
+        if (statemap_size(c->map) == c->max_states)
+        {
+            lazy_cache_flush(c);
+            state = lazy_cache_add(c, c->current);
+        }
+        rv = lazy_cache_add(c, c->next);
+    }
+    c->gotos[state * c->num_classes + ci] = rv;
+    return rv;
+}
+
+size_t lazy_cache_accept(MreLazyCache *c, size_t state)
+{
+    return c->accept[state];
+}
+
+bool lazy_cache_hopeful(MreLazyCache *c, size_t state)
+{
+    return c->hopeful[state];
+}
+
+size_t lazy_cache_flushes(MreLazyCache *c)
+{
+    return c->num_flushes;
+}
@@ -23,36 +23,69 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <pthread.h>
+
 #include "bitset.h"
 #include "hashmap.h"
 #include "pool.h"
 #include "util.h"
 
 
-/* These numbers are specially chosen and MultiNfa will break if changed. */
+/* The DFA builder relies on this being 0. */
 #define NFA_START 0
-#define NFA_ACCEPT 1
 
+typedef enum NfaKind NfaKind;
 typedef struct NfaPair NfaPair;
+typedef struct NfaCaptureKey NfaCaptureKey;
 typedef struct NfaEpsilonKey NfaEpsilonKey;
 typedef struct NfaCharKey NfaCharKey;
+typedef struct NfaPosition NfaPosition;
+typedef struct NfaPositions NfaPositions;
+typedef struct NfaFragment NfaFragment;
+
+enum NfaKind
+{
+    NFA_KIND_TEXT,
+    NFA_KIND_CLASS,
+    NFA_KIND_ALT,
+    NFA_KIND_CAT,
+    NFA_KIND_OPT,
+    NFA_KIND_STAR,
+    NFA_KIND_PLUS,
+    NFA_KIND_CAPTURE,
+};
+
+/*
+    An Nfa is just a node in a DAG of references to its operands, so
+    building one never copies anything. It is only turned into states
+    and edges when it is added to a MultiNfa.
 
+    The `num_*` fields are how many edges `nfa_emit` will add for this
+    node, so the MultiNfa can reserve space up front.
+*/
 struct Nfa
 {
-    /*
-        Bad, need to be able to enumerate all targets from node X.
-        Since all new edges are guaranteed not to exist, why not just X?
+    NfaKind kind;
+    /* NFA_KIND_TEXT; the text is interned in the same pool. */
+    const char *text;
+    size_t len;
+    /* NFA_KIND_CLASS */
+    CharBitSet cbs;
+    /* everything else; `b` only for ALT and CAT */
+    Nfa *a;
+    Nfa *b;
+    /* NFA_KIND_CAPTURE */
+    size_t group;
 
-        Workaround: just sort after iterating.
-    */
-    HashMap *epsilon_edges;
-    HashMap *character_edges;
-    size_t num_states;
+    size_t num_epsilons;
+    size_t num_chars;
+    /* The highest group number in this node, or 0. */
+    size_t num_groups;
 };
-/* Key fields must precede value fields. */
 struct NfaEpsilonKey
 {
-    size_t from, to;
+    /* `tag` is 0, or 1 more than the tag passed along the edge. */
+    size_t from, to, tag;
 };
 struct NfaCharKey
 {
@@ -64,206 +97,133 @@ struct NfaPair
     Nfa *a;
     Nfa *b;
 };
+struct NfaCaptureKey
+{
+    Nfa *inner;
+    size_t group;
+};
+/*
+    All rules, already flattened. State NFA_START is shared by all rules;
+    the accept state of each rule is recorded in `accepts`.
+*/
 struct MultiNfa
 {
-    Pool *pool;
-    Nfa *nfa;
+    /* Whether `multi_nfa_add` uses `glushkov_emit` instead of `nfa_emit`. */
+    bool glushkov;
+    size_t num_states;
     size_t num_accept;
+    size_t *accepts;
+    /* Parallel to `accepts`: how many groups each rule has. */
+    size_t *groups;
+    size_t accepts_cap;
+    NfaEpsilonKey *epsilons;
+    size_t num_epsilons;
+    size_t epsilons_cap;
+    NfaCharKey *chars;
+    size_t num_chars;
+    size_t chars_cap;
+    NfaLiterals literals;
 };
 
 
-static void nfa_free(void *ptr)
-{
-    Nfa *nfa = (Nfa *)ptr;
-    map_destroy(nfa->character_edges);
-    map_destroy(nfa->epsilon_edges);
-    free(nfa);
-}
-static Nfa *nfa_alloc(Pool *pool)
+static Nfa *nfa_alloc(Pool *pool, NfaKind kind)
 {
     Nfa *rv = (Nfa *)calloc(1, sizeof(*rv));
-    rv->epsilon_edges = map_create();
-    rv->character_edges = map_create();
-    rv->num_states = 2;
-    pool_free(pool, nfa_free, rv);
+    rv->kind = kind;
+    pool_free(pool, free, rv);
     return rv;
 }
-static size_t nfa_alloc_id(Nfa *nfa)
-{
-    return nfa->num_states++;
-}
-static void nfa_add_epsilon(Nfa *nfa, size_t from, size_t to)
-{
-    NfaEpsilonKey str = {from, to};
-    HashKey key = {(unsigned char *)&str, sizeof(str)};
-    HashEntry *entry = map_entry(nfa->epsilon_edges, key, SEARCH_OR_INSERT);
-    (void)entry;
-}
-static void nfa_add_char(Nfa *nfa, size_t from, size_t to, char ch)
-{
-    NfaCharKey str = {from, (unsigned char)ch, to};
-    HashKey key = {(unsigned char *)&str, sizeof(str)};
-    HashEntry *entry = map_entry(nfa->character_edges, key, SEARCH_OR_INSERT);
-    (void)entry;
-}
-static void do_merge_epsilon(HashMap *dst, HashMap *src, size_t off)
+static Nfa *nfa_alloc_unary(Pool *pool, NfaKind kind, const void *str, size_t len)
 {
-    HashIterator *it;
-    for (it = map_first(src); it; it = map_next(it))
-    {
-        HashEntry *e = map_deref(it);
-        HashKey key = e->key;
-        NfaEpsilonKey ekey = *(NfaEpsilonKey *)key.data;
-        ekey.from += off;
-        ekey.to += off;
-        key.data = (unsigned char *)&ekey;
-        (void)map_entry(dst, key, SEARCH_OR_INSERT);
-        /* Remember we don't do values here. */
-    }
-}
-static void do_merge_char(HashMap *dst, HashMap *src, size_t off)
-{
-    HashIterator *it;
-    for (it = map_first(src); it; it = map_next(it))
-    {
-        HashEntry *e = map_deref(it);
-        HashKey key = e->key;
-        NfaCharKey ckey = *(NfaCharKey *)key.data;
-        ckey.from += off;
-        ckey.to += off;
-        key.data = (unsigned char *)&ckey;
-        (void)map_entry(dst, key, SEARCH_OR_INSERT);
-        /* Remember we don't do values here. */
-    }
+    Nfa *inner = (assert (len == sizeof(inner)), *(Nfa **)str);
+    Nfa *rv = nfa_alloc(pool, kind);
+    rv->a = inner;
+    rv->num_epsilons = inner->num_epsilons;
+    rv->num_chars = inner->num_chars;
+    rv->num_groups = inner->num_groups;
+    return rv;
 }
-static size_t nfa_merge(Nfa *nfa, Nfa *inner)
+static Nfa *nfa_alloc_binary(Pool *pool, NfaKind kind, const void *str, size_t len)
 {
-    size_t rv = nfa->num_states;
-    do_merge_epsilon(nfa->epsilon_edges, inner->epsilon_edges, nfa->num_states);
-    do_merge_char(nfa->character_edges, inner->character_edges, nfa->num_states);
-    nfa->num_states += inner->num_states;
+    NfaPair p = (assert (len == sizeof(p)), *(NfaPair *)str);
+    Nfa *rv = nfa_alloc(pool, kind);
+    rv->a = p.a;
+    rv->b = p.b;
+    rv->num_epsilons = p.a->num_epsilons + p.b->num_epsilons;
+    rv->num_chars = p.a->num_chars + p.b->num_chars;
+    rv->num_groups = p.a->num_groups > p.b->num_groups ? p.a->num_groups : p.b->num_groups;
     return rv;
 }
 
 static void *transform_text(Pool *pool, const void *str, size_t len, void *context)
 {
-    Nfa *rv = nfa_alloc(pool);
-    const char *s = (const char *)str;
+    Nfa *rv = nfa_alloc(pool, NFA_KIND_TEXT);
     (void)context;
-    if (!len)
-    {
-        nfa_add_epsilon(rv, NFA_START, NFA_ACCEPT);
-    }
-    else
-    {
-        size_t from = NFA_START;
-        while (--len)
-        {
-            char c = *s++;
-            size_t to = nfa_alloc_id(rv);
-            nfa_add_char(rv, from, to, c);
-            from = to;
-        }
-        nfa_add_char(rv, from, NFA_ACCEPT, *s);
-    }
+    rv->text = (const char *)str;
+    rv->len = len;
+    rv->num_epsilons = !len;
+    rv->num_chars = len;
     return rv;
 }
 static void *transform_class(Pool *pool, const void *str, size_t len, void *context)
 {
-    CharBitSet *cbs = (CharBitSet *)str;
-    Nfa *rv = nfa_alloc(pool);
+    Nfa *rv = nfa_alloc(pool, NFA_KIND_CLASS);
     size_t i;
     (void)context;
-    assert (sizeof(*cbs) == len);
+    assert (sizeof(rv->cbs) == len);
+    memcpy(&rv->cbs, str, len);
     for (i = 0; i < 256; ++i)
     {
-        if (char_bitset_test(cbs, i))
+        if (char_bitset_test(&rv->cbs, i))
         {
-            nfa_add_char(rv, NFA_START, NFA_ACCEPT, i);
+            rv->num_chars++;
         }
     }
     return rv;
 }
 static void *transform_alt(Pool *pool, const void *str, size_t len, void *context)
 {
-    Nfa *rv = nfa_alloc(pool);
-    NfaPair p = (assert (len == sizeof(p)), *(NfaPair *)str);
-    size_t a_offset = nfa_merge(rv, p.a);
-    size_t b_offset = nfa_merge(rv, p.b);
     (void)context;
-    nfa_add_epsilon(rv, NFA_START, a_offset + NFA_START);
-    nfa_add_epsilon(rv, NFA_START, b_offset + NFA_START);
-    nfa_add_epsilon(rv, a_offset + NFA_ACCEPT, NFA_ACCEPT);
-    nfa_add_epsilon(rv, b_offset + NFA_ACCEPT, NFA_ACCEPT);
-    return rv;
+    return nfa_alloc_binary(pool, NFA_KIND_ALT, str, len);
 }
 static void *transform_cat(Pool *pool, const void *str, size_t len, void *context)
 {
-    Nfa *rv = nfa_alloc(pool);
-    NfaPair p = (assert (len == sizeof(p)), *(NfaPair *)str);
-    size_t left_offset = nfa_merge(rv, p.a);
-    size_t right_offset = nfa_merge(rv, p.b);
     (void)context;
-    nfa_add_epsilon(rv, NFA_START, left_offset + NFA_START);
-    nfa_add_epsilon(rv, left_offset + NFA_ACCEPT, right_offset + NFA_START);
-    nfa_add_epsilon(rv, right_offset + NFA_ACCEPT, NFA_ACCEPT);
-    return rv;
+    return nfa_alloc_binary(pool, NFA_KIND_CAT, str, len);
 }
 /* TODO figure out which of these should be kept */
 static void *transform_opt(Pool *pool, const void *str, size_t len, void *context)
 {
-    Nfa *rv = nfa_alloc(pool);
-    Nfa *inner = (assert (len == sizeof(inner)), *(Nfa **)str);
-    size_t inner_offset = nfa_merge(rv, inner);
+    Nfa *rv = nfa_alloc_unary(pool, NFA_KIND_OPT, str, len);
     (void)context;
-    /*
-        Snew -----> Anew
-          |           ^
-          v           |
-        Sold========Snew
-    */
-    nfa_add_epsilon(rv, NFA_START, NFA_ACCEPT);
-    nfa_add_epsilon(rv, NFA_START, inner_offset + NFA_START);
-    nfa_add_epsilon(rv, inner_offset + NFA_ACCEPT, NFA_ACCEPT);
+    rv->num_epsilons += 1;
     return rv;
 }
 static void *transform_star(Pool *pool, const void *str, size_t len, void *context)
 {
-    Nfa *rv = nfa_alloc(pool);
-    Nfa *inner = (assert (len == sizeof(inner)), *(Nfa **)str);
-    size_t inner_offset = nfa_merge(rv, inner);
+    Nfa *rv = nfa_alloc_unary(pool, NFA_KIND_STAR, str, len);
     (void)context;
-    /*
-        Snew -----> Anew
-          |           ^
-          v           |
-        Sold========Snew
-          ^           |
-           \---------/
-    */
-    nfa_add_epsilon(rv, NFA_START, NFA_ACCEPT);
-    nfa_add_epsilon(rv, NFA_START, inner_offset + NFA_START);
-    nfa_add_epsilon(rv, inner_offset + NFA_ACCEPT, inner_offset + NFA_START);
-    nfa_add_epsilon(rv, inner_offset + NFA_ACCEPT, NFA_ACCEPT);
+    rv->num_epsilons += 2;
     return rv;
 }
 static void *transform_plus(Pool *pool, const void *str, size_t len, void *context)
 {
-    Nfa *rv = nfa_alloc(pool);
-    Nfa *inner = (assert (len == sizeof(inner)), *(Nfa **)str);
-    size_t inner_offset = nfa_merge(rv, inner);
+    Nfa *rv = nfa_alloc_unary(pool, NFA_KIND_PLUS, str, len);
     (void)context;
-    /*
-        Snew        Anew
-          |           ^
-          v           |
-        Sold========Snew
-          ^           |
-           \---------/
-    */
-    nfa_add_epsilon(rv, NFA_START, inner_offset + NFA_START);
-    nfa_add_epsilon(rv, inner_offset + NFA_ACCEPT, inner_offset + NFA_START);
-    nfa_add_epsilon(rv, inner_offset + NFA_ACCEPT, NFA_ACCEPT);
+    rv->num_epsilons += 3;
+    return rv;
+}
+
+static void *transform_capture(Pool *pool, const void *str, size_t len, void *context)
+{
+    NfaCaptureKey k = (assert (len == sizeof(k)), *(NfaCaptureKey *)str);
+    Nfa *rv = nfa_alloc(pool, NFA_KIND_CAPTURE);
+    (void)context;
+    rv->a = k.inner;
+    rv->group = k.group;
+    rv->num_epsilons = k.inner->num_epsilons + 2;
+    rv->num_chars = k.inner->num_chars;
+    rv->num_groups = k.inner->num_groups > k.group ? k.inner->num_groups : k.group;
     return rv;
 }
 
@@ -355,365 +315,1020 @@ Nfa *nfa_plus(Pool *pool, Nfa *inner)
 {
     return (Nfa *)pool_intern_map(pool, transform_plus, &inner, sizeof(inner), NULL);
 }
+Nfa *nfa_capture(Pool *pool, Nfa *inner, size_t group)
+{
+    NfaCaptureKey k;
+    assert (0 < group && group <= MRE_MAX_GROUPS);
+    k.inner = inner;
+    k.group = group;
+    return (Nfa *)pool_intern_map(pool, transform_capture, &k, sizeof(k), NULL);
+}
 
-
-MultiNfa *multi_nfa_create(void)
+static size_t literal_len(Nfa *nfa, char *buf)
 {
-    MultiNfa *rv = (MultiNfa *)calloc(1, sizeof(*rv));
-    rv->pool = pool_create();
-    rv->nfa = nfa_alloc(rv->pool);
-    /* TODO check the first merging */
-    rv->num_accept = 0;
+    size_t left, right;
+    switch (nfa->kind)
+    {
+    case NFA_KIND_TEXT:
+        if (buf)
+        {
+            memcpy(buf, nfa->text, nfa->len);
+        }
+        return nfa->len;
+    case NFA_KIND_CLASS:
+        if (nfa->num_chars != 1)
+        {
+            return (size_t)-1;
+        }
+        if (buf)
+        {
+            size_t c = 0;
+            while (!char_bitset_test(&nfa->cbs, c))
+            {
+                c++;
+            }
+            *buf = (char)c;
+        }
+        return 1;
+    case NFA_KIND_CAT:
+        left = literal_len(nfa->a, buf);
+        if (left == (size_t)-1)
+        {
+            return left;
+        }
+        right = literal_len(nfa->b, buf ? buf + left : NULL);
+        if (right == (size_t)-1)
+        {
+            return right;
+        }
+        return left + right;
+    default:
+        return (size_t)-1;
+    }
+}
+size_t nfa_literal(Nfa *nfa, char *buf)
+{
+    size_t rv = literal_len(nfa, NULL);
+    if (rv == (size_t)-1)
+    {
+        return 0;
+    }
+    if (buf)
+    {
+        literal_len(nfa, buf);
+    }
     return rv;
 }
 
-void multi_nfa_destroy(MultiNfa *m)
+/* `a` then `b`, cut short at the start if `keep_end`, else at the end. */
+static size_t literals_join(char *dst, const char *a, size_t a_len, const char *b, size_t b_len, bool keep_end)
 {
-    pool_destroy(m->pool);
-    free(m);
+    char tmp[2 * NFA_LITERAL_MAX];
+    size_t len, skip;
+    if (a_len > NFA_LITERAL_MAX)
+    {
+        a += keep_end ? a_len - NFA_LITERAL_MAX : 0;
+        a_len = NFA_LITERAL_MAX;
+    }
+    if (b_len > NFA_LITERAL_MAX)
+    {
+        b += keep_end ? b_len - NFA_LITERAL_MAX : 0;
+        b_len = NFA_LITERAL_MAX;
+    }
+    len = a_len + b_len;
+    skip = keep_end && len > NFA_LITERAL_MAX ? len - NFA_LITERAL_MAX : 0;
+    memcpy(tmp, a, a_len);
+    memcpy(tmp + a_len, b, b_len);
+    len -= skip;
+    if (len > NFA_LITERAL_MAX)
+    {
+        len = NFA_LITERAL_MAX;
+    }
+    memcpy(dst, tmp + skip, len);
+    return len;
 }
 
-size_t multi_nfa_add(MultiNfa *m, Nfa *nfa)
+/* The longest text that is in both `a` and `b`. */
+static size_t literals_common(char *dst, const char *a, size_t a_len, const char *b, size_t b_len)
 {
-    size_t old_start, middle_start;
-    size_t i;
-    Nfa *merged = nfa_alloc(m->pool);
-    m->num_accept++;
-    merged->num_states = m->num_accept + 1;
-    old_start = nfa_merge(merged, m->nfa);
-    middle_start = nfa_merge(merged, nfa);
-    m->nfa = merged;
-    assert (old_start == m->num_accept + 1);
-
-    /*
-        S
-        |
-        S1======A1--1
-    */
-    /*
-        S---S1======A1--1
-        |   S2======A2--2
-        |   S3======A3--3
-        |
-        S4==========A4--4
-    */
-    if (old_start != 1)
-        nfa_add_epsilon(merged, NFA_START, old_start);
-    nfa_add_epsilon(merged, NFA_START, middle_start);
-    for (i = 1; i < m->num_accept; ++i)
-        nfa_add_epsilon(merged, old_start + i, NFA_START + i);
-    nfa_add_epsilon(merged, middle_start + NFA_ACCEPT, NFA_START + m->num_accept);
-    return m->num_accept;
+    size_t best = 0, best_at = 0;
+    size_t i, j, k;
+    for (i = 0; i < a_len; ++i)
+    {
+        for (j = 0; j < b_len; ++j)
+        {
+            for (k = 0; i + k < a_len && j + k < b_len && a[i + k] == b[j + k]; ++k)
+            {
+            }
+            if (k > best)
+            {
+                best = k;
+                best_at = i;
+            }
+        }
+    }
+    memmove(dst, a + best_at, best);
+    return best;
 }
 
-/* Here be dragons. */
-
-typedef struct EpsilonTransitions EpsilonTransitions;
-typedef struct CharTransitions CharTransitions;
-typedef struct StateMap StateMap;
-
-struct EpsilonTransitions
-{
-    NfaEpsilonKey *begin, *end;
-};
+static void literals_text(NfaLiterals *rv, const char *text, size_t len)
+{
+    memset(rv, 0, sizeof(*rv));
+    rv->exact = len <= NFA_LITERAL_MAX;
+    rv->prefix_len = literals_join(rv->prefix, text, len, "", 0, false);
+    rv->suffix_len = literals_join(rv->suffix, text, len, "", 0, true);
+    rv->factor_len = literals_join(rv->factor, text, len, "", 0, false);
+    rv->max_len = len;
+}
 
-static int epsilon_key_compare(const void *a, const void *b)
+/* Either `a` or `b`; `rv` may be either of them. */
+static void literals_alt(NfaLiterals *rv, const NfaLiterals *a, const NfaLiterals *b)
 {
-    return memcmp(a, b, sizeof(NfaEpsilonKey));
+    NfaLiterals tmp;
+    size_t n;
+    if (a->never || b->never)
+    {
+        *rv = a->never ? *b : *a;
+        return;
+    }
+    memset(&tmp, 0, sizeof(tmp));
+    for (n = 0; n < a->prefix_len && n < b->prefix_len && a->prefix[n] == b->prefix[n]; ++n)
+    {
+    }
+    tmp.prefix_len = n;
+    memcpy(tmp.prefix, a->prefix, n);
+    for (n = 0; n < a->suffix_len && n < b->suffix_len && a->suffix[a->suffix_len - 1 - n] == b->suffix[b->suffix_len - 1 - n]; ++n)
+    {
+    }
+    tmp.suffix_len = n;
+    memcpy(tmp.suffix, a->suffix + a->suffix_len - n, n);
+    tmp.exact = a->exact && b->exact && a->prefix_len == b->prefix_len && tmp.prefix_len == a->prefix_len;
+    tmp.factor_len = literals_common(tmp.factor, a->factor, a->factor_len, b->factor, b->factor_len);
+    if (tmp.prefix_len > tmp.factor_len)
+    {
+        tmp.factor_len = literals_join(tmp.factor, tmp.prefix, tmp.prefix_len, "", 0, false);
+    }
+    if (tmp.suffix_len > tmp.factor_len)
+    {
+        tmp.factor_len = literals_join(tmp.factor, tmp.suffix, tmp.suffix_len, "", 0, false);
+    }
+    tmp.max_len = a->max_len > b->max_len ? a->max_len : b->max_len;
+    *rv = tmp;
 }
 
-static EpsilonTransitions *epsilon_transitions_create(Nfa *nfa)
+/* `a` then `b`. */
+static void literals_cat(NfaLiterals *rv, const NfaLiterals *a, const NfaLiterals *b)
 {
-    HashIterator *it;
-    size_t i;
-    size_t size = map_size(nfa->epsilon_edges);
-    EpsilonTransitions *rv = (EpsilonTransitions *)calloc(1, sizeof(*rv));
-    rv->begin = (NfaEpsilonKey *)calloc(size, sizeof(*rv->begin));
-    rv->end = rv->begin + size;
-    /* Both iterating backwards, so likely to end semi-sorted. */
-    for (i = size, it = map_first(nfa->epsilon_edges); it && i--; it = map_next(it))
-    {
-        HashEntry *e = map_deref(it);
-        memcpy(&rv->begin[i], e->key.data, sizeof(rv->begin[i]));
-    }
-    assert (!i && !it);
-    /* Okay that little-endian sort is "wrong", we only do prefix lookups. */
-    qsort(rv->begin, size, sizeof(*rv->begin), epsilon_key_compare);
-    return rv;
+    char join[NFA_LITERAL_MAX];
+    size_t join_len;
+    memset(rv, 0, sizeof(*rv));
+    if (a->never || b->never)
+    {
+        rv->never = true;
+        return;
+    }
+    rv->exact = a->exact && b->exact && a->prefix_len + b->prefix_len <= NFA_LITERAL_MAX;
+    if (a->exact)
+    {
+        rv->prefix_len = literals_join(rv->prefix, a->prefix, a->prefix_len, b->prefix, b->prefix_len, false);
+    }
+    else
+    {
+        rv->prefix_len = literals_join(rv->prefix, a->prefix, a->prefix_len, "", 0, false);
+    }
+    if (b->exact)
+    {
+        rv->suffix_len = literals_join(rv->suffix, a->suffix, a->suffix_len, b->suffix, b->suffix_len, true);
+    }
+    else
+    {
+        rv->suffix_len = literals_join(rv->suffix, b->suffix, b->suffix_len, "", 0, true);
+    }
+    rv->factor_len = literals_join(rv->factor, a->factor, a->factor_len, "", 0, false);
+    if (b->factor_len > rv->factor_len)
+    {
+        rv->factor_len = literals_join(rv->factor, b->factor, b->factor_len, "", 0, false);
+    }
+    join_len = literals_join(join, a->suffix, a->suffix_len, b->prefix, b->prefix_len, false);
+    if (join_len > rv->factor_len)
+    {
+        rv->factor_len = literals_join(rv->factor, join, join_len, "", 0, false);
+    }
+    rv->max_len = a->max_len == (size_t)-1 || b->max_len == (size_t)-1 ? (size_t)-1 : a->max_len + b->max_len;
 }
 
-static void epsilon_transitions_destroy(EpsilonTransitions *et)
+static void nfa_literals(Nfa *nfa, NfaLiterals *rv)
 {
-    free(et->begin);
-    free(et);
+    NfaLiterals a, b;
+    switch (nfa->kind)
+    {
+    case NFA_KIND_TEXT:
+        literals_text(rv, nfa->text, nfa->len);
+        return;
+    case NFA_KIND_CLASS:
+        if (nfa->num_chars == 1)
+        {
+            char c;
+            literal_len(nfa, &c);
+            literals_text(rv, &c, 1);
+            return;
+        }
+        memset(rv, 0, sizeof(*rv));
+        rv->never = !nfa->num_chars;
+        rv->max_len = 1;
+        return;
+    case NFA_KIND_ALT:
+        nfa_literals(nfa->a, &a);
+        nfa_literals(nfa->b, &b);
+        literals_alt(rv, &a, &b);
+        return;
+    case NFA_KIND_CAT:
+        nfa_literals(nfa->a, &a);
+        nfa_literals(nfa->b, &b);
+        literals_cat(rv, &a, &b);
+        return;
+    case NFA_KIND_OPT:
+    case NFA_KIND_STAR:
+    case NFA_KIND_PLUS:
+        nfa_literals(nfa->a, &a);
+        memset(rv, 0, sizeof(*rv));
+        rv->never = a.never && nfa->kind == NFA_KIND_PLUS;
+        rv->max_len = a.max_len && nfa->kind != NFA_KIND_OPT ? (size_t)-1 : a.max_len;
+        if (nfa->kind == NFA_KIND_PLUS)
+        {
+            /* Every repeat has them, and there is at least one. */
+            rv->prefix_len = a.prefix_len;
+            memcpy(rv->prefix, a.prefix, a.prefix_len);
+            rv->suffix_len = a.suffix_len;
+            memcpy(rv->suffix, a.suffix, a.suffix_len);
+            rv->factor_len = a.factor_len;
+            memcpy(rv->factor, a.factor, a.factor_len);
+        }
+        return;
+    case NFA_KIND_CAPTURE:
+        nfa_literals(nfa->a, rv);
+        return;
+    }
+    abort();
 }
 
-static void epsilon_check(EpsilonTransitions *et, size_t from, NfaEpsilonKey *lower, NfaEpsilonKey *upper)
+
+static void multi_nfa_reserve(MultiNfa *m, size_t accepts, size_t epsilons, size_t chars)
 {
-    if (et->begin == et->end)
+    if (m->num_accept + accepts > m->accepts_cap)
     {
-        assert (lower == upper);
-        assert (lower == et->begin);
-        return;
+        size_t want = m->num_accept + accepts;
+        m->accepts_cap = m->accepts_cap * 2 > want ? m->accepts_cap * 2 : want;
+        m->accepts = (size_t *)realloc(m->accepts, m->accepts_cap * sizeof(*m->accepts));
+        m->groups = (size_t *)realloc(m->groups, m->accepts_cap * sizeof(*m->groups));
     }
-    assert (lower <= upper);
-    assert (lower >= et->begin);
-    assert (upper <= et->end);
-    if (lower != upper)
+    if (m->num_epsilons + epsilons > m->epsilons_cap)
     {
-        assert (lower == et->begin || memcmp(&lower[-1].from, &from, sizeof(size_t)) < 0);
-        assert (upper == et->end || memcmp(&upper->from, &from, sizeof(size_t)) > 0);
-        assert (lower->from == from);
-        assert (upper[-1].from == from);
+        size_t want = m->num_epsilons + epsilons;
+        m->epsilons_cap = m->epsilons_cap * 2 > want ? m->epsilons_cap * 2 : want;
+        m->epsilons = (NfaEpsilonKey *)realloc(m->epsilons, m->epsilons_cap * sizeof(*m->epsilons));
+    }
+    if (m->num_chars + chars > m->chars_cap)
+    {
+        size_t want = m->num_chars + chars;
+        m->chars_cap = m->chars_cap * 2 > want ? m->chars_cap * 2 : want;
+        m->chars = (NfaCharKey *)realloc(m->chars, m->chars_cap * sizeof(*m->chars));
     }
 }
-static void *average(void *lower, void *upper, size_t element_size)
+static size_t multi_nfa_alloc_id(MultiNfa *m)
 {
-    char *l = (char *)lower;
-    char *u = (char *)upper;
-    return l + element_size * ((u - l) / element_size / 2);
-    /* return lower + (upper - lower) / 2; */
+    return m->num_states++;
 }
-static bool adjacent(void *lower, void *upper, size_t element_size)
+static void multi_nfa_add_tag(MultiNfa *m, size_t from, size_t to, size_t tag)
 {
-    char *l = (char *)lower;
-    char *u = (char *)upper;
-    return l + element_size == u;
-    /* return lower + 1 == upper; */
+    NfaEpsilonKey *e = &m->epsilons[m->num_epsilons++];
+    assert (m->num_epsilons <= m->epsilons_cap);
+    e->from = from;
+    e->to = to;
+    e->tag = tag;
 }
-static void *prev(void *upper, size_t element_size)
+static void multi_nfa_add_epsilon(MultiNfa *m, size_t from, size_t to)
 {
-    char *u = (char *)upper;
-    return u - element_size;
-    /* return &upper[-1]; */
+    multi_nfa_add_tag(m, from, to, 0);
 }
-static void double_binary_search(void **begin, void **end, size_t element_size, void *key, size_t key_size)
+static void multi_nfa_add_char(MultiNfa *m, size_t from, size_t to, unsigned char ch)
 {
-    /*
-        Returns, if successful:
-            *begin < *end
-            (*begin)->from == from
-            (*end)[-1].from == from
-            *end is singular or (*end)->from > from
-        Returns, if not successful:
-            *begin == *end
-            *end is singular or (*end)->from > from
-    */
-    void *lower, *middle, *upper;
-    int cmp;
-    lower = *begin;
-    upper = *end;
+    NfaCharKey *e = &m->chars[m->num_chars++];
+    assert (m->num_chars <= m->chars_cap);
+    e->from = from;
+    e->ch = ch;
+    e->to = to;
+}
+/*
+    Add the states and edges for `nfa`, so that the paths from `start`
+    to `accept` spell exactly its language.
 
-    if (lower == upper)
-    {
-        *begin = *end = lower;
-        return;
-    }
-    if (memcmp(lower, key, key_size) > 0)
-    {
-        *begin = *end = lower;
-        return;
-    }
-    if (memcmp(prev(upper, element_size), key, key_size) < 0)
-    {
-        *begin = *end = upper;
-        return;
-    }
-    /*
-        Invariants:
-        lower < end
-        lower is not singular and lower->from <= from.
-        lower - 1 is singular or lower[-1] < from
-        upper - 1 is not singular and upper[-1].from >= from.
-        upper is singular or upper->from > from.
-    */
-    while (true)
+    This never adds an edge into `start` or out of `accept` (unless they
+    are the same state), so callers can share them between operands.
+*/
+static void nfa_emit(MultiNfa *m, Nfa *nfa, size_t start, size_t accept)
+{
+    switch (nfa->kind)
     {
-        if (adjacent(lower, upper, element_size))
+    case NFA_KIND_TEXT:
+        if (!nfa->len)
+        {
+            multi_nfa_add_epsilon(m, start, accept);
+        }
+        else
         {
-            if (memcmp(lower, key, key_size) == 0)
+            const char *s = nfa->text;
+            size_t len = nfa->len;
+            size_t from = start;
+            while (--len)
             {
-                *begin = lower;
-                *end = upper;
-                return;
+                size_t to = multi_nfa_alloc_id(m);
+                multi_nfa_add_char(m, from, to, *s++);
+                from = to;
             }
-            else
+            multi_nfa_add_char(m, from, accept, *s);
+        }
+        break;
+    case NFA_KIND_CLASS:
+        {
+            size_t i;
+            for (i = 0; i < 256; ++i)
             {
-                /* lower->from < from */
-                *begin = *end = upper;
-                return;
+                if (char_bitset_test(&nfa->cbs, i))
+                {
+                    multi_nfa_add_char(m, start, accept, i);
+                }
             }
         }
-        /*
-            lower < middle < upper
-            middle <= upper - 1
-            lower->from <= middle->from <= upper[-1].from
-            lower->from <= from
-            upper[-1].from >= from
-        */
-        middle = average(lower, upper, element_size);
-        cmp = memcmp(middle, key, key_size);
-        if (cmp < 0)
-        {
-            lower = middle;
-            continue;
+        break;
+    case NFA_KIND_ALT:
+        nfa_emit(m, nfa->a, start, accept);
+        nfa_emit(m, nfa->b, start, accept);
+        break;
+    case NFA_KIND_CAT:
+        {
+            size_t middle = multi_nfa_alloc_id(m);
+            nfa_emit(m, nfa->a, start, middle);
+            nfa_emit(m, nfa->b, middle, accept);
         }
-        if (cmp > 0)
+        break;
+    case NFA_KIND_OPT:
+        multi_nfa_add_epsilon(m, start, accept);
+        nfa_emit(m, nfa->a, start, accept);
+        break;
+    case NFA_KIND_STAR:
         {
-            upper = middle;
-            continue;
+            /*
+                start --> loop --> accept
+                          |  ^
+                          \==/
+            */
+            size_t loop = multi_nfa_alloc_id(m);
+            multi_nfa_add_epsilon(m, start, loop);
+            nfa_emit(m, nfa->a, loop, loop);
+            multi_nfa_add_epsilon(m, loop, accept);
         }
-        /*
-            middle->from == from
-            Split and do each half's search separately.
-        */
         break;
-    }
-    if (memcmp(lower, key, key_size) != 0)
-    {
-        void *lower_middle;
-        void *lower_upper = middle;
-        while (true)
+    case NFA_KIND_PLUS:
         {
-            if (adjacent(lower, lower_upper, element_size))
-            {
-                lower = lower_upper;
-                break;
-            }
             /*
-                lower < lower_middle < lower_upper
-                lower->from < from
-                lower_upper->from == from
-                lower->from <= lower_middle->from <= lower_upper->from
+                start --> in=====out --> accept
+                          ^       |
+                           \-----/
             */
-            lower_middle = average(lower, lower_upper, element_size);
-            if (memcmp(lower_middle, key, key_size) == 0)
-            {
-                lower_upper = lower_middle;
-            }
-            else
-            {
-                lower = lower_middle;
-            }
+            size_t in = multi_nfa_alloc_id(m);
+            size_t out = multi_nfa_alloc_id(m);
+            multi_nfa_add_epsilon(m, start, in);
+            nfa_emit(m, nfa->a, in, out);
+            multi_nfa_add_epsilon(m, out, in);
+            multi_nfa_add_epsilon(m, out, accept);
         }
-    }
-    if (memcmp(prev(upper, element_size), key, key_size) != 0)
-    {
-        void *upper_middle;
-        void *upper_lower = middle;
-        while (true)
+        break;
+    case NFA_KIND_CAPTURE:
         {
-            if (adjacent(upper_lower, upper, element_size))
-            {
-                break;
-            }
             /*
-                upper_lower < upper_middle < upper
-                upper_lower->from == from
-                upper[-1].from > from
-                upper_lower->from <= upper_middle->from <= upper[-1].from
+                start --open--> in=====out --close--> accept
             */
-            upper_middle = average(upper_lower, upper, element_size);
-            if (memcmp(upper_middle, key, key_size) == 0)
-            {
-                upper_lower = upper_middle;
-            }
-            else
-            {
-                upper = upper_middle;
-            }
+            size_t in = multi_nfa_alloc_id(m);
+            size_t out = multi_nfa_alloc_id(m);
+            multi_nfa_add_tag(m, start, in, 2 * (nfa->group - 1) + 1);
+            nfa_emit(m, nfa->a, in, out);
+            multi_nfa_add_tag(m, out, accept, 2 * (nfa->group - 1) + 2);
         }
+        break;
     }
-
-    *begin = lower;
-    *end = upper;
-    return;
-}
-static void epsilon_transitions_lookup(EpsilonTransitions *et, size_t from, NfaEpsilonKey **begin, NfaEpsilonKey **end)
-{
-    size_t key[1] = {from};
-    *begin = et->begin;
-    *end = et->end;
-    double_binary_search((void **)begin, (void **)end, sizeof(**begin), &key, sizeof(key));
-    epsilon_check(et, from, *begin, *end);
 }
 
-
-struct CharTransitions
+/*
+    For the Glushkov construction, each character of text and each class
+    is a position, with a state of its own; every edge into that state
+    is labelled with that character or class.
+*/
+struct NfaPosition
+{
+    size_t state;
+    Nfa *node;
+    unsigned char ch;
+};
+struct NfaPositions
+{
+    NfaPosition *items;
+    size_t num;
+    size_t cap;
+};
+/*
+    The positions a fragment of the regex can begin and end with, and
+    whether it matches the empty string. The follow edges between its own
+    positions are already added.
+*/
+struct NfaFragment
 {
-    NfaCharKey *begin, *end;
+    size_t *first;
+    size_t num_first;
+    size_t *last;
+    size_t num_last;
+    bool nullable;
 };
 
-static int char_key_compare(const void *a, const void *b)
+static size_t glushkov_position(MultiNfa *m, NfaPositions *ps, Nfa *node, unsigned char ch)
 {
-    return memcmp(a, b, sizeof(NfaCharKey));
+    NfaPosition *p;
+    if (ps->num == ps->cap)
+    {
+        ps->cap = ps->cap ? 2 * ps->cap : 16;
+        ps->items = (NfaPosition *)realloc(ps->items, ps->cap * sizeof(*ps->items));
+    }
+    p = &ps->items[ps->num];
+    p->state = multi_nfa_alloc_id(m);
+    p->node = node;
+    p->ch = ch;
+    return ps->num++;
 }
 
-static CharTransitions *char_transitions_create(Nfa *nfa)
+static void glushkov_edge(MultiNfa *m, NfaPositions *ps, size_t from, size_t to)
 {
-    HashIterator *it;
+    NfaPosition *p = &ps->items[to];
     size_t i;
-    size_t size = map_size(nfa->character_edges);
-    CharTransitions *rv = (CharTransitions *)calloc(1, sizeof(*rv));
-    rv->begin = (NfaCharKey *)calloc(size, sizeof(*rv->begin));
-    rv->end = rv->begin + size;
-    for (i = size, it = map_first(nfa->character_edges); it && i--; it = map_next(it))
-    {
-        HashEntry *e = map_deref(it);
-        memcpy(&rv->begin[i], e->key.data, sizeof(rv->begin[i]));
-    }
-    assert (!i && !it);
-    /* Okay that little-endian sort is "wrong", we only do prefix lookups. */
-    qsort(rv->begin, size, sizeof(*rv->begin), char_key_compare);
-    return rv;
+    if (p->node->kind == NFA_KIND_TEXT)
+    {
+        multi_nfa_reserve(m, 0, 0, 1);
+        multi_nfa_add_char(m, from, p->state, p->ch);
+        return;
+    }
+    multi_nfa_reserve(m, 0, 0, p->node->num_chars);
+    for (i = 0; i < 256; ++i)
+    {
+        if (char_bitset_test(&p->node->cbs, i))
+        {
+            multi_nfa_add_char(m, from, p->state, i);
+        }
+    }
 }
 
-static void char_transitions_destroy(CharTransitions *ct)
+/* Add an edge from each of the `last` positions to each of the `first`. */
+static void glushkov_follow(MultiNfa *m, NfaPositions *ps, NfaFragment *from, NfaFragment *to)
 {
-    free(ct->begin);
-    free(ct);
+    size_t i, j;
+    for (i = 0; i < from->num_last; ++i)
+    {
+        for (j = 0; j < to->num_first; ++j)
+        {
+            glushkov_edge(m, ps, ps->items[from->last[i]].state, to->first[j]);
+        }
+    }
 }
 
-static void char_transitions_lookup_all(CharTransitions *ct, size_t from, NfaCharKey **begin, NfaCharKey **end)
+static size_t *glushkov_join(size_t *a, size_t num_a, size_t *b, size_t num_b)
 {
-    size_t key[1] = {from};
-    *begin = ct->begin;
-    *end = ct->end;
-    double_binary_search((void **)begin, (void **)end, sizeof(**begin), &key, sizeof(key));
+    size_t *rv = (size_t *)malloc((num_a + num_b + 1) * sizeof(size_t));
+    memcpy(rv, a, num_a * sizeof(size_t));
+    memcpy(rv + num_a, b, num_b * sizeof(size_t));
+    return rv;
 }
 
-static void char_transitions_lookup_one(CharTransitions *ct, size_t from, size_t ch, NfaCharKey **begin, NfaCharKey **end)
+static void glushkov_free(NfaFragment *f)
 {
-    size_t key[2] = {from, ch};
-    *begin = ct->begin;
-    *end = ct->end;
-    double_binary_search((void **)begin, (void **)end, sizeof(**begin), &key, sizeof(key));
+    free(f->first);
+    free(f->last);
 }
 
-
-struct StateMap
-{
-    HashMap *hash;
-    HashKey *vec;
-    size_t vec_cap;
-};
-static StateMap *statemap_create(void)
+/*
+    Like `nfa_emit`, but builds a position automaton, which has no epsilon
+    edges at all: a path through the regex goes straight from position to
+    position. Shared nodes are emitted once per use, as there.
+*/
+static NfaFragment glushkov_emit(MultiNfa *m, NfaPositions *ps, Nfa *nfa)
 {
-    StateMap *rv = (StateMap *)calloc(1, sizeof(*rv));
-    rv->hash = map_create();
-    rv->vec_cap = 16;
-    rv->vec = (HashKey *)calloc(rv->vec_cap, sizeof(*rv->vec));
+    NfaFragment rv, a, b;
+    memset(&rv, 0, sizeof(rv));
+    switch (nfa->kind)
+    {
+    case NFA_KIND_TEXT:
+        rv.nullable = !nfa->len;
+        rv.first = (size_t *)malloc(sizeof(size_t));
+        rv.last = (size_t *)malloc(sizeof(size_t));
+        if (nfa->len)
+        {
+            size_t i, p = glushkov_position(m, ps, nfa, nfa->text[0]);
+            rv.first[rv.num_first++] = p;
+            for (i = 1; i < nfa->len; ++i)
+            {
+                size_t q = glushkov_position(m, ps, nfa, nfa->text[i]);
+                glushkov_edge(m, ps, ps->items[p].state, q);
+                p = q;
+            }
+            rv.last[rv.num_last++] = p;
+        }
+        break;
+    case NFA_KIND_CLASS:
+        rv.first = (size_t *)malloc(sizeof(size_t));
+        rv.last = (size_t *)malloc(sizeof(size_t));
+        if (nfa->num_chars)
+        {
+            size_t p = glushkov_position(m, ps, nfa, 0);
+            rv.first[rv.num_first++] = p;
+            rv.last[rv.num_last++] = p;
+        }
+        break;
+    case NFA_KIND_ALT:
+        a = glushkov_emit(m, ps, nfa->a);
+        b = glushkov_emit(m, ps, nfa->b);
+        rv.first = glushkov_join(a.first, a.num_first, b.first, b.num_first);
+        rv.num_first = a.num_first + b.num_first;
+        rv.last = glushkov_join(a.last, a.num_last, b.last, b.num_last);
+        rv.num_last = a.num_last + b.num_last;
+        rv.nullable = a.nullable || b.nullable;
+        glushkov_free(&a);
+        glushkov_free(&b);
+        break;
+    case NFA_KIND_CAT:
+        a = glushkov_emit(m, ps, nfa->a);
+        b = glushkov_emit(m, ps, nfa->b);
+        glushkov_follow(m, ps, &a, &b);
+        rv.first = glushkov_join(a.first, a.num_first, b.first, a.nullable ? b.num_first : 0);
+        rv.num_first = a.num_first + (a.nullable ? b.num_first : 0);
+        rv.last = glushkov_join(b.last, b.num_last, a.last, b.nullable ? a.num_last : 0);
+        rv.num_last = b.num_last + (b.nullable ? a.num_last : 0);
+        rv.nullable = a.nullable && b.nullable;
+        glushkov_free(&a);
+        glushkov_free(&b);
+        break;
+    case NFA_KIND_OPT:
+        rv = glushkov_emit(m, ps, nfa->a);
+        rv.nullable = true;
+        break;
+    case NFA_KIND_STAR:
+    case NFA_KIND_PLUS:
+        rv = glushkov_emit(m, ps, nfa->a);
+        glushkov_follow(m, ps, &rv, &rv);
+        if (nfa->kind == NFA_KIND_STAR)
+        {
+            rv.nullable = true;
+        }
+        break;
+    case NFA_KIND_CAPTURE:
+        /* Rules with groups are always emitted by `nfa_emit`. */
+        abort();
+    }
+    return rv;
+}
+
+
+MultiNfa *multi_nfa_create(void)
+{
+    MultiNfa *rv = (MultiNfa *)calloc(1, sizeof(*rv));
+    rv->num_states = 1;
+    rv->num_accept = 0;
+    rv->literals.never = true;
     return rv;
 }
 
-static void statemap_destroy(StateMap *sm)
+MultiNfa *multi_nfa_create_glushkov(void)
+{
+    MultiNfa *rv = multi_nfa_create();
+    rv->glushkov = true;
+    return rv;
+}
+
+void multi_nfa_destroy(MultiNfa *m)
+{
+    free(m->chars);
+    free(m->epsilons);
+    free(m->groups);
+    free(m->accepts);
+    free(m);
+}
+
+size_t multi_nfa_add(MultiNfa *m, Nfa *nfa)
+{
+    /*
+        S======A1--1
+        |
+        \======A2--2
+    */
+    size_t accept;
+    NfaLiterals literals;
+    nfa_literals(nfa, &literals);
+    literals_alt(&m->literals, &m->literals, &literals);
+    multi_nfa_reserve(m, 1, nfa->num_epsilons, nfa->num_chars);
+    accept = multi_nfa_alloc_id(m);
+    m->groups[m->num_accept] = nfa->num_groups;
+    m->accepts[m->num_accept++] = accept;
+    /* Tags go on epsilon edges, which a position automaton lacks. */
+    if (m->glushkov && !nfa->num_groups)
+    {
+        NfaPositions ps;
+        NfaFragment f;
+        size_t i;
+        memset(&ps, 0, sizeof(ps));
+        f = glushkov_emit(m, &ps, nfa);
+        for (i = 0; i < f.num_first; ++i)
+        {
+            glushkov_edge(m, &ps, NFA_START, f.first[i]);
+        }
+        /* The only epsilons: the DFA builder wants one accept per rule. */
+        multi_nfa_reserve(m, 0, f.num_last + 1, 0);
+        for (i = 0; i < f.num_last; ++i)
+        {
+            multi_nfa_add_epsilon(m, ps.items[f.last[i]].state, accept);
+        }
+        if (f.nullable)
+        {
+            multi_nfa_add_epsilon(m, NFA_START, accept);
+        }
+        glushkov_free(&f);
+        free(ps.items);
+        return m->num_accept;
+    }
+    nfa_emit(m, nfa, NFA_START, accept);
+    return m->num_accept;
+}
+
+const NfaLiterals *multi_nfa_literals(MultiNfa *m)
+{
+    return &m->literals;
+}
+
+size_t multi_nfa_add_all(MultiNfa *m, size_t num_nfas, Nfa **nfas)
+{
+    size_t epsilons = 0, chars = 0;
+    size_t first = m->num_accept + 1;
+    size_t i;
+    for (i = 0; i < num_nfas; ++i)
+    {
+        epsilons += nfas[i]->num_epsilons;
+        chars += nfas[i]->num_chars;
+    }
+    multi_nfa_reserve(m, num_nfas, epsilons, chars);
+    for (i = 0; i < num_nfas; ++i)
+    {
+        size_t j = multi_nfa_add(m, nfas[i]);
+        (void)j;
+        assert (j == first + i);
+    }
+    return first;
+}
+
+/* Here be dragons. */
+
+static int char_key_group_compare(const void *a, const void *b)
+{
+    const NfaCharKey *l = (const NfaCharKey *)a;
+    const NfaCharKey *r = (const NfaCharKey *)b;
+    if (l->from != r->from)
+        return l->from < r->from ? -1 : 1;
+    if (l->to != r->to)
+        return l->to < r->to ? -1 : 1;
+    if (l->ch != r->ch)
+        return l->ch < r->ch ? -1 : 1;
+    return 0;
+}
+static int char_key_class_compare(const void *a, const void *b)
+{
+    const NfaCharKey *l = (const NfaCharKey *)a;
+    const NfaCharKey *r = (const NfaCharKey *)b;
+    if (l->from != r->from)
+        return l->from < r->from ? -1 : 1;
+    if (l->ch != r->ch)
+        return l->ch < r->ch ? -1 : 1;
+    if (l->to != r->to)
+        return l->to < r->to ? -1 : 1;
+    return 0;
+}
+static void refine_classes(unsigned char *classes, size_t *num_classes, CharBitSet *cbs)
+{
+    size_t members[256] = {0};
+    size_t hits[256] = {0};
+    size_t remap[256];
+    size_t b;
+    for (b = 0; b < 256; ++b)
+    {
+        members[classes[b]]++;
+        if (char_bitset_test(cbs, b))
+        {
+            hits[classes[b]]++;
+        }
+    }
+    for (b = 0; b < 256; ++b)
+    {
+        remap[b] = b;
+    }
+    for (b = 0; b < 256; ++b)
+    {
+        size_t old = classes[b];
+        if (!char_bitset_test(cbs, b) || hits[old] == members[old])
+        {
+            continue;
+        }
+        if (remap[old] == old)
+        {
+            remap[old] = (*num_classes)++;
+        }
+        classes[b] = remap[old];
+    }
+}
+/*
+    Partition the bytes so that two bytes share a class if and only if
+    every character edge in the NFA either accepts both or neither.
+
+    Classes are numbered in order of their smallest byte, so byte 0 is
+    always in class 0.
+
+    The edges must be sorted by `char_key_group_compare`.
+*/
+static size_t compute_classes(NfaCharKey *edges, size_t num_edges, unsigned char *classes, unsigned char *reps)
+{
+    size_t num_classes = 1;
+    size_t renumber[256];
+    size_t i, b;
+
+    memset(classes, 0, 256);
+    for (i = 0; i < num_edges; )
+    {
+        CharBitSet cbs;
+        size_t j;
+        char_bitset_erase(&cbs);
+        for (j = i; j < num_edges && edges[j].from == edges[i].from && edges[j].to == edges[i].to; ++j)
+        {
+            char_bitset_set(&cbs, edges[j].ch);
+        }
+        refine_classes(classes, &num_classes, &cbs);
+        i = j;
+    }
+
+    for (i = 0; i < num_classes; ++i)
+    {
+        renumber[i] = (size_t)-1;
+    }
+    num_classes = 0;
+    for (b = 0; b < 256; ++b)
+    {
+        if (renumber[classes[b]] == (size_t)-1)
+        {
+            reps[num_classes] = b;
+            renumber[classes[b]] = num_classes++;
+        }
+        classes[b] = renumber[classes[b]];
+    }
+    return num_classes;
+}
+
+NfaGraph *nfa_graph_create(MultiNfa *m)
+{
+    NfaGraph *rv = (NfaGraph *)calloc(1, sizeof(*rv));
+    const size_t n = m->num_states;
+    size_t num_eps = m->num_epsilons;
+    size_t num_chars = m->num_chars;
+    NfaCharKey *edges = (NfaCharKey *)calloc(num_chars + 1, sizeof(*edges));
+    size_t *renumber = (size_t *)calloc(n, sizeof(*renumber));
+    size_t i, j;
+
+    rv->num_states = n;
+    rv->num_accept = m->num_accept;
+
+    /* Renumber so that states 1 through num_accept are the accepts. */
+    for (i = 0; i < m->num_accept; ++i)
+    {
+        renumber[m->accepts[i]] = i + 1;
+    }
+    for (i = 1, j = m->num_accept + 1; i < n; ++i)
+    {
+        if (!renumber[i])
+        {
+            renumber[i] = j++;
+        }
+    }
+
+    /* Only if some rule has groups: which rule each state is part of. */
+    for (i = 0; i < m->num_accept; ++i)
+    {
+        if (m->groups[i])
+        {
+            break;
+        }
+    }
+    if (i < m->num_accept)
+    {
+        rv->groups = (size_t *)calloc(m->num_accept + 1, sizeof(*rv->groups));
+        rv->owner = (size_t *)calloc(n, sizeof(*rv->owner));
+        rv->eps_tag = (size_t *)calloc(num_eps + 1, sizeof(*rv->eps_tag));
+        memcpy(rv->groups + 1, m->groups, m->num_accept * sizeof(*rv->groups));
+        /* `multi_nfa_add` allocates the accept state of a rule first. */
+        for (i = 0, j = 0; i < n; ++i)
+        {
+            if (j < m->num_accept && m->accepts[j] == i)
+            {
+                j++;
+            }
+            rv->owner[renumber[i]] = j;
+        }
+    }
+
+    /* epsilon edges, bucketed by source */
+    rv->eps_start = (size_t *)calloc(n + 1, sizeof(*rv->eps_start));
+    rv->eps_to = (size_t *)calloc(num_eps + 1, sizeof(*rv->eps_to));
+    for (i = 0; i < num_eps; ++i)
+    {
+        rv->eps_start[renumber[m->epsilons[i].from] + 1]++;
+    }
+    for (i = 0; i < n; ++i)
+    {
+        rv->eps_start[i + 1] += rv->eps_start[i];
+    }
+    {
+        size_t *fill = (size_t *)memdup(rv->eps_start, (n + 1) * sizeof(*fill));
+        for (i = 0; i < num_eps; ++i)
+        {
+            size_t f = fill[renumber[m->epsilons[i].from]]++;
+            rv->eps_to[f] = renumber[m->epsilons[i].to];
+            if (rv->eps_tag)
+            {
+                rv->eps_tag[f] = m->epsilons[i].tag;
+            }
+        }
+        free(fill);
+    }
+
+    for (i = 0; i < num_chars; ++i)
+    {
+        edges[i].from = renumber[m->chars[i].from];
+        edges[i].ch = m->chars[i].ch;
+        edges[i].to = renumber[m->chars[i].to];
+    }
+    free(renumber);
+
+    /* character edges: find classes, then bucket by source and class */
+    qsort(edges, num_chars, sizeof(*edges), char_key_group_compare);
+    rv->num_classes = compute_classes(edges, num_chars, rv->classes, rv->reps);
+    for (i = 0; i < num_chars; ++i)
+    {
+        edges[i].ch = rv->classes[edges[i].ch];
+    }
+    qsort(edges, num_chars, sizeof(*edges), char_key_class_compare);
+    rv->char_start = (size_t *)calloc(n + 1, sizeof(*rv->char_start));
+    rv->char_class = (unsigned char *)calloc(num_chars + 1, sizeof(*rv->char_class));
+    rv->char_to = (size_t *)calloc(num_chars + 1, sizeof(*rv->char_to));
+    for (i = 0, j = 0; i < num_chars; ++i)
+    {
+        if (j && edges[i].from == edges[j - 1].from && edges[i].ch == edges[j - 1].ch && edges[i].to == edges[j - 1].to)
+        {
+            continue;
+        }
+        edges[j++] = edges[i];
+    }
+    num_chars = j;
+    for (i = 0; i < num_chars; ++i)
+    {
+        rv->char_start[edges[i].from + 1]++;
+        rv->char_class[i] = edges[i].ch;
+        rv->char_to[i] = edges[i].to;
+    }
+    for (i = 0; i < n; ++i)
+    {
+        rv->char_start[i + 1] += rv->char_start[i];
+    }
+    free(edges);
+
+    rv->closures = (BitSet **)calloc(n, sizeof(*rv->closures));
+    rv->scratch = bitset_create(n);
+    rv->stack = (size_t *)calloc(n, sizeof(*rv->stack));
+    return rv;
+}
+
+void nfa_graph_destroy(NfaGraph *g)
+{
+    size_t i;
+    for (i = g->num_states; i--; )
+    {
+        if (g->closures[i])
+        {
+            bitset_destroy(g->closures[i]);
+        }
+    }
+    free(g->closures);
+    free(g->stack);
+    bitset_destroy(g->scratch);
+    free(g->eps_tag);
+    free(g->owner);
+    free(g->groups);
+    free(g->char_to);
+    free(g->char_class);
+    free(g->char_start);
+    free(g->eps_to);
+    free(g->eps_start);
+    free(g);
+}
+
+static bool nfa_graph_useful(NfaGraph *g, size_t s)
+{
+    /* Remove states without char transitions (allows much more merging). */
+    if (s > 0 && s <= g->num_accept)
+    {
+        return true;
+    }
+    return g->char_start[s] != g->char_start[s + 1];
+}
+
+BitSet *nfa_graph_closure(NfaGraph *g, size_t from)
+{
+    BitSet *seen = g->scratch;
+    BitSet *rv;
+    size_t top = 0;
+
+    if (g->closures[from])
+    {
+        return g->closures[from];
+    }
+
+    rv = bitset_create(g->num_states);
+    bitset_erase(seen);
+    bitset_set(seen, from);
+    g->stack[top++] = from;
+    while (top)
+    {
+        size_t s = g->stack[--top];
+        size_t e;
+        if (nfa_graph_useful(g, s))
+        {
+            bitset_set(rv, s);
+        }
+        for (e = g->eps_start[s]; e != g->eps_start[s + 1]; ++e)
+        {
+            size_t to = g->eps_to[e];
+            if (!bitset_test(seen, to))
+            {
+                bitset_set(seen, to);
+                g->stack[top++] = to;
+            }
+        }
+    }
+    g->closures[from] = rv;
+    return rv;
+}
+
+void nfa_graph_close_all(NfaGraph *g)
+{
+    size_t e;
+    (void)nfa_graph_closure(g, NFA_START);
+    for (e = 0; e < g->char_start[g->num_states]; ++e)
+    {
+        (void)nfa_graph_closure(g, g->char_to[e]);
+    }
+}
+
+size_t nfa_graph_accept(NfaGraph *g, BitSet *states)
+{
+    size_t i = bitset_find_next(states, 1);
+    if (i <= g->num_accept)
+    {
+        return i;
+    }
+    return 0;
+}
+
+struct StateMap
+{
+    HashMap *hash;
+    HashKey *vec;
+    size_t vec_cap;
+};
+StateMap *statemap_create(void)
+{
+    StateMap *rv = (StateMap *)calloc(1, sizeof(*rv));
+    rv->hash = map_create();
+    rv->vec_cap = 16;
+    rv->vec = (HashKey *)calloc(rv->vec_cap, sizeof(*rv->vec));
+    return rv;
+}
+
+void statemap_destroy(StateMap *sm)
 {
     map_destroy(sm->hash);
     free(sm->vec);
     free(sm);
 }
 
-static size_t statemap_intern(StateMap *sm, BitSet *bs)
+size_t statemap_intern(StateMap *sm, BitSet *bs)
 {
     HashKey key = bitset_as_key(bs);
     size_t old_size = map_size(sm->hash);
@@ -736,7 +1351,17 @@ static size_t statemap_intern(StateMap *sm, BitSet *bs)
     return (size_t)entry->value.ptr;
 }
 
-static void statemap_index(StateMap *sm, size_t i, BitSet *bs)
+size_t statemap_find(StateMap *sm, BitSet *bs)
+{
+    HashEntry *entry = map_entry(sm->hash, bitset_as_key(bs), SEARCH_ONLY);
+    if (!entry)
+    {
+        return (size_t)-1;
+    }
+    return (size_t)entry->value.ptr;
+}
+
+void statemap_index(StateMap *sm, size_t i, BitSet *bs)
 {
     HashKey in_key = sm->vec[i];
     HashKey out_key = bitset_as_key(bs);
@@ -744,87 +1369,99 @@ static void statemap_index(StateMap *sm, size_t i, BitSet *bs)
     memcpy(out_key.data, in_key.data, out_key.len);
 }
 
-static size_t statemap_size(StateMap *sm)
+size_t statemap_size(StateMap *sm)
 {
     return map_size(sm->hash);
 }
 
 
-static size_t calc_accept(BitSet *states, size_t num_accept)
+/*
+    Successor sets are computed a batch of DFA states at a time, possibly
+    by several threads, but only ever interned by the calling thread, in
+    the same order as if there were no batching. So the result does not
+    depend on the number of threads.
+*/
+typedef struct DfaBatch DfaBatch;
+struct DfaBatch
+{
+    NfaGraph *graph;
+    StateMap *state_map;
+    size_t first;
+    size_t count;
+    /* Next slot to claim; shared between the threads. */
+    size_t claim;
+    /* Slot `i`, class `c` is at `i * num_classes + c`. */
+    BitSet **next_states;
+    bool *next_touched;
+    /* Whether a match may also start after every byte. */
+    bool unanchored;
+};
+
+static void *dfa_batch_work(void *arg)
 {
-    size_t i;
-    for (i = 1; i <= num_accept; ++i)
+    DfaBatch *b = (DfaBatch *)arg;
+    NfaGraph *graph = b->graph;
+    const size_t num_states = graph->num_states;
+    const size_t num_classes = graph->num_classes;
+    BitSet *current_states = bitset_create(num_states);
+    size_t slot;
+    while ((slot = __sync_fetch_and_add(&b->claim, 1)) < b->count)
     {
-        if (bitset_test(states, i))
+        BitSet **next_states = &b->next_states[slot * num_classes];
+        bool *next_touched = &b->next_touched[slot * num_classes];
+        size_t si;
+        statemap_index(b->state_map, b->first + slot, current_states);
+        /* Every class's successor set in a single pass over the members. */
+        for (si = bitset_find_next(current_states, 0); si < num_states; si = bitset_find_next(current_states, si + 1))
         {
-            return i;
+            size_t e;
+            for (e = graph->char_start[si]; e != graph->char_start[si + 1]; ++e)
+            {
+                size_t ec = graph->char_class[e];
+                bitset_or_eq(next_states[ec], nfa_graph_closure(graph, graph->char_to[e]));
+                next_touched[ec] = true;
+            }
         }
-    }
-    return 0;
-}
-static void fill_epsilons_from(BitSet *states, EpsilonTransitions *transitions, size_t from)
-{
-    NfaEpsilonKey *begin, *end, *it;
-    epsilon_transitions_lookup(transitions, from, &begin, &end);
-    for (it = begin; it != end; ++it)
-    {
-        size_t to = it->to;
-        bool was = bitset_test(states, to);
-        if (!was)
+        if (b->unanchored)
         {
-            bitset_set(states, to);
-            fill_epsilons_from(states, transitions, to);
+            size_t c;
+            for (c = 0; c < num_classes; ++c)
+            {
+                bitset_or_eq(next_states[c], nfa_graph_closure(graph, NFA_START));
+                next_touched[c] = true;
+            }
         }
     }
+    bitset_destroy(current_states);
+    return NULL;
 }
-static void fill_epsilons(BitSet *states, size_t num_states, size_t num_accept, EpsilonTransitions *transitions, CharTransitions *char_transitions)
+
+static void dfa_batch_run(DfaBatch *b, size_t num_threads)
 {
-    size_t si;
-    for (si = 0; si < num_states; ++si)
+    pthread_t threads[MRE_MAX_THREADS];
+    size_t num_started;
+    b->claim = 0;
+    if (num_threads > b->count)
     {
-        if (bitset_test(states, si))
-        {
-            fill_epsilons_from(states, transitions, si);
-        }
+        num_threads = b->count;
     }
-
-    /* Remove states without char transitions (allows much more merging). */
-    for (si = 0; si < num_states; ++si)
+    /* The calling thread is one of the workers. */
+    for (num_started = 0; num_started + 1 < num_threads; ++num_started)
     {
-        if (bitset_test(states, si))
+        if (pthread_create(&threads[num_started], NULL, dfa_batch_work, b))
         {
-            NfaCharKey *begin, *end;
-            if (si > 0 && si <= num_accept)
-            {
-                continue;
-            }
-            char_transitions_lookup_all(char_transitions, si, &begin, &end);
-            if (begin == end)
-            {
-                bitset_unset(states, si);
-            }
+            /* Not fatal; the remaining workers will do the rest. */
+            break;
         }
     }
-}
-static void fill_chars(BitSet *current, BitSet *next, size_t num_states, CharTransitions *transitions, size_t c)
-{
-    size_t ci;
-    for (ci = 0; ci < num_states; ++ci)
+    dfa_batch_work(b);
+    while (num_started--)
     {
-        if (bitset_test(current, ci))
-        {
-            NfaCharKey *begin, *end, *it;
-            char_transitions_lookup_one(transitions, ci, c, &begin, &end);
-            for (it = begin; it != end; ++it)
-            {
-                size_t to = it->to;
-                bitset_set(next, to);
-            }
-        }
+        pthread_join(threads[num_started], NULL);
     }
 }
 
-static MreState *multi_nfa_to_dfa_impl(MultiNfa *m, size_t *rv_count)
+static bool multi_nfa_to_dfa_impl(MultiNfa *m, MreDfa *dfa, const MreOptions *options, bool unanchored, bool *too_big)
 {
     /*
         Input:
@@ -837,24 +1474,69 @@ static MreState *multi_nfa_to_dfa_impl(MultiNfa *m, size_t *rv_count)
         any state may be accept
      */
     const size_t num_accept = m->num_accept;
-    const size_t num_states = m->nfa->num_states;
+    const size_t num_states = m->num_states;
+    size_t num_threads = options->num_threads;
     MreState *rv;
+    size_t num_classes;
+    size_t batch_cap;
+    size_t state_bytes;
+    size_t c;
+    bool invalid = false;
+    MreTagBuilder *tags = NULL;
 
 
     /* setup */
     BitSet *did_accept = bitset_create(num_accept);
-    EpsilonTransitions *epsilon_transitions = epsilon_transitions_create(m->nfa);
-    CharTransitions *char_transitions = char_transitions_create(m->nfa);
+    NfaGraph *graph = nfa_graph_create(m);
     BitSet *current_states = bitset_create(num_states);
-    BitSet *next_states = bitset_create(num_states);
     StateMap *state_map = statemap_create();
+    DfaBatch batch;
+
+    if (num_threads < 1)
+    {
+        num_threads = 1;
+    }
+    if (num_threads > MRE_MAX_THREADS)
+    {
+        num_threads = MRE_MAX_THREADS;
+    }
+    if (num_threads > 1)
+    {
+        /* The workers must not write to the graph. */
+        nfa_graph_close_all(graph);
+    }
+    batch_cap = num_threads == 1 ? 1 : 16 * num_threads;
+
+    num_classes = graph->num_classes;
+    /*
+        What each state found will cost by the time it is compiled: its
+        NFA states in the map, and a goto for each class in both the DFA
+        and the compiled table (minimization only ever shrinks them).
+    */
+    state_bytes = sizeof(MreState) + (num_states + 7) / 8 + 2 * num_classes * sizeof(size_t);
+    if (graph->groups && !unanchored)
+    {
+        tags = tag_builder_create(graph, num_classes);
+    }
+    dfa->num_classes = num_classes;
+    memcpy(dfa->classes, graph->classes, sizeof(dfa->classes));
+    batch.graph = graph;
+    batch.state_map = state_map;
+    batch.unanchored = unanchored;
+    batch.next_states = (BitSet **)calloc(batch_cap * num_classes, sizeof(*batch.next_states));
+    batch.next_touched = (bool *)calloc(batch_cap * num_classes, sizeof(*batch.next_touched));
+    for (c = 0; c < batch_cap * num_classes; ++c)
+    {
+        batch.next_states[c] = bitset_create(num_states);
+    }
 
     /* fail = 0 */
     (void)statemap_intern(state_map, current_states);
-    bitset_set(current_states, NFA_START);
-    fill_epsilons(current_states, num_states, num_accept, epsilon_transitions, char_transitions);
-    if (calc_accept(current_states, num_accept))
-        abort();
+    bitset_or_eq(current_states, nfa_graph_closure(graph, NFA_START));
+    if (nfa_graph_accept(graph, current_states))
+    {
+        invalid = true;
+    }
     /* start = 1*/
     if (!statemap_intern(state_map, current_states))
         abort();
@@ -865,88 +1547,195 @@ static MreState *multi_nfa_to_dfa_impl(MultiNfa *m, size_t *rv_count)
         size_t rv_cap = 16;
         rv = (MreState *)calloc(rv_cap, sizeof(*rv));
         size_t i;
+        /* fail has no gotos */
+        rv[0].first_goto = 255;
+        rv[0].last_goto = 0;
         /* statemap keeps growing as we go */
-        for (i = 1; i < statemap_size(state_map); ++i)
+        for (i = 1; !invalid; )
         {
-            MreState *rvi;
-            size_t c;
-            size_t next_gotos[256];
-            unsigned char first_goto = 255;
-            unsigned char last_goto = 0;
-            if (i == rv_cap)
+            size_t found = statemap_size(state_map);
+            size_t bytes = found * state_bytes + (tags ? tag_builder_bytes(tags) : 0);
+            size_t slot;
+            if (options->progress && !options->progress(options->progress_data, i, found, bytes))
             {
-                size_t old_rv_bytes = rv_cap * sizeof(*rv);
-                size_t new_rv_cap = rv_cap * 2;
-                MreState *new_rv = (MreState *)realloc(rv, new_rv_cap * sizeof(*rv));
-                memset((char *)new_rv + old_rv_bytes, '\0', old_rv_bytes);
-                rv_cap = new_rv_cap;
-                rv = new_rv;
+                *too_big = true;
+                break;
             }
-            rvi = &rv[i];
-            statemap_index(state_map, i, current_states);
-            rvi->accept = calc_accept(current_states, num_accept);
-            if (rvi->accept)
+            if ((options->max_states && found > options->max_states)
+                    || (options->max_bytes && bytes > options->max_bytes))
             {
-                bitset_set(did_accept, rvi->accept - 1);
+                *too_big = true;
+                break;
             }
-            for (c = 0; c < 256; ++c)
+            if (i == found)
             {
-                bitset_erase(next_states);
-                fill_chars(current_states, next_states, num_states, char_transitions, c);
-                fill_epsilons(next_states, num_states, num_accept, epsilon_transitions, char_transitions);
-                next_gotos[c] = statemap_intern(state_map, next_states);
-                if (next_gotos[c])
+                break;
+            }
+            batch.first = i;
+            batch.count = statemap_size(state_map) - i;
+            if (batch.count > batch_cap)
+            {
+                batch.count = batch_cap;
+            }
+            dfa_batch_run(&batch, num_threads);
+
+            for (slot = 0; slot < batch.count; ++slot, ++i)
+            {
+                BitSet **next_states = &batch.next_states[slot * num_classes];
+                bool *next_touched = &batch.next_touched[slot * num_classes];
+                MreState *rvi;
+                size_t next_gotos[256];
+                unsigned char first_goto = 255;
+                unsigned char last_goto = 0;
+                if (i == rv_cap)
+                {
+                    size_t old_rv_bytes = rv_cap * sizeof(*rv);
+                    size_t new_rv_cap = rv_cap * 2;
+                    MreState *new_rv = (MreState *)realloc(rv, new_rv_cap * sizeof(*rv));
+                    memset((char *)new_rv + old_rv_bytes, '\0', old_rv_bytes);
+                    rv_cap = new_rv_cap;
+                    rv = new_rv;
+                }
+                rvi = &rv[i];
+                statemap_index(state_map, i, current_states);
+                rvi->accept = nfa_graph_accept(graph, current_states);
+                if (rvi->accept)
+                {
+                    bitset_set(did_accept, rvi->accept - 1);
+                }
+                for (c = 0; c < num_classes; ++c)
                 {
-                    if (c < first_goto)
+                    if (tags)
                     {
-                        first_goto = c;
+                        tag_builder_goto(tags, current_states, c, next_touched[c] ? next_states[c] : NULL);
                     }
-                    if (c > last_goto)
+                    if (!next_touched[c])
                     {
-                        last_goto = c;
+                        next_gotos[c] = 0;
+                        continue;
+                    }
+                    next_gotos[c] = statemap_intern(state_map, next_states[c]);
+                    bitset_erase(next_states[c]);
+                    next_touched[c] = false;
+                    if (next_gotos[c])
+                    {
+                        if (c < first_goto)
+                        {
+                            first_goto = c;
+                        }
+                        if (c > last_goto)
+                        {
+                            last_goto = c;
+                        }
                     }
                 }
-            }
-            rvi->first_goto = first_goto;
-            rvi->last_goto = last_goto;
-            if (first_goto == 255 && last_goto == 0)
-            {
-                rvi->some_gotos = NULL;
-            }
-            else
-            {
-                size_t num_gotos = last_goto - first_goto + 1;
-                assert (first_goto <= last_goto);
-                rvi->some_gotos = (size_t *)memdup(&next_gotos[first_goto], num_gotos * sizeof(size_t));
+                rvi->first_goto = first_goto;
+                rvi->last_goto = last_goto;
+                if (first_goto == 255 && last_goto == 0)
+                {
+                    rvi->some_gotos = NULL;
+                }
+                else
+                {
+                    size_t num_gotos = last_goto - first_goto + 1;
+                    assert (first_goto <= last_goto);
+                    rvi->some_gotos = (size_t *)memdup(&next_gotos[first_goto], num_gotos * sizeof(size_t));
+                }
             }
         }
-        *rv_count = i;
+        dfa->num_states = i;
     }
 
 
     /* teardown */
-    if (!bitset_any(did_accept))
+    if (!*too_big && !bitset_any(did_accept))
     {
         /* TODO warn about partials */
-        abort();
+        invalid = true;
     }
 
+    if (tags)
+    {
+        dfa->tags = tag_builder_finish(tags);
+    }
     statemap_destroy(state_map);
-    bitset_destroy(next_states);
+    for (c = batch_cap * num_classes; c--; )
+    {
+        bitset_destroy(batch.next_states[c]);
+    }
+    free(batch.next_touched);
+    free(batch.next_states);
     bitset_destroy(current_states);
-    char_transitions_destroy(char_transitions);
-    epsilon_transitions_destroy(epsilon_transitions);
+    nfa_graph_destroy(graph);
     bitset_destroy(did_accept);
 
-    /* TODO Do a final merging step here? Only useful on pedantic input? */
+    dfa->states = rv;
+    return !invalid && !*too_big;
+}
 
+static MreDfa *multi_nfa_to_dfa_mode(MultiNfa *m, const MreOptions *options, bool unanchored, bool *too_big)
+{
+    MreDfa *rv;
+    *too_big = false;
+    if (!m->num_accept)
+    {
+        return NULL;
+    }
+    rv = (MreDfa *)calloc(1, sizeof(*rv));
+    if (!multi_nfa_to_dfa_impl(m, rv, options, unanchored, too_big))
+    {
+        mre_dfa_destroy(rv);
+        return NULL;
+    }
+    /* Merging states would mix up their registers. */
+    if (!rv->tags)
+    {
+        mre_dfa_minimize(rv);
+    }
     return rv;
 }
 
-MreRules *multi_nfa_to_dfa(MultiNfa *m)
+MreDfa *multi_nfa_to_dfa(MultiNfa *m, const MreOptions *options, bool *too_big)
+{
+    return multi_nfa_to_dfa_mode(m, options, false, too_big);
+}
+
+MreDfa *multi_nfa_to_search_dfa(MultiNfa *m, const MreOptions *options)
+{
+    bool too_big;
+    return multi_nfa_to_dfa_mode(m, options, true, &too_big);
+}
+
+void mre_dfa_destroy(MreDfa *dfa)
+{
+    size_t i;
+    for (i = dfa->num_states; i--; )
+    {
+        free(dfa->states[i].some_gotos);
+    }
+    free(dfa->states);
+    if (dfa->tags)
+    {
+        mre_tags_destroy(dfa->tags);
+    }
+    free(dfa);
+}
+
+MreRules *multi_nfa_to_lazy(MultiNfa *m)
 {
     MreRules *rv = (MreRules *)calloc(1, sizeof(*rv));
+    NfaGraph *graph = nfa_graph_create(m);
     rv->refcount = 1;
-    rv->states = multi_nfa_to_dfa_impl(m, &rv->num_states);
+    nfa_graph_close_all(graph);
+    /* The same restrictions as the full DFA, minus the partials check. */
+    if (!graph->num_accept || nfa_graph_accept(graph, nfa_graph_closure(graph, NFA_START)))
+    {
+        nfa_graph_destroy(graph);
+        free(rv);
+        return NULL;
+    }
+    rv->num_classes = graph->num_classes;
+    memcpy(rv->classes, graph->classes, sizeof(rv->classes));
+    rv->graph = graph;
     return rv;
 }
@@ -49,6 +49,7 @@
     a{,2}   as a{0,2}
     a{2,}   as a{2}a*
     (a)     grouping
+    $(a)    capture group, numbered from 1 in order of its $
 
     REGULAR EXPRESSION GRAMMAR:
     regexes must be entirely ascii printable.
@@ -88,6 +89,7 @@
         double-quote
         escape
         group
+        capture
         class
     single-quote:
         ' sq-chars_opt '
@@ -118,6 +120,8 @@
         \ x hex hex
     group:
         ( regex )
+    capture:
+        $ ( regex )
     class:
         [ ^_opt ] class-chars_opt -_opt ]
         [ ^_opt - class-chars_opt ]
@@ -547,9 +551,9 @@ static Result parse_after_bs(Pool *pool, const char *re, const char *re_end)
     return rv;
 }
 
-static Result parse_regex(Pool *pool, const char *re, const char *re_end);
+static Result parse_regex(Pool *pool, const char *re, const char *re_end, size_t *groups);
 
-static Result parse_atom(Pool *pool, const char *re, const char *re_end)
+static Result parse_atom(Pool *pool, const char *re, const char *re_end, size_t *groups)
 {
     unsigned char c;
     assert (re != re_end);
@@ -635,7 +639,7 @@ static Result parse_atom(Pool *pool, const char *re, const char *re_end)
         }
     case '(':
         {
-            Result rv = parse_regex(pool, re + 1, re_end);
+            Result rv = parse_regex(pool, re + 1, re_end, groups);
             if (rv.limit == re_end || rv.limit[0] != ')')
             {
                 fail("missing )");
@@ -743,6 +747,22 @@ static Result parse_atom(Pool *pool, const char *re, const char *re_end)
     case '#':
         fail("unquoted #");
     case '$':
+        if (re + 1 != re_end && re[1] == '(')
+        {
+            size_t group = ++*groups;
+            Result rv = parse_regex(pool, re + 2, re_end, groups);
+            if (group > MRE_MAX_GROUPS)
+            {
+                fail("too many groups");
+            }
+            if (rv.limit == re_end || rv.limit[0] != ')')
+            {
+                fail("missing )");
+            }
+            rv.nfa = nfa_capture(pool, rv.nfa, group);
+            rv.limit++;
+            return rv;
+        }
         fail("unsupported $");
     case ')':
         abort();
@@ -767,9 +787,9 @@ static Result parse_atom(Pool *pool, const char *re, const char *re_end)
     }
 }
 
-static Result parse_repeat(Pool *pool, const char *re, const char *re_end)
+static Result parse_repeat(Pool *pool, const char *re, const char *re_end, size_t *groups)
 {
-    Result rv1 = parse_atom(pool, re, re_end);
+    Result rv1 = parse_atom(pool, re, re_end, groups);
     if (rv1.limit != re_end)
     {
         switch (*rv1.limit)
@@ -818,7 +838,7 @@ static Result parse_repeat(Pool *pool, const char *re, const char *re_end)
     return rv1;
 }
 
-static Result parse_cat(Pool *pool, const char *re, const char *re_end)
+static Result parse_cat(Pool *pool, const char *re, const char *re_end, size_t *groups)
 {
     if (re == re_end || *re == '|' || *re == ')')
     {
@@ -827,19 +847,19 @@ static Result parse_cat(Pool *pool, const char *re, const char *re_end)
     }
     else
     {
-        Result rv1 = parse_repeat(pool, re, re_end);
-        Result rv2 = parse_cat(pool, rv1.limit, re_end);
+        Result rv1 = parse_repeat(pool, re, re_end, groups);
+        Result rv2 = parse_cat(pool, rv1.limit, re_end, groups);
         Result rv = {nfa_cat(pool, rv1.nfa, rv2.nfa), rv2.limit, rv1.not_empty || rv2.not_empty};
         return rv;
     }
 }
 
-static Result parse_regex(Pool *pool, const char *re, const char *re_end)
+static Result parse_regex(Pool *pool, const char *re, const char *re_end, size_t *groups)
 {
-    Result rv1 = parse_cat(pool, re, re_end);
+    Result rv1 = parse_cat(pool, re, re_end, groups);
     if (rv1.limit != re_end && *rv1.limit == '|')
     {
-        Result rv2 = parse_regex(pool, rv1.limit + 1, re_end);
+        Result rv2 = parse_regex(pool, rv1.limit + 1, re_end, groups);
         Result rv = {nfa_alt(pool, rv1.nfa, rv2.nfa), rv2.limit, rv1.not_empty && rv2.not_empty};
         return rv;
     }
@@ -860,7 +880,8 @@ Nfa *nfa_parse_regex(Pool *pool, const char *re)
 
 Nfa *nfa_parse_regex_slice(Pool *pool, const char *re, size_t re_len)
 {
-    Result rv = parse_regex(pool, re, re + re_len);
+    size_t groups = 0;
+    Result rv = parse_regex(pool, re, re + re_len, &groups);
     assert (rv.not_empty);
     if (rv.limit != re + re_len)
     {
@@ -20,24 +20,223 @@
 */
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "simd.h"
+#include "util.h"
+
+
+typedef struct FailMemo FailMemo;
+
+/*
+    A set of (state, offset) pairs, by open addressing. An offset of 0
+    marks an empty slot, which is fine since no state is entered at 0.
+*/
+struct FailMemo
+{
+    size_t size;
+    size_t cap;
+    size_t max_offset;
+    size_t *offsets;
+    size_t *states;
+};
 
 struct MreRuntime
 {
     MreRules *states;
+    /* Only for the lazy engine. Unlike `states`, never shared. */
+    MreLazyCache *lazy;
+    /*
+        Only for the bit-parallel engine: the current positions, and room
+        for the next ones. Then `cur_state` is 1 while there are any.
+    */
+    size_t *cur_bits;
+    size_t *next_bits;
     size_t cur_state;
     size_t cur_len;
     size_t last_match;
     size_t match_len;
+    size_t steps;
+
+    /*
+        Only with the `linear` option. The trail is the states entered
+        since the last match, the first at offset `trail_first`; they are
+        known to fail once the runtime is no longer hopeful.
+    */
+    bool linear;
+    size_t base;
+    size_t *trail;
+    size_t trail_first;
+    size_t trail_len;
+    size_t trail_cap;
+    size_t flushes;
+    FailMemo memo;
+
+    /*
+        Only if the rules have tags: the registers, room to save some
+        while a transition writes them, and the groups of the last match,
+        as offsets from the start of the token.
+    */
+    size_t *regs;
+    size_t *saved_regs;
+    size_t captures[2 * MRE_MAX_GROUPS];
 };
 
 
-MreRuntime *mre_runtime_create(MultiNfa *m, void *unused)
+static size_t memo_slot(FailMemo *f, size_t state, size_t offset)
 {
-    MreRuntime *rv = (MreRuntime *)calloc(1, sizeof(*rv));
-    (void)unused;
-    rv->states = multi_nfa_to_dfa(m);
+    size_t mask = f->cap - 1;
+    size_t i = ((offset * 0x9E3779B9u) ^ state) & mask;
+    while (f->offsets[i] && (f->offsets[i] != offset || f->states[i] != state))
+    {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+static void memo_clear(FailMemo *f)
+{
+    if (f->size)
+    {
+        memset(f->offsets, 0, f->cap * sizeof(*f->offsets));
+        f->size = 0;
+    }
+    f->max_offset = 0;
+}
+
+static bool memo_test(FailMemo *f, size_t state, size_t offset)
+{
+    return f->size && f->offsets[memo_slot(f, state, offset)];
+}
+
+static void memo_add(FailMemo *f, size_t state, size_t offset)
+{
+    size_t i;
+    if (2 * (f->size + 1) > f->cap)
+    {
+        FailMemo old = *f;
+        size_t j;
+        f->cap = old.cap ? 2 * old.cap : 64;
+        f->size = 0;
+        f->offsets = (size_t *)calloc(f->cap, sizeof(*f->offsets));
+        f->states = (size_t *)calloc(f->cap, sizeof(*f->states));
+        for (j = 0; j < old.cap; ++j)
+        {
+            if (old.offsets[j])
+            {
+                i = memo_slot(f, old.states[j], old.offsets[j]);
+                f->offsets[i] = old.offsets[j];
+                f->states[i] = old.states[j];
+                f->size++;
+            }
+        }
+        free(old.states);
+        free(old.offsets);
+    }
+    i = memo_slot(f, state, offset);
+    if (!f->offsets[i])
+    {
+        f->offsets[i] = offset;
+        f->states[i] = state;
+        f->size++;
+    }
+    if (offset > f->max_offset)
+    {
+        f->max_offset = offset;
+    }
+}
+
+
+void mre_options_init(MreOptions *options)
+{
+    options->engine = MRE_ENGINE_DFA;
+    options->cache_states = 1024;
+    options->num_threads = 1;
+    options->linear = false;
+    options->max_states = 0;
+    options->max_bytes = 0;
+    options->progress = NULL;
+    options->progress_data = NULL;
+}
+
+const MreOptions *mre_options_resolve(const MreOptions *options, MreOptions *buf)
+{
+    if (!options)
+    {
+        mre_options_init(buf);
+        options = buf;
+    }
+    /* Without a bound, there would be nothing to fall back from. */
+    if (options->engine == MRE_ENGINE_AUTO && !options->max_states && !options->max_bytes)
+    {
+        *buf = *options;
+        buf->max_states = MRE_AUTO_MAX_STATES;
+        buf->max_bytes = MRE_AUTO_MAX_BYTES;
+        options = buf;
+    }
+    return options;
+}
+
+MreRuntime *mre_runtime_create(MultiNfa *m, const MreOptions *options)
+{
+    MreRuntime *rv;
+    MreRules *states = NULL;
+    MreOptions buf;
+    options = mre_options_resolve(options, &buf);
+    switch (options->engine)
+    {
+    case MRE_ENGINE_DFA:
+    case MRE_ENGINE_AUTO:
+    {
+        bool too_big;
+        MreDfa *dfa = multi_nfa_to_dfa(m, options, &too_big);
+        if (dfa)
+        {
+            states = mre_rules_compile(dfa);
+            mre_dfa_destroy(dfa);
+        }
+        else if (too_big && options->engine == MRE_ENGINE_AUTO)
+        {
+            states = multi_nfa_to_bits(m, options->max_bytes);
+            if (!states)
+            {
+                states = multi_nfa_to_lazy(m);
+            }
+        }
+        break;
+    }
+    case MRE_ENGINE_LAZY_DFA:
+        states = multi_nfa_to_lazy(m);
+        break;
+    case MRE_ENGINE_BIT_NFA:
+        states = multi_nfa_to_bits(m, options->max_bytes);
+        break;
+    default:
+        abort();
+    }
+    if (!states)
+    {
+        return NULL;
+    }
+    rv = (MreRuntime *)calloc(1, sizeof(*rv));
+    rv->states = states;
+    if (states->graph)
+    {
+        rv->lazy = lazy_cache_create(states->graph, options->cache_states);
+    }
+    if (rv->states->bits)
+    {
+        rv->cur_bits = (size_t *)calloc(rv->states->bits->num_words, sizeof(size_t));
+        rv->next_bits = (size_t *)calloc(rv->states->bits->num_words, sizeof(size_t));
+    }
+    if (rv->states->tags)
+    {
+        rv->regs = (size_t *)calloc(rv->states->tags->num_regs + 1, sizeof(size_t));
+        rv->saved_regs = (size_t *)calloc(rv->states->tags->num_saved + 1, sizeof(size_t));
+    }
+    rv->linear = options->linear && !rv->states->bits;
     mre_runtime_reset(rv);
     return rv;
 }
@@ -45,60 +244,472 @@ MreRuntime *mre_runtime_clone(MreRuntime *old)
 {
     MreRuntime *rv = (MreRuntime *)calloc(1, sizeof(*rv));
     *rv = *old;
-    rv->states->refcount++;
+    __sync_fetch_and_add(&rv->states->refcount, 1);
+    if (old->lazy)
+    {
+        rv->lazy = lazy_cache_clone(old->lazy, &rv->cur_state);
+        rv->flushes = lazy_cache_flushes(rv->lazy);
+    }
+    if (old->cur_bits)
+    {
+        size_t bytes = old->states->bits->num_words * sizeof(size_t);
+        rv->cur_bits = (size_t *)memdup(old->cur_bits, bytes);
+        rv->next_bits = (size_t *)calloc(1, bytes);
+    }
+    if (old->regs)
+    {
+        MreTags *t = old->states->tags;
+        rv->regs = (size_t *)memdup(old->regs, (t->num_regs + 1) * sizeof(size_t));
+        rv->saved_regs = (size_t *)calloc(t->num_saved + 1, sizeof(size_t));
+    }
+    /* What the old one learned is only an optimization. */
+    rv->trail = NULL;
+    rv->trail_len = 0;
+    rv->trail_cap = 0;
+    memset(&rv->memo, 0, sizeof(rv->memo));
     return rv;
 }
+/*
+    Run the ops from `first` to `last`, where `pos` is the offset after
+    the byte just taken. Sources that are also written are read first.
+*/
+static void tags_apply(MreRuntime *run, size_t first, size_t last, size_t pos)
+{
+    const MreTagOp *ops = run->states->tags->ops;
+    size_t i;
+    for (i = first; i < last; ++i)
+    {
+        if (ops[i].saved != (size_t)-1)
+        {
+            run->saved_regs[ops[i].saved] = run->regs[ops[i].src];
+        }
+    }
+    for (i = first; i < last; ++i)
+    {
+        const MreTagOp *op = &ops[i];
+        if (op->src == MRE_TAG_NOW)
+        {
+            run->regs[op->dst] = pos;
+        }
+        else if (op->src == MRE_TAG_UNSET)
+        {
+            run->regs[op->dst] = MRE_TAG_UNSET;
+        }
+        else if (op->saved != (size_t)-1)
+        {
+            run->regs[op->dst] = run->saved_regs[op->saved];
+        }
+        else
+        {
+            run->regs[op->dst] = run->regs[op->src];
+        }
+    }
+}
+static void tags_accept(MreRuntime *run, size_t sa)
+{
+    MreTags *t = run->states->tags;
+    const size_t *regs = run->regs + t->accept_regs[sa];
+    size_t k;
+    for (k = 0; k < 2 * t->groups[sa]; ++k)
+    {
+        run->captures[k] = regs[k];
+    }
+}
 void mre_runtime_reset(MreRuntime *run)
 {
+    memo_clear(&run->memo);
+    run->trail_len = 0;
+    mre_runtime_reset_at(run, 0);
+}
+void mre_runtime_reset_at(MreRuntime *run, size_t offset)
+{
+    if (run->linear)
+    {
+        size_t i;
+        if (!mre_runtime_hopeful(run))
+        {
+            for (i = 0; i < run->trail_len; ++i)
+            {
+                memo_add(&run->memo, run->trail[i], run->trail_first + i);
+            }
+        }
+        run->trail_len = 0;
+        /* Only offsets after the start of the token ever matter. */
+        if (offset >= run->memo.max_offset)
+        {
+            memo_clear(&run->memo);
+        }
+    }
+    run->base = offset;
     run->cur_state = 1;
+    if (run->cur_bits)
+    {
+        MreBitNfa *b = run->states->bits;
+        memcpy(run->cur_bits, b->start, b->num_words * sizeof(size_t));
+    }
     run->cur_len = 0;
     run->last_match = 0;
     run->match_len = 1;
+    if (run->regs)
+    {
+        MreTags *t = run->states->tags;
+        size_t k = run->states->num_classes;
+        tags_apply(run, t->op_start[k * run->states->num_states], t->num_ops, 0);
+    }
+}
+void mre_runtime_finish(MreRuntime *run)
+{
+    run->cur_state = 0;
 }
 static void free_rules(MreRules *rul)
 {
-    if (!--rul->refcount)
+    if (!__sync_sub_and_fetch(&rul->refcount, 1))
     {
-        size_t i;
-        for (i = rul->num_states; i--; )
+        if (rul->graph)
+        {
+            nfa_graph_destroy(rul->graph);
+        }
+        if (rul->bits)
         {
-            free(rul->states[i].some_gotos);
+            bit_nfa_destroy(rul->bits);
+        }
+        if (rul->tags)
+        {
+            mre_tags_destroy(rul->tags);
         }
-        free(rul->states);
         free(rul);
     }
 }
 void mre_runtime_destroy(MreRuntime *run)
 {
+    if (run->lazy)
+    {
+        lazy_cache_destroy(run->lazy);
+    }
+    free(run->next_bits);
+    free(run->cur_bits);
+    free(run->memo.states);
+    free(run->memo.offsets);
+    free(run->trail);
+    free(run->saved_regs);
+    free(run->regs);
     free_rules(run->states);
     free(run);
 }
 
-static size_t get_goto(MreState *state, size_t ci)
+/* Unsigned wraparound makes fail (0) not hopeful. */
+#define TABLE_HOPEFUL(rules, s) ((size_t)((s) - 1) < (rules)->num_hopeful)
+#define TABLE_ACCEPT(rules, s) ((s) >= (rules)->first_accept ? (rules)->accepts[(s) - (rules)->first_accept] : 0)
+
+static size_t table_goto(MreRules *rules, size_t s, size_t ci)
+{
+    size_t i = s * rules->num_classes + ci;
+    switch (rules->width)
+    {
+    case 1:
+        return ((const uint8_t *)rules->table)[i];
+    case 2:
+        return ((const uint16_t *)rules->table)[i];
+    case 4:
+        return ((const uint32_t *)rules->table)[i];
+    default:
+        abort();
+    }
+}
+
+/* Record that `si` was entered at `n` offsets in a row, from `offset`. */
+static void trail_push(MreRuntime *run, size_t si, size_t offset, size_t n)
+{
+    if (!run->trail_len)
+    {
+        run->trail_first = offset;
+    }
+    if (run->trail_len + n > run->trail_cap)
+    {
+        while (run->trail_len + n > run->trail_cap)
+        {
+            run->trail_cap = run->trail_cap ? 2 * run->trail_cap : 16;
+        }
+        run->trail = (size_t *)realloc(run->trail, run->trail_cap * sizeof(*run->trail));
+    }
+    while (n--)
+    {
+        run->trail[run->trail_len++] = si;
+    }
+}
+
+/*
+    For the `linear` option: returns the state to go to instead of `si`,
+    having just entered it at `offset`, and updates the trail.
+*/
+static size_t linear_enter(MreRuntime *run, size_t si, size_t sa, size_t offset)
+{
+    if (run->lazy && lazy_cache_flushes(run->lazy) != run->flushes)
+    {
+        run->flushes = lazy_cache_flushes(run->lazy);
+        memo_clear(&run->memo);
+        run->trail_len = 0;
+    }
+    if (sa)
+    {
+        run->trail_len = 0;
+        return si;
+    }
+    if (!si || memo_test(&run->memo, si, offset))
+    {
+        return 0;
+    }
+    trail_push(run, si, offset, 1);
+    return si;
+}
+
+/*
+    One scan loop per table width, so that the loads have a fixed size.
+    The match length is `run->cur_len + i` once `buf[i - 1]` is in.
+
+    Whenever a state goes back to itself, the rest of the run of such
+    bytes is skipped in bulk if it can be.
+
+    With `tagged`, the loop stops before a byte whose transition has
+    register ops, or enters an accept with groups to report, and leaves
+    that byte to `mre_runtime_step`.
+
+    With `linear`, each state entered is checked against the memo. A
+    run of bytes skipped in bulk only goes on the trail: it stays in
+    one state, which cannot fail any sooner for being checked.
+*/
+#define DEFINE_TABLE_SCAN(name, type, tagged, linear)                       \
+static size_t name(MreRuntime *run, const char *buf, size_t len)            \
+{                                                                           \
+    MreRules *rules = run->states;                                          \
+    const type *table = (const type *)rules->table;                         \
+    const unsigned char *classes = rules->classes;                          \
+    const size_t num_classes = rules->num_classes;                          \
+    const size_t first_accept = rules->first_accept;                        \
+    const MreAccel *accels = rules->accels;                                 \
+    const MreTags *tags = rules->tags;                                      \
+    size_t state = run->cur_state;                                          \
+    size_t last_match = run->last_match;                                    \
+    size_t match_len = run->match_len;                                      \
+    size_t i = 0;                                                           \
+    while (i < len && TABLE_HOPEFUL(rules, state))                          \
+    {                                                                       \
+        size_t t = state * num_classes + classes[(unsigned char)buf[i]];    \
+        size_t next = table[t];                                             \
+        if (tagged && (tags->op_start[t] != tags->op_start[t + 1]           \
+                    || (next != state && tags->groups[TABLE_ACCEPT(rules, next)]))) \
+        {                                                                   \
+            break;                                                          \
+        }                                                                   \
+        ++i;                                                                \
+        if (linear)                                                         \
+        {                                                                   \
+            next = linear_enter(run, next, TABLE_ACCEPT(rules, next), run->base + run->cur_len + i); \
+        }                                                                   \
+        if (next == state && accels[state].num_ranges)                      \
+        {                                                                   \
+            const MreAccel *a = &accels[state];                             \
+            size_t n = simd_skip_ranges(buf + i, len - i, a->num_ranges, a->lo, a->hi); \
+            if (linear && n && state < first_accept)                        \
+            {                                                               \
+                trail_push(run, state, run->base + run->cur_len + i + 1, n); \
+            }                                                               \
+            i += n;                                                         \
+        }                                                                   \
+        state = next;                                                       \
+        if (state >= first_accept)                                          \
+        {                                                                   \
+            last_match = rules->accepts[state - first_accept];              \
+            match_len = run->cur_len + i;                                   \
+        }                                                                   \
+    }                                                                       \
+    run->cur_state = state;                                                 \
+    run->cur_len += i;                                                      \
+    run->last_match = last_match;                                           \
+    run->match_len = match_len;                                             \
+    return i;                                                               \
+}
+
+/* The loops for each width, and a function to pick one. */
+#define DEFINE_TABLE_SCANS(name, tagged, linear)                            \
+DEFINE_TABLE_SCAN(name##_8, uint8_t, tagged, linear)                        \
+DEFINE_TABLE_SCAN(name##_16, uint16_t, tagged, linear)                      \
+DEFINE_TABLE_SCAN(name##_32, uint32_t, tagged, linear)                      \
+static size_t name(MreRuntime *run, const char *buf, size_t len)            \
+{                                                                           \
+    switch (run->states->width)                                             \
+    {                                                                       \
+    case 1:                                                                 \
+        return name##_8(run, buf, len);                                     \
+    case 2:                                                                 \
+        return name##_16(run, buf, len);                                    \
+    case 4:                                                                 \
+        return name##_32(run, buf, len);                                    \
+    default:                                                                \
+        abort();                                                            \
+    }                                                                       \
+}
+
+DEFINE_TABLE_SCANS(table_scan, false, false)
+DEFINE_TABLE_SCANS(linear_scan, false, true)
+DEFINE_TABLE_SCANS(tags_bulk_scan, true, false)
+DEFINE_TABLE_SCANS(tags_linear_scan, true, true)
+
+/* Bulk where there is nothing to track, else one byte at a time. */
+static size_t tags_scan(MreRuntime *run, const char *buf, size_t len)
+{
+    size_t i = 0;
+    while (i < len && TABLE_HOPEFUL(run->states, run->cur_state))
+    {
+        size_t n = run->linear ? tags_linear_scan(run, buf + i, len - i) : tags_bulk_scan(run, buf + i, len - i);
+        run->steps += n;
+        i += n;
+        if (i < len && TABLE_HOPEFUL(run->states, run->cur_state))
+        {
+            mre_runtime_step(run, buf[i++]);
+        }
+    }
+    return i;
+}
+
+static size_t lazy_scan(MreRuntime *run, const char *buf, size_t len)
 {
-    if (state->first_goto <= ci && ci <= state->last_goto)
+    const unsigned char *classes = run->states->classes;
+    MreLazyCache *lazy = run->lazy;
+    size_t state = run->cur_state;
+    size_t last_match = run->last_match;
+    size_t match_len = run->match_len;
+    size_t i = 0;
+    while (i < len && lazy_cache_hopeful(lazy, state))
     {
-        return state->some_gotos[ci - state->first_goto];
+        size_t sa;
+        state = lazy_cache_goto(lazy, state, classes[(unsigned char)buf[i++]]);
+        sa = lazy_cache_accept(lazy, state);
+        if (run->linear)
+        {
+            state = linear_enter(run, state, sa, run->base + run->cur_len + i);
+        }
+        if (sa)
+        {
+            last_match = sa;
+            match_len = run->cur_len + i;
+        }
     }
-    return 0;
+    run->cur_state = state;
+    run->cur_len += i;
+    run->last_match = last_match;
+    run->match_len = match_len;
+    return i;
+}
+
+static size_t bits_scan(MreRuntime *run, const char *buf, size_t len)
+{
+    const unsigned char *classes = run->states->classes;
+    MreBitNfa *b = run->states->bits;
+    size_t i = 0;
+    while (i < len && run->cur_state)
+    {
+        size_t sa;
+        size_t *tmp = run->cur_bits;
+        run->cur_state = bit_nfa_step(b, tmp, classes[(unsigned char)buf[i++]], run->next_bits, &sa);
+        run->cur_bits = run->next_bits;
+        run->next_bits = tmp;
+        if (sa)
+        {
+            run->last_match = sa;
+            run->match_len = run->cur_len + i;
+        }
+    }
+    run->cur_len += i;
+    return i;
 }
 
 void mre_runtime_step(MreRuntime *run, char c)
 {
-    size_t ci = (unsigned char)c;
-    size_t si = get_goto(&run->states->states[run->cur_state], ci);
-    size_t sa = run->states->states[si].accept;
-    run->cur_state = si;
+    size_t ci = run->states->classes[(unsigned char)c];
+    size_t si, sa;
+    if (run->cur_bits)
+    {
+        size_t *tmp = run->cur_bits;
+        si = sa = 0;
+        if (run->cur_state)
+        {
+            si = bit_nfa_step(run->states->bits, tmp, ci, run->next_bits, &sa);
+            run->cur_bits = run->next_bits;
+            run->next_bits = tmp;
+        }
+    }
+    else if (run->lazy)
+    {
+        si = lazy_cache_goto(run->lazy, run->cur_state, ci);
+        sa = lazy_cache_accept(run->lazy, si);
+    }
+    else
+    {
+        si = table_goto(run->states, run->cur_state, ci);
+        sa = TABLE_ACCEPT(run->states, si);
+    }
     run->cur_len++;
+    run->steps++;
+    if (run->regs)
+    {
+        const size_t *op_start = run->states->tags->op_start;
+        size_t i = run->cur_state * run->states->num_classes + ci;
+        tags_apply(run, op_start[i], op_start[i + 1], run->cur_len);
+        if (sa)
+        {
+            tags_accept(run, sa);
+        }
+    }
+    if (run->linear)
+    {
+        si = linear_enter(run, si, sa, run->base + run->cur_len);
+    }
+    run->cur_state = si;
     if (sa)
     {
         run->last_match = sa;
         run->match_len = run->cur_len;
     }
 }
+size_t mre_runtime_scan(MreRuntime *run, const char *buf, size_t len)
+{
+    size_t i = 0;
+    if (run->regs)
+    {
+        /* It counts its own steps. */
+        return tags_scan(run, buf, len);
+    }
+    if (run->cur_bits)
+    {
+        i = bits_scan(run, buf, len);
+    }
+    else if (run->lazy)
+    {
+        i = lazy_scan(run, buf, len);
+    }
+    else if (run->linear)
+    {
+        i = linear_scan(run, buf, len);
+    }
+    else
+    {
+        i = table_scan(run, buf, len);
+    }
+    run->steps += i;
+    return i;
+}
 bool mre_runtime_hopeful(MreRuntime *run)
 {
-    return run->states->states[run->cur_state].some_gotos;
+    if (run->cur_bits)
+    {
+        return run->cur_state != 0;
+    }
+    if (run->lazy)
+    {
+        return lazy_cache_hopeful(run->lazy, run->cur_state);
+    }
+    return TABLE_HOPEFUL(run->states, run->cur_state);
 }
 size_t mre_runtime_match_id(MreRuntime *run)
 {
@@ -108,3 +719,25 @@ size_t mre_runtime_match_len(MreRuntime *run)
 {
     return run->match_len;
 }
+bool mre_runtime_match_group(MreRuntime *run, size_t group, size_t *start, size_t *len)
+{
+    MreTags *t = run->states->tags;
+    size_t open, close;
+    if (!t || !run->last_match || group < 1 || group > t->groups[run->last_match])
+    {
+        return false;
+    }
+    open = run->captures[2 * (group - 1)];
+    close = run->captures[2 * (group - 1) + 1];
+    if (open == MRE_TAG_UNSET || close == MRE_TAG_UNSET || close < open)
+    {
+        return false;
+    }
+    *start = open;
+    *len = close - open;
+    return true;
+}
+size_t mre_runtime_steps(MreRuntime *run)
+{
+    return run->steps;
+}
@@ -0,0 +1,325 @@
+#include "mre.h"
+#include "mre_internal.h"
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitset.h"
+#include "simd.h"
+
+
+struct MreSearch
+{
+    /* Decides each match, with the same priorities as a lexer would. */
+    MreRuntime *anchored;
+    /* Where the last match started, for its groups. */
+    size_t match_start;
+    /*
+        Finds where the first match ends, or NULL if over budget or if
+        the engine is not one that builds a DFA.
+    */
+    MreRules *ends;
+    /*
+        Every match has `literals.factor` somewhere in it, so a start is
+        only tried if there is one no more than `max_len` away. If every
+        match starts with more than one byte in common, they are found
+        with `literals.prefix`, rather than the first bytes below.
+    */
+    NfaLiterals literals;
+    /*
+        The bytes that can start a match. If there is only one, it is
+        found with memchr, else if the others fit in a few ranges they
+        are skipped with SIMD, else one at a time.
+    */
+    bool first[256];
+    size_t num_first;
+    char only_first;
+    size_t num_skip;
+    unsigned char skip_lo[MRE_ACCEL_RANGES];
+    unsigned char skip_hi[MRE_ACCEL_RANGES];
+};
+
+
+static void find_first_bytes(MreSearch *s, MultiNfa *m)
+{
+    NfaGraph *g = nfa_graph_create(m);
+    BitSet *start = nfa_graph_closure(g, 0);
+    bool classes[256];
+    size_t st, e, b;
+    memset(classes, 0, sizeof(classes));
+    for (st = bitset_find_next(start, 0); st < g->num_states; st = bitset_find_next(start, st + 1))
+    {
+        for (e = g->char_start[st]; e != g->char_start[st + 1]; ++e)
+        {
+            classes[g->char_class[e]] = true;
+        }
+    }
+    for (b = 0; b < 256; ++b)
+    {
+        s->first[b] = classes[g->classes[b]];
+        if (s->first[b])
+        {
+            s->only_first = (char)b;
+            s->num_first++;
+        }
+        else if (b && !s->first[b - 1] && s->num_skip)
+        {
+            if (s->num_skip <= MRE_ACCEL_RANGES)
+            {
+                s->skip_hi[s->num_skip - 1] = (unsigned char)b;
+            }
+        }
+        else
+        {
+            if (s->num_skip < MRE_ACCEL_RANGES)
+            {
+                s->skip_lo[s->num_skip] = (unsigned char)b;
+                s->skip_hi[s->num_skip] = (unsigned char)b;
+            }
+            s->num_skip++;
+        }
+    }
+    nfa_graph_destroy(g);
+}
+
+MreSearch *mre_search_create(MultiNfa *m, const MreOptions *options)
+{
+    MreSearch *rv;
+    MreOptions buf;
+    MreOptions anchored;
+    MreRuntime *run;
+    anchored = *mre_options_resolve(options, &buf);
+    /* So that failed attempts at later starts are not repeated. */
+    anchored.linear = true;
+    run = mre_runtime_create(m, &anchored);
+    if (!run)
+    {
+        return NULL;
+    }
+    rv = (MreSearch *)calloc(1, sizeof(*rv));
+    rv->anchored = run;
+    if (anchored.engine == MRE_ENGINE_DFA || anchored.engine == MRE_ENGINE_AUTO)
+    {
+        MreOptions search = anchored;
+        MreDfa *dfa;
+        /* It only saves time, so it is never worth unbounded memory. */
+        if (!search.max_states && !search.max_bytes)
+        {
+            search.max_states = MRE_AUTO_MAX_STATES;
+            search.max_bytes = MRE_AUTO_MAX_BYTES;
+        }
+        dfa = multi_nfa_to_search_dfa(m, &search);
+        if (dfa)
+        {
+            rv->ends = mre_rules_compile(dfa);
+            mre_dfa_destroy(dfa);
+        }
+    }
+    rv->literals = *multi_nfa_literals(m);
+    find_first_bytes(rv, m);
+    return rv;
+}
+
+void mre_search_destroy(MreSearch *s)
+{
+    free(s->ends);
+    mre_runtime_destroy(s->anchored);
+    free(s);
+}
+
+/* The first offset from `pos` on where `text` is, or `len`. */
+static size_t find_text(const char *buf, size_t len, size_t pos, const char *text, size_t text_len)
+{
+    while (pos + text_len <= len)
+    {
+        const char *p = (const char *)memchr(buf + pos, text[0], len - pos - text_len + 1);
+        if (!p)
+        {
+            break;
+        }
+        pos = (size_t)(p - buf);
+        if (!memcmp(p + 1, text + 1, text_len - 1))
+        {
+            return pos;
+        }
+        ++pos;
+    }
+    return len;
+}
+
+static size_t next_start(MreSearch *s, const char *buf, size_t len, size_t pos)
+{
+    if (s->literals.prefix_len > 1)
+    {
+        return find_text(buf, len, pos, s->literals.prefix, s->literals.prefix_len);
+    }
+    if (s->num_first == 1)
+    {
+        const char *p = (const char *)memchr(buf + pos, s->only_first, len - pos);
+        return p ? (size_t)(p - buf) : len;
+    }
+    if (s->num_skip <= MRE_ACCEL_RANGES)
+    {
+        return pos + simd_skip_ranges(buf + pos, len - pos, s->num_skip, s->skip_lo, s->skip_hi);
+    }
+    while (pos < len && !s->first[(unsigned char)buf[pos]])
+    {
+        ++pos;
+    }
+    return pos;
+}
+
+/*
+    The first offset from `pos` on where a match might start, or `len`.
+    `*factor_at` is where the factor was last found, or (size_t)-1.
+*/
+static size_t next_candidate(MreSearch *s, const char *buf, size_t len, size_t pos, size_t *factor_at)
+{
+    const NfaLiterals *lit = &s->literals;
+    const bool use_factor = lit->factor_len > lit->prefix_len;
+    while (pos < len)
+    {
+        if (use_factor)
+        {
+            if (*factor_at == (size_t)-1 || *factor_at < pos)
+            {
+                *factor_at = find_text(buf, len, pos, lit->factor, lit->factor_len);
+                if (*factor_at == len)
+                {
+                    return len;
+                }
+            }
+            /* The match must reach as far as the end of the factor. */
+            if (lit->max_len != (size_t)-1 && *factor_at + lit->factor_len - pos > lit->max_len)
+            {
+                pos = *factor_at + lit->factor_len - lit->max_len;
+            }
+        }
+        pos = next_start(s, buf, len, pos);
+        if (!use_factor || pos >= len || *factor_at >= pos)
+        {
+            return pos;
+        }
+    }
+    return len;
+}
+
+/*
+    One loop per table width, as for the runtime. Returns the length of
+    the shortest prefix of `buf` at the end of which some match ends,
+    or 0 if there is none.
+*/
+#define DEFINE_ENDS_SCAN(name, type)                                        \
+static size_t name(MreRules *rules, const char *buf, size_t len)            \
+{                                                                           \
+    const type *table = (const type *)rules->table;                         \
+    const unsigned char *classes = rules->classes;                          \
+    const size_t num_classes = rules->num_classes;                          \
+    const size_t first_accept = rules->first_accept;                        \
+    const MreAccel *accels = rules->accels;                                 \
+    size_t state = 1;                                                       \
+    size_t i = 0;                                                           \
+    while (i < len)                                                         \
+    {                                                                       \
+        size_t next = table[state * num_classes + classes[(unsigned char)buf[i++]]]; \
+        if (next == state && accels[state].num_ranges)                      \
+        {                                                                   \
+            const MreAccel *a = &accels[state];                             \
+            i += simd_skip_ranges(buf + i, len - i, a->num_ranges, a->lo, a->hi); \
+        }                                                                   \
+        state = next;                                                       \
+        if (state >= first_accept)                                          \
+        {                                                                   \
+            return i;                                                       \
+        }                                                                   \
+    }                                                                       \
+    return 0;                                                               \
+}
+
+DEFINE_ENDS_SCAN(ends_scan_8, uint8_t)
+DEFINE_ENDS_SCAN(ends_scan_16, uint16_t)
+DEFINE_ENDS_SCAN(ends_scan_32, uint32_t)
+
+static size_t ends_scan(MreRules *rules, const char *buf, size_t len)
+{
+    switch (rules->width)
+    {
+    case 1:
+        return ends_scan_8(rules, buf, len);
+    case 2:
+        return ends_scan_16(rules, buf, len);
+    case 4:
+        return ends_scan_32(rules, buf, len);
+    default:
+        abort();
+    }
+}
+
+size_t mre_search(MreSearch *s, const char *buf, size_t len, size_t start, size_t *match_start, size_t *match_len)
+{
+    MreRuntime *run = s->anchored;
+    size_t factor_at = (size_t)-1;
+    size_t pos = next_candidate(s, buf, len, start, &factor_at);
+    size_t limit = len;
+    size_t base = pos;
+    if (pos == len)
+    {
+        return 0;
+    }
+    if (s->ends)
+    {
+        /* The leftmost match starts before the first one ends. */
+        size_t end = ends_scan(s->ends, buf + pos, len - pos);
+        if (!end)
+        {
+            return 0;
+        }
+        limit = pos + end;
+    }
+    mre_runtime_reset(run);
+    while (pos < limit)
+    {
+        size_t id;
+        mre_runtime_reset_at(run, pos - base);
+        mre_runtime_scan(run, buf + pos, len - pos);
+        mre_runtime_finish(run);
+        id = mre_runtime_match_id(run);
+        if (id)
+        {
+            s->match_start = pos;
+            *match_start = pos;
+            *match_len = mre_runtime_match_len(run);
+            return id;
+        }
+        pos = next_candidate(s, buf, len, pos + 1, &factor_at);
+    }
+    return 0;
+}
+bool mre_search_group(MreSearch *s, size_t group, size_t *start, size_t *len)
+{
+    if (!mre_runtime_match_group(s->anchored, group, start, len))
+    {
+        return false;
+    }
+    *start += s->match_start;
+    return true;
+}
@@ -0,0 +1,268 @@
+#include "mre_internal.h"
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "util.h"
+
+
+static size_t get_goto(MreState *state, size_t ci)
+{
+    if (state->first_goto <= ci && ci <= state->last_goto)
+    {
+        return state->some_gotos[ci - state->first_goto];
+    }
+    return 0;
+}
+
+/*
+    Find the bytes on which `s` goes back to itself, as ranges.
+
+    Leaves `num_ranges` at 0 if there are too many ranges, or none.
+*/
+static void find_accel(MreDfa *dfa, size_t s, MreAccel *accel)
+{
+    size_t num_ranges = 0;
+    bool prev = false;
+    size_t b;
+    accel->num_ranges = 0;
+    for (b = 0; b < 256; ++b)
+    {
+        bool stay = get_goto(&dfa->states[s], dfa->classes[b]) == s;
+        if (stay && !prev)
+        {
+            if (num_ranges == MRE_ACCEL_RANGES)
+            {
+                return;
+            }
+            accel->lo[num_ranges++] = b;
+        }
+        if (stay)
+        {
+            accel->hi[num_ranges - 1] = b;
+        }
+        prev = stay;
+    }
+    accel->num_ranges = num_ranges;
+}
+
+/* The same ops, for the states as `mre_rules_compile` numbers them. */
+static MreTags *renumber_tags(MreTags *old, const size_t *renumber, size_t old_states, size_t num_states, size_t k)
+{
+    MreTags *rv = (MreTags *)calloc(1, sizeof(*rv));
+    size_t *from = (size_t *)calloc(num_states, sizeof(size_t));
+    size_t s, c, i;
+    for (s = 1; s < old_states; ++s)
+    {
+        if (renumber[s])
+        {
+            from[renumber[s]] = s;
+        }
+    }
+    *rv = *old;
+    rv->groups = (size_t *)memdup(old->groups, (old->num_rules + 1) * sizeof(size_t));
+    rv->accept_regs = (size_t *)memdup(old->accept_regs, (old->num_rules + 1) * sizeof(size_t));
+    rv->op_start = (size_t *)malloc((num_states * k + 1) * sizeof(size_t));
+    rv->ops = (MreTagOp *)malloc((old->num_ops + 1) * sizeof(MreTagOp));
+    rv->num_ops = 0;
+    for (s = 0; s < num_states; ++s)
+    {
+        for (c = 0; c < k; ++c)
+        {
+            size_t first = old->op_start[from[s] * k + c];
+            size_t last = old->op_start[from[s] * k + c + 1];
+            rv->op_start[s * k + c] = rv->num_ops;
+            /* State 0 is fail both before and after. */
+            if (!s)
+            {
+                continue;
+            }
+            for (i = first; i < last; ++i)
+            {
+                rv->ops[rv->num_ops++] = old->ops[i];
+            }
+        }
+    }
+    rv->op_start[num_states * k] = rv->num_ops;
+    for (i = old->op_start[old_states * k]; i < old->num_ops; ++i)
+    {
+        rv->ops[rv->num_ops++] = old->ops[i];
+    }
+    free(from);
+    return rv;
+}
+
+static void set_goto(void *table, size_t width, size_t i, size_t s)
+{
+    switch (width)
+    {
+    case 1:
+        ((uint8_t *)table)[i] = s;
+        break;
+    case 2:
+        ((uint16_t *)table)[i] = s;
+        break;
+    case 4:
+        ((uint32_t *)table)[i] = s;
+        break;
+    default:
+        abort();
+    }
+}
+
+MreRules *mre_rules_compile(MreDfa *dfa)
+{
+    const size_t n = dfa->num_states;
+    const size_t k = dfa->num_classes;
+    size_t *renumber = (size_t *)calloc(n, sizeof(*renumber));
+    size_t num_states, num_hopeful, first_accept;
+    size_t num_plain = 0, num_accept_hopeful = 0, num_accept_dead = 0;
+    size_t next_plain, next_accept_hopeful, next_accept_dead;
+    size_t width, table_offset, accels_offset;
+    MreRules *rv;
+    size_t *accepts;
+    void *table;
+    MreAccel *accels;
+    size_t s, c;
+
+    assert (n >= 2 && !dfa->states[1].accept && dfa->states[1].some_gotos);
+    for (s = 2; s < n; ++s)
+    {
+        MreState *st = &dfa->states[s];
+        if (!st->accept)
+        {
+            /* Without an accept or a goto, it is just another fail. */
+            if (st->some_gotos)
+            {
+                num_plain++;
+            }
+        }
+        else if (st->some_gotos)
+        {
+            num_accept_hopeful++;
+        }
+        else
+        {
+            num_accept_dead++;
+        }
+    }
+    num_states = 2 + num_plain + num_accept_hopeful + num_accept_dead;
+    num_hopeful = 1 + num_plain + num_accept_hopeful;
+    first_accept = 2 + num_plain;
+
+    renumber[0] = 0;
+    renumber[1] = 1;
+    next_plain = 2;
+    next_accept_hopeful = first_accept;
+    next_accept_dead = first_accept + num_accept_hopeful;
+    for (s = 2; s < n; ++s)
+    {
+        MreState *st = &dfa->states[s];
+        if (!st->accept)
+        {
+            renumber[s] = st->some_gotos ? next_plain++ : 0;
+        }
+        else if (st->some_gotos)
+        {
+            renumber[s] = next_accept_hopeful++;
+        }
+        else
+        {
+            renumber[s] = next_accept_dead++;
+        }
+    }
+
+    if (num_states <= UINT8_MAX + 1)
+    {
+        width = 1;
+    }
+    else if (num_states <= UINT16_MAX + 1)
+    {
+        width = 2;
+    }
+    else if (num_states <= (size_t)UINT32_MAX + 1)
+    {
+        width = 4;
+    }
+    else
+    {
+        abort();
+    }
+
+    /* The accepts are size_t, so the table after them is aligned too. */
+    table_offset = sizeof(*rv) + (num_states - first_accept) * sizeof(size_t);
+    accels_offset = table_offset + num_states * k * width;
+    rv = (MreRules *)calloc(1, accels_offset + num_states * sizeof(MreAccel));
+    rv->refcount = 1;
+    memcpy(rv->classes, dfa->classes, sizeof(rv->classes));
+    rv->num_classes = k;
+    rv->num_states = num_states;
+    rv->num_hopeful = num_hopeful;
+    rv->first_accept = first_accept;
+    rv->width = width;
+    accepts = (size_t *)(rv + 1);
+    table = (char *)rv + table_offset;
+    accels = (MreAccel *)((char *)rv + accels_offset);
+    rv->accepts = accepts;
+    rv->table = table;
+    rv->accels = accels;
+    for (s = 1; s < n; ++s)
+    {
+        size_t ns = renumber[s];
+        if (!ns)
+        {
+            continue;
+        }
+        if (ns >= first_accept)
+        {
+            accepts[ns - first_accept] = dfa->states[s].accept;
+        }
+        if (ns <= num_hopeful)
+        {
+            find_accel(dfa, s, &accels[ns]);
+            if (dfa->tags && accels[ns].num_ranges)
+            {
+                /* A skipped byte must not have to update registers. */
+                for (c = 0; c < k; ++c)
+                {
+                    if (get_goto(&dfa->states[s], c) == s && mre_tags_any(dfa->tags, k, s, c))
+                    {
+                        accels[ns].num_ranges = 0;
+                    }
+                }
+            }
+        }
+        for (c = 0; c < k; ++c)
+        {
+            set_goto(table, width, ns * k + c, renumber[get_goto(&dfa->states[s], c)]);
+        }
+    }
+
+    if (dfa->tags)
+    {
+        rv->tags = renumber_tags(dfa->tags, renumber, n, num_states, k);
+    }
+    free(renumber);
+    return rv;
+}
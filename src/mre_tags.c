@@ -0,0 +1,359 @@
+#include "mre_internal.h"
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitset.h"
+#include "util.h"
+
+
+typedef struct TagReach TagReach;
+
+/* A state with registers, reached over epsilons, and the tags passed. */
+struct TagReach
+{
+    size_t state;
+    unsigned long tags;
+};
+
+struct MreTagBuilder
+{
+    NfaGraph *graph;
+    size_t num_classes;
+    /* Per NFA state: its first register, and how many (0 if none). */
+    size_t *reg_base;
+    size_t *num_tags;
+    size_t num_regs;
+    /* Per NFA state, computed when first needed. */
+    TagReach **reach;
+    size_t *num_reach;
+    /* Scratch, per NFA state and per register; a slot is only valid if its stamp is current. */
+    size_t stamp;
+    size_t *state_stamp;
+    size_t *source;
+    unsigned long *passed;
+    size_t *reg_stamp;
+    size_t *stack_state;
+    unsigned long *stack_tags;
+
+    size_t *op_start;
+    size_t op_start_cap;
+    size_t num_slots;
+    MreTagOp *ops;
+    size_t num_ops;
+    size_t ops_cap;
+    size_t num_saved;
+};
+
+
+static bool tag_useful(NfaGraph *g, size_t s)
+{
+    /* As for closures. */
+    if (s > 0 && s <= g->num_accept)
+    {
+        return true;
+    }
+    return g->char_start[s] != g->char_start[s + 1];
+}
+
+/*
+    The states with registers in the closure of `from`, each with the
+    tags passed on the first path found to it. The search is depth first
+    and takes the edges in order, so the first alternative of a regex is
+    preferred, and so is going round a loop again.
+*/
+static TagReach *tag_reach(MreTagBuilder *b, size_t from, size_t *num)
+{
+    NfaGraph *g = b->graph;
+    TagReach *rv;
+    size_t cap = 4;
+    size_t top = 0;
+    if (b->reach[from])
+    {
+        *num = b->num_reach[from];
+        return b->reach[from];
+    }
+    rv = (TagReach *)malloc(cap * sizeof(*rv));
+    *num = 0;
+    b->stamp++;
+    b->state_stamp[from] = b->stamp;
+    b->stack_state[top] = from;
+    b->stack_tags[top++] = 0;
+    while (top)
+    {
+        size_t s = b->stack_state[--top];
+        unsigned long tags = b->stack_tags[top];
+        size_t e;
+        if (b->num_tags[s] && tag_useful(g, s))
+        {
+            if (*num == cap)
+            {
+                cap *= 2;
+                rv = (TagReach *)realloc(rv, cap * sizeof(*rv));
+            }
+            rv[*num].state = s;
+            rv[*num].tags = tags;
+            ++*num;
+        }
+        /* Backwards, so that the first edge is popped first. */
+        for (e = g->eps_start[s + 1]; e-- != g->eps_start[s]; )
+        {
+            size_t to = g->eps_to[e];
+            if (b->state_stamp[to] != b->stamp)
+            {
+                b->state_stamp[to] = b->stamp;
+                b->stack_state[top] = to;
+                b->stack_tags[top++] = g->eps_tag[e] ? tags | 1UL << (g->eps_tag[e] - 1) : tags;
+            }
+        }
+    }
+    b->reach[from] = rv;
+    b->num_reach[from] = *num;
+    return rv;
+}
+
+static void tag_op(MreTagBuilder *b, size_t dst, size_t src)
+{
+    MreTagOp *op;
+    if (dst == src)
+    {
+        return;
+    }
+    if (b->num_ops == b->ops_cap)
+    {
+        b->ops_cap = b->ops_cap ? 2 * b->ops_cap : 64;
+        b->ops = (MreTagOp *)realloc(b->ops, b->ops_cap * sizeof(*b->ops));
+    }
+    op = &b->ops[b->num_ops++];
+    op->dst = dst;
+    op->src = src;
+    op->saved = (size_t)-1;
+}
+
+static void tag_slot(MreTagBuilder *b)
+{
+    if (b->num_slots == b->op_start_cap)
+    {
+        b->op_start_cap *= 2;
+        b->op_start = (size_t *)realloc(b->op_start, b->op_start_cap * sizeof(*b->op_start));
+    }
+    b->op_start[b->num_slots++] = b->num_ops;
+}
+
+/*
+    Emit the ops for the states reached so far (those with the current
+    stamp), and save any source that is also a destination.
+*/
+static void tag_emit(MreTagBuilder *b, size_t first_op, BitSet *to)
+{
+    NfaGraph *g = b->graph;
+    size_t t, i, k;
+    size_t saved = 0;
+    for (t = bitset_find_next(to, 0); t < g->num_states; t = bitset_find_next(to, t + 1))
+    {
+        size_t s;
+        if (!b->num_tags[t] || b->state_stamp[t] != b->stamp)
+        {
+            continue;
+        }
+        s = b->source[t];
+        for (k = 0; k < b->num_tags[t]; ++k)
+        {
+            size_t src = MRE_TAG_UNSET;
+            if (b->passed[t] >> k & 1)
+            {
+                src = MRE_TAG_NOW;
+            }
+            else if (b->num_tags[s])
+            {
+                src = b->reg_base[s] + k;
+            }
+            b->reg_stamp[b->reg_base[t] + k] = b->stamp;
+            tag_op(b, b->reg_base[t] + k, src);
+        }
+    }
+    for (i = first_op; i < b->num_ops; ++i)
+    {
+        MreTagOp *op = &b->ops[i];
+        if (op->src < b->num_regs && b->reg_stamp[op->src] == b->stamp)
+        {
+            op->saved = saved++;
+        }
+    }
+    if (saved > b->num_saved)
+    {
+        b->num_saved = saved;
+    }
+}
+
+MreTagBuilder *tag_builder_create(NfaGraph *g, size_t num_classes)
+{
+    MreTagBuilder *rv = (MreTagBuilder *)calloc(1, sizeof(*rv));
+    const size_t n = g->num_states;
+    size_t s, c;
+    rv->graph = g;
+    rv->num_classes = num_classes;
+    rv->reg_base = (size_t *)calloc(n, sizeof(size_t));
+    rv->num_tags = (size_t *)calloc(n, sizeof(size_t));
+    for (s = 0; s < n; ++s)
+    {
+        rv->reg_base[s] = rv->num_regs;
+        rv->num_tags[s] = 2 * g->groups[g->owner[s]];
+        rv->num_regs += rv->num_tags[s];
+    }
+    rv->reach = (TagReach **)calloc(n, sizeof(TagReach *));
+    rv->num_reach = (size_t *)calloc(n, sizeof(size_t));
+    rv->state_stamp = (size_t *)calloc(n, sizeof(size_t));
+    rv->source = (size_t *)calloc(n, sizeof(size_t));
+    rv->passed = (unsigned long *)calloc(n, sizeof(unsigned long));
+    rv->reg_stamp = (size_t *)calloc(rv->num_regs + 1, sizeof(size_t));
+    rv->stack_state = (size_t *)calloc(n, sizeof(size_t));
+    rv->stack_tags = (unsigned long *)calloc(n, sizeof(unsigned long));
+    rv->op_start_cap = 16 * num_classes;
+    rv->op_start = (size_t *)malloc(rv->op_start_cap * sizeof(size_t));
+    /* The fail state has no ops. */
+    for (c = 0; c < num_classes; ++c)
+    {
+        tag_slot(rv);
+    }
+    return rv;
+}
+
+void tag_builder_goto(MreTagBuilder *b, BitSet *from, size_t ci, BitSet *to)
+{
+    NfaGraph *g = b->graph;
+    size_t first_op = b->num_ops;
+    size_t s, e, i;
+    tag_slot(b);
+    if (!to)
+    {
+        return;
+    }
+    /* `tag_reach` uses the stamps too, so fill them all in first. */
+    for (s = bitset_find_next(from, 0); s < g->num_states; s = bitset_find_next(from, s + 1))
+    {
+        for (e = g->char_start[s]; e != g->char_start[s + 1]; ++e)
+        {
+            if (g->char_class[e] == ci)
+            {
+                (void)tag_reach(b, g->char_to[e], &i);
+            }
+        }
+    }
+    b->stamp++;
+    for (s = bitset_find_next(from, 0); s < g->num_states; s = bitset_find_next(from, s + 1))
+    {
+        for (e = g->char_start[s]; e != g->char_start[s + 1]; ++e)
+        {
+            size_t num;
+            TagReach *r;
+            if (g->char_class[e] != ci)
+            {
+                continue;
+            }
+            r = tag_reach(b, g->char_to[e], &num);
+            for (i = 0; i < num; ++i)
+            {
+                size_t t = r[i].state;
+                if (b->state_stamp[t] != b->stamp)
+                {
+                    b->state_stamp[t] = b->stamp;
+                    b->source[t] = s;
+                    b->passed[t] = r[i].tags;
+                }
+            }
+        }
+    }
+    tag_emit(b, first_op, to);
+}
+
+size_t tag_builder_bytes(MreTagBuilder *b)
+{
+    return b->num_slots * sizeof(size_t) + b->num_ops * sizeof(MreTagOp);
+}
+
+MreTags *tag_builder_finish(MreTagBuilder *b)
+{
+    NfaGraph *g = b->graph;
+    MreTags *rv = (MreTags *)calloc(1, sizeof(*rv));
+    size_t first_op, num, i;
+    TagReach *r;
+
+    assert (b->num_slots % b->num_classes == 0);
+    /* The start: as a transition from nowhere. */
+    tag_slot(b);
+    first_op = b->num_ops;
+    r = tag_reach(b, 0, &num);
+    b->stamp++;
+    for (i = 0; i < num; ++i)
+    {
+        b->state_stamp[r[i].state] = b->stamp;
+        b->source[r[i].state] = 0;
+        b->passed[r[i].state] = r[i].tags;
+    }
+    tag_emit(b, first_op, nfa_graph_closure(g, 0));
+
+    rv->num_regs = b->num_regs;
+    rv->num_saved = b->num_saved;
+    rv->num_rules = g->num_accept;
+    rv->groups = (size_t *)memdup(g->groups, (g->num_accept + 1) * sizeof(size_t));
+    rv->accept_regs = (size_t *)calloc(g->num_accept + 1, sizeof(size_t));
+    for (i = 1; i <= g->num_accept; ++i)
+    {
+        rv->accept_regs[i] = b->reg_base[i];
+    }
+    rv->op_start = b->op_start;
+    rv->ops = b->ops;
+    rv->num_ops = b->num_ops;
+
+    for (i = 0; i < g->num_states; ++i)
+    {
+        free(b->reach[i]);
+    }
+    free(b->reach);
+    free(b->num_reach);
+    free(b->state_stamp);
+    free(b->source);
+    free(b->passed);
+    free(b->reg_stamp);
+    free(b->stack_state);
+    free(b->stack_tags);
+    free(b->reg_base);
+    free(b->num_tags);
+    free(b);
+    return rv;
+}
+
+void mre_tags_destroy(MreTags *t)
+{
+    free(t->ops);
+    free(t->op_start);
+    free(t->accept_regs);
+    free(t->groups);
+    free(t);
+}
+
+bool mre_tags_any(MreTags *t, size_t num_classes, size_t s, size_t ci)
+{
+    size_t i = s * num_classes + ci;
+    return t->op_start[i] != t->op_start[i + 1];
+}
@@ -0,0 +1,386 @@
+#include "typenames.h"
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "automaton.h"
+#include "automaton-internal.h"
+#include "bitset.h"
+#include "hashmap.h"
+#include "util.h"
+
+
+typedef struct Binding Binding;
+typedef struct EntryList EntryList;
+struct Binding
+{
+    HashEntry *entry;
+    /* What the entry's value was before; bindings are numbered from 1. */
+    size_t prev;
+    size_t depth;
+    bool is_typedef;
+};
+
+struct EntryList
+{
+    HashEntry **entries;
+    size_t num;
+    size_t cap;
+};
+
+struct TypeNames
+{
+    TypeNameSyms syms;
+    BitSet *declarators;
+    /* Each name's value is its innermost binding, or 0. */
+    HashMap *names;
+    Binding *bindings;
+    size_t num_bindings;
+    size_t bindings_cap;
+    size_t num_builtins;
+    size_t depth;
+    bool seen_type;
+    /* Parameters waiting for the function body's scope. */
+    EntryList params;
+    /* Enumerators waiting for the end of their braces' scope. */
+    EntryList enumerators;
+};
+
+
+TypeNames *type_names_create(const TypeNameSyms *syms)
+{
+    TypeNames *rv = (TypeNames *)calloc(1, sizeof(*rv));
+    size_t i, max = 0;
+    rv->syms = *syms;
+    for (i = 0; i < syms->num_declarators; ++i)
+    {
+        if (syms->declarators[i] > max)
+        {
+            max = syms->declarators[i];
+        }
+    }
+    rv->declarators = bitset_create(max + 1);
+    for (i = 0; i < syms->num_declarators; ++i)
+    {
+        bitset_set(rv->declarators, syms->declarators[i]);
+    }
+    rv->syms.declarators = NULL;
+    rv->names = map_create();
+    rv->bindings_cap = 16;
+    rv->bindings = (Binding *)malloc(rv->bindings_cap * sizeof(*rv->bindings));
+    return rv;
+}
+
+TypeNames *type_names_clone(TypeNames *tn)
+{
+    TypeNames *rv = (TypeNames *)calloc(1, sizeof(*rv));
+    size_t i;
+    rv->syms = tn->syms;
+    rv->declarators = bitset_copy(tn->declarators);
+    rv->names = map_create();
+    rv->bindings_cap = 16;
+    rv->bindings = (Binding *)malloc(rv->bindings_cap * sizeof(*rv->bindings));
+    for (i = 0; i < tn->num_builtins; ++i)
+    {
+        HashKey key = tn->bindings[i].entry->key;
+        type_names_builtin(rv, (const char *)key.data, key.len);
+    }
+    return rv;
+}
+
+void type_names_destroy(TypeNames *tn)
+{
+    free(tn->enumerators.entries);
+    free(tn->params.entries);
+    free(tn->bindings);
+    map_destroy(tn->names);
+    bitset_destroy(tn->declarators);
+    free(tn);
+}
+
+static HashEntry *intern(TypeNames *tn, const char *name, size_t len)
+{
+    HashKey key;
+    key.data = (unsigned char *)name;
+    key.len = len;
+    return map_entry(tn->names, key, SEARCH_OR_INSERT);
+}
+
+static void entry_list_push(EntryList *l, HashEntry *entry)
+{
+    if (l->num == l->cap)
+    {
+        l->cap = l->cap ? l->cap * 2 : 16;
+        l->entries = (HashEntry **)realloc(l->entries, l->cap * sizeof(*l->entries));
+    }
+    l->entries[l->num++] = entry;
+}
+
+static void bind(TypeNames *tn, HashEntry *entry, bool is_typedef)
+{
+    Binding *b;
+    if (tn->num_bindings == tn->bindings_cap)
+    {
+        tn->bindings_cap *= 2;
+        tn->bindings = (Binding *)realloc(tn->bindings, tn->bindings_cap * sizeof(*tn->bindings));
+    }
+    b = &tn->bindings[tn->num_bindings++];
+    b->entry = entry;
+    b->prev = (size_t)entry->value.ptr;
+    b->depth = tn->depth;
+    b->is_typedef = is_typedef;
+    entry->value.ptr = (void *)tn->num_bindings;
+}
+
+static void unbind_to(TypeNames *tn, size_t num_bindings)
+{
+    while (tn->num_bindings > num_bindings)
+    {
+        Binding *b = &tn->bindings[--tn->num_bindings];
+        b->entry->value.ptr = (void *)b->prev;
+    }
+}
+
+static void push_scope(TypeNames *tn)
+{
+    size_t i;
+    tn->depth++;
+    for (i = 0; i < tn->params.num; ++i)
+    {
+        bind(tn, tn->params.entries[i], false);
+    }
+    tn->params.num = 0;
+}
+
+static void pop_scope(TypeNames *tn)
+{
+    size_t n = tn->num_bindings;
+    size_t i;
+    /* Unbalanced braces are a syntax error, but do not crash. */
+    if (tn->depth)
+    {
+        while (n > tn->num_builtins && tn->bindings[n - 1].depth == tn->depth)
+        {
+            n--;
+        }
+        unbind_to(tn, n);
+        tn->depth--;
+    }
+    for (i = 0; i < tn->enumerators.num; ++i)
+    {
+        bind(tn, tn->enumerators.entries[i], false);
+    }
+    tn->enumerators.num = 0;
+    tn->params.num = 0;
+}
+
+void type_names_reset(TypeNames *tn)
+{
+    unbind_to(tn, tn->num_builtins);
+    tn->depth = 0;
+    tn->seen_type = false;
+    tn->params.num = 0;
+    tn->enumerators.num = 0;
+}
+
+void type_names_builtin(TypeNames *tn, const char *name, size_t len)
+{
+    assert (tn->num_bindings == tn->num_builtins && !tn->depth);
+    bind(tn, intern(tn, name, len), true);
+    tn->num_builtins++;
+}
+
+bool type_names_is_typedef(TypeNames *tn, const char *name, size_t len)
+{
+    HashKey key;
+    HashEntry *entry;
+    size_t b;
+    key.data = (unsigned char *)name;
+    key.len = len;
+    entry = map_entry(tn->names, key, SEARCH_ONLY);
+    if (!entry)
+    {
+        return false;
+    }
+    b = (size_t)entry->value.ptr;
+    return b && tn->bindings[b - 1].is_typedef;
+}
+
+
+static bool is_terminal(Tree *t)
+{
+    return !t->num_children;
+}
+
+static bool has_terminal(Tree *t, size_t sym)
+{
+    size_t i;
+    if (is_terminal(t))
+    {
+        return t->type == sym;
+    }
+    for (i = 0; i < t->num_children; ++i)
+    {
+        if (has_terminal(&t->children[i], sym))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_declarator(TypeNames *tn, Tree *t)
+{
+    return !is_terminal(t) && t->type < bitset_bits(tn->declarators) && bitset_test(tn->declarators, t->type);
+}
+
+/* The first identifier, looking only inside declarators. */
+static Tree *declarator_name(TypeNames *tn, Tree *t)
+{
+    size_t i;
+    for (i = 0; i < t->num_children; ++i)
+    {
+        Tree *c = &t->children[i];
+        if (is_terminal(c))
+        {
+            if (c->type == tn->syms.identifier)
+            {
+                return c;
+            }
+        }
+        else if (is_declarator(tn, c))
+        {
+            Tree *rv = declarator_name(tn, c);
+            if (rv)
+            {
+                return rv;
+            }
+        }
+    }
+    return NULL;
+}
+
+/* Declare the name of each declarator, but not of nested ones. */
+static void declare_all(TypeNames *tn, Tree *t, bool is_typedef, bool is_param)
+{
+    size_t i;
+    if (is_terminal(t) || t->type == tn->syms.declaration_specifiers || t->type == tn->syms.initializer)
+    {
+        return;
+    }
+    if (is_declarator(tn, t))
+    {
+        Tree *name = declarator_name(tn, t);
+        if (name)
+        {
+            HashEntry *entry = intern(tn, name->token, name->token_length);
+            if (!is_param)
+            {
+                bind(tn, entry, is_typedef);
+            }
+            else
+            {
+                entry_list_push(&tn->params, entry);
+            }
+        }
+        return;
+    }
+    for (i = 0; i < t->num_children; ++i)
+    {
+        declare_all(tn, &t->children[i], is_typedef, is_param);
+    }
+}
+
+static void on_reduce(void *data, Tree *t)
+{
+    TypeNames *tn = (TypeNames *)data;
+    size_t i;
+    if (t->type == tn->syms.type_specifier)
+    {
+        tn->seen_type = true;
+    }
+    else if (t->type == tn->syms.declaration)
+    {
+        bool is_typedef = false;
+        for (i = 0; i < t->num_children; ++i)
+        {
+            Tree *c = &t->children[i];
+            if (c->type == tn->syms.declaration_specifiers && has_terminal(c, tn->syms.typedef_keyword))
+            {
+                is_typedef = true;
+            }
+        }
+        declare_all(tn, t, is_typedef, false);
+    }
+    else if (t->type == tn->syms.parameter_declaration)
+    {
+        declare_all(tn, t, false, true);
+    }
+    else if (t->type == tn->syms.enumerator)
+    {
+        Tree *c = &t->children[0];
+        if (is_terminal(c) && c->type == tn->syms.identifier)
+        {
+            entry_list_push(&tn->enumerators, intern(tn, c->token, c->token_length));
+        }
+    }
+}
+
+void type_names_attach(TypeNames *tn, Automaton *a)
+{
+    automaton_set_reduce_hook(a, on_reduce, tn);
+}
+
+bool type_names_feed(TypeNames *tn, Automaton *a, size_t sym, const char *str, size_t len)
+{
+    if (sym == tn->syms.identifier && type_names_is_typedef(tn, str, len))
+    {
+        if (automaton_accepts(a, tn->syms.typedef_name)
+                && (!tn->seen_type || !automaton_accepts(a, sym)))
+        {
+            sym = tn->syms.typedef_name;
+        }
+    }
+    if (!automaton_feed_term(a, sym, str, len))
+    {
+        return false;
+    }
+    if (sym == tn->syms.identifier || sym == tn->syms.open_paren || sym == tn->syms.close_paren
+            || sym == tn->syms.comma || sym == tn->syms.semicolon
+            || sym == tn->syms.open_brace || sym == tn->syms.close_brace)
+    {
+        tn->seen_type = false;
+    }
+    if (sym == tn->syms.open_brace)
+    {
+        push_scope(tn);
+    }
+    else if (sym == tn->syms.close_brace)
+    {
+        pop_scope(tn);
+    }
+    else if (sym == tn->syms.semicolon)
+    {
+        tn->params.num = 0;
+    }
+    return true;
+}
@@ -0,0 +1,83 @@
+#pragma once
+/*
+    Copyright © 2016 Ben Longbons
+
+    This file is part of Nicate.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "fwd.h"
+
+
+/*
+    Decides whether each identifier is a typedef-name, for a C grammar.
+
+    The caller supplies the ids (as in the Grammar) of the symbols below,
+    then feeds terminals through `type_names_feed` instead of
+    `automaton_feed_term`. Each identifier that names a typedef in the
+    current scope is fed as `typedef_name` instead, unless only an
+    identifier could come next, or both could and a `type_specifier`
+    has already been seen since the last brace, parenthesis, comma,
+    semicolon or identifier. So in `int T;` T is declared again.
+
+    Names are declared when a `declaration`, `parameter_declaration` or
+    `enumerator` is reduced; a declaration declares typedefs if its
+    `declaration_specifiers` contain `typedef_keyword`. The declared name
+    of a declarator is its first identifier within `declarators`.
+    `declaration_specifiers` and `initializer` are not searched.
+
+    Braces open and close scopes. Parameters are declared in the scope
+    of the next open brace, unless a semicolon or close brace comes
+    first, as happens for prototypes. Enumerators are declared when
+    their close brace is, in the scope outside it.
+*/
+struct TypeNameSyms
+{
+    size_t identifier;
+    size_t typedef_name;
+    size_t typedef_keyword;
+    size_t open_brace;
+    size_t close_brace;
+    size_t semicolon;
+    size_t open_paren;
+    size_t close_paren;
+    size_t comma;
+
+    size_t declaration;
+    size_t parameter_declaration;
+    size_t enumerator;
+    size_t declaration_specifiers;
+    size_t type_specifier;
+    size_t initializer;
+    size_t num_declarators;
+    const size_t *declarators;
+};
+
+TypeNames *type_names_create(const TypeNameSyms *syms);
+/* Only the builtin typedefs are copied, as for a reset. */
+TypeNames *type_names_clone(TypeNames *tn);
+void type_names_destroy(TypeNames *tn);
+/* Forget everything but the file scope's builtin typedefs. */
+void type_names_reset(TypeNames *tn);
+/* Declare a typedef in the file scope, that survives resets. */
+void type_names_builtin(TypeNames *tn, const char *name, size_t len);
+bool type_names_is_typedef(TypeNames *tn, const char *name, size_t len);
+
+/* Installs a reduce hook, so only one TypeNames per Automaton. */
+void type_names_attach(TypeNames *tn, Automaton *a);
+bool type_names_feed(TypeNames *tn, Automaton *a, size_t sym, const char *str, size_t len);